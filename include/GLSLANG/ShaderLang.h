@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 422
+#define ANGLE_SH_VERSION 425
 
 enum ShShaderSpec
 {
@@ -474,6 +474,10 @@ struct ShCompileOptions
     // Whether ESSL300 fragment outputs should be expanded to vec4s.
     uint64_t expandFragmentOutputsToVec4 : 1;
 
+    // Records the time and memory spent in each phase of the compilation.  Can be queried with
+    // sh::GetCompilePhaseStats().
+    uint64_t collectPhaseStats : 1;
+
     ShCompileOptionsMetal metal;
     ShPixelLocalStorageOptions pls;
 };
@@ -749,6 +753,33 @@ struct ShBuiltInResources
     int MaxCombinedDrawBuffersAndPixelLocalStoragePlanes;
 };
 
+// Statistics of the memory the compiler used for the last compilation.
+struct ShCompileMemoryStats
+{
+    // Number and total size of the compiler's allocations.
+    size_t allocationCount;
+    size_t allocatedBytes;
+    // The most memory held at once by the compiler's pool allocator, in pages and in bytes.
+    size_t peakPageCount;
+    size_t peakBytes;
+    // Number of pages reused from previous compilations on the same thread.
+    size_t recycledPageCount;
+};
+
+// Statistics of a phase of the last compilation, such as parsing, an AST pass or the generation of
+// the object code.
+struct ShCompilePhaseStats
+{
+    // The name of the phase.  Valid as long as the compiler is.
+    const char *name;
+    // The number of phases that enclose this one.
+    uint32_t depth;
+    // Wall time spent in the phase, including its nested phases.
+    double seconds;
+    // Bytes allocated by the compiler during the phase, including its nested phases.
+    size_t allocatedBytes;
+};
+
 //
 // ShHandle held by but opaque to the driver.  It is allocated,
 // managed, and de-allocated by the compiler. Its contents
@@ -758,6 +789,11 @@ struct ShBuiltInResources
 //
 using ShHandle = void *;
 
+namespace angle
+{
+struct PlatformMethods;
+}  // namespace angle
+
 namespace sh
 {
 using BinaryBlob       = std::vector<uint32_t>;
@@ -860,6 +896,38 @@ bool GetShaderBinary(const ShHandle handle,
                      const ShCompileOptions &compileOptions,
                      ShaderBinaryBlob *const binaryOut);
 
+// Reduces shader source to a form that is identical for sources that differ only in comments,
+// white space and #line directives.  Such sources produce the same result when they compile
+// successfully, so the normalized source can stand in for them in a cache key.  Diagnostics and
+// the translated source of HLSL output with line directives do depend on the difference.
+// Returns false if the source cannot be normalized, for example because it uses __LINE__.
+// Does not require a compiler.
+// Parameters:
+// shaderStrings: Specifies an array of pointers to null-terminated strings containing the shader
+//                source code.
+// numStrings: Specifies the number of elements in shaderStrings array.
+// normalizedSourceOut: Receives the normalized source.
+bool GetNormalizedSource(const char *const shaderStrings[],
+                         size_t numStrings,
+                         std::string *normalizedSourceOut);
+
+// Returns statistics of the memory used by the last compilation.
+// Parameters:
+// handle: Specifies the compiler
+ShCompileMemoryStats GetCompileMemoryStats(const ShHandle handle);
+
+// Returns the phases of the last compilation, in the order they started.  Only available if the
+// collectPhaseStats compile option was set.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<ShCompilePhaseStats> &GetCompilePhaseStats(const ShHandle handle);
+
+// Makes the compiler emit trace events for the phases of its compilations through |platform|.
+// Parameters:
+// handle: Specifies the compiler
+// platform: The platform methods to trace through, or nullptr to disable tracing
+void SetTracePlatform(const ShHandle handle, angle::PlatformMethods *platform);
+
 // Returns a (original_name, hash) map containing all the user defined names in the shader,
 // including variable names, function names, struct names, and struct field names.
 // Parameters:
@@ -398,6 +398,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo forceGenerateMipmapOnCPU = {
+        "forceGenerateMipmapOnCPU",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsRenderPassStoreOpNone = {
         "supportsRenderPassStoreOpNone",
         FeatureCategory::VulkanFeatures,
@@ -728,6 +734,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo warmUpPipelinesFromManifest = {
+        "warmUpPipelinesFromManifest",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferDeviceLocalMemoryHostVisible = {
         "preferDeviceLocalMemoryHostVisible",
         FeatureCategory::VulkanFeatures,
@@ -1094,6 +1106,18 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo asyncTransferQueueUploads = {
+        "asyncTransferQueueUploads",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo cacheTransformedSpirv = {
+        "cacheTransformedSpirv",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo useResetCommandBufferBitForSecondaryPools = {
         "useResetCommandBufferBitForSecondaryPools",
         FeatureCategory::VulkanWorkarounds,
@@ -1598,6 +1622,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsDescriptorBuffer = {
+        "supportsDescriptorBuffer",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferBGR565ToRGB565 = {
         "preferBGR565ToRGB565",
         FeatureCategory::VulkanFeatures,
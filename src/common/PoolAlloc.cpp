@@ -11,6 +11,7 @@
 #include "common/unsafe_buffers.h"
 
 #include <assert.h>
+#include <algorithm>
 #include <stdint.h>
 #include <stdio.h>
 #include <utility>
@@ -146,6 +147,94 @@ class PageHeader
 };
 #endif
 
+PoolPageRecycler::PoolPageRecycler(size_t pageSize, size_t maxCachedBytes)
+    : mPageSize(pageSize), mMaxCachedPages(maxCachedBytes / pageSize), mHighWaterMark(0)
+{}
+
+PoolPageRecycler::~PoolPageRecycler()
+{
+    PoolPageRecycler::trim();
+}
+
+size_t PoolPageRecycler::getCachedPageCount() const
+{
+    return mPages.size();
+}
+
+size_t PoolPageRecycler::getHighWaterMark() const
+{
+    return mHighWaterMark;
+}
+
+uint8_t *PoolPageRecycler::acquirePage()
+{
+    if (mPages.empty())
+    {
+        return nullptr;
+    }
+
+    uint8_t *page = mPages.back();
+    mPages.pop_back();
+    return page;
+}
+
+bool PoolPageRecycler::releasePage(uint8_t *page)
+{
+    if (mPages.size() >= mMaxCachedPages)
+    {
+        return false;
+    }
+
+    mPages.push_back(page);
+    mHighWaterMark = std::max(mHighWaterMark, mPages.size());
+    return true;
+}
+
+void PoolPageRecycler::trim()
+{
+    for (uint8_t *page : mPages)
+    {
+        delete[] page;
+    }
+    mPages.clear();
+}
+
+SynchronizedPoolPageRecycler::SynchronizedPoolPageRecycler(size_t pageSize, size_t maxCachedBytes)
+    : PoolPageRecycler(pageSize, maxCachedBytes)
+{}
+
+SynchronizedPoolPageRecycler::~SynchronizedPoolPageRecycler() = default;
+
+size_t SynchronizedPoolPageRecycler::getCachedPageCount() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    return PoolPageRecycler::getCachedPageCount();
+}
+
+size_t SynchronizedPoolPageRecycler::getHighWaterMark() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    return PoolPageRecycler::getHighWaterMark();
+}
+
+uint8_t *SynchronizedPoolPageRecycler::acquirePage()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    return PoolPageRecycler::acquirePage();
+}
+
+bool SynchronizedPoolPageRecycler::releasePage(uint8_t *page)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    return PoolPageRecycler::releasePage(page);
+}
+
+void SynchronizedPoolPageRecycler::trim()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    PoolPageRecycler::trim();
+}
+
 //
 // Implement the functionality of the PoolAllocator class, which
 // is documented in PoolAlloc.h.
@@ -156,8 +245,7 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mPageSize(growthIncrement),
       mFreeList(nullptr),
       mInUseList(nullptr),
-      mNumCalls(0),
-      mTotalBytes(0),
+      mPageRecycler(nullptr),
 #endif
       mAlignment(allocationAlignment)
 {
@@ -193,22 +281,44 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
     // be obtained to allocate memory.
     //
     mCurrentPageOffset = mPageSize;
+    mStats.pageSize    = mPageSize;
 #endif
 }
 
 PoolAllocator::~PoolAllocator()
 {
     reset();
+    releaseFreePages();
+}
+
+void PoolAllocator::releaseFreePages()
+{
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     while (mFreeList)
     {
         PageHeader *next = mFreeList->nextPage;
-        delete[] reinterpret_cast<char *>(mFreeList);
+        uint8_t *page    = reinterpret_cast<uint8_t *>(mFreeList);
+        if (mPageRecycler == nullptr || !mPageRecycler->releasePage(page))
+        {
+            delete[] page;
+        }
         mFreeList = next;
     }
 #endif
 }
 
+void PoolAllocator::setPageRecycler(PoolPageRecycler *recycler)
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    ASSERT(mInUseList == nullptr && mFreeList == nullptr);
+    if (recycler != nullptr && recycler->getPageSize() != mPageSize)
+    {
+        return;
+    }
+    mPageRecycler = recycler;
+#endif
+}
+
 //
 // Check a single guard block for damage
 //
@@ -235,8 +345,11 @@ void Allocation::checkGuardBlock(unsigned char *blockMem,
 void PoolAllocator::reset()
 {
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
-    mNumCalls   = 0;
-    mTotalBytes = 0;
+    mStats.allocationCount   = 0;
+    mStats.allocatedBytes    = 0;
+    mStats.pageCount         = 0;
+    mStats.peakPageCount     = 0;
+    mStats.recycledPageCount = 0;
 
     mCurrentPageOffset = mPageSize;
     PageHeader *page   = std::exchange(mInUseList, nullptr);
@@ -270,6 +383,8 @@ void PoolAllocator::reset()
         page = nextInUse;
     }
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
+    mStats.allocationCount = 0;
+    mStats.allocatedBytes  = 0;
     mStack.clear();
 #endif
 }
@@ -277,11 +392,8 @@ void PoolAllocator::reset()
 void *PoolAllocator::allocate(size_t numBytes)
 {
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
-    //
-    // Just keep some interesting statistics.
-    //
-    ++mNumCalls;
-    mTotalBytes += numBytes;
+    ++mStats.allocationCount;
+    mStats.allocatedBytes += numBytes;
 
     uint8_t *currentPagePtr =
         ANGLE_UNSAFE_TODO(reinterpret_cast<uint8_t *>(mInUseList) + mCurrentPageOffset);
@@ -325,6 +437,7 @@ void *PoolAllocator::allocate(size_t numBytes)
         }
         mInUseList =
             new (memory) PageHeader(mInUseList, (numBytesToAlloc + mPageSize - 1) / mPageSize);
+        onPagesInUse(mInUseList->pageCount);
 
         // Make next allocation come from a new page
         mCurrentPageOffset = mPageSize;
@@ -343,6 +456,9 @@ void *PoolAllocator::allocate(size_t numBytes)
 
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
 
+    ++mStats.allocationCount;
+    mStats.allocatedBytes += numBytes;
+
     uint8_t *alloc = new (std::nothrow) uint8_t[numBytes + mAlignment - 1];
     mStack.emplace_back(std::unique_ptr<uint8_t[]>(alloc));
 
@@ -366,13 +482,23 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     }
     else
     {
-        uint8_t *memory = new (std::nothrow) uint8_t[mPageSize];
-        if (memory == nullptr)
+        // Then try pages left behind by other allocators.
+        uint8_t *memory = mPageRecycler ? mPageRecycler->acquirePage() : nullptr;
+        if (memory != nullptr)
         {
-            return nullptr;
+            ++mStats.recycledPageCount;
+        }
+        else
+        {
+            memory = new (std::nothrow) uint8_t[mPageSize];
+            if (memory == nullptr)
+            {
+                return nullptr;
+            }
         }
         mInUseList = new (memory) PageHeader(mInUseList, 1);
     }
+    onPagesInUse(1);
 
     // Leave room for the page header.
     mCurrentPageOffset      = mPageHeaderSkip;
@@ -390,6 +516,12 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
                              preAllocationPadding);
 }
 
+void PoolAllocator::onPagesInUse(size_t pageCount)
+{
+    mStats.pageCount += pageCount;
+    mStats.peakPageCount = std::max(mStats.peakPageCount, mStats.pageCount);
+}
+
 void *PoolAllocator::initializeAllocation(uint8_t *memory, size_t numBytes)
 {
 #    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
@@ -34,18 +34,87 @@
 #include <stdint.h>
 #include "common/unsafe_buffers.h"
 
+#include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "common/log_utils.h"
 
+#include <vector>
+
 #if defined(ANGLE_DISABLE_POOL_ALLOC)
 #    include <memory>
-#    include <vector>
 #endif
 
 namespace angle
 {
 class PageHeader;
 
+// Statistics of a PoolAllocator since its creation or last reset().  Page counts include the pages
+// of multi-page allocations.
+struct PoolAllocatorStats
+{
+    // Number and total size of the allocations made through allocate().
+    size_t allocationCount = 0;
+    size_t allocatedBytes  = 0;
+    // Number of pages currently in use, and the most that were in use at once.
+    size_t pageCount     = 0;
+    size_t peakPageCount = 0;
+    // Number of pages that were taken from the PoolPageRecycler instead of the system allocator.
+    size_t recycledPageCount = 0;
+    // The size of each page.
+    size_t pageSize = 0;
+};
+
+// Keeps the free pages of PoolAllocators that are destroyed, so that the next PoolAllocator that
+// uses the same recycler can reuse them instead of going back to the system allocator.  At most
+// |maxCachedBytes| worth of pages are kept; the rest are freed.
+//
+// The recycler is not thread-safe.  It is intended to be used by the short-lived allocators that
+// are created and destroyed one after the other on the same thread.  Allocators that live on
+// different threads can share a SynchronizedPoolPageRecycler instead.
+class PoolPageRecycler : angle::NonCopyable
+{
+  public:
+    PoolPageRecycler(size_t pageSize, size_t maxCachedBytes);
+    virtual ~PoolPageRecycler();
+
+    size_t getPageSize() const { return mPageSize; }
+    virtual size_t getCachedPageCount() const;
+    // The most pages that were ever cached at the same time.
+    virtual size_t getHighWaterMark() const;
+
+    // Returns a cached page, or nullptr if there are none.
+    virtual uint8_t *acquirePage();
+    // Takes ownership of |page| if the budget allows it, otherwise returns false.
+    virtual bool releasePage(uint8_t *page);
+
+    // Frees all cached pages.
+    virtual void trim();
+
+  private:
+    const size_t mPageSize;
+    const size_t mMaxCachedPages;
+    size_t mHighWaterMark;
+    std::vector<uint8_t *> mPages;
+};
+
+class SynchronizedPoolPageRecycler final : public PoolPageRecycler
+{
+  public:
+    SynchronizedPoolPageRecycler(size_t pageSize, size_t maxCachedBytes);
+    ~SynchronizedPoolPageRecycler() override;
+
+    size_t getCachedPageCount() const override;
+    size_t getHighWaterMark() const override;
+
+    uint8_t *acquirePage() override;
+    bool releasePage(uint8_t *page) override;
+
+    void trim() override;
+
+  private:
+    mutable angle::SimpleMutex mMutex;
+};
+
 // Pages are linked together with a simple header at the beginning
 // of each allocation obtained from the underlying OS.
 // The "page size" used is not, nor must it match, the underlying OS
@@ -67,6 +136,17 @@ class PoolAllocator : angle::NonCopyable
     // Marks all allocated memory as unused. The memory will be reused.
     void reset();
 
+    // Take new pages from |recycler| when possible, and hand the free pages back to it when the
+    // allocator is destroyed.  Must be called before any allocation is made.  The recycler is
+    // ignored if its page size doesn't match the allocator's.
+    void setPageRecycler(PoolPageRecycler *recycler);
+    // Hand the pages that are not currently in use (such as after reset()) to the page recycler,
+    // or free them if there is no recycler or it is full.  Useful for long-lived allocators that
+    // sit idle for a while, so their memory can be used by other allocators in the meantime.
+    void releaseFreePages();
+
+    const PoolAllocatorStats &getStats() const { return mStats; }
+
     // Call allocate() to actually acquire memory.  Returns 0 if no memory
     // available, otherwise a properly aligned pointer to 'numBytes' of memory.
     //
@@ -108,6 +188,8 @@ class PoolAllocator : angle::NonCopyable
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     // Slow path of allocation when we have to get a new page.
     uint8_t *allocateNewPage(size_t numBytes);
+    // Updates the page statistics when pages are put in use.
+    void onPagesInUse(size_t pageCount);
     // Track allocations if and only if we're using guard blocks
     void *initializeAllocation(uint8_t *memory, size_t numBytes);
 
@@ -126,9 +208,8 @@ class PoolAllocator : angle::NonCopyable
     // List of all memory currently being used.  The head of this list is where allocations are
     // currently being made from.
     PageHeader *mInUseList;
-
-    int mNumCalls;       // just an interesting statistic
-    size_t mTotalBytes;  // just an interesting statistic
+    // Optional source of recycled pages, shared with other allocators.
+    PoolPageRecycler *mPageRecycler;
 
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::unique_ptr<uint8_t[]>> mStack;
@@ -136,6 +217,8 @@ class PoolAllocator : angle::NonCopyable
 
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
+
+    PoolAllocatorStats mStats;
 };
 
 }  // namespace angle
@@ -8,6 +8,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "common/unsafe_buffers.h"
 
 #include "common/PoolAlloc.h"
@@ -50,6 +51,127 @@ TEST(PoolAllocatorTest, Interface)
     }
 }
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+// Verify the statistics kept by the allocator
+TEST(PoolAllocatorTest, Stats)
+{
+    PoolAllocator poolAllocator(4096);
+    EXPECT_EQ(0u, poolAllocator.getStats().allocationCount);
+    EXPECT_EQ(0u, poolAllocator.getStats().pageCount);
+    EXPECT_EQ(4096u, poolAllocator.getStats().pageSize);
+
+    // Fill a few pages, and make a multi-page allocation.
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        EXPECT_NE(nullptr, poolAllocator.allocate(1000));
+    }
+    EXPECT_NE(nullptr, poolAllocator.allocate(3 * 4096));
+
+    const PoolAllocatorStats &stats = poolAllocator.getStats();
+    EXPECT_EQ(11u, stats.allocationCount);
+    EXPECT_EQ(10u * 1000u + 3u * 4096u, stats.allocatedBytes);
+    EXPECT_GE(stats.pageCount, 3u + 3u);
+    EXPECT_EQ(stats.pageCount, stats.peakPageCount);
+    EXPECT_EQ(0u, stats.recycledPageCount);
+
+    // Reset clears the statistics.
+    poolAllocator.reset();
+    EXPECT_EQ(0u, poolAllocator.getStats().allocationCount);
+    EXPECT_EQ(0u, poolAllocator.getStats().pageCount);
+    EXPECT_EQ(0u, poolAllocator.getStats().peakPageCount);
+}
+
+// Verify that pages are reused across allocators through a recycler, within its budget
+TEST(PoolAllocatorTest, PageRecycler)
+{
+    constexpr size_t kPageSize = 4096;
+    PoolPageRecycler recycler(kPageSize, 4 * kPageSize);
+
+    size_t firstPageCount = 0;
+    {
+        PoolAllocator poolAllocator(kPageSize);
+        poolAllocator.setPageRecycler(&recycler);
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            EXPECT_NE(nullptr, poolAllocator.allocate(1000));
+        }
+        firstPageCount = poolAllocator.getStats().pageCount;
+        EXPECT_GT(firstPageCount, 4u);
+        EXPECT_EQ(0u, poolAllocator.getStats().recycledPageCount);
+    }
+
+    // Only as many pages as the budget allows are kept.
+    EXPECT_EQ(4u, recycler.getCachedPageCount());
+    EXPECT_EQ(4u, recycler.getHighWaterMark());
+
+    {
+        PoolAllocator poolAllocator(kPageSize);
+        poolAllocator.setPageRecycler(&recycler);
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            void *allocation = poolAllocator.allocate(1000);
+            EXPECT_NE(nullptr, allocation);
+            ANGLE_UNSAFE_TODO(memset(allocation, 0xb8, 1000));
+        }
+        EXPECT_EQ(firstPageCount, poolAllocator.getStats().pageCount);
+        EXPECT_EQ(4u, poolAllocator.getStats().recycledPageCount);
+        EXPECT_EQ(0u, recycler.getCachedPageCount());
+    }
+
+    // A recycler with a different page size is not used.
+    {
+        PoolAllocator poolAllocator(2 * kPageSize);
+        poolAllocator.setPageRecycler(&recycler);
+        EXPECT_NE(nullptr, poolAllocator.allocate(1000));
+        EXPECT_EQ(0u, poolAllocator.getStats().recycledPageCount);
+    }
+    EXPECT_EQ(4u, recycler.getCachedPageCount());
+
+    recycler.trim();
+    EXPECT_EQ(0u, recycler.getCachedPageCount());
+}
+
+// Verify that an idle allocator can hand its free pages to a recycler shared with other threads
+TEST(PoolAllocatorTest, ReleaseFreePages)
+{
+    constexpr size_t kPageSize = 4096;
+    SynchronizedPoolPageRecycler recycler(kPageSize, 16 * kPageSize);
+
+    PoolAllocator idleAllocator(kPageSize);
+    idleAllocator.setPageRecycler(&recycler);
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        EXPECT_NE(nullptr, idleAllocator.allocate(1000));
+    }
+    const size_t pageCount = idleAllocator.getStats().pageCount;
+
+    // Nothing is released while the pages are in use.
+    idleAllocator.releaseFreePages();
+    EXPECT_EQ(0u, recycler.getCachedPageCount());
+
+    idleAllocator.reset();
+    idleAllocator.releaseFreePages();
+    EXPECT_EQ(pageCount, recycler.getCachedPageCount());
+
+    // Another allocator on another thread picks up the pages.
+    std::thread otherThread([&recycler, pageCount]() {
+        PoolAllocator poolAllocator(kPageSize);
+        poolAllocator.setPageRecycler(&recycler);
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_NE(nullptr, poolAllocator.allocate(1000));
+        }
+        EXPECT_EQ(pageCount, poolAllocator.getStats().recycledPageCount);
+    });
+    otherThread.join();
+    EXPECT_EQ(pageCount, recycler.getCachedPageCount());
+
+    // The idle allocator can still be used after releasing its pages.
+    EXPECT_NE(nullptr, idleAllocator.allocate(1000));
+    EXPECT_EQ(1u, idleAllocator.getStats().recycledPageCount);
+}
+#endif
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
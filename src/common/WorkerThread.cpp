@@ -10,6 +10,7 @@
 
 #include "common/WorkerThread.h"
 
+#include "common/PackedEnums.h"
 #include "common/angleutils.h"
 #include "common/system_utils.h"
 
@@ -20,8 +21,9 @@
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS) && & !defined(ANGLE_ENABLE_WINDOWS_UWP)
 
 #if ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
+#    include <atomic>
+#    include <deque>
 #    include <future>
-#    include <queue>
 #    include <thread>
 #endif  // ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
 
@@ -70,13 +72,16 @@ WorkerThreadPool::~WorkerThreadPool() = default;
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    using WorkerThreadPool::postWorkerTask;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
     // Thread safety: This function is thread-safe because the task is run on the calling thread
     // itself.
@@ -91,6 +96,11 @@ bool SingleThreadedWorkerPool::isAsync()
 
 #if ANGLE_STD_ASYNC_WORKERS
 
+// A work-stealing pool.  Each worker thread owns a set of per-priority deques, protected by a
+// per-worker mutex.  Tasks posted from a worker thread go to that worker's deques, while tasks
+// posted from any other thread are distributed round-robin.  A worker that runs out of work steals
+// from the other workers, always preferring the highest priority task available anywhere.  The
+// pool-wide mutex is only taken to put idle workers to sleep and to wake them up.
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
@@ -98,7 +108,9 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     ~AsyncWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    using WorkerThreadPool::postWorkerTask;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
@@ -109,36 +121,76 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     using Task = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
 
+    struct WorkerQueue : angle::NonCopyable
+    {
+        std::mutex mutex;  // Protects |tasks|
+        angle::PackedEnumMap<WorkerTaskPriority, std::deque<Task>> tasks;
+    };
+
+    // Takes the oldest task of the highest available priority, looking at the queue of
+    // |workerIndex| first and then stealing from the other workers.
+    bool popTask(size_t workerIndex, Task *taskOut);
+    bool popTaskFromQueue(WorkerQueue *queue, WorkerTaskPriority priority, Task *taskOut);
+
     // Thread's main loop
-    void threadLoop();
+    void threadLoop(size_t workerIndex);
 
+    std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+    std::atomic<size_t> mNextQueueIndex;
+    std::atomic<size_t> mEnqueuedTaskCount;
+    std::atomic<size_t> mIdleThreadCount;
+
+    std::once_flag mCreateThreadsOnce;
+    std::mutex mMutex;                 // Protects |mTerminated| and idle waits
+    std::condition_variable mCondVar;  // Signals when work is available in the queues
     bool mTerminated = false;
-    std::mutex mMutex;                 // Protects access to the fields in this class
-    std::condition_variable mCondVar;  // Signals when work is available in the queue
-    std::queue<Task> mTaskQueue;
     std::deque<std::thread> mThreads;
-    size_t mDesiredThreadCount;
+
+    // The pool and worker index the current thread belongs to, if any.  Used to keep tasks that
+    // are posted from inside another task local to the posting worker.
+    static thread_local const AsyncWorkerPool *tCurrentPool;
+    static thread_local size_t tCurrentWorkerIndex;
 };
 
+thread_local const AsyncWorkerPool *AsyncWorkerPool::tCurrentPool = nullptr;
+thread_local size_t AsyncWorkerPool::tCurrentWorkerIndex          = 0;
+
 // AsyncWorkerPool implementation.
 
-AsyncWorkerPool::AsyncWorkerPool(size_t numThreads) : mDesiredThreadCount(numThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t numThreads)
+    : mNextQueueIndex(0), mEnqueuedTaskCount(0), mIdleThreadCount(0)
 {
-    ASSERT(mDesiredThreadCount != 0);
+    ASSERT(numThreads != 0);
+    mQueues.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        mQueues.emplace_back(std::make_unique<WorkerQueue>());
+    }
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
     {
         std::unique_lock<std::mutex> lock(mMutex);
-        // Mark each task's AsyncWaitableEvent as aborted and drain the task queue
-        for (; !mTaskQueue.empty(); mTaskQueue.pop())
+        mTerminated = true;
+    }
+
+    // Mark each task's AsyncWaitableEvent as aborted and drain the task queues
+    for (std::unique_ptr<WorkerQueue> &queue : mQueues)
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        for (std::deque<Task> &tasks : queue->tasks)
         {
-            auto task = mTaskQueue.front();
-            task.first->markAsAborted();
+            for (Task &task : tasks)
+            {
+                task.first->markAsAborted();
+            }
+            mEnqueuedTaskCount -= tasks.size();
+            tasks.clear();
         }
-        mTerminated = true;
     }
+    ASSERT(mEnqueuedTaskCount == 0);
+
     mCondVar.notify_all();
     for (auto &thread : mThreads)
     {
@@ -149,53 +201,107 @@ AsyncWorkerPool::~AsyncWorkerPool()
 
 void AsyncWorkerPool::createThreads()
 {
-    if (mDesiredThreadCount == mThreads.size())
-    {
-        return;
-    }
     ASSERT(mThreads.empty());
 
-    for (size_t i = 0; i < mDesiredThreadCount; ++i)
+    for (size_t i = 0; i < mQueues.size(); ++i)
     {
-        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this, i);
     }
 }
 
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task)
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                               WorkerTaskPriority priority)
 {
-    // Thread safety: This function is thread-safe because access to |mTaskQueue| is protected by
-    // |mMutex|.
+    // Thread safety: This function is thread-safe because access to each queue is protected by
+    // its own mutex, and the bookkeeping counters are atomic.
+    ASSERT(priority < WorkerTaskPriority::EnumCount);
     auto waitable = std::make_shared<AsyncWaitableEvent>();
+
+    // Lazily create the threads on first task
+    std::call_once(mCreateThreadsOnce, [this] { createThreads(); });
+
+    const size_t queueIndex = tCurrentPool == this
+                                  ? tCurrentWorkerIndex
+                                  : mNextQueueIndex.fetch_add(1) % mQueues.size();
+    WorkerQueue *queue = mQueues[queueIndex].get();
+
+    // The count is incremented before the task is visible, so that a worker that pops the task
+    // right away never takes the count below zero.  A worker that sees the count before the task
+    // is pushed retries until it finds it.  The count is read by workers before they go to sleep;
+    // together with |mIdleThreadCount|, which is incremented by workers before they check this
+    // count, either the worker sees the new task or this thread sees the idle worker.
+    ++mEnqueuedTaskCount;
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->tasks[priority].emplace_back(waitable, task);
+    }
+
+    if (mIdleThreadCount > 0)
     {
         std::lock_guard<std::mutex> lock(mMutex);
         ASSERT(!mTerminated);
+        mCondVar.notify_one();
+    }
+    return waitable;
+}
 
-        // Lazily create the threads on first task
-        createThreads();
+bool AsyncWorkerPool::popTaskFromQueue(WorkerQueue *queue,
+                                       WorkerTaskPriority priority,
+                                       Task *taskOut)
+{
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    std::deque<Task> &tasks = queue->tasks[priority];
+    if (tasks.empty())
+    {
+        return false;
+    }
+    *taskOut = std::move(tasks.front());
+    tasks.pop_front();
+    --mEnqueuedTaskCount;
+    return true;
+}
 
-        mTaskQueue.push(std::make_pair(waitable, task));
+bool AsyncWorkerPool::popTask(size_t workerIndex, Task *taskOut)
+{
+    const size_t queueCount = mQueues.size();
+    for (WorkerTaskPriority priority : angle::AllEnums<WorkerTaskPriority>())
+    {
+        for (size_t offset = 0; offset < queueCount; ++offset)
+        {
+            if (mEnqueuedTaskCount == 0)
+            {
+                return false;
+            }
+            WorkerQueue *queue = mQueues[(workerIndex + offset) % queueCount].get();
+            if (popTaskFromQueue(queue, priority, taskOut))
+            {
+                return true;
+            }
+        }
     }
-    mCondVar.notify_one();
-    return waitable;
+    return false;
 }
 
-void AsyncWorkerPool::threadLoop()
+void AsyncWorkerPool::threadLoop(size_t workerIndex)
 {
     angle::SetCurrentThreadName("ANGLE-Worker");
+    tCurrentPool        = this;
+    tCurrentWorkerIndex = workerIndex;
 
     while (true)
     {
         Task task;
+        if (!popTask(workerIndex, &task))
         {
             std::unique_lock<std::mutex> lock(mMutex);
-            mCondVar.wait(lock, [this] { return !mTaskQueue.empty() || mTerminated; });
+            ++mIdleThreadCount;
+            mCondVar.wait(lock, [this] { return mEnqueuedTaskCount > 0 || mTerminated; });
+            --mIdleThreadCount;
             if (mTerminated)
             {
-                ASSERT(mTaskQueue.empty());
                 return;
             }
-            task = mTaskQueue.front();
-            mTaskQueue.pop();
+            continue;
         }
 
         auto &waitable = task.first;
@@ -218,8 +324,7 @@ bool AsyncWorkerPool::isAsync()
 
 size_t AsyncWorkerPool::getEnqueuedTaskCount()
 {
-    std::unique_lock<std::mutex> lock(mMutex);
-    return mTaskQueue.size();
+    return mEnqueuedTaskCount;
 }
 
 #endif  // ANGLE_STD_ASYNC_WORKERS
@@ -232,7 +337,9 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool(PlatformMethods *platform) : mPlatform(platform) {}
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    using WorkerThreadPool::postWorkerTask;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
@@ -271,8 +378,10 @@ class DelegateWorkerTask
 
 ANGLE_NO_SANITIZE_CFI_ICALL
 std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
+    // The platform's task runner has no notion of ANGLE's priorities; tasks are forwarded as-is.
     if (mPlatform->postWorkerTask == nullptr)
     {
         // In the unexpected case where the platform methods have been changed during execution and
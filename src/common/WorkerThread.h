@@ -108,6 +108,24 @@ enum class ThreadPoolType
     Synchronous  = 1,
 };
 
+// Scheduling class of a worker task.  Pools that support prioritization always run a ready task of
+// a lower-valued class before any task of a higher-valued class; tasks within the same class run
+// roughly in submission order.  Pools that don't support prioritization ignore this.
+enum class WorkerTaskPriority : uint8_t
+{
+    // Shader compile, program link and link subtasks, which the application is likely to wait on
+    // soon.
+    InteractiveLink = 0,
+    // Speculative work such as monolithic pipeline creation, which nothing blocks on right away.
+    BackgroundPipeline = 1,
+    // Compression of cache blobs before they are handed to the application, and writes to the
+    // on-disk blob cache.
+    CacheCompression = 2,
+
+    InvalidEnum = 3,
+    EnumCount   = InvalidEnum,
+};
+
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
 // we avoid the costly spin up and spin down time.
 class WorkerThreadPool : angle::NonCopyable
@@ -133,7 +151,14 @@ class WorkerThreadPool : angle::NonCopyable
 
     // Returns an event to wait on for the task to finish.  If the pool fails to create the task,
     // returns null.  This function is thread-safe.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) = 0;
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                          WorkerTaskPriority priority) = 0;
+
+    // Same as above, scheduled as WorkerTaskPriority::InteractiveLink.
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task)
+    {
+        return postWorkerTask(task, WorkerTaskPriority::InteractiveLink);
+    }
 
     virtual bool isAsync() = 0;
 
@@ -8,6 +8,10 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 #include "common/WorkerThread.h"
 
@@ -122,4 +126,206 @@ TEST(WorkerPoolTest, AsyncPoolWithOneThreadTest)
     EXPECT_EQ(callCount, kTaskCount * kCallbackSteps);
 }
 
+// Tests that queued tasks run in priority order once a worker becomes available.
+TEST(WorkerPoolTest, AsyncPoolPriorityTest)
+{
+    // Blocks the only worker until released, so that the other tasks pile up in the queues.
+    class GateTask : public Closure
+    {
+      public:
+        void operator()() override
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return released; });
+        }
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+            condition.notify_all();
+        }
+
+      private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool released = false;
+    };
+
+    class RecordTask : public Closure
+    {
+      public:
+        RecordTask(std::vector<WorkerTaskPriority> *order, WorkerTaskPriority priority)
+            : mOrder(order), mPriority(priority)
+        {}
+        void operator()() override { mOrder->push_back(mPriority); }
+
+      private:
+        std::vector<WorkerTaskPriority> *mOrder;
+        WorkerTaskPriority mPriority;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 1, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires an asynchronous worker pool";
+    }
+
+    std::shared_ptr<GateTask> gate = std::make_shared<GateTask>();
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    waitables.push_back(pool->postWorkerTask(gate));
+
+    // Only the pool's own threads touch |order|, and there is a single one.
+    std::vector<WorkerTaskPriority> order;
+    constexpr WorkerTaskPriority kPostOrder[] = {
+        WorkerTaskPriority::CacheCompression, WorkerTaskPriority::BackgroundPipeline,
+        WorkerTaskPriority::InteractiveLink,  WorkerTaskPriority::CacheCompression,
+        WorkerTaskPriority::InteractiveLink,  WorkerTaskPriority::BackgroundPipeline,
+    };
+    for (WorkerTaskPriority priority : kPostOrder)
+    {
+        waitables.push_back(
+            pool->postWorkerTask(std::make_shared<RecordTask>(&order, priority), priority));
+    }
+
+    gate->release();
+    WaitableEvent::WaitMany(&waitables);
+
+    const std::vector<WorkerTaskPriority> kExpectedOrder = {
+        WorkerTaskPriority::InteractiveLink,    WorkerTaskPriority::InteractiveLink,
+        WorkerTaskPriority::BackgroundPipeline, WorkerTaskPriority::BackgroundPipeline,
+        WorkerTaskPriority::CacheCompression,   WorkerTaskPriority::CacheCompression,
+    };
+    EXPECT_EQ(order, kExpectedOrder);
+}
+
+// Tests that tasks posted from inside a task run to completion, including when they are stolen by
+// other workers.
+TEST(WorkerPoolTest, AsyncPoolNestedTasksTest)
+{
+    constexpr size_t kOuterTaskCount = 16;
+    constexpr size_t kInnerTaskCount = 64;
+
+    std::atomic<size_t> innerCount(0);
+
+    class InnerTask : public Closure
+    {
+      public:
+        InnerTask(std::atomic<size_t> *count) : mCount(count) {}
+        void operator()() override { ++*mCount; }
+
+      private:
+        std::atomic<size_t> *mCount;
+    };
+
+    class OuterTask : public Closure
+    {
+      public:
+        OuterTask(WorkerThreadPool *pool, std::atomic<size_t> *count) : mPool(pool), mCount(count)
+        {}
+        void operator()() override
+        {
+            for (size_t i = 0; i < kInnerTaskCount; ++i)
+            {
+                waitables.push_back(mPool->postWorkerTask(std::make_shared<InnerTask>(mCount),
+                                                          WorkerTaskPriority::BackgroundPipeline));
+            }
+        }
+
+        std::vector<std::shared_ptr<WaitableEvent>> waitables;
+
+      private:
+        WorkerThreadPool *mPool;
+        std::atomic<size_t> *mCount;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 4, ANGLEPlatformCurrent());
+
+    std::vector<std::shared_ptr<OuterTask>> outerTasks;
+    std::vector<std::shared_ptr<WaitableEvent>> outerWaitables;
+    for (size_t i = 0; i < kOuterTaskCount; ++i)
+    {
+        outerTasks.push_back(std::make_shared<OuterTask>(pool.get(), &innerCount));
+        outerWaitables.push_back(pool->postWorkerTask(outerTasks.back()));
+    }
+
+    WaitableEvent::WaitMany(&outerWaitables);
+    for (std::shared_ptr<OuterTask> &outerTask : outerTasks)
+    {
+        WaitableEvent::WaitMany(&outerTask->waitables);
+    }
+
+    EXPECT_EQ(innerCount, kOuterTaskCount * kInnerTaskCount);
+}
+
+// Benchmarks many threads posting small tasks to the pool concurrently, with mixed priorities.
+// This exercises the contention on the pool's queues.  The elapsed time is recorded as a test
+// property.
+TEST(WorkerPoolTest, AsyncPoolContentionBenchmark)
+{
+    constexpr size_t kPosterThreadCount  = 8;
+    constexpr size_t kTasksPerPoster     = 4096;
+    constexpr size_t kWorkPerTaskCounter = 64;
+
+    class SmallTask : public Closure
+    {
+      public:
+        SmallTask(std::atomic<size_t> *count) : mCount(count) {}
+        void operator()() override
+        {
+            // A small amount of work to keep the workers from doing nothing but dequeuing.
+            volatile size_t sum = 0;
+            for (size_t i = 0; i < kWorkPerTaskCounter; ++i)
+            {
+                sum = sum + i;
+            }
+            ++*mCount;
+        }
+
+      private:
+        std::atomic<size_t> *mCount;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent());
+
+    std::atomic<size_t> count(0);
+    std::array<std::vector<std::shared_ptr<WaitableEvent>>, kPosterThreadCount> waitables;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> posters;
+    for (size_t posterIndex = 0; posterIndex < kPosterThreadCount; ++posterIndex)
+    {
+        posters.emplace_back([&, posterIndex]() {
+            std::vector<std::shared_ptr<WaitableEvent>> &posterWaitables = waitables[posterIndex];
+            posterWaitables.reserve(kTasksPerPoster);
+            for (size_t taskIndex = 0; taskIndex < kTasksPerPoster; ++taskIndex)
+            {
+                const WorkerTaskPriority priority = static_cast<WorkerTaskPriority>(
+                    (posterIndex + taskIndex) % static_cast<size_t>(WorkerTaskPriority::EnumCount));
+                posterWaitables.push_back(
+                    pool->postWorkerTask(std::make_shared<SmallTask>(&count), priority));
+            }
+        });
+    }
+    for (std::thread &poster : posters)
+    {
+        poster.join();
+    }
+    for (std::vector<std::shared_ptr<WaitableEvent>> &posterWaitables : waitables)
+    {
+        WaitableEvent::WaitMany(&posterWaitables);
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - startTime;
+    ::testing::Test::RecordProperty(
+        "microseconds",
+        static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+
+    EXPECT_EQ(count, kPosterThreadCount * kTasksPerPoster);
+    EXPECT_EQ(pool->getEnqueuedTaskCount(), 0u);
+}
+
 }  // anonymous namespace
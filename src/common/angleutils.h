@@ -100,6 +100,8 @@ struct PerfMonitorTriplet
     FN(vkQueueSubmitCallsTotal)                    \
     FN(commandQueueWaitSemaphoresTotal)            \
     FN(renderPasses)                               \
+    FN(renderPassesMerged)                         \
+    FN(renderPassesElided)                         \
     FN(writeDescriptorSets)                        \
     FN(flushedOutsideRenderPassCommandBuffers)     \
     FN(swapchainCreate)                            \
@@ -136,7 +138,10 @@ struct PerfMonitorTriplet
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
     FN(monolithicPipelineCreation)                 \
+    FN(warmedUpGraphicsPipelineMisses)             \
+    FN(coldGraphicsPipelineMisses)                 \
     FN(descriptorSetAllocations)                   \
+    FN(descriptorBufferSetCopies)                  \
     FN(descriptorSetCacheTotalSize)                \
     FN(uniformsAndXfbDescriptorSetCacheHits)       \
     FN(uniformsAndXfbDescriptorSetCacheMisses)     \
@@ -161,7 +166,15 @@ struct PerfMonitorTriplet
     FN(bufferSuballocationCalls)                   \
     FN(framebufferCacheSize)                       \
     FN(pendingSubmissionGarbageObjects)            \
-    FN(graphicsDriverUniformsUpdated)
+    FN(graphicsDriverUniformsUpdated)              \
+    FN(commandBufferBlockAllocations)              \
+    FN(commandBufferBlockBytes)                    \
+    FN(transferQueueUploads)                       \
+    FN(frameRingBufferAllocations)                 \
+    FN(shaderCacheHits)                            \
+    FN(shaderCacheMisses)                          \
+    FN(shaderCacheNormalizedSourceHits)            \
+    FN(shaderCacheSavedCompileDurationUs)
 
 #define ANGLE_VK_API_PERF_COUNTER_GROUPS_X(FN) \
     FN(Command)                                \
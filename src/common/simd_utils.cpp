@@ -0,0 +1,89 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// simd_utils.cpp: Runtime CPU feature detection for SIMD kernels that are selected at runtime.
+//
+
+#include "common/simd_utils.h"
+
+#include <atomic>
+
+#if defined(ANGLE_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif
+
+namespace angle
+{
+namespace
+{
+CPUFeatureMask DetectCPUFeatures()
+{
+    CPUFeatureMask features = 0;
+
+#if defined(ANGLE_SIMD_X86)
+#    if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    if (maxLeaf >= 1)
+    {
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 19)) != 0)
+        {
+            features |= static_cast<CPUFeatureMask>(CPUFeature::SSE41);
+        }
+
+        // AVX2 additionally needs the OS to save the YMM registers on context switch.
+        const bool osSavesYMM = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        if (osSavesYMM && maxLeaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            if ((info[1] & (1 << 5)) != 0)
+            {
+                features |= static_cast<CPUFeatureMask>(CPUFeature::AVX2);
+            }
+        }
+    }
+#    else
+    // __builtin_cpu_supports takes OS support for the extended register state into account.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        features |= static_cast<CPUFeatureMask>(CPUFeature::SSE41);
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        features |= static_cast<CPUFeatureMask>(CPUFeature::AVX2);
+    }
+#    endif
+#elif defined(ANGLE_SIMD_NEON)
+    features |= static_cast<CPUFeatureMask>(CPUFeature::NEON);
+#endif
+
+    return features;
+}
+
+CPUFeatureMask GetDetectedCPUFeatures()
+{
+    // Detected once, on first use, to avoid a static initializer.
+    static const CPUFeatureMask sFeatures = DetectCPUFeatures();
+    return sFeatures;
+}
+
+std::atomic<CPUFeatureMask> gCPUFeatureMask(kAllCPUFeatures);
+}  // anonymous namespace
+
+bool HasCPUFeature(CPUFeature feature)
+{
+    const CPUFeatureMask mask = static_cast<CPUFeatureMask>(feature);
+    return (GetDetectedCPUFeatures() & gCPUFeatureMask.load(std::memory_order_relaxed) & mask) !=
+           0;
+}
+
+void SetCPUFeatureMaskForTesting(CPUFeatureMask mask)
+{
+    gCPUFeatureMask.store(mask, std::memory_order_relaxed);
+}
+}  // namespace angle
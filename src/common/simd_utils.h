@@ -0,0 +1,61 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// simd_utils.h: Runtime CPU feature detection for SIMD kernels that are selected at runtime.
+//
+// Kernels that need instructions beyond the target's baseline are compiled with a per-function
+// target attribute (ANGLE_SIMD_TARGET_*) so that the rest of the translation unit keeps the
+// baseline flags, and must only be called after checking HasCPUFeature().
+//
+
+#ifndef COMMON_SIMD_UTILS_H_
+#define COMMON_SIMD_UTILS_H_
+
+#include <stdint.h>
+
+#include "common/platform.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    define ANGLE_SIMD_X86 1
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+// MSVC allows intrinsics for any instruction set without per-function attributes.
+#        define ANGLE_SIMD_TARGET_SSE41
+#        define ANGLE_SIMD_TARGET_AVX2
+#    else
+#        define ANGLE_SIMD_TARGET_SSE41 __attribute__((target("sse4.1")))
+#        define ANGLE_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#    endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+// NEON is part of the ARMv8-A baseline, so it needs no runtime check on 64-bit ARM.
+#    define ANGLE_SIMD_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace angle
+{
+enum class CPUFeature : uint32_t
+{
+    SSE41 = 0x1,
+    AVX2  = 0x2,
+    NEON  = 0x4,
+};
+
+using CPUFeatureMask = uint32_t;
+
+constexpr CPUFeatureMask kAllCPUFeatures = 0xFFFFFFFFu;
+
+// Returns whether the given feature can be used.  This is the feature set supported by the CPU and
+// OS, restricted by the mask passed to SetCPUFeatureMaskForTesting().
+bool HasCPUFeature(CPUFeature feature);
+
+// Restricts the features reported by HasCPUFeature() to |mask|, which allows tests and benchmarks
+// to compare the SIMD kernels with each other and with the scalar fallbacks.  Pass
+// kAllCPUFeatures to restore the default.
+void SetCPUFeatureMaskForTesting(CPUFeatureMask mask);
+
+}  // namespace angle
+
+#endif  // COMMON_SIMD_UTILS_H_
@@ -10,6 +10,7 @@
 #include "GLES3/gl3.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "common/simd_utils.h"
 #include "common/string_utils.h"
 #include "common/unsafe_buffers.h"
 
@@ -25,15 +26,19 @@
 namespace
 {
 
+// Below this many indices the scalar loop is as fast as the vector kernels.
+constexpr size_t kMinIndexCountForSIMD = 64;
+
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled)
+ANGLE_INLINE void AccumulateIndexRange(const IndexType *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled,
+                                       IndexType *minIndexInOut,
+                                       IndexType *maxIndexInOut)
 {
     constexpr IndexType primitiveRestartIndex = std::numeric_limits<IndexType>::max();
-    IndexType minIndex                        = primitiveRestartIndex;
-    IndexType maxIndex                        = 0;
-    bool hasVertices                          = false;
+    IndexType minIndex                        = *minIndexInOut;
+    IndexType maxIndex                        = *maxIndexInOut;
 
     if (primitiveRestartEnabled)
     {
@@ -44,9 +49,8 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
             {
                 continue;
             }
-            hasVertices = true;
-            minIndex    = std::min(minIndex, index);
-            maxIndex    = std::max(maxIndex, index);
+            minIndex = std::min(minIndex, index);
+            maxIndex = std::max(maxIndex, index);
         }
     }
     else
@@ -57,8 +61,308 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
             minIndex        = std::min(minIndex, index);
             maxIndex        = std::max(maxIndex, index);
         }
-        hasVertices = count > 0;
     }
+
+    *minIndexInOut = minIndex;
+    *maxIndexInOut = maxIndex;
+}
+
+#if defined(ANGLE_SIMD_X86)
+// Per-type wrappers for the unsigned min/max/compare intrinsics.  The 128-bit unsigned 16 and 32
+// bit min/max instructions are SSE4.1, the 256-bit variants are AVX2.
+template <class IndexType>
+struct IndexVectorOps;
+
+template <>
+struct IndexVectorOps<uint8_t>
+{
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu8(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu8(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct IndexVectorOps<uint16_t>
+{
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu16(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu16(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu16(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu16(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct IndexVectorOps<uint32_t>
+{
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu32(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu32(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu32(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu32(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+};
+
+// The vector kernels keep a running min and max per lane.  With primitive restart, the restart
+// index is the largest representable value, so it never lowers the minimum; it is only masked to
+// zero before it reaches the maximum.
+template <class IndexType>
+ANGLE_SIMD_TARGET_SSE41 void AccumulateIndexRangeSSE41(const IndexType *indices,
+                                                       size_t count,
+                                                       bool primitiveRestartEnabled,
+                                                       IndexType *minIndexInOut,
+                                                       IndexType *maxIndexInOut)
+{
+    using Ops                   = IndexVectorOps<IndexType>;
+    constexpr size_t kLaneCount = sizeof(__m128i) / sizeof(IndexType);
+
+    // The restart index is all ones for every index type.
+    const __m128i restart = _mm_set1_epi8(-1);
+    __m128i minVector     = restart;
+    __m128i maxVector     = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        __m128i values =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(ANGLE_UNSAFE_TODO(indices + i)));
+        minVector = Ops::Min(minVector, values);
+        if (primitiveRestartEnabled)
+        {
+            values = _mm_andnot_si128(Ops::Equal(values, restart), values);
+        }
+        maxVector = Ops::Max(maxVector, values);
+    }
+
+    alignas(16) IndexType minLanes[kLaneCount];
+    alignas(16) IndexType maxLanes[kLaneCount];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), minVector);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), maxVector);
+
+    IndexType minIndex = *minIndexInOut;
+    IndexType maxIndex = *maxIndexInOut;
+    for (size_t lane = 0; lane < kLaneCount; ++lane)
+    {
+        minIndex = std::min(minIndex, ANGLE_UNSAFE_TODO(minLanes[lane]));
+        maxIndex = std::max(maxIndex, ANGLE_UNSAFE_TODO(maxLanes[lane]));
+    }
+
+    AccumulateIndexRange(ANGLE_UNSAFE_TODO(indices + i), count - i, primitiveRestartEnabled,
+                         &minIndex, &maxIndex);
+    *minIndexInOut = minIndex;
+    *maxIndexInOut = maxIndex;
+}
+
+template <class IndexType>
+ANGLE_SIMD_TARGET_AVX2 void AccumulateIndexRangeAVX2(const IndexType *indices,
+                                                     size_t count,
+                                                     bool primitiveRestartEnabled,
+                                                     IndexType *minIndexInOut,
+                                                     IndexType *maxIndexInOut)
+{
+    using Ops                   = IndexVectorOps<IndexType>;
+    constexpr size_t kLaneCount = sizeof(__m256i) / sizeof(IndexType);
+
+    // The restart index is all ones for every index type.
+    const __m256i restart = _mm256_set1_epi8(-1);
+    __m256i minVector     = restart;
+    __m256i maxVector     = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        __m256i values =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ANGLE_UNSAFE_TODO(indices + i)));
+        minVector = Ops::Min(minVector, values);
+        if (primitiveRestartEnabled)
+        {
+            values = _mm256_andnot_si256(Ops::Equal(values, restart), values);
+        }
+        maxVector = Ops::Max(maxVector, values);
+    }
+
+    alignas(32) IndexType minLanes[kLaneCount];
+    alignas(32) IndexType maxLanes[kLaneCount];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(minLanes), minVector);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxLanes), maxVector);
+
+    IndexType minIndex = *minIndexInOut;
+    IndexType maxIndex = *maxIndexInOut;
+    for (size_t lane = 0; lane < kLaneCount; ++lane)
+    {
+        minIndex = std::min(minIndex, ANGLE_UNSAFE_TODO(minLanes[lane]));
+        maxIndex = std::max(maxIndex, ANGLE_UNSAFE_TODO(maxLanes[lane]));
+    }
+
+    AccumulateIndexRange(ANGLE_UNSAFE_TODO(indices + i), count - i, primitiveRestartEnabled,
+                         &minIndex, &maxIndex);
+    *minIndexInOut = minIndex;
+    *maxIndexInOut = maxIndex;
+}
+#endif  // defined(ANGLE_SIMD_X86)
+
+#if defined(ANGLE_SIMD_NEON)
+template <class IndexType>
+struct IndexVectorOps;
+
+template <>
+struct IndexVectorOps<uint8_t>
+{
+    using Vector = uint8x16_t;
+    static Vector Load(const uint8_t *ptr) { return vld1q_u8(ptr); }
+    static Vector Splat(uint8_t value) { return vdupq_n_u8(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector ClearEqual(Vector a, Vector b) { return vbicq_u8(a, vceqq_u8(a, b)); }
+    static uint8_t ReduceMin(Vector a) { return vminvq_u8(a); }
+    static uint8_t ReduceMax(Vector a) { return vmaxvq_u8(a); }
+};
+
+template <>
+struct IndexVectorOps<uint16_t>
+{
+    using Vector = uint16x8_t;
+    static Vector Load(const uint16_t *ptr) { return vld1q_u16(ptr); }
+    static Vector Splat(uint16_t value) { return vdupq_n_u16(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector ClearEqual(Vector a, Vector b) { return vbicq_u16(a, vceqq_u16(a, b)); }
+    static uint16_t ReduceMin(Vector a) { return vminvq_u16(a); }
+    static uint16_t ReduceMax(Vector a) { return vmaxvq_u16(a); }
+};
+
+template <>
+struct IndexVectorOps<uint32_t>
+{
+    using Vector = uint32x4_t;
+    static Vector Load(const uint32_t *ptr) { return vld1q_u32(ptr); }
+    static Vector Splat(uint32_t value) { return vdupq_n_u32(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector ClearEqual(Vector a, Vector b) { return vbicq_u32(a, vceqq_u32(a, b)); }
+    static uint32_t ReduceMin(Vector a) { return vminvq_u32(a); }
+    static uint32_t ReduceMax(Vector a) { return vmaxvq_u32(a); }
+};
+
+template <class IndexType>
+void AccumulateIndexRangeNEON(const IndexType *indices,
+                              size_t count,
+                              bool primitiveRestartEnabled,
+                              IndexType *minIndexInOut,
+                              IndexType *maxIndexInOut)
+{
+    using Ops                   = IndexVectorOps<IndexType>;
+    using Vector                = typename Ops::Vector;
+    constexpr size_t kLaneCount = sizeof(Vector) / sizeof(IndexType);
+
+    const Vector restart = Ops::Splat(std::numeric_limits<IndexType>::max());
+    Vector minVector     = restart;
+    Vector maxVector     = Ops::Splat(0);
+
+    size_t i = 0;
+    for (; i + kLaneCount <= count; i += kLaneCount)
+    {
+        Vector values = Ops::Load(ANGLE_UNSAFE_TODO(indices + i));
+        minVector     = Ops::Min(minVector, values);
+        if (primitiveRestartEnabled)
+        {
+            values = Ops::ClearEqual(values, restart);
+        }
+        maxVector = Ops::Max(maxVector, values);
+    }
+
+    IndexType minIndex = std::min(*minIndexInOut, Ops::ReduceMin(minVector));
+    IndexType maxIndex = std::max(*maxIndexInOut, Ops::ReduceMax(maxVector));
+    AccumulateIndexRange(ANGLE_UNSAFE_TODO(indices + i), count - i, primitiveRestartEnabled,
+                         &minIndex, &maxIndex);
+    *minIndexInOut = minIndex;
+    *maxIndexInOut = maxIndex;
+}
+#endif  // defined(ANGLE_SIMD_NEON)
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled)
+{
+    constexpr IndexType primitiveRestartIndex = std::numeric_limits<IndexType>::max();
+    IndexType minIndex                        = primitiveRestartIndex;
+    IndexType maxIndex                        = 0;
+
+    if (count >= kMinIndexCountForSIMD)
+    {
+#if defined(ANGLE_SIMD_X86)
+        if (angle::HasCPUFeature(angle::CPUFeature::AVX2))
+        {
+            AccumulateIndexRangeAVX2(indices, count, primitiveRestartEnabled, &minIndex,
+                                     &maxIndex);
+        }
+        else if (angle::HasCPUFeature(angle::CPUFeature::SSE41))
+        {
+            AccumulateIndexRangeSSE41(indices, count, primitiveRestartEnabled, &minIndex,
+                                      &maxIndex);
+        }
+        else
+#elif defined(ANGLE_SIMD_NEON)
+        if (angle::HasCPUFeature(angle::CPUFeature::NEON))
+        {
+            AccumulateIndexRangeNEON(indices, count, primitiveRestartEnabled, &minIndex,
+                                     &maxIndex);
+        }
+        else
+#endif
+        {
+            AccumulateIndexRange(indices, count, primitiveRestartEnabled, &minIndex, &maxIndex);
+        }
+    }
+    else
+    {
+        AccumulateIndexRange(indices, count, primitiveRestartEnabled, &minIndex, &maxIndex);
+    }
+
+    // With primitive restart, restart indices are skipped, so the minimum remains at the restart
+    // index only if there is no other index.
+    const bool hasVertices =
+        primitiveRestartEnabled ? minIndex != primitiveRestartIndex : count > 0;
     if (!hasVertices)
     {
         return gl::IndexRange();
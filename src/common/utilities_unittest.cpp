@@ -9,8 +9,11 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "common/simd_utils.h"
 #include "common/utilities.h"
 
+#include <random>
+
 namespace
 {
 
@@ -260,4 +263,102 @@ TEST(Utilities, IndexRanges)
     EXPECT_EQ(ComputeIndexRange(b, vertices2, 3, false), gl::IndexRange(2, 255));
 }
 
+// Reference implementation of gl::ComputeIndexRange() for the SIMD kernel tests.
+template <typename T>
+gl::IndexRange ComputeReferenceIndexRange(const std::vector<T> &indices,
+                                          size_t offset,
+                                          size_t count,
+                                          bool primitiveRestartEnabled)
+{
+    constexpr T kRestart = std::numeric_limits<T>::max();
+    bool hasVertices     = false;
+    T minIndex           = kRestart;
+    T maxIndex           = 0;
+    for (size_t i = offset; i < offset + count; ++i)
+    {
+        if (primitiveRestartEnabled && indices[i] == kRestart)
+        {
+            continue;
+        }
+        hasVertices = true;
+        minIndex    = std::min(minIndex, indices[i]);
+        maxIndex    = std::max(maxIndex, indices[i]);
+    }
+    return hasVertices ? gl::IndexRange(minIndex, maxIndex) : gl::IndexRange();
+}
+
+template <typename T>
+void TestIndexRangeWithAllCPUFeatures(gl::DrawElementsType type)
+{
+    constexpr size_t kMaxCount = 300;
+    constexpr T kRestart       = std::numeric_limits<T>::max();
+
+    const angle::CPUFeatureMask kMasks[] = {
+        0,
+        static_cast<angle::CPUFeatureMask>(angle::CPUFeature::SSE41) |
+            static_cast<angle::CPUFeatureMask>(angle::CPUFeature::NEON),
+        angle::kAllCPUFeatures,
+    };
+
+    std::mt19937 generator(1234);
+    std::vector<T> indices(kMaxCount + 1);
+
+    for (int pattern = 0; pattern < 4; ++pattern)
+    {
+        for (T &index : indices)
+        {
+            switch (pattern)
+            {
+                case 0:
+                    // Full range of values, including the restart index.
+                    index = static_cast<T>(generator());
+                    break;
+                case 1:
+                    // Mostly restart indices.
+                    index = generator() % 8 == 0 ? static_cast<T>(generator() % 100) : kRestart;
+                    break;
+                case 2:
+                    // Only restart indices.
+                    index = kRestart;
+                    break;
+                default:
+                    // Restart indices mixed with a narrow range of small values.
+                    index = generator() % 4 == 0 ? kRestart : static_cast<T>(generator() % 16 + 3);
+                    break;
+            }
+        }
+
+        // Cover every vector tail length and an unaligned start.
+        for (size_t offset = 0; offset < 2; ++offset)
+        {
+            for (size_t count = 0; count <= kMaxCount; ++count)
+            {
+                for (bool primitiveRestart : {false, true})
+                {
+                    const gl::IndexRange expected =
+                        ComputeReferenceIndexRange(indices, offset, count, primitiveRestart);
+                    const T *data = ANGLE_UNSAFE_TODO(indices.data() + offset);
+                    for (angle::CPUFeatureMask mask : kMasks)
+                    {
+                        angle::SetCPUFeatureMaskForTesting(mask);
+                        EXPECT_EQ(gl::ComputeIndexRange(type, data, count, primitiveRestart),
+                                  expected)
+                            << "pattern " << pattern << " offset " << offset << " count " << count
+                            << " restart " << primitiveRestart << " mask " << mask;
+                    }
+                }
+            }
+        }
+    }
+    angle::SetCPUFeatureMaskForTesting(angle::kAllCPUFeatures);
+}
+
+// Tests that the vectorized gl::ComputeIndexRange() kernels match the scalar results.
+TEST(Utilities, IndexRangesSIMD)
+{
+    TestIndexRangeWithAllCPUFeatures<uint8_t>(gl::DrawElementsType::UnsignedByte);
+    TestIndexRangeWithAllCPUFeatures<uint16_t>(gl::DrawElementsType::UnsignedShort);
+    TestIndexRangeWithAllCPUFeatures<uint32_t>(gl::DrawElementsType::UnsignedInt);
+}
+
 }  // anonymous namespace
@@ -368,6 +368,25 @@ void DirectiveParser::parseDefine(Token *token)
         macro->replacements.front().setHasLeadingSpace(false);
     }
 
+    if (macro->type == Macro::kTypeFunc)
+    {
+        const Macro::Parameters &parameters = macro->parameters;
+        macro->replacementParameterIndices.reserve(macro->replacements.size());
+        for (const Token &replacement : macro->replacements)
+        {
+            int parameterIndex = -1;
+            if (replacement.type == Token::IDENTIFIER)
+            {
+                auto iter = std::find(parameters.begin(), parameters.end(), replacement.text);
+                if (iter != parameters.end())
+                {
+                    parameterIndex = static_cast<int>(std::distance(parameters.begin(), iter));
+                }
+            }
+            macro->replacementParameterIndices.push_back(parameterIndex);
+        }
+    }
+
     // Check for macro redefinition.
     MacroSet::const_iterator iter = mMacroSet->find(macro->name);
     if (iter != mMacroSet->end() && !macro->equals(*iter->second))
@@ -7,11 +7,12 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "common/hash_containers.h"
+
 namespace angle
 {
 
@@ -34,6 +35,13 @@ struct Macro
     ~Macro();
     bool equals(const Macro &other) const;
 
+    // Returns the index of the parameter the |index|th replacement token refers to, or -1 if it is
+    // not a parameter.
+    int getReplacementParameterIndex(size_t index) const
+    {
+        return index < replacementParameterIndices.size() ? replacementParameterIndices[index] : -1;
+    }
+
     bool predefined;
     mutable bool disabled;
     mutable int expansionCount;
@@ -42,9 +50,14 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+    // For function-like macros, the parameter index of each replacement token, so macro expansion
+    // doesn't have to look up the parameters by name.  Derived from |parameters| and
+    // |replacements|.
+    std::vector<int> replacementParameterIndices;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+// Looked up for every identifier in the shader, so a hash map is used.
+typedef angle::HashMap<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
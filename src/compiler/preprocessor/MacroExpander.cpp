@@ -209,7 +209,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back().get();
+        mContextStack.back().get(token);
     }
     else
     {
@@ -224,7 +224,12 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext &context = mContextStack.back();
         context.unget();
-        ASSERT(context.replacements[context.index] == token);
+#if defined(ANGLE_ENABLE_ASSERTS)
+        MacroContext contextCopy = context;
+        Token expected;
+        contextCopy.get(&expected);
+        ASSERT(expected == token);
+#endif
     }
     else
     {
@@ -251,15 +256,31 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    // In the case of an object-like macro, the replacement list gets its location
+    // from the identifier, but in the case of a function-like macro, the replacement
+    // list gets its location from the closing parenthesis of the macro invocation.
+    // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
+    SourceLocation replacementLocation = identifier.location;
+    std::vector<MacroArg> args;
+    if (macro->type == Macro::kTypeFunc)
+    {
+        args.reserve(macro->parameters.size());
+        if (!collectMacroArgs(*macro, identifier, &args, &replacementLocation))
+            return false;
+    }
+
+    MacroContext context(std::move(macro), std::move(args), identifier, replacementLocation);
+    if (context.size + mTotalTokensInContexts > kMaxContextTokens)
+    {
+        mDiagnostics->report(Diagnostics::PP_OUT_OF_MEMORY, identifier.location, identifier.text);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
-    macro->disabled = true;
+    context.macro->disabled = true;
 
-    mTotalTokensInContexts += replacements.size();
-    mContextStack.emplace_back(std::move(macro), std::move(replacements));
+    mTotalTokensInContexts += context.size;
+    mContextStack.push_back(std::move(context));
     return true;
 }
 
@@ -282,65 +303,7 @@ void MacroExpander::popMacro()
         context.macro->disabled = false;
     }
     context.macro->expansionCount--;
-    mTotalTokensInContexts -= context.replacements.size();
-}
-
-bool MacroExpander::expandMacro(const Macro &macro,
-                                const Token &identifier,
-                                std::vector<Token> *replacements)
-{
-    replacements->clear();
-
-    // In the case of an object-like macro, the replacement list gets its location
-    // from the identifier, but in the case of a function-like macro, the replacement
-    // list gets its location from the closing parenthesis of the macro invocation.
-    // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
-    if (macro.type == Macro::kTypeObj)
-    {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
-
-        if (macro.predefined)
-        {
-            const char kLine[] = "__LINE__";
-            const char kFile[] = "__FILE__";
-
-            ASSERT(replacements->size() == 1);
-            Token &repl = replacements->front();
-            if (macro.name == kLine)
-            {
-                repl.text = ToString(identifier.location.line);
-            }
-            else if (macro.name == kFile)
-            {
-                repl.text = ToString(identifier.location.file);
-            }
-        }
-    }
-    else
-    {
-        ASSERT(macro.type == Macro::kTypeFunc);
-        std::vector<MacroArg> args;
-        args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
-            return false;
-
-        replaceMacroParams(macro, args, replacements);
-    }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
-    }
-    return true;
+    mTotalTokensInContexts -= context.size;
 }
 
 bool MacroExpander::collectMacroArgs(const Macro &macro,
@@ -457,66 +420,108 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     return true;
 }
 
-void MacroExpander::replaceMacroParams(const Macro &macro,
-                                       const std::vector<MacroArg> &args,
-                                       std::vector<Token> *replacements)
+MacroExpander::MacroContext::MacroContext(std::shared_ptr<Macro> macroIn,
+                                          std::vector<MacroArg> &&argsIn,
+                                          const Token &identifier,
+                                          const SourceLocation &replacementLocation)
+    : macro(std::move(macroIn)),
+      args(std::move(argsIn)),
+      location(replacementLocation),
+      atStartOfLine(identifier.atStartOfLine()),
+      hasLeadingSpace(identifier.hasLeadingSpace()),
+      size(0)
 {
-    for (std::size_t i = 0; i < macro.replacements.size(); ++i)
+    if (macro->predefined)
     {
-        if (!replacements->empty() &&
-            replacements->size() + mTotalTokensInContexts > kMaxContextTokens)
-        {
-            const Token &token = replacements->back();
-            mDiagnostics->report(Diagnostics::PP_OUT_OF_MEMORY, token.location, token.text);
-            return;
-        }
+        const char kLine[] = "__LINE__";
+        const char kFile[] = "__FILE__";
 
-        const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
+        ASSERT(macro->replacements.size() == 1);
+        if (macro->name == kLine)
         {
-            replacements->push_back(repl);
-            continue;
+            predefinedText = ToString(identifier.location.line);
         }
-
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
+        else if (macro->name == kFile)
         {
-            replacements->push_back(repl);
-            continue;
+            predefinedText = ToString(identifier.location.file);
         }
+    }
 
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
-        const MacroArg &arg = args[iArg];
-        if (arg.empty())
-        {
-            continue;
-        }
-        std::size_t iRepl = replacements->size();
-        replacements->insert(replacements->end(), arg.begin(), arg.end());
-        // The replacement token inherits padding properties from
-        // macro replacement token.
-        replacements->at(iRepl).setHasLeadingSpace(repl.hasLeadingSpace());
+    for (size_t index = 0; index < macro->replacements.size(); ++index)
+    {
+        const int parameterIndex = macro->getReplacementParameterIndex(index);
+        size += parameterIndex < 0 ? 1 : args[parameterIndex].size();
     }
 }
 
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return tokensRead == size;
 }
 
-const Token &MacroExpander::MacroContext::get()
+void MacroExpander::MacroContext::get(Token *token)
 {
-    return replacements[index++];
+    ASSERT(!empty());
+
+    previousReplacementIndex = replacementIndex;
+    previousArgTokenIndex    = argTokenIndex;
+
+    while (true)
+    {
+        ASSERT(replacementIndex < macro->replacements.size());
+        const Token &replacement = macro->replacements[replacementIndex];
+        const int parameterIndex = macro->getReplacementParameterIndex(replacementIndex);
+        if (parameterIndex < 0)
+        {
+            *token = replacement;
+            if (!predefinedText.empty())
+            {
+                token->text = predefinedText;
+            }
+            ++replacementIndex;
+            break;
+        }
+
+        const MacroArg &arg = args[parameterIndex];
+        if (arg.empty())
+        {
+            // A parameter with an empty argument produces no tokens.
+            ++replacementIndex;
+            continue;
+        }
+
+        *token = arg[argTokenIndex];
+        if (argTokenIndex == 0)
+        {
+            // The replacement token inherits padding properties from
+            // macro replacement token.
+            token->setHasLeadingSpace(replacement.hasLeadingSpace());
+        }
+        if (++argTokenIndex == arg.size())
+        {
+            argTokenIndex = 0;
+            ++replacementIndex;
+        }
+        break;
+    }
+
+    if (tokensRead == 0)
+    {
+        // The first token in the replacement list inherits the padding
+        // properties of the identifier token.
+        token->setAtStartOfLine(atStartOfLine);
+        token->setHasLeadingSpace(hasLeadingSpace);
+    }
+    token->location = location;
+    ++tokensRead;
 }
 
 void MacroExpander::MacroContext::unget()
 {
-    ASSERT(index > 0);
-    --index;
+    ASSERT(tokensRead > 0);
+    --tokensRead;
+    replacementIndex = previousReplacementIndex;
+    argTokenIndex    = previousArgTokenIndex;
 }
 
 }  // namespace pp
@@ -8,6 +8,7 @@
 #define COMPILER_PREPROCESSOR_MACROEXPANDER_H_
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "compiler/preprocessor/Lexer.h"
@@ -44,29 +45,44 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
-
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
                           const Token &identifier,
                           std::vector<MacroArg> *args,
                           SourceLocation *closingParenthesisLocation);
-    void replaceMacroParams(const Macro &macro,
-                            const std::vector<MacroArg> &args,
-                            std::vector<Token> *replacements);
 
+    // The expansion of a macro.  The replacement list is replayed from the macro by reference, and
+    // the parameters are substituted with the pre-expanded arguments as the tokens are read, so
+    // the replacement list is never copied.
     struct MacroContext
     {
-        MacroContext(std::shared_ptr<Macro> macro, std::vector<Token> &&replacements)
-            : macro(std::move(macro)), replacements(std::move(replacements))
-        {}
+        MacroContext(std::shared_ptr<Macro> macro,
+                     std::vector<MacroArg> &&args,
+                     const Token &identifier,
+                     const SourceLocation &replacementLocation);
         bool empty() const;
-        const Token &get();
+        void get(Token *token);
         void unget();
 
         std::shared_ptr<Macro> macro;
-        std::vector<Token> replacements;
-        std::size_t index = 0;
+        std::vector<MacroArg> args;
+
+        // Properties that the replacement tokens take from the macro invocation.
+        SourceLocation location;
+        bool atStartOfLine;
+        bool hasLeadingSpace;
+        // The value of __LINE__ or __FILE__, empty for other macros.
+        std::string predefinedText;
+
+        // Total number of tokens in the expansion.
+        size_t size;
+        size_t tokensRead = 0;
+        // Position in the replacement list, and in the argument if the replacement token is a
+        // parameter.  The previous position is kept for unget().
+        size_t replacementIndex         = 0;
+        size_t argTokenIndex            = 0;
+        size_t previousReplacementIndex = 0;
+        size_t previousArgTokenIndex    = 0;
     };
 
     Lexer *mLexer;
@@ -0,0 +1,96 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilePhaseStats.cpp: Records the time and pool memory spent in each phase of a compilation,
+// and emits trace events for the phases.
+//
+
+#include "compiler/translator/CompilePhaseStats.h"
+
+#include "common/debug.h"
+#include "common/event_tracer.h"
+#include "common/system_utils.h"
+#include "compiler/translator/PoolAlloc.h"
+
+namespace sh
+{
+namespace
+{
+constexpr char kTraceCategory[] = "gpu.angle";
+
+size_t GetPoolAllocatedBytes()
+{
+    return GetGlobalPoolAllocator()->getStats().allocatedBytes;
+}
+}  // anonymous namespace
+
+TCompilePhaseStats::TCompilePhaseStats()
+    : mCollect(false), mDepth(0), mTracePlatform(nullptr), mTraceCategoryEnabled(nullptr)
+{}
+
+void TCompilePhaseStats::setTracePlatform(angle::PlatformMethods *platform)
+{
+    mTracePlatform = platform;
+    mTraceCategoryEnabled =
+        platform != nullptr ? angle::GetTraceCategoryEnabledFlag(platform, kTraceCategory) : nullptr;
+}
+
+void TCompilePhaseStats::reset(bool collect)
+{
+    ASSERT(mDepth == 0);
+    mCollect = collect;
+    mPhases.clear();
+}
+
+bool TCompilePhaseStats::isTracing() const
+{
+    return mTraceCategoryEnabled != nullptr && *mTraceCategoryEnabled != 0;
+}
+
+size_t TCompilePhaseStats::beginPhase(const char *name)
+{
+    if (isTracing())
+    {
+        angle::AddTraceEvent(mTracePlatform, 'B', mTraceCategoryEnabled, name, 0, 0, nullptr,
+                             nullptr, nullptr, 0);
+    }
+
+    if (!mCollect)
+    {
+        return kNotRecorded;
+    }
+
+    // The start time and pool usage are kept in the phase until it ends.
+    ShCompilePhaseStats phase;
+    phase.name           = name;
+    phase.depth          = mDepth++;
+    phase.seconds        = angle::GetCurrentSystemTime();
+    phase.allocatedBytes = GetPoolAllocatedBytes();
+    mPhases.push_back(phase);
+
+    return mPhases.size() - 1;
+}
+
+void TCompilePhaseStats::endPhase(const char *name, size_t index)
+{
+    if (isTracing())
+    {
+        angle::AddTraceEvent(mTracePlatform, 'E', mTraceCategoryEnabled, name, 0, 0, nullptr,
+                             nullptr, nullptr, 0);
+    }
+
+    if (index == kNotRecorded)
+    {
+        return;
+    }
+
+    ASSERT(mDepth > 0);
+    --mDepth;
+
+    ShCompilePhaseStats &phase = mPhases[index];
+    phase.seconds              = angle::GetCurrentSystemTime() - phase.seconds;
+    phase.allocatedBytes       = GetPoolAllocatedBytes() - phase.allocatedBytes;
+}
+}  // namespace sh
@@ -0,0 +1,74 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilePhaseStats.h: Records the time and pool memory spent in each phase of a compilation, and
+// emits trace events for the phases.
+//
+
+#ifndef COMPILER_TRANSLATOR_COMPILEPHASESTATS_H_
+#define COMPILER_TRANSLATOR_COMPILEPHASESTATS_H_
+
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+
+namespace angle
+{
+struct PlatformMethods;
+}  // namespace angle
+
+namespace sh
+{
+class TCompilePhaseStats : angle::NonCopyable
+{
+  public:
+    TCompilePhaseStats();
+
+    // Trace events are emitted through |platform| if given and if its trace category is enabled.
+    void setTracePlatform(angle::PlatformMethods *platform);
+
+    // Drops the phases of the previous compilation.  The phases of the next one are only recorded
+    // if |collect| is true.
+    void reset(bool collect);
+
+    const std::vector<ShCompilePhaseStats> &getPhases() const { return mPhases; }
+
+  private:
+    friend class TScopedCompilePhase;
+
+    static constexpr size_t kNotRecorded = static_cast<size_t>(-1);
+
+    bool isTracing() const;
+    // Returns the index of the phase in mPhases, or kNotRecorded.
+    size_t beginPhase(const char *name);
+    void endPhase(const char *name, size_t index);
+
+    bool mCollect;
+    uint32_t mDepth;
+    std::vector<ShCompilePhaseStats> mPhases;
+
+    angle::PlatformMethods *mTracePlatform;
+    const unsigned char *mTraceCategoryEnabled;
+};
+
+// Records a phase from its construction to its destruction.  Phases that start while another is in
+// progress are nested in it.  |name| must outlive the compilation.
+class [[nodiscard]] TScopedCompilePhase : angle::NonCopyable
+{
+  public:
+    TScopedCompilePhase(TCompilePhaseStats *stats, const char *name)
+        : mStats(stats), mName(name), mIndex(stats->beginPhase(name))
+    {}
+    ~TScopedCompilePhase() { mStats->endPhase(mName, mIndex); }
+
+  private:
+    TCompilePhaseStats *mStats;
+    const char *mName;
+    size_t mIndex;
+};
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_COMPILEPHASESTATS_H_
@@ -391,6 +391,7 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mShaderSpec(spec),
       mOutputType(output),
       mDiagnostics(mInfoSink.info),
+      mPassManager(&mPhaseStats),
       mSourcePath(nullptr),
       mVariablesCollected(false),
       mGLPositionInitialized(false),
@@ -474,14 +475,17 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
     ASSERT(mSymbolTable.atGlobalLevel());
 
     // Parse shader.
-    if (PaParseStrings(shaderStrings.subspan(firstSource), nullptr, &parseContext) != 0)
     {
-        return nullptr;
-    }
+        TScopedCompilePhase phase(&mPhaseStats, "Parse");
+        if (PaParseStrings(shaderStrings.subspan(firstSource), nullptr, &parseContext) != 0)
+        {
+            return nullptr;
+        }
 
-    if (!parseContext.postParseChecks())
-    {
-        return nullptr;
+        if (!parseContext.postParseChecks())
+        {
+            return nullptr;
+        }
     }
 
     setShaderMetadata(parseContext);
@@ -541,6 +545,7 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
     mValidateASTOptions = {};
     if (!compileOptions.useIR)
     {
+        TScopedCompilePhase phase(&mPhaseStats, "CheckAndSimplifyAST");
         if (!checkAndSimplifyAST(root, parseContext, compileOptions))
         {
             return nullptr;
@@ -682,6 +687,7 @@ bool TCompiler::validateAST(TIntermNode *root)
 {
     if (mCompileOptions.validateAST)
     {
+        TScopedCompilePhase phase(&mPhaseStats, "ValidateAST");
         bool valid = ValidateAST(root, &mDiagnostics, mValidateASTOptions);
 
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -762,7 +768,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          IsExtensionEnabled(mExtensionBehavior,
                             TExtension::EXT_shader_framebuffer_fetch_non_coherent)))
     {
-        if (!RemoveUnusedFramebufferFetch(this, root, &mSymbolTable))
+        if (!mPassManager.run("RemoveUnusedFramebufferFetch", [&] {
+                return RemoveUnusedFramebufferFetch(this, root, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -770,7 +778,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!mPassManager.run("FoldExpressions",
+                          [&] { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
@@ -789,15 +798,19 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // The translator treats them as having the maximum allowed size and this pass
         // applies the actual sizes if needed.
         if (mClipDistanceSize > 0 && !parseContext.isClipDistanceRedeclared() &&
-            !SizeClipCullDistance(this, root, ImmutableString("gl_ClipDistance"),
-                                  mClipDistanceSize))
+            !mPassManager.run("SizeClipCullDistance", [&] {
+                return SizeClipCullDistance(this, root, ImmutableString("gl_ClipDistance"),
+                                            mClipDistanceSize);
+            }))
         {
 
             return false;
         }
         if (mCullDistanceSize > 0 && !parseContext.isCullDistanceRedeclared() &&
-            !SizeClipCullDistance(this, root, ImmutableString("gl_CullDistance"),
-                                  mCullDistanceSize))
+            !mPassManager.run("SizeClipCullDistance", [&] {
+                return SizeClipCullDistance(this, root, ImmutableString("gl_CullDistance"),
+                                            mCullDistanceSize);
+            }))
         {
             return false;
         }
@@ -811,7 +824,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      invalid ESSL.
     //   3. Any unreachable statement after a discard, return, break or continue.
     // After this empty declarations are not allowed in the AST.
-    if (!PruneNoOps(this, root, &mSymbolTable))
+    if (!mPassManager.run("PruneNoOps", [&] { return PruneNoOps(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -824,9 +837,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         mExtensionBehavior, TExtension::EXT_shader_non_constant_global_initializers);
 
     if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 compileOptions.forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+        !mPassManager.run("DeferGlobalInitializers", [&] {
+            return DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                           canUseLoopsToInitialize,
+                                           compileOptions.forceDeferNonConstGlobalInitializers,
+                                           &mSymbolTable);
+        }))
     {
         return false;
     }
@@ -839,14 +855,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     mFunctionMetadata.resize(mCallDag.size());
     tagUsedFunctions();
 
-    if (!pruneUnusedFunctions(root))
+    if (!mPassManager.run("PruneUnusedFunctions", [&] { return pruneUnusedFunctions(root); }))
     {
         return false;
     }
 
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
-        if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+        if (!mPassManager.run("ReplaceShadowingVariables",
+                              [&] { return ReplaceShadowingVariables(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -863,8 +880,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         ASSERT(
             IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_shader_pixel_local_storage));
-        if (!RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
-                                      getShaderVersion()))
+        if (!mPassManager.run("RewritePixelLocalStorage", [&] {
+                return RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
+                                                getShaderVersion());
+            }))
         {
             return false;
         }
@@ -875,9 +894,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          parseContext.isExtensionEnabled(TExtension::OVR_multiview)))
     {
         // Note: if multiview is enabled via #extension all, num_views may not be set.
-        if (!DeclareAndInitBuiltinsForInstancedMultiview(this, root, std::max(mNumViews, 1),
-                                                         mShaderType, compileOptions, mOutputType,
-                                                         &mSymbolTable))
+        if (!mPassManager.run("DeclareAndInitBuiltinsForInstancedMultiview", [&] {
+                return DeclareAndInitBuiltinsForInstancedMultiview(
+                    this, root, std::max(mNumViews, 1), mShaderType, compileOptions, mOutputType,
+                    &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -885,7 +906,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.addAndTrueToLoopCondition)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        if (!mPassManager.run("AddAndTrueToLoopCondition",
+                              [&] { return AddAndTrueToLoopCondition(this, root); }))
         {
             return false;
         }
@@ -893,7 +915,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.unfoldShortCircuit)
     {
-        if (!UnfoldShortCircuitAST(this, root))
+        if (!mPassManager.run("UnfoldShortCircuitAST",
+                              [&] { return UnfoldShortCircuitAST(this, root); }))
         {
             return false;
         }
@@ -902,7 +925,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (compileOptions.emulateGLDrawID &&
         IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_multi_draw))
     {
-        if (!EmulateGLDrawID(this, root, &mSymbolTable))
+        if (!mPassManager.run("EmulateGLDrawID",
+                              [&] { return EmulateGLDrawID(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -912,8 +936,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         IsExtensionEnabled(mExtensionBehavior,
                            TExtension::ANGLE_base_vertex_base_instance_shader_builtin))
     {
-        if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable,
-                                             compileOptions.addBaseVertexToVertexID))
+        if (!mPassManager.run("EmulateGLBaseVertexBaseInstance", [&] {
+                return EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable,
+                                                       compileOptions.addBaseVertexToVertexID);
+            }))
         {
             return false;
         }
@@ -926,15 +952,17 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // In WebGL2, gl_FragData has only one element.  But in WebGL2, EXT_draw_buffers is not a
         // supported extension.
         ASSERT(mShaderSpec != SH_WEBGL2_SPEC);
-        if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
-                                         mResources.MaxDualSourceDrawBuffers, &mSymbolTable,
-                                         mShaderVersion))
+        if (!mPassManager.run("EmulateGLFragColorBroadcast", [&] {
+                return EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
+                                                   mResources.MaxDualSourceDrawBuffers,
+                                                   &mSymbolTable, mShaderVersion);
+            }))
         {
             return false;
         }
     }
 
-    if (!sortUniforms(root))
+    if (!mPassManager.run("SortUniforms", [&] { return sortUniforms(root); }))
     {
         return false;
     }
@@ -942,7 +970,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Needs to run before SimplifyLoopConditions to be able to detect |for| loops correctly.
     if (compileOptions.ensureLoopForwardProgress)
     {
-        if (!EnsureLoopForwardProgress(this, root))
+        if (!mPassManager.run("EnsureLoopForwardProgress",
+                              [&] { return EnsureLoopForwardProgress(this, root); }))
         {
             return false;
         }
@@ -950,7 +979,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.simplifyLoopConditions)
     {
-        if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
+        if (!mPassManager.run("SimplifyLoopConditions", [&] {
+                return SimplifyLoopConditions(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -960,10 +991,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // Split multi declarations and remove calls to array length().
         // Note that SimplifyLoopConditions needs to be run before any other AST transformations
         // that may need to generate new statements from loop conditions or loop expressions.
-        if (!SimplifyLoopConditions(this, root,
-                                    IntermNodePatternMatcher::kMultiDeclaration |
-                                        IntermNodePatternMatcher::kArrayLengthMethod,
-                                    &getSymbolTable()))
+        if (!mPassManager.run("SimplifyLoopConditions", [&] {
+                return SimplifyLoopConditions(this, root,
+                                              IntermNodePatternMatcher::kMultiDeclaration |
+                                                  IntermNodePatternMatcher::kArrayLengthMethod,
+                                              &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -971,33 +1004,45 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
+    if (!mPassManager.run("SeparateDeclarations", [&] {
+            return SeparateDeclarations(*this, *root,
+                                        mCompileOptions.separateCompoundStructDeclarations);
+        }))
     {
         return false;
     }
     mValidateASTOptions.validateMultiDeclarations = true;
 
     // Move declarations before functions to simplify transformations.
-    MoveDeclarationsBeforeFunctions(root);
+    if (!mPassManager.run("MoveDeclarationsBeforeFunctions",
+                          [&] { MoveDeclarationsBeforeFunctions(root); }))
+    {
+        return false;
+    }
 
-    if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
-                               &getSymbolTable()))
+    if (!mPassManager.run("SplitSequenceOperator", [&] {
+            return SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
+                                         &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!RemoveArrayLengthMethod(this, root))
+    if (!mPassManager.run("RemoveArrayLengthMethod",
+                          [&] { return RemoveArrayLengthMethod(this, root); }))
     {
         return false;
     }
     // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new
     // constants.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!mPassManager.run("FoldExpressions",
+                          [&] { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
 
-    if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+    if (!mPassManager.run("RemoveUnreferencedVariables",
+                          [&] { return RemoveUnreferencedVariables(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -1008,16 +1053,20 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // RemoveUnreferencedVariables may have left switch statements that only contained an empty
     // declaration inside the final case in an invalid state. Relies on that PruneNoOps and
     // RemoveUnreferencedVariables have already been run.
-    if (!PruneEmptyCases(this, root))
+    if (!mPassManager.run("PruneEmptyCases", [&] { return PruneEmptyCases(this, root); }))
     {
         return false;
     }
 
-    collectVariables(root);
+    if (!mPassManager.run("CollectVariables", [&] { collectVariables(root); }))
+    {
+        return false;
+    }
 
     if (compileOptions.useUnusedStandardSharedBlocks)
     {
-        if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
+        if (!mPassManager.run("UseAllMembersInUnusedStandardAndSharedBlocks",
+                              [&] { return useAllMembersInUnusedStandardAndSharedBlocks(root); }))
         {
             return false;
         }
@@ -1025,7 +1074,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.scalarizeVecAndMatConstructorArgs)
     {
-        if (!ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable))
+        if (!mPassManager.run("ScalarizeVecAndMatConstructorArgs", [&] {
+                return ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -1033,7 +1084,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.avoidComplexExpressionsInStructConstructor)
     {
-        if (!WrapStructConstructors(this, root, &mSymbolTable))
+        if (!mPassManager.run("WrapStructConstructors",
+                              [&] { return WrapStructConstructors(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -1041,7 +1093,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampIndirectArrayBounds)
     {
-        if (!ClampIndirectIndices(this, root, &mSymbolTable, mExtensionBehavior))
+        if (!mPassManager.run("ClampIndirectIndices", [&] {
+                return ClampIndirectIndices(this, root, &mSymbolTable, mExtensionBehavior);
+            }))
         {
             return false;
         }
@@ -1055,10 +1109,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // For the MSL output, keep the inactive fragment outputs, but remove them otherwise.
     if (compileOptions.removeInactiveVariables)
     {
-        if (!RemoveInactiveInterfaceVariables(this, root, &getSymbolTable(), getAttributes(),
-                                              getInputVaryings(), getOutputVariables(),
-                                              getUniforms(), getInterfaceBlocks(),
-                                              !compileOptions.retainInactiveFragmentOutputs))
+        if (!mPassManager.run("RemoveInactiveInterfaceVariables", [&] {
+                return RemoveInactiveInterfaceVariables(
+                    this, root, &getSymbolTable(), getAttributes(), getInputVaryings(),
+                    getOutputVariables(), getUniforms(), getInterfaceBlocks(),
+                    !compileOptions.retainInactiveFragmentOutputs);
+            }))
         {
             return false;
         }
@@ -1066,7 +1122,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.initOutputVariables)
     {
-        if (!initializeOutputVariables(root))
+        if (!mPassManager.run("InitializeOutputVariables",
+                              [&] { return initializeOutputVariables(root); }))
         {
             return false;
         }
@@ -1076,7 +1133,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // we don't need to initialize it twice.
     if (!mGLPositionInitialized && compileOptions.initGLPosition)
     {
-        if (!initializeGLPosition(root))
+        if (!mPassManager.run("InitializeGLPosition", [&] { return initializeGLPosition(root); }))
         {
             return false;
         }
@@ -1091,9 +1148,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // must generate global initializers before we generate the DAG, since initializers may call
     // functions which must not be optimized out
     if (!enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 compileOptions.forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+        !mPassManager.run("DeferGlobalInitializers", [&] {
+            return DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                           canUseLoopsToInitialize,
+                                           compileOptions.forceDeferNonConstGlobalInitializers,
+                                           &mSymbolTable);
+        }))
     {
         return false;
     }
@@ -1110,17 +1170,22 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
         if (!shouldRunLoopAndIndexingValidation())
         {
-            if (!SimplifyLoopConditions(this, root,
-                                        IntermNodePatternMatcher::kArrayDeclaration |
-                                            IntermNodePatternMatcher::kNamelessStructDeclaration,
-                                        &getSymbolTable()))
+            if (!mPassManager.run("SimplifyLoopConditions", [&] {
+                    return SimplifyLoopConditions(
+                        this, root,
+                        IntermNodePatternMatcher::kArrayDeclaration |
+                            IntermNodePatternMatcher::kNamelessStructDeclaration,
+                        &getSymbolTable());
+                }))
             {
                 return false;
             }
         }
 
-        if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
-                                           &getSymbolTable()))
+        if (!mPassManager.run("InitializeUninitializedLocals", [&] {
+                return InitializeUninitializedLocals(this, root, getShaderVersion(),
+                                                     canUseLoopsToInitialize, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -1128,8 +1193,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampPointSize)
     {
-        if (!ClampPointSize(this, root, mResources.MinPointSize, mResources.MaxPointSize,
-                            &getSymbolTable()))
+        if (!mPassManager.run("ClampPointSize", [&] {
+                return ClampPointSize(this, root, mResources.MinPointSize,
+                                      mResources.MaxPointSize, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -1137,7 +1204,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampFragDepth)
     {
-        if (!ClampFragDepth(this, root, &getSymbolTable()))
+        if (!mPassManager.run("ClampFragDepth",
+                              [&] { return ClampFragDepth(this, root, &getSymbolTable()); }))
         {
             return false;
         }
@@ -1145,7 +1213,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.rewriteRepeatedAssignToSwizzled)
     {
-        if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+        if (!mPassManager.run("RewriteRepeatedAssignToSwizzled",
+                              [&] { return sh::RewriteRepeatedAssignToSwizzled(this, root); }))
         {
             return false;
         }
@@ -1221,7 +1290,7 @@ bool TCompiler::compile(angle::Span<const char *const> shaderStrings,
 
     const ShCompileOptions compileOptions = adjustOptions(compileOptionsIn);
 
-    TScopedPoolAllocator scopedAlloc;
+    TScopedPoolAllocator scopedAlloc(&mPoolAllocatorStats);
     TIntermBlock *root = compileTreeImpl(shaderStrings, compileOptions);
 
     if (root)
@@ -1234,6 +1303,7 @@ bool TCompiler::compile(angle::Span<const char *const> shaderStrings,
         if (compileOptions.objectCode)
         {
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
+            TScopedCompilePhase phase(&mPhaseStats, "Translate");
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
                 return false;
@@ -1467,6 +1537,8 @@ void TCompiler::clearResults()
     mInfoSink.obj.erase();
     mInfoSink.debug.erase();
     mDiagnostics.resetErrorCount();
+    mPoolAllocatorStats = {};
+    mPhaseStats.reset(mCompileOptions.collectPhaseStats);
 
     mMetadataFlags.reset();
 
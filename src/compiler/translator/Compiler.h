@@ -19,6 +19,7 @@
 #include "common/PackedEnums.h"
 #include "common/span.h"
 #include "compiler/translator/CallDAG.h"
+#include "compiler/translator/CompilePhaseStats.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ExtensionBehavior.h"
 #include "compiler/translator/HashNames.h"
@@ -26,6 +27,7 @@
 #include "compiler/translator/Pragma.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/ValidateAST.h"
+#include "compiler/translator/tree_util/PassManager.h"
 
 namespace sh
 {
@@ -102,6 +104,8 @@ class TCompiler : public TShHandleBase
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
+    const angle::PoolAllocatorStats &getPoolAllocatorStats() const { return mPoolAllocatorStats; }
+    TCompilePhaseStats &getPhaseStats() { return mPhaseStats; }
 
     bool specifyEarlyFragmentTests() { return mEarlyFragmentTestsSpecified = true; }
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
@@ -315,7 +319,10 @@ class TCompiler : public TShHandleBase
     // Results of compilation.
     int mShaderVersion;
     TInfoSink mInfoSink;  // Output sink.
+    angle::PoolAllocatorStats mPoolAllocatorStats;
     TDiagnostics mDiagnostics;
+    TCompilePhaseStats mPhaseStats;
+    TPassManager mPassManager;
     const char *mSourcePath;  // Path of source file or NULL
 
     bool mVariablesCollected;
@@ -0,0 +1,164 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NormalizeSource.cpp: Reduces shader source to the tokens that affect the result of a successful
+// compilation.
+//
+// The source is only tokenized, not preprocessed, so macros are not expanded.  The normalized form
+// keeps:
+//
+// - Every token outside preprocessor directives, separated by a single space.  Comments, white
+//   space and line breaks are dropped.
+// - Every preprocessor directive on its own line, along with whether each of its tokens is preceded
+//   by white space.  That distinguishes function-like macros from object-like ones, and the
+//   definitions of a macro must match in it for the macro to be redefined.
+// - The line of #version directives, as ESSL 3.00 requires it to be on the first line.
+//
+// Valid #line directives are otherwise dropped.  The line numbers only affect diagnostics, which a
+// failed compilation reports from its own source anyway, as well as __LINE__ and __FILE__, which
+// disable normalization altogether.
+//
+
+#include "compiler/translator/NormalizeSource.h"
+
+#include <limits>
+#include <vector>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/Token.h"
+#include "compiler/preprocessor/Tokenizer.h"
+
+namespace sh
+{
+namespace
+{
+// Larger line numbers could overflow while counting the lines that follow the directive, which
+// fails the compilation.
+constexpr int kMaxDroppedLineNumber = 1 << 24;
+
+class ErrorTrackingDiagnostics : public angle::pp::Diagnostics
+{
+  public:
+    bool hasError() const { return mHasError; }
+
+  protected:
+    void print(ID id, const angle::pp::SourceLocation &loc, const std::string &text) override
+    {
+        mHasError = mHasError || isError(id);
+    }
+
+  private:
+    bool mHasError = false;
+};
+
+bool IsDroppableLineDirective(const std::vector<angle::pp::Token> &directive)
+{
+    // #line line-number [source-string-number]
+    if (directive.size() != 3 && directive.size() != 4)
+    {
+        return false;
+    }
+    if (directive[1].type != angle::pp::Token::IDENTIFIER || directive[1].text != "line")
+    {
+        return false;
+    }
+    for (size_t index = 2; index < directive.size(); ++index)
+    {
+        int value = 0;
+        if (directive[index].type != angle::pp::Token::CONST_INT ||
+            !directive[index].iValue(&value) || value < 0 || value > kMaxDroppedLineNumber)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AppendDirective(const std::vector<angle::pp::Token> &directive, std::string *normalizedOut)
+{
+    // A #line directive ahead of everything else could change the line that #version is reported
+    // on, so it is kept.
+    if (!normalizedOut->empty() && IsDroppableLineDirective(directive))
+    {
+        return;
+    }
+
+    normalizedOut->append("\n#");
+    for (size_t index = 1; index < directive.size(); ++index)
+    {
+        // The directive name is always separated from the #.  Other tokens are separated only if
+        // they were preceded by white space, which redefinitions of a macro must match.
+        const angle::pp::Token &token = directive[index];
+        if (index == 1 || token.hasLeadingSpace())
+        {
+            normalizedOut->push_back(' ');
+        }
+        normalizedOut->append(token.text);
+    }
+
+    if (directive.size() > 1 && directive[1].type == angle::pp::Token::IDENTIFIER &&
+        directive[1].text == "version")
+    {
+        normalizedOut->append(" @");
+        normalizedOut->append(std::to_string(directive[1].location.line));
+    }
+    normalizedOut->push_back('\n');
+}
+}  // anonymous namespace
+
+bool NormalizeSource(angle::Span<const char *const> shaderStrings, std::string *normalizedOut)
+{
+    ErrorTrackingDiagnostics diagnostics;
+    angle::pp::Tokenizer tokenizer(&diagnostics);
+    // Long tokens are kept as they are; whether they are too long depends on the shader spec, but
+    // equivalent sources fail the same way either way.
+    tokenizer.setMaxTokenSize(std::numeric_limits<size_t>::max());
+    if (!tokenizer.init(shaderStrings.size(), shaderStrings.data(), nullptr))
+    {
+        return false;
+    }
+
+    normalizedOut->clear();
+
+    // The tokens of the directive being read, starting with its #.
+    std::vector<angle::pp::Token> directive;
+    angle::pp::Token token;
+    do
+    {
+        tokenizer.lex(&token);
+
+        if (token.type == angle::pp::Token::IDENTIFIER &&
+            (token.text == "__LINE__" || token.text == "__FILE__"))
+        {
+            return false;
+        }
+
+        const bool isLineEnd = token.type == '\n' || token.type == angle::pp::Token::LAST;
+        if (!directive.empty())
+        {
+            if (isLineEnd)
+            {
+                AppendDirective(directive, normalizedOut);
+                directive.clear();
+            }
+            else
+            {
+                directive.push_back(token);
+            }
+        }
+        else if (token.type == angle::pp::Token::PP_HASH)
+        {
+            directive.push_back(token);
+        }
+        else if (!isLineEnd)
+        {
+            normalizedOut->push_back(' ');
+            normalizedOut->append(token.text);
+        }
+    } while (token.type != angle::pp::Token::LAST);
+
+    return !diagnostics.hasError();
+}
+}  // namespace sh
@@ -0,0 +1,25 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NormalizeSource.h: Reduces shader source to the tokens that affect the result of a successful
+// compilation, so that sources that differ only in comments, white space and #line directives can
+// be recognized as equivalent.
+//
+
+#ifndef COMPILER_TRANSLATOR_NORMALIZESOURCE_H_
+#define COMPILER_TRANSLATOR_NORMALIZESOURCE_H_
+
+#include <string>
+
+#include "common/span.h"
+
+namespace sh
+{
+// Returns false if the source cannot be normalized, for example because it uses __LINE__ or fails
+// to tokenize.
+bool NormalizeSource(angle::Span<const char *const> shaderStrings, std::string *normalizedOut);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_NORMALIZESOURCE_H_
@@ -11,6 +11,15 @@
 
 angle::TLSIndex PoolIndex = TLS_INVALID_INDEX;
 
+namespace
+{
+// The page size of the compiler's pool allocators, i.e. the default of angle::PoolAllocator.
+constexpr size_t kPoolPageSize = 8 * 1024;
+// The most memory a thread keeps around for its next compile.  This covers the needs of most
+// shaders, while bounding the memory held by idle worker threads.
+constexpr size_t kMaxRecycledPoolPageBytes = 2 * 1024 * 1024;
+}  // anonymous namespace
+
 bool InitializePoolIndex()
 {
     ASSERT(PoolIndex == TLS_INVALID_INDEX);
@@ -43,3 +52,10 @@ void SetGlobalPoolAllocator(angle::PoolAllocator *poolAllocator)
     ASSERT(PoolIndex != TLS_INVALID_INDEX);
     angle::SetTLSValue(PoolIndex, poolAllocator);
 }
+
+angle::PoolPageRecycler *GetThreadPoolPageRecycler()
+{
+    static thread_local angle::PoolPageRecycler sRecycler(kPoolPageSize,
+                                                         kMaxRecycledPoolPageBytes);
+    return &sRecycler;
+}
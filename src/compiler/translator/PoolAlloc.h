@@ -30,14 +30,32 @@ extern angle::PoolAllocator *GetGlobalPoolAllocator();
 extern void SetGlobalPoolAllocator(angle::PoolAllocator *poolAllocator);
 extern bool IsGlobalPoolAllocatorInitialized();
 
+// The pages of the pool allocators of compiles that ran on the calling thread, kept for the next
+// compile on the same thread.
+extern angle::PoolPageRecycler *GetThreadPoolPageRecycler();
+
 class [[nodiscard]] TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator() { SetGlobalPoolAllocator(&mAllocator); }
-    ~TScopedPoolAllocator() { SetGlobalPoolAllocator(nullptr); }
+    TScopedPoolAllocator() : TScopedPoolAllocator(nullptr) {}
+    // |statsOut|, if given, receives the allocator statistics when the scope ends.
+    explicit TScopedPoolAllocator(angle::PoolAllocatorStats *statsOut) : mStatsOut(statsOut)
+    {
+        mAllocator.setPageRecycler(GetThreadPoolPageRecycler());
+        SetGlobalPoolAllocator(&mAllocator);
+    }
+    ~TScopedPoolAllocator()
+    {
+        SetGlobalPoolAllocator(nullptr);
+        if (mStatsOut)
+        {
+            *mStatsOut = mAllocator.getStats();
+        }
+    }
 
   private:
     angle::PoolAllocator mAllocator;
+    angle::PoolAllocatorStats *mStatsOut;
 };
 
 //
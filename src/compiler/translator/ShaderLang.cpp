@@ -16,6 +16,7 @@
 #include "common/unsafe_buffers.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
+#include "compiler/translator/NormalizeSource.h"
 #include "compiler/translator/length_limits.h"
 #ifdef ANGLE_ENABLE_HLSL
 #    include "compiler/translator/hlsl/TranslatorHLSL.h"
@@ -492,6 +493,49 @@ const BinaryBlob &GetObjectBinaryBlob(const ShHandle handle)
     return infoSink.obj.getBinary();
 }
 
+bool GetNormalizedSource(const char *const shaderStrings[],
+                         size_t numStrings,
+                         std::string *normalizedSourceOut)
+{
+    ASSERT(normalizedSourceOut);
+
+    // SAFETY: required from caller across this exposed API.
+    return NormalizeSource(ANGLE_UNSAFE_BUFFERS(angle::Span(shaderStrings, numStrings)),
+                           normalizedSourceOut);
+}
+
+ShCompileMemoryStats GetCompileMemoryStats(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    const angle::PoolAllocatorStats &stats = compiler->getPoolAllocatorStats();
+
+    ShCompileMemoryStats memoryStats;
+    memoryStats.allocationCount   = stats.allocationCount;
+    memoryStats.allocatedBytes    = stats.allocatedBytes;
+    memoryStats.peakPageCount     = stats.peakPageCount;
+    memoryStats.peakBytes         = stats.peakPageCount * stats.pageSize;
+    memoryStats.recycledPageCount = stats.recycledPageCount;
+    return memoryStats;
+}
+
+const std::vector<ShCompilePhaseStats> &GetCompilePhaseStats(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->getPhaseStats().getPhases();
+}
+
+void SetTracePlatform(const ShHandle handle, angle::PlatformMethods *platform)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    compiler->getPhaseStats().setTracePlatform(platform);
+}
+
 bool GetShaderBinary(const ShHandle handle,
                      const char *const shaderStrings[],
                      size_t numStrings,
@@ -1159,6 +1159,7 @@ bool TranslatorSPIRV::translate(TIntermBlock *root,
         return false;
     }
 
+    TScopedCompilePhase phase(&getPhaseStats(), "OutputSPIRV");
     return OutputSPIRV(this, root, compileOptions, mUniqueToSpirvIdMap, mFirstUnusedSpirvId);
 }
 
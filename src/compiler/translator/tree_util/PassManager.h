@@ -0,0 +1,46 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.h: Runs AST passes and records each of them as a compile phase.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_PASSMANAGER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_PASSMANAGER_H_
+
+#include <type_traits>
+
+#include "compiler/translator/CompilePhaseStats.h"
+
+namespace sh
+{
+class TPassManager : angle::NonCopyable
+{
+  public:
+    explicit TPassManager(TCompilePhaseStats *phaseStats) : mPhaseStats(phaseStats) {}
+
+    // Runs |pass|, which either returns whether it succeeded or returns nothing, as the phase
+    // |name|.  Any AST validation done by the pass is included in its phase.
+    template <typename Pass>
+    [[nodiscard]] bool run(const char *name, Pass &&pass)
+    {
+        TScopedCompilePhase phase(mPhaseStats, name);
+
+        if constexpr (std::is_void_v<decltype(pass())>)
+        {
+            pass();
+            return true;
+        }
+        else
+        {
+            return pass();
+        }
+    }
+
+  private:
+    TCompilePhaseStats *mPhaseStats;
+};
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_PASSMANAGER_H_
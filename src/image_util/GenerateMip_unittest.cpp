@@ -0,0 +1,118 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMip_unittest.cpp: Unit tests for the mip generation functions.
+
+#include <gmock/gmock.h>
+#include <random>
+#include <vector>
+#include "common/simd_utils.h"
+#include "common/unsafe_buffers.h"
+#include "image_util/generatemip.h"
+
+using namespace angle;
+using namespace testing;
+
+namespace
+{
+constexpr CPUFeatureMask kSIMDFeatureMasks[] = {
+    static_cast<CPUFeatureMask>(CPUFeature::SSE41),
+    static_cast<CPUFeatureMask>(CPUFeature::AVX2),
+    static_cast<CPUFeatureMask>(CPUFeature::NEON),
+    kAllCPUFeatures,
+};
+
+// Generates the next level of |source| with the scalar code and with each set of CPU features, and
+// checks that the results are identical.  Destination rows are padded to catch overruns.
+template <typename T>
+void TestGenerateMipMatchesScalar(size_t sourceWidth,
+                                  size_t sourceHeight,
+                                  const std::vector<uint8_t> &source)
+{
+    const size_t sourceRowPitch = sourceWidth * sizeof(T);
+    const size_t destWidth      = std::max<size_t>(1, sourceWidth / 2);
+    const size_t destHeight     = std::max<size_t>(1, sourceHeight / 2);
+    const size_t destRowPitch   = (destWidth + 3) * sizeof(T);
+    const size_t destSize       = destRowPitch * destHeight;
+    ASSERT_EQ(source.size(), sourceRowPitch * sourceHeight);
+
+    SetCPUFeatureMaskForTesting(0);
+    std::vector<uint8_t> expected(destSize, 0xAA);
+    GenerateMip<T>(sourceWidth, sourceHeight, 1, source.data(), sourceRowPitch, source.size(),
+                   expected.data(), destRowPitch, destSize);
+
+    for (CPUFeatureMask mask : kSIMDFeatureMasks)
+    {
+        SetCPUFeatureMaskForTesting(mask);
+        std::vector<uint8_t> actual(destSize, 0xAA);
+        GenerateMip<T>(sourceWidth, sourceHeight, 1, source.data(), sourceRowPitch, source.size(),
+                       actual.data(), destRowPitch, destSize);
+        EXPECT_EQ(expected, actual) << sourceWidth << "x" << sourceHeight << ", feature mask "
+                                    << mask;
+    }
+
+    SetCPUFeatureMaskForTesting(kAllCPUFeatures);
+}
+
+template <typename T>
+void TestRandomImages()
+{
+    std::mt19937 rng(0x5EED);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    // Cover the vector widths of every kernel, their remainders, and odd source dimensions.
+    for (size_t sourceWidth : {2, 3, 7, 8, 9, 16, 17, 31, 32, 33, 64, 65, 130})
+    {
+        for (size_t sourceHeight : {2, 3, 5})
+        {
+            std::vector<uint8_t> source(sourceWidth * sourceHeight * sizeof(T));
+            for (uint8_t &value : source)
+            {
+                value = static_cast<uint8_t>(byteDistribution(rng));
+            }
+            TestGenerateMipMatchesScalar<T>(sourceWidth, sourceHeight, source);
+        }
+    }
+}
+
+// Tests that the vectorized 8-bit kernels match the scalar box filter.
+TEST(GenerateMipSIMD, ByteFormatsMatchScalar)
+{
+    TestRandomImages<R8G8B8A8>();
+    TestRandomImages<B8G8R8A8>();
+    TestRandomImages<R8G8B8X8>();
+    TestRandomImages<B8G8R8X8>();
+}
+
+// Tests that the vectorized half float kernels match the scalar box filter on random bits, which
+// include plenty of INF, NaN and denormal values.
+TEST(GenerateMipSIMD, HalfFloatMatchesScalar)
+{
+    TestRandomImages<R16G16B16A16F>();
+}
+
+// Tests every half float value, each averaged with a random neighbor.
+TEST(GenerateMipSIMD, HalfFloatAllValues)
+{
+    constexpr size_t kSourceWidth = 2 * 65536 / 4;
+    std::mt19937 rng(0x5EED);
+    std::uniform_int_distribution<int> halfDistribution(0, 0xFFFF);
+
+    std::vector<uint16_t> source(kSourceWidth * 4 * 2);
+    for (uint16_t &value : source)
+    {
+        value = static_cast<uint16_t>(halfDistribution(rng));
+    }
+    for (size_t value = 0; value < 65536; ++value)
+    {
+        source[value] = static_cast<uint16_t>(value);
+    }
+
+    const uint8_t *sourceBytes = reinterpret_cast<const uint8_t *>(source.data());
+    TestGenerateMipMatchesScalar<R16G16B16A16F>(
+        kSourceWidth, 2,
+        std::vector<uint8_t>(sourceBytes, ANGLE_UNSAFE_TODO(sourceBytes + source.size() * 2)));
+}
+}  // anonymous namespace
@@ -6,9 +6,11 @@
 // LoadToNative_unittest.cpp: Unit tests for pixel loading functions.
 
 #include <gmock/gmock.h>
+#include <random>
 #include <vector>
 #include "common/debug.h"
 #include "common/mathutil.h"
+#include "common/simd_utils.h"
 #include "common/unsafe_buffers.h"
 #include "image_util/loadimage.h"
 
@@ -503,4 +505,181 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
+
+using LoadImageFunction = void (*)(const ImageLoadContext &context,
+                                   size_t width,
+                                   size_t height,
+                                   size_t depth,
+                                   const uint8_t *input,
+                                   size_t inputRowPitch,
+                                   size_t inputDepthPitch,
+                                   uint8_t *output,
+                                   size_t outputRowPitch,
+                                   size_t outputDepthPitch);
+
+// The CPU feature subsets to compare against the scalar code.  Features that the CPU doesn't have
+// are ignored by HasCPUFeature, so this covers whichever kernels the test machine can run.
+constexpr CPUFeatureMask kSIMDFeatureMasks[] = {
+    static_cast<CPUFeatureMask>(CPUFeature::SSE41),
+    static_cast<CPUFeatureMask>(CPUFeature::AVX2),
+    static_cast<CPUFeatureMask>(CPUFeature::NEON),
+    kAllCPUFeatures,
+};
+
+// Runs |loadFunction| over random input with every row width up to |maxWidth|, and checks that
+// the vectorized kernels produce the same bytes as the scalar code.  The input rows are padded
+// and offset by |inputAlignment| (the alignment the scalar code needs) so that the kernels see
+// rows at various addresses.
+void TestLoadFunctionMatchesScalar(LoadImageFunction loadFunction,
+                                   size_t inputPixelBytes,
+                                   size_t inputAlignment,
+                                   size_t outputPixelBytes,
+                                   size_t maxWidth,
+                                   const std::vector<uint8_t> &randomBytes)
+{
+    constexpr size_t kHeight = 3;
+    ImageLoadContext context;
+
+    for (size_t width = 1; width <= maxWidth; ++width)
+    {
+        const size_t inputRowPitch =
+            rx::roundUpPow2(width * inputPixelBytes, inputAlignment) + inputAlignment;
+        const size_t inputDepthPitch = inputRowPitch * kHeight;
+        const size_t outputRowPitch  = width * outputPixelBytes + 4;
+        const size_t outputDepth     = outputRowPitch * kHeight;
+
+        std::vector<uint8_t> input(inputDepthPitch + inputAlignment);
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            input[i] = randomBytes[(width * 7 + i) % randomBytes.size()];
+        }
+
+        SetCPUFeatureMaskForTesting(0);
+        std::vector<uint8_t> expected(outputDepth + 4, 0xAA);
+        loadFunction(context, width, kHeight, 1, ANGLE_UNSAFE_TODO(input.data() + inputAlignment),
+                     inputRowPitch, inputDepthPitch, ANGLE_UNSAFE_TODO(expected.data() + 4),
+                     outputRowPitch, outputDepth);
+
+        for (CPUFeatureMask mask : kSIMDFeatureMasks)
+        {
+            SetCPUFeatureMaskForTesting(mask);
+            std::vector<uint8_t> actual(outputDepth + 4, 0xAA);
+            loadFunction(context, width, kHeight, 1,
+                         ANGLE_UNSAFE_TODO(input.data() + inputAlignment), inputRowPitch,
+                         inputDepthPitch, ANGLE_UNSAFE_TODO(actual.data() + 4), outputRowPitch,
+                         outputDepth);
+            EXPECT_EQ(expected, actual) << "width " << width << ", feature mask " << mask;
+        }
+    }
+
+    SetCPUFeatureMaskForTesting(kAllCPUFeatures);
+}
+
+std::vector<uint8_t> GetRandomBytes(size_t count)
+{
+    std::mt19937 generator(0x1234);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+    std::vector<uint8_t> bytes(count);
+    for (uint8_t &byte : bytes)
+    {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    return bytes;
+}
+
+// Tests that the vectorized byte swizzles match the scalar code.
+TEST(LoadImageSIMD, ByteSwizzlesMatchScalar)
+{
+    const std::vector<uint8_t> randomBytes = GetRandomBytes(4096);
+
+    TestLoadFunctionMatchesScalar(LoadToNative3To4<uint8_t, 0xFF>, 3, 1, 4, 67, randomBytes);
+    TestLoadFunctionMatchesScalar(LoadToNative3To4<uint8_t, 0x01>, 3, 1, 4, 67, randomBytes);
+    TestLoadFunctionMatchesScalar(LoadRGB8ToBGRX8, 3, 1, 4, 67, randomBytes);
+    TestLoadFunctionMatchesScalar(LoadRGBA8ToBGRA8, 4, 4, 4, 67, randomBytes);
+    TestLoadFunctionMatchesScalar(LoadLA8ToRGBA8, 2, 1, 4, 67, randomBytes);
+}
+
+// Tests that the vectorized float conversions match the scalar code on random bit patterns, which
+// include negative, denormal, INF and NaN values.
+TEST(LoadImageSIMD, FloatConversionsMatchScalar)
+{
+    const std::vector<uint8_t> randomBytes = GetRandomBytes(4096);
+
+    TestLoadFunctionMatchesScalar(Load32FTo16F<1>, 4, 4, 2, 35, randomBytes);
+    TestLoadFunctionMatchesScalar(Load32FTo16F<4>, 16, 4, 8, 35, randomBytes);
+    TestLoadFunctionMatchesScalar(LoadRGB16FToRG11B10F, 6, 2, 4, 35, randomBytes);
+}
+
+// Tests every float32 exponent, with a few mantissas each, through the float16 kernels.
+TEST(LoadImageSIMD, Load32FTo16FAllExponents)
+{
+    std::vector<uint32_t> input;
+    for (uint32_t sign : {0u, 0x80000000u})
+    {
+        for (uint32_t exponent = 0; exponent < 256; ++exponent)
+        {
+            for (uint32_t mantissa : {0u, 1u, 0xFFFu, 0x1000u, 0x1FFFu, 0x2000u, 0x3FFFFFu,
+                                      0x400000u, 0x7FEFFFu, 0x7FF000u, 0x7FFFFFu})
+            {
+                input.push_back(sign | (exponent << 23) | mantissa);
+            }
+        }
+    }
+
+    std::vector<uint16_t> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        expected[i] = gl::float32ToFloat16(gl::bitCast<float>(input[i]));
+    }
+
+    ImageLoadContext context;
+    for (CPUFeatureMask mask : kSIMDFeatureMasks)
+    {
+        SetCPUFeatureMaskForTesting(mask);
+        std::vector<uint16_t> actual(input.size());
+        Load32FTo16F<1>(context, input.size(), 1, 1,
+                        reinterpret_cast<const uint8_t *>(input.data()), input.size() * 4,
+                        input.size() * 4, reinterpret_cast<uint8_t *>(actual.data()),
+                        actual.size() * 2, actual.size() * 2);
+        EXPECT_EQ(expected, actual) << "feature mask " << mask;
+    }
+    SetCPUFeatureMaskForTesting(kAllCPUFeatures);
+}
+
+// Tests every half float value in each channel through the R11G11B10F kernels.
+TEST(LoadImageSIMD, LoadRGB16FToRG11B10FAllValues)
+{
+    constexpr size_t kValueCount = 0x10000;
+
+    // Each channel sweeps through all values at a different offset, so that fast and slow lanes
+    // are mixed within each group of pixels.
+    std::vector<uint16_t> input(kValueCount * 3);
+    for (size_t i = 0; i < kValueCount; ++i)
+    {
+        input[i * 3 + 0] = static_cast<uint16_t>(i);
+        input[i * 3 + 1] = static_cast<uint16_t>(i * 5 + 3);
+        input[i * 3 + 2] = static_cast<uint16_t>(kValueCount - 1 - i);
+    }
+
+    std::vector<uint32_t> expected(kValueCount);
+    for (size_t i = 0; i < kValueCount; ++i)
+    {
+        expected[i] = (gl::float32ToFloat11(gl::float16ToFloat32(input[i * 3 + 0])) << 0) |
+                      (gl::float32ToFloat11(gl::float16ToFloat32(input[i * 3 + 1])) << 11) |
+                      (gl::float32ToFloat10(gl::float16ToFloat32(input[i * 3 + 2])) << 22);
+    }
+
+    ImageLoadContext context;
+    for (CPUFeatureMask mask : kSIMDFeatureMasks)
+    {
+        SetCPUFeatureMaskForTesting(mask);
+        std::vector<uint32_t> actual(kValueCount);
+        LoadRGB16FToRG11B10F(context, kValueCount, 1, 1,
+                             reinterpret_cast<const uint8_t *>(input.data()), kValueCount * 6,
+                             kValueCount * 6, reinterpret_cast<uint8_t *>(actual.data()),
+                             kValueCount * 4, kValueCount * 4);
+        EXPECT_EQ(expected, actual) << "feature mask " << mask;
+    }
+    SetCPUFeatureMaskForTesting(kAllCPUFeatures);
+}
 }  // namespace
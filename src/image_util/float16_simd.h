@@ -0,0 +1,151 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// float16_simd.h: Vectorized float32 <-> float16 conversions shared by the image_util SIMD
+// kernels.  The results are bit-identical to gl::float32ToFloat16 and gl::float16ToFloat32, which
+// is not the case for the hardware conversion instructions (F16C, FCVT) as they differ in how NaNs
+// are produced.  Half floats are held in the low 16 bits of 32-bit lanes.
+
+#ifndef IMAGEUTIL_FLOAT16_SIMD_H_
+#define IMAGEUTIL_FLOAT16_SIMD_H_
+
+#include "common/simd_utils.h"
+
+namespace angle
+{
+namespace priv
+{
+#if defined(ANGLE_SIMD_X86)
+ANGLE_SIMD_TARGET_AVX2
+inline __m256i Float32ToFloat16AVX2(__m256i bits)
+{
+    const __m256i valueMask     = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i signMask      = _mm256_set1_epi32(0x8000);
+    const __m256i one           = _mm256_set1_epi32(1);
+    const __m256i rebias        = _mm256_set1_epi32(static_cast<int>(0xC8000FFF));
+    const __m256i roundingBias  = _mm256_set1_epi32(0xFFF);
+    const __m256i mantissaMask  = _mm256_set1_epi32(0x007FFFFF);
+    const __m256i implicitOne   = _mm256_set1_epi32(0x00800000);
+    const __m256i denormalShift = _mm256_set1_epi32(113);
+    const __m256i minNormal     = _mm256_set1_epi32(0x38800000);
+    const __m256i maxFinite     = _mm256_set1_epi32(0x47FFEFFF);
+    const __m256i infinity      = _mm256_set1_epi32(0x7F800000);
+    const __m256i infinityHalf  = _mm256_set1_epi32(0x7C00);
+    const __m256i nanHalf       = _mm256_set1_epi32(0x7FFF);
+
+    const __m256i sign = _mm256_and_si256(_mm256_srli_epi32(bits, 16), signMask);
+    const __m256i abs  = _mm256_and_si256(bits, valueMask);
+
+    const __m256i normalRound = _mm256_and_si256(_mm256_srli_epi32(abs, 13), one);
+    const __m256i normal =
+        _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(abs, rebias), normalRound), 13);
+
+    // srlv yields 0 for shifts of 32 or more, which covers values too small for a denormal.
+    const __m256i mantissa = _mm256_or_si256(_mm256_and_si256(abs, mantissaMask), implicitOne);
+    const __m256i shift    = _mm256_sub_epi32(denormalShift, _mm256_srli_epi32(abs, 23));
+    const __m256i shifted  = _mm256_srlv_epi32(mantissa, shift);
+    const __m256i denormalRound = _mm256_and_si256(_mm256_srli_epi32(shifted, 13), one);
+    const __m256i denormal      = _mm256_srli_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(shifted, roundingBias), denormalRound), 13);
+
+    __m256i result = _mm256_blendv_epi8(normal, denormal, _mm256_cmpgt_epi32(minNormal, abs));
+    result         = _mm256_or_si256(result, sign);
+    result         = _mm256_blendv_epi8(result, _mm256_or_si256(sign, infinityHalf),
+                                        _mm256_cmpgt_epi32(abs, maxFinite));
+    return _mm256_blendv_epi8(result, nanHalf, _mm256_cmpgt_epi32(abs, infinity));
+}
+
+ANGLE_SIMD_TARGET_AVX2
+inline __m256 Float16ToFloat32AVX2(__m256i halves)
+{
+    const __m256i valueMask    = _mm256_set1_epi32(0x7FFF);
+    const __m256i signMask     = _mm256_set1_epi32(0x8000);
+    const __m256i minNormal    = _mm256_set1_epi32(0x0400);
+    const __m256i maxFinite    = _mm256_set1_epi32(0x7BFF);
+    const __m256i normalBias   = _mm256_set1_epi32(0x38000000);
+    const __m256i infinityBias = _mm256_set1_epi32(0x70000000);
+    const __m256 denormalScale = _mm256_set1_ps(1.0f / 16777216.0f);
+
+    const __m256i abs  = _mm256_and_si256(halves, valueMask);
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(halves, signMask), 16);
+
+    // Normal values only need the exponent rebiased; INF and NaN keep the maximum exponent.
+    const __m256i bias =
+        _mm256_blendv_epi8(normalBias, infinityBias, _mm256_cmpgt_epi32(abs, maxFinite));
+    const __m256i normal = _mm256_add_epi32(_mm256_slli_epi32(abs, 13), bias);
+
+    // Denormals (and zero) are exactly mantissa * 2^-24.
+    const __m256i denormal =
+        _mm256_castps_si256(_mm256_mul_ps(_mm256_cvtepi32_ps(abs), denormalScale));
+
+    const __m256i result =
+        _mm256_blendv_epi8(normal, denormal, _mm256_cmpgt_epi32(minNormal, abs));
+    return _mm256_castsi256_ps(_mm256_or_si256(result, sign));
+}
+#elif defined(ANGLE_SIMD_NEON)
+inline uint32x4_t Float32ToFloat16NEON(uint32x4_t bits)
+{
+    const uint32x4_t valueMask    = vdupq_n_u32(0x7FFFFFFF);
+    const uint32x4_t signMask     = vdupq_n_u32(0x8000);
+    const uint32x4_t one          = vdupq_n_u32(1);
+    const uint32x4_t rebias       = vdupq_n_u32(0xC8000FFF);
+    const uint32x4_t roundingBias = vdupq_n_u32(0xFFF);
+    const uint32x4_t mantissaMask = vdupq_n_u32(0x007FFFFF);
+    const uint32x4_t implicitOne  = vdupq_n_u32(0x00800000);
+    const int32x4_t denormalShift = vdupq_n_s32(113);
+    const uint32x4_t minNormal    = vdupq_n_u32(0x38800000);
+    const uint32x4_t maxFinite    = vdupq_n_u32(0x47FFEFFF);
+    const uint32x4_t infinity     = vdupq_n_u32(0x7F800000);
+    const uint32x4_t infinityHalf = vdupq_n_u32(0x7C00);
+    const uint32x4_t nanHalf      = vdupq_n_u32(0x7FFF);
+
+    const uint32x4_t sign = vandq_u32(vshrq_n_u32(bits, 16), signMask);
+    const uint32x4_t abs  = vandq_u32(bits, valueMask);
+
+    const uint32x4_t normal = vshrq_n_u32(
+        vaddq_u32(vaddq_u32(abs, rebias), vandq_u32(vshrq_n_u32(abs, 13), one)), 13);
+
+    // A negative shift count shifts right; counts of 32 or more produce 0, which covers values too
+    // small for a denormal.
+    const uint32x4_t mantissa = vorrq_u32(vandq_u32(abs, mantissaMask), implicitOne);
+    const int32x4_t shift = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(abs, 23)), denormalShift);
+    const uint32x4_t shifted  = vshlq_u32(mantissa, shift);
+    const uint32x4_t denormal = vshrq_n_u32(
+        vaddq_u32(vaddq_u32(shifted, roundingBias), vandq_u32(vshrq_n_u32(shifted, 13), one)), 13);
+
+    uint32x4_t result = vbslq_u32(vcltq_u32(abs, minNormal), denormal, normal);
+    result            = vorrq_u32(result, sign);
+    result = vbslq_u32(vcgtq_u32(abs, maxFinite), vorrq_u32(sign, infinityHalf), result);
+    return vbslq_u32(vcgtq_u32(abs, infinity), nanHalf, result);
+}
+
+inline float32x4_t Float16ToFloat32NEON(uint32x4_t halves)
+{
+    const uint32x4_t valueMask    = vdupq_n_u32(0x7FFF);
+    const uint32x4_t signMask     = vdupq_n_u32(0x8000);
+    const uint32x4_t minNormal    = vdupq_n_u32(0x0400);
+    const uint32x4_t maxFinite    = vdupq_n_u32(0x7BFF);
+    const uint32x4_t normalBias   = vdupq_n_u32(0x38000000);
+    const uint32x4_t infinityBias = vdupq_n_u32(0x70000000);
+
+    const uint32x4_t abs  = vandq_u32(halves, valueMask);
+    const uint32x4_t sign = vshlq_n_u32(vandq_u32(halves, signMask), 16);
+
+    // Normal values only need the exponent rebiased; INF and NaN keep the maximum exponent.
+    const uint32x4_t bias   = vbslq_u32(vcgtq_u32(abs, maxFinite), infinityBias, normalBias);
+    const uint32x4_t normal = vaddq_u32(vshlq_n_u32(abs, 13), bias);
+
+    // Denormals (and zero) are exactly mantissa * 2^-24.
+    const uint32x4_t denormal = vreinterpretq_u32_f32(vcvtq_n_f32_u32(abs, 24));
+
+    const uint32x4_t result = vbslq_u32(vcltq_u32(abs, minNormal), denormal, normal);
+    return vreinterpretq_f32_u32(vorrq_u32(result, sign));
+}
+#endif
+}  // namespace priv
+}  // namespace angle
+
+#endif  // IMAGEUTIL_FLOAT16_SIMD_H_
@@ -0,0 +1,305 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// generatemip_simd.cpp: Vectorized box filter row kernels used by GenerateMip.
+
+#include "image_util/generatemip_simd.h"
+
+#include "common/simd_utils.h"
+#include "image_util/float16_simd.h"
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+// The 8-bit formats average each channel as floor((a + b) / 2), first vertically and then
+// horizontally.  |alphaMask| is ORed into every pixel, which forces X to 255 for the RGBX formats.
+#if defined(ANGLE_SIMD_X86)
+ANGLE_SIMD_TARGET_SSE41
+inline __m128i FloorAverageU8SSE41(__m128i a, __m128i b)
+{
+    // avg_epu8 rounds up, so subtract the bit that was rounded.
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+}
+
+ANGLE_SIMD_TARGET_AVX2
+inline __m256i FloorAverageU8AVX2(__m256i a, __m256i b)
+{
+    return _mm256_sub_epi8(_mm256_avg_epu8(a, b),
+                           _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_set1_epi8(1)));
+}
+
+ANGLE_SIMD_TARGET_SSE41
+size_t GenerateMipRowXY8888SSE41(const uint8_t *sourceRow0,
+                                 const uint8_t *sourceRow1,
+                                 uint8_t *destRow,
+                                 size_t destWidth,
+                                 uint32_t alphaMask)
+{
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(alphaMask));
+
+    size_t x = 0;
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        const uint8_t *src0 = sourceRow0 + x * 8;
+        const uint8_t *src1 = sourceRow1 + x * 8;
+
+        const __m128i vertical0 =
+            FloorAverageU8SSE41(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src0)),
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(src1)));
+        const __m128i vertical1 =
+            FloorAverageU8SSE41(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src0 + 16)),
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(src1 + 16)));
+
+        const __m128 v0    = _mm_castsi128_ps(vertical0);
+        const __m128 v1    = _mm_castsi128_ps(vertical1);
+        const __m128i even = _mm_castps_si128(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i odd  = _mm_castps_si128(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+        const __m128i result = _mm_or_si128(FloorAverageU8SSE41(even, odd), alpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * 4), result);
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2
+size_t GenerateMipRowXY8888AVX2(const uint8_t *sourceRow0,
+                                const uint8_t *sourceRow1,
+                                uint8_t *destRow,
+                                size_t destWidth,
+                                uint32_t alphaMask)
+{
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(alphaMask));
+
+    size_t x = 0;
+    for (; x + 8 <= destWidth; x += 8)
+    {
+        const uint8_t *src0 = sourceRow0 + x * 8;
+        const uint8_t *src1 = sourceRow1 + x * 8;
+
+        const __m256i vertical0 =
+            FloorAverageU8AVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src0)),
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src1)));
+        const __m256i vertical1 =
+            FloorAverageU8AVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src0 + 32)),
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src1 + 32)));
+
+        // shuffle_ps works within 128-bit lanes, which leaves the pixels in 0, 1, 4, 5, 2, 3, 6, 7
+        // order; the final permute restores it.
+        const __m256 v0 = _mm256_castsi256_ps(vertical0);
+        const __m256 v1 = _mm256_castsi256_ps(vertical1);
+        const __m256i even =
+            _mm256_castps_si256(_mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m256i odd =
+            _mm256_castps_si256(_mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+        const __m256i result = _mm256_permute4x64_epi64(
+            _mm256_or_si256(FloorAverageU8AVX2(even, odd), alpha), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destRow + x * 4), result);
+    }
+    return x;
+}
+
+// Returns gl::averageHalfFloat of each lane, rounded to half and widened back to float32.
+ANGLE_SIMD_TARGET_AVX2
+inline __m256 AverageHalfFloatAVX2(__m256 a, __m256 b)
+{
+    const __m256 sum     = _mm256_mul_ps(_mm256_add_ps(a, b), _mm256_set1_ps(0.5f));
+    const __m256i halves = Float32ToFloat16AVX2(_mm256_castps_si256(sum));
+    return Float16ToFloat32AVX2(halves);
+}
+
+ANGLE_SIMD_TARGET_AVX2
+size_t GenerateMipRowXYRGBA16FAVX2(const uint8_t *sourceRow0,
+                                   const uint8_t *sourceRow1,
+                                   uint8_t *destRow,
+                                   size_t destWidth)
+{
+    size_t x = 0;
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        // Two destination pixels come from four source pixels, which are two vectors of eight
+        // channels per row.
+        const uint8_t *src0 = sourceRow0 + x * 16;
+        const uint8_t *src1 = sourceRow1 + x * 16;
+
+        const __m256 row0a = Float16ToFloat32AVX2(
+            _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src0))));
+        const __m256 row0b = Float16ToFloat32AVX2(
+            _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src0 + 16))));
+        const __m256 row1a = Float16ToFloat32AVX2(
+            _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src1))));
+        const __m256 row1b = Float16ToFloat32AVX2(
+            _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src1 + 16))));
+
+        const __m256 verticalA = AverageHalfFloatAVX2(row0a, row1a);
+        const __m256 verticalB = AverageHalfFloatAVX2(row0b, row1b);
+
+        // Each 128-bit lane holds one source pixel; pair the even pixels with the odd ones.
+        const __m256 even = _mm256_permute2f128_ps(verticalA, verticalB, 0x20);
+        const __m256 odd  = _mm256_permute2f128_ps(verticalA, verticalB, 0x31);
+
+        const __m256 sum     = _mm256_mul_ps(_mm256_add_ps(even, odd), _mm256_set1_ps(0.5f));
+        const __m256i result = Float32ToFloat16AVX2(_mm256_castps_si256(sum));
+
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * 8),
+                         _mm256_castsi256_si128(packed));
+    }
+    return x;
+}
+#elif defined(ANGLE_SIMD_NEON)
+size_t GenerateMipRowXY8888NEON(const uint8_t *sourceRow0,
+                                const uint8_t *sourceRow1,
+                                uint8_t *destRow,
+                                size_t destWidth,
+                                uint32_t alphaMask)
+{
+    const uint8x16_t alpha = vreinterpretq_u8_u32(vdupq_n_u32(alphaMask));
+
+    size_t x = 0;
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        // vld2 splits the even and odd source pixels; vhadd is the truncating byte average.
+        const uint32x4x2_t src0 = vld2q_u32(reinterpret_cast<const uint32_t *>(sourceRow0 + x * 8));
+        const uint32x4x2_t src1 = vld2q_u32(reinterpret_cast<const uint32_t *>(sourceRow1 + x * 8));
+
+        const uint8x16_t even =
+            vhaddq_u8(vreinterpretq_u8_u32(src0.val[0]), vreinterpretq_u8_u32(src1.val[0]));
+        const uint8x16_t odd =
+            vhaddq_u8(vreinterpretq_u8_u32(src0.val[1]), vreinterpretq_u8_u32(src1.val[1]));
+
+        vst1q_u8(destRow + x * 4, vorrq_u8(vhaddq_u8(even, odd), alpha));
+    }
+    return x;
+}
+
+// Returns gl::averageHalfFloat of each lane, rounded to half and widened back to float32.
+inline float32x4_t AverageHalfFloatNEON(float32x4_t a, float32x4_t b)
+{
+    const float32x4_t sum = vmulq_n_f32(vaddq_f32(a, b), 0.5f);
+    return Float16ToFloat32NEON(Float32ToFloat16NEON(vreinterpretq_u32_f32(sum)));
+}
+
+size_t GenerateMipRowXYRGBA16FNEON(const uint8_t *sourceRow0,
+                                   const uint8_t *sourceRow1,
+                                   uint8_t *destRow,
+                                   size_t destWidth)
+{
+    size_t x = 0;
+    for (; x < destWidth; ++x)
+    {
+        // One destination pixel comes from two source pixels, one vector of four channels each.
+        const uint16x8_t src0 = vld1q_u16(reinterpret_cast<const uint16_t *>(sourceRow0 + x * 16));
+        const uint16x8_t src1 = vld1q_u16(reinterpret_cast<const uint16_t *>(sourceRow1 + x * 16));
+
+        const float32x4_t even =
+            AverageHalfFloatNEON(Float16ToFloat32NEON(vmovl_u16(vget_low_u16(src0))),
+                                 Float16ToFloat32NEON(vmovl_u16(vget_low_u16(src1))));
+        const float32x4_t odd = AverageHalfFloatNEON(
+            Float16ToFloat32NEON(vmovl_u16(vget_high_u16(src0))),
+            Float16ToFloat32NEON(vmovl_u16(vget_high_u16(src1))));
+
+        const float32x4_t sum = vmulq_n_f32(vaddq_f32(even, odd), 0.5f);
+        vst1_u16(reinterpret_cast<uint16_t *>(destRow + x * 8),
+                 vmovn_u32(Float32ToFloat16NEON(vreinterpretq_u32_f32(sum))));
+    }
+    return x;
+}
+#endif
+
+size_t GenerateMipRowXY8888(const uint8_t *sourceRow0,
+                            const uint8_t *sourceRow1,
+                            uint8_t *destRow,
+                            size_t destWidth,
+                            uint32_t alphaMask)
+{
+    size_t x = 0;
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::AVX2))
+    {
+        x = GenerateMipRowXY8888AVX2(sourceRow0, sourceRow1, destRow, destWidth, alphaMask);
+    }
+    if (HasCPUFeature(CPUFeature::SSE41))
+    {
+        x += GenerateMipRowXY8888SSE41(sourceRow0 + x * 8, sourceRow1 + x * 8, destRow + x * 4,
+                                       destWidth - x, alphaMask);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        x = GenerateMipRowXY8888NEON(sourceRow0, sourceRow1, destRow, destWidth, alphaMask);
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
+
+template <>
+size_t GenerateMipRowXY<R8G8B8A8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth)
+{
+    return GenerateMipRowXY8888(sourceRow0, sourceRow1, destRow, destWidth, 0);
+}
+
+template <>
+size_t GenerateMipRowXY<B8G8R8A8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth)
+{
+    return GenerateMipRowXY8888(sourceRow0, sourceRow1, destRow, destWidth, 0);
+}
+
+template <>
+size_t GenerateMipRowXY<R8G8B8X8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth)
+{
+    return GenerateMipRowXY8888(sourceRow0, sourceRow1, destRow, destWidth, 0xFF000000);
+}
+
+template <>
+size_t GenerateMipRowXY<B8G8R8X8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth)
+{
+    return GenerateMipRowXY8888(sourceRow0, sourceRow1, destRow, destWidth, 0xFF000000);
+}
+
+template <>
+size_t GenerateMipRowXY<R16G16B16A16F>(const uint8_t *sourceRow0,
+                                       const uint8_t *sourceRow1,
+                                       uint8_t *destRow,
+                                       size_t destWidth)
+{
+    // SSE4.1 has no per-lane variable shift for the denormal half conversion, so the half float
+    // kernel needs AVX2.
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::AVX2))
+    {
+        return GenerateMipRowXYRGBA16FAVX2(sourceRow0, sourceRow1, destRow, destWidth);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        return GenerateMipRowXYRGBA16FNEON(sourceRow0, sourceRow1, destRow, destWidth);
+    }
+#endif
+    return 0;
+}
+}  // namespace priv
+}  // namespace angle
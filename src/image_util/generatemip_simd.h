@@ -0,0 +1,63 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip_simd.h: Vectorized box filter row kernels used by GenerateMip.
+//
+// GenerateMipRowXY<T> filters the 2x2 blocks of two adjacent source rows into a prefix of one
+// destination row and returns the number of destination pixels it wrote.  The generic version
+// writes nothing, and the specializations return 0 when no suitable instruction set is available,
+// leaving the rest of the row to the scalar loop.  The results are bit-identical to T::average.
+
+#ifndef IMAGEUTIL_GENERATEMIP_SIMD_H_
+#define IMAGEUTIL_GENERATEMIP_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "image_util/imageformats.h"
+
+namespace angle
+{
+namespace priv
+{
+template <typename T>
+inline size_t GenerateMipRowXY(const uint8_t *sourceRow0,
+                               const uint8_t *sourceRow1,
+                               uint8_t *destRow,
+                               size_t destWidth)
+{
+    return 0;
+}
+
+template <>
+size_t GenerateMipRowXY<R8G8B8A8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth);
+template <>
+size_t GenerateMipRowXY<B8G8R8A8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth);
+template <>
+size_t GenerateMipRowXY<R8G8B8X8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth);
+template <>
+size_t GenerateMipRowXY<B8G8R8X8>(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth);
+template <>
+size_t GenerateMipRowXY<R16G16B16A16F>(const uint8_t *sourceRow0,
+                                       const uint8_t *sourceRow1,
+                                       uint8_t *destRow,
+                                       size_t destWidth);
+}  // namespace priv
+}  // namespace angle
+
+#endif  // IMAGEUTIL_GENERATEMIP_SIMD_H_
@@ -15,6 +15,7 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
+#include "image_util/loadimage_simd.h"
 
 #if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
 #    if defined(_MSC_VER)
@@ -368,7 +369,7 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadLA8ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -571,7 +572,8 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRGB8ToRGBX8Row(source, dest, width, 0xFF, true); x < width;
+                 x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -721,58 +723,6 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_LOADIMAGE_USE_SSE)
-    if (supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; x < width && (reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -781,7 +731,10 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            const size_t simdWidth =
+                priv::LoadRGBA8ToBGRA8Row(reinterpret_cast<const uint8_t *>(source),
+                                          reinterpret_cast<uint8_t *>(dest), width);
+            for (size_t x = simdWidth; x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -1543,7 +1496,7 @@ void LoadRGB16FToRG11B10F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRGB16FToRG11B10FRow(source, dest, width); x < width; x++)
             {
                 dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) << 0) |
                           (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
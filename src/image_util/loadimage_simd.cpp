@@ -0,0 +1,575 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// loadimage_simd.cpp: Vectorized row kernels used by the image loading functions.
+
+#include "image_util/loadimage_simd.h"
+
+#include "common/mathutil.h"
+#include "common/simd_utils.h"
+#include "image_util/float16_simd.h"
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+#if defined(ANGLE_SIMD_X86) || defined(ANGLE_SIMD_NEON)
+// Scalar reference for a single RGB16F -> R11G11B10F pixel, used for the lanes that the vector
+// kernels do not handle (negative, denormal, out of range, INF and NaN inputs).
+inline uint32_t ConvertRGB16FToRG11B10F(const uint16_t *source)
+{
+    return (gl::float32ToFloat11(gl::float16ToFloat32(source[0])) << 0) |
+           (gl::float32ToFloat11(gl::float16ToFloat32(source[1])) << 11) |
+           (gl::float32ToFloat10(gl::float16ToFloat32(source[2])) << 22);
+}
+
+// Positive, normal half floats map to normal float11/float10 values with the same exponent bias,
+// so the conversion reduces to rounding the mantissa:
+//
+//   float11 = ((h << 13) + 0xFFFF + ((h >> 4) & 1)) >> 17
+//   float10 = ((h << 13) + 0x1FFFF + ((h >> 5) & 1)) >> 18
+//
+// This is exact for h == 0 and for kMinNormalHalf <= h <= kMaxHalfForFloat11/10.  Everything else
+// (denormals, values that clamp, and negative, INF and NaN inputs, which all compare above the
+// limits) is rare in practice and takes the scalar path.
+constexpr uint32_t kMinNormalHalf     = 0x400;
+constexpr uint32_t kMaxHalfForFloat11 = 0x7BF0;
+constexpr uint32_t kMaxHalfForFloat10 = 0x7BE0;
+#endif  // defined(ANGLE_SIMD_X86) || defined(ANGLE_SIMD_NEON)
+
+#if defined(ANGLE_SIMD_X86)
+ANGLE_SIMD_TARGET_SSE41
+size_t LoadRGB8ToRGBX8RowSSE41(const uint8_t *source,
+                               uint8_t *dest,
+                               size_t width,
+                               uint8_t fourthValue,
+                               bool swapRB)
+{
+    const __m128i shuffle =
+        swapRB ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+               : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i fourth =
+        _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(fourthValue) << 24));
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        // 16 RGB pixels are exactly three 16-byte loads.
+        const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 3));
+        const __m128i in1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 3 + 16));
+        const __m128i in2 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 3 + 32));
+
+        const __m128i px0 = in0;
+        const __m128i px1 = _mm_alignr_epi8(in1, in0, 12);
+        const __m128i px2 = _mm_alignr_epi8(in2, in1, 8);
+        const __m128i px3 = _mm_srli_si128(in2, 4);
+
+        __m128i *out = reinterpret_cast<__m128i *>(dest + x * 4);
+        _mm_storeu_si128(out + 0, _mm_or_si128(_mm_shuffle_epi8(px0, shuffle), fourth));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_shuffle_epi8(px1, shuffle), fourth));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_shuffle_epi8(px2, shuffle), fourth));
+        _mm_storeu_si128(out + 3, _mm_or_si128(_mm_shuffle_epi8(px3, shuffle), fourth));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2
+size_t LoadRGB8ToRGBX8RowAVX2(const uint8_t *source,
+                              uint8_t *dest,
+                              size_t width,
+                              uint8_t fourthValue,
+                              bool swapRB)
+{
+    const __m256i shuffle =
+        swapRB ? _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1, 2, 1, 0,
+                                  -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+               : _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2,
+                                  -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i fourth =
+        _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(fourthValue) << 24));
+
+    // Each 128-bit lane loads four pixels (12 bytes) with a 16-byte load, so the last load of an
+    // iteration reads 4 bytes past the 16 pixels it converts.  Stop early enough for that read to
+    // stay within the row.
+    size_t x = 0;
+    for (; x + 18 <= width; x += 16)
+    {
+        const uint8_t *in = source + x * 3;
+        const __m256i px01 =
+            _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in + 0))),
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 12)), 1);
+        const __m256i px23 =
+            _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in + 24))),
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 36)), 1);
+
+        __m256i *out = reinterpret_cast<__m256i *>(dest + x * 4);
+        _mm256_storeu_si256(out + 0, _mm256_or_si256(_mm256_shuffle_epi8(px01, shuffle), fourth));
+        _mm256_storeu_si256(out + 1, _mm256_or_si256(_mm256_shuffle_epi8(px23, shuffle), fourth));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41
+size_t LoadRGBA8ToBGRA8RowSSE41(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * 4),
+                         _mm_shuffle_epi8(in, shuffle));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2
+size_t LoadRGBA8ToBGRA8RowAVX2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m256i shuffle =
+        _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4,
+                         7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + x * 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + x * 4),
+                            _mm256_shuffle_epi8(in, shuffle));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41
+size_t LoadLA8ToRGBA8RowSSE41(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i shuffleLo = _mm_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7);
+    const __m128i shuffleHi =
+        _mm_setr_epi8(8, 8, 8, 9, 10, 10, 10, 11, 12, 12, 12, 13, 14, 14, 14, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 2));
+        __m128i *out     = reinterpret_cast<__m128i *>(dest + x * 4);
+        _mm_storeu_si128(out + 0, _mm_shuffle_epi8(in, shuffleLo));
+        _mm_storeu_si128(out + 1, _mm_shuffle_epi8(in, shuffleHi));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2
+size_t LoadLA8ToRGBA8RowAVX2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m256i shuffleLo =
+        _mm256_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7, 0, 0, 0, 1, 2, 2, 2, 3, 4,
+                         4, 4, 5, 6, 6, 6, 7);
+    const __m256i shuffleHi =
+        _mm256_setr_epi8(8, 8, 8, 9, 10, 10, 10, 11, 12, 12, 12, 13, 14, 14, 14, 15, 8, 8, 8, 9,
+                         10, 10, 10, 11, 12, 12, 12, 13, 14, 14, 14, 15);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + x * 2));
+        // The shuffles stay within 128-bit lanes: lo = {px0-3, px8-11}, hi = {px4-7, px12-15}.
+        const __m256i lo = _mm256_shuffle_epi8(in, shuffleLo);
+        const __m256i hi = _mm256_shuffle_epi8(in, shuffleHi);
+
+        __m256i *out = reinterpret_cast<__m256i *>(dest + x * 4);
+        _mm256_storeu_si256(out + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41
+size_t Load32FTo16FRowSSE41(const float *source, uint16_t *dest, size_t count)
+{
+    const __m128i valueMask    = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i signMask     = _mm_set1_epi32(0x8000);
+    const __m128i one          = _mm_set1_epi32(1);
+    const __m128i rebias       = _mm_set1_epi32(static_cast<int>(0xC8000FFF));
+    const __m128i minNormal    = _mm_set1_epi32(0x38800000);
+    const __m128i minDenormal  = _mm_set1_epi32(0x2D000000);
+    const __m128i maxFinite    = _mm_set1_epi32(0x47FFEFFF);
+    const __m128i infinity     = _mm_set1_epi32(0x7F800000);
+    const __m128i infinityHalf = _mm_set1_epi32(0x7C00);
+    const __m128i nanHalf      = _mm_set1_epi32(0x7FFF);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        const __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), signMask);
+        const __m128i abs  = _mm_and_si128(bits, valueMask);
+
+        // |abs| is non-negative, so signed comparisons are safe.
+        const __m128i isSmall  = _mm_cmplt_epi32(abs, minNormal);
+        const __m128i isDenorm = _mm_andnot_si128(_mm_cmplt_epi32(abs, minDenormal), isSmall);
+        if (_mm_movemask_epi8(isDenorm) != 0)
+        {
+            // Denormal halves need a per-lane shift, which SSE4.1 doesn't have.
+            for (size_t i = 0; i < 4; ++i)
+            {
+                dest[x + i] = gl::float32ToFloat16(source[x + i]);
+            }
+            continue;
+        }
+
+        const __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, 13), one);
+        __m128i result =
+            _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, rebias), roundBit), 13);
+        // Values too small for a denormal half round to (signed) zero.
+        result = _mm_andnot_si128(isSmall, result);
+        result = _mm_or_si128(result, sign);
+        result = _mm_blendv_epi8(result, _mm_or_si128(sign, infinityHalf),
+                                 _mm_cmpgt_epi32(abs, maxFinite));
+        result = _mm_blendv_epi8(result, nanHalf, _mm_cmpgt_epi32(abs, infinity));
+
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dest + x), _mm_packus_epi32(result, result));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2
+size_t Load32FTo16FRowAVX2(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + x));
+        const __m256i result = Float32ToFloat16AVX2(bits);
+
+        // packus works within 128-bit lanes; gather the two low halves into the first lane.
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), _mm256_castsi256_si128(packed));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41
+size_t LoadRGB16FToRG11B10FRowSSE41(const uint16_t *source, uint32_t *dest, size_t width)
+{
+    // Four pixels are twelve halves: eight in the first load and four in the second.  Each
+    // channel is gathered into 32-bit lanes from both.
+    const __m128i redLo   = _mm_setr_epi8(0, 1, -1, -1, 6, 7, -1, -1, 12, 13, -1, -1, -1, -1, -1,
+                                          -1);
+    const __m128i redHi   = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3,
+                                          -1, -1);
+    const __m128i greenLo = _mm_setr_epi8(2, 3, -1, -1, 8, 9, -1, -1, 14, 15, -1, -1, -1, -1, -1,
+                                          -1);
+    const __m128i greenHi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5,
+                                          -1, -1);
+    const __m128i blueLo  = _mm_setr_epi8(4, 5, -1, -1, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                          -1);
+    const __m128i blueHi  = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 1, -1, -1, 6, 7, -1,
+                                          -1);
+
+    const __m128i one         = _mm_set1_epi32(1);
+    const __m128i zero        = _mm_setzero_si128();
+    const __m128i minNormal   = _mm_set1_epi32(kMinNormalHalf);
+    const __m128i maxFloat11  = _mm_set1_epi32(kMaxHalfForFloat11);
+    const __m128i maxFloat10  = _mm_set1_epi32(kMaxHalfForFloat10);
+    const __m128i float11Bias = _mm_set1_epi32(0xFFFF);
+    const __m128i float10Bias = _mm_set1_epi32(0x1FFFF);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint16_t *in = source + x * 3;
+        const __m128i lo   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+        const __m128i hi   = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in + 8));
+
+        const __m128i red =
+            _mm_or_si128(_mm_shuffle_epi8(lo, redLo), _mm_shuffle_epi8(hi, redHi));
+        const __m128i green =
+            _mm_or_si128(_mm_shuffle_epi8(lo, greenLo), _mm_shuffle_epi8(hi, greenHi));
+        const __m128i blue =
+            _mm_or_si128(_mm_shuffle_epi8(lo, blueLo), _mm_shuffle_epi8(hi, blueHi));
+
+        // Lanes outside the range where the fast path is exact: denormals, and anything above the
+        // maximum (which includes negative values, INF and NaN).
+        const __m128i redDenorm =
+            _mm_and_si128(_mm_cmpgt_epi32(red, zero), _mm_cmplt_epi32(red, minNormal));
+        const __m128i greenDenorm =
+            _mm_and_si128(_mm_cmpgt_epi32(green, zero), _mm_cmplt_epi32(green, minNormal));
+        const __m128i blueDenorm =
+            _mm_and_si128(_mm_cmpgt_epi32(blue, zero), _mm_cmplt_epi32(blue, minNormal));
+        const __m128i slowLanes = _mm_or_si128(
+            _mm_or_si128(_mm_or_si128(redDenorm, greenDenorm), blueDenorm),
+            _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(red, maxFloat11),
+                                      _mm_cmpgt_epi32(green, maxFloat11)),
+                         _mm_cmpgt_epi32(blue, maxFloat10)));
+        if (_mm_movemask_epi8(slowLanes) != 0)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                dest[x + i] = ConvertRGB16FToRG11B10F(in + i * 3);
+            }
+            continue;
+        }
+
+        const __m128i red11 = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(red, 13), float11Bias),
+                          _mm_and_si128(_mm_srli_epi32(red, 4), one)),
+            17);
+        const __m128i green11 = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(green, 13), float11Bias),
+                          _mm_and_si128(_mm_srli_epi32(green, 4), one)),
+            17);
+        const __m128i blue10 = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(blue, 13), float10Bias),
+                          _mm_and_si128(_mm_srli_epi32(blue, 5), one)),
+            18);
+
+        const __m128i result = _mm_or_si128(
+            _mm_or_si128(red11, _mm_slli_epi32(green11, 11)), _mm_slli_epi32(blue10, 22));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), result);
+    }
+    return x;
+}
+#endif  // defined(ANGLE_SIMD_X86)
+
+#if defined(ANGLE_SIMD_NEON)
+size_t LoadRGB8ToRGBX8RowNEON(const uint8_t *source,
+                              uint8_t *dest,
+                              size_t width,
+                              uint8_t fourthValue,
+                              bool swapRB)
+{
+    const uint8x16_t fourth = vdupq_n_u8(fourthValue);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x3_t in = vld3q_u8(source + x * 3);
+        uint8x16x4_t out;
+        out.val[0] = swapRB ? in.val[2] : in.val[0];
+        out.val[1] = in.val[1];
+        out.val[2] = swapRB ? in.val[0] : in.val[2];
+        out.val[3] = fourth;
+        vst4q_u8(dest + x * 4, out);
+    }
+    return x;
+}
+
+size_t LoadRGBA8ToBGRA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(source + x * 4);
+        const uint8x16_t r  = pixels.val[0];
+        pixels.val[0]       = pixels.val[2];
+        pixels.val[2]       = r;
+        vst4q_u8(dest + x * 4, pixels);
+    }
+    return x;
+}
+
+size_t LoadLA8ToRGBA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x2_t in = vld2q_u8(source + x * 2);
+        uint8x16x4_t out;
+        out.val[0] = in.val[0];
+        out.val[1] = in.val[0];
+        out.val[2] = in.val[0];
+        out.val[3] = in.val[1];
+        vst4q_u8(dest + x * 4, out);
+    }
+    return x;
+}
+
+size_t Load32FTo16FRowNEON(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        const uint32x4_t bits = vld1q_u32(reinterpret_cast<const uint32_t *>(source + x));
+        vst1_u16(dest + x, vmovn_u32(Float32ToFloat16NEON(bits)));
+    }
+    return x;
+}
+
+size_t LoadRGB16FToRG11B10FRowNEON(const uint16_t *source, uint32_t *dest, size_t width)
+{
+    const uint32x4_t one         = vdupq_n_u32(1);
+    const uint32x4_t minNormal   = vdupq_n_u32(kMinNormalHalf);
+    const uint32x4_t maxFloat11  = vdupq_n_u32(kMaxHalfForFloat11);
+    const uint32x4_t maxFloat10  = vdupq_n_u32(kMaxHalfForFloat10);
+    const uint32x4_t float11Bias = vdupq_n_u32(0xFFFF);
+    const uint32x4_t float10Bias = vdupq_n_u32(0x1FFFF);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint16_t *in     = source + x * 3;
+        const uint16x4x3_t rgb = vld3_u16(in);
+        const uint32x4_t red   = vmovl_u16(rgb.val[0]);
+        const uint32x4_t green = vmovl_u16(rgb.val[1]);
+        const uint32x4_t blue  = vmovl_u16(rgb.val[2]);
+
+        // See LoadRGB16FToRG11B10FRowSSE41 for the lanes that need the scalar path.
+        const uint32x4_t redDenorm   = vandq_u32(vtstq_u32(red, red), vcltq_u32(red, minNormal));
+        const uint32x4_t greenDenorm =
+            vandq_u32(vtstq_u32(green, green), vcltq_u32(green, minNormal));
+        const uint32x4_t blueDenorm =
+            vandq_u32(vtstq_u32(blue, blue), vcltq_u32(blue, minNormal));
+        const uint32x4_t slowLanes =
+            vorrq_u32(vorrq_u32(vorrq_u32(redDenorm, greenDenorm), blueDenorm),
+                      vorrq_u32(vorrq_u32(vcgtq_u32(red, maxFloat11), vcgtq_u32(green, maxFloat11)),
+                                vcgtq_u32(blue, maxFloat10)));
+        if (vmaxvq_u32(slowLanes) != 0)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                dest[x + i] = ConvertRGB16FToRG11B10F(in + i * 3);
+            }
+            continue;
+        }
+
+        const uint32x4_t red11 = vshrq_n_u32(
+            vaddq_u32(vaddq_u32(vshlq_n_u32(red, 13), float11Bias),
+                      vandq_u32(vshrq_n_u32(red, 4), one)),
+            17);
+        const uint32x4_t green11 = vshrq_n_u32(
+            vaddq_u32(vaddq_u32(vshlq_n_u32(green, 13), float11Bias),
+                      vandq_u32(vshrq_n_u32(green, 4), one)),
+            17);
+        const uint32x4_t blue10 = vshrq_n_u32(
+            vaddq_u32(vaddq_u32(vshlq_n_u32(blue, 13), float10Bias),
+                      vandq_u32(vshrq_n_u32(blue, 5), one)),
+            18);
+
+        vst1q_u32(dest + x, vorrq_u32(vorrq_u32(red11, vshlq_n_u32(green11, 11)),
+                                      vshlq_n_u32(blue10, 22)));
+    }
+    return x;
+}
+#endif  // defined(ANGLE_SIMD_NEON)
+}  // anonymous namespace
+
+size_t LoadRGB8ToRGBX8Row(const uint8_t *source,
+                          uint8_t *dest,
+                          size_t width,
+                          uint8_t fourthValue,
+                          bool swapRB)
+{
+    size_t x = 0;
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::AVX2))
+    {
+        x = LoadRGB8ToRGBX8RowAVX2(source, dest, width, fourthValue, swapRB);
+    }
+    if (HasCPUFeature(CPUFeature::SSE41))
+    {
+        x += LoadRGB8ToRGBX8RowSSE41(source + x * 3, dest + x * 4, width - x, fourthValue, swapRB);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        x = LoadRGB8ToRGBX8RowNEON(source, dest, width, fourthValue, swapRB);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGBA8ToBGRA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::AVX2))
+    {
+        x = LoadRGBA8ToBGRA8RowAVX2(source, dest, width);
+    }
+    if (HasCPUFeature(CPUFeature::SSE41))
+    {
+        x += LoadRGBA8ToBGRA8RowSSE41(source + x * 4, dest + x * 4, width - x);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        x = LoadRGBA8ToBGRA8RowNEON(source, dest, width);
+    }
+#endif
+    return x;
+}
+
+size_t LoadLA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::AVX2))
+    {
+        x = LoadLA8ToRGBA8RowAVX2(source, dest, width);
+    }
+    if (HasCPUFeature(CPUFeature::SSE41))
+    {
+        x += LoadLA8ToRGBA8RowSSE41(source + x * 2, dest + x * 4, width - x);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        x = LoadLA8ToRGBA8RowNEON(source, dest, width);
+    }
+#endif
+    return x;
+}
+
+size_t Load32FTo16FRow(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::AVX2))
+    {
+        x = Load32FTo16FRowAVX2(source, dest, count);
+    }
+    if (HasCPUFeature(CPUFeature::SSE41))
+    {
+        x += Load32FTo16FRowSSE41(source + x, dest + x, count - x);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        x = Load32FTo16FRowNEON(source, dest, count);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGB16FToRG11B10FRow(const uint16_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_SIMD_X86)
+    if (HasCPUFeature(CPUFeature::SSE41))
+    {
+        x = LoadRGB16FToRG11B10FRowSSE41(source, dest, width);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (HasCPUFeature(CPUFeature::NEON))
+    {
+        x = LoadRGB16FToRG11B10FRowNEON(source, dest, width);
+    }
+#endif
+    return x;
+}
+}  // namespace priv
+}  // namespace angle
@@ -0,0 +1,45 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.h: Vectorized row kernels used by the image loading functions.
+//
+// Each kernel converts a prefix of a single row and returns the number of pixels (or, for
+// Load32FTo16FRow, elements) that it wrote.  The caller converts the remainder of the row with
+// its scalar loop, so the kernels return 0 when no suitable instruction set is available.  The
+// results are bit-identical to the scalar code.
+
+#ifndef IMAGEUTIL_LOADIMAGE_SIMD_H_
+#define IMAGEUTIL_LOADIMAGE_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+namespace priv
+{
+// RGB8 -> RGBA8 with a constant fourth component.  If |swapRB| is set, the output is BGRA8.
+size_t LoadRGB8ToRGBX8Row(const uint8_t *source,
+                          uint8_t *dest,
+                          size_t width,
+                          uint8_t fourthValue,
+                          bool swapRB);
+
+// RGBA8 -> BGRA8.
+size_t LoadRGBA8ToBGRA8Row(const uint8_t *source, uint8_t *dest, size_t width);
+
+// LA8 -> RGBA8, replicating luminance into the color channels.
+size_t LoadLA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width);
+
+// float32 -> float16, element-wise, matching gl::float32ToFloat16.
+size_t Load32FTo16FRow(const float *source, uint16_t *dest, size_t count);
+
+// RGB16F -> R11G11B10F, matching gl::float32ToFloat11/10(gl::float16ToFloat32(x)).
+size_t LoadRGB16FToRG11B10FRow(const uint16_t *source, uint32_t *dest, size_t width);
+}  // namespace priv
+}  // namespace angle
+
+#endif  // IMAGEUTIL_LOADIMAGE_SIMD_H_
@@ -8,50 +8,452 @@
 // disk.  MemoryProgramCache uses this to handle caching of compiled programs.
 
 #include "libANGLE/BlobCache.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/WorkerThread.h"
+#include "common/unsafe_buffers.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCacheDiskStore.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/histogram_macros.h"
+#include "libANGLE/trace.h"
 #include "platform/PlatformMethods.h"
 
 namespace egl
 {
+namespace
+{
+// Small blobs are compressed on the calling thread, as that's cheaper than posting a task.
+constexpr size_t kMinBackgroundCompressionSize = 16 * 1024;
+// Past this many bytes of blobs waiting to be compressed, new blobs are compressed on the calling
+// thread to bound the memory used by uncompressed blobs.
+constexpr size_t kMaxPendingBlobsSize = 32 * 1024 * 1024;
+
+// Returns a shared copy of |value|, or null if it can't be allocated.  A null value queued for the
+// on-disk store removes any older copy of the blob from the store, so that it's not found stale.
+std::shared_ptr<const angle::MemoryBuffer> CopySharedBlob(const angle::MemoryBuffer &value)
+{
+    auto copy = std::make_shared<angle::MemoryBuffer>();
+    if (!copy->resize(value.size()))
+    {
+        return nullptr;
+    }
+    ANGLE_UNSAFE_TODO(memcpy(copy->data(), value.data(), value.size()));
+    return copy;
+}
+}  // anonymous namespace
+
+class BlobCache::CompressTask final : public angle::Closure
+{
+  public:
+    CompressTask(BlobCache *blobCache,
+                 const BlobCache::Key &key,
+                 const std::shared_ptr<PendingBlob> &blob)
+        : mBlobCache(blobCache), mKey(key), mBlob(blob)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "BlobCache::CompressTask");
+        mBlobCache->finishCompression(mKey, mBlob);
+    }
+
+  private:
+    BlobCache *mBlobCache;
+    BlobCache::Key mKey;
+    std::shared_ptr<PendingBlob> mBlob;
+};
+
+class BlobCache::DiskWriteTask final : public angle::Closure
+{
+  public:
+    DiskWriteTask(BlobCache *blobCache) : mBlobCache(blobCache) {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "BlobCache::DiskWriteTask");
+        mBlobCache->flushDiskStoreUpdates();
+    }
+
+  private:
+    BlobCache *mBlobCache;
+};
+
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
-{}
+    : mMaxSize(maxCacheSizeBytes),
+      mSize(0),
+      mUseCounter(0),
+      mPendingBlobCount(0),
+      mPendingBlobsSize(0),
+      mHasDiskStore(false),
+      mHasCompressionThreadPool(false),
+      mCompressedBlobNotificationCount(0),
+      mDiskWriteScheduled(false),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr),
+      mBlobCacheFuncsSet(false)
+{
+    for (Shard &shard : mShards)
+    {
+        shard.cache.resize(maxCacheSizeBytes);
+    }
+}
+
+BlobCache::~BlobCache()
+{
+    // The compression and disk write tasks reference this object.
+    finishPendingCompression();
+    finishPendingDiskWrites();
+}
+
+void BlobCache::setCompressionThreadPool(std::shared_ptr<angle::WorkerThreadPool> threadPool)
+{
+    finishPendingCompression();
 
-BlobCache::~BlobCache() {}
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mCompressionThreadPool = threadPool && threadPool->isAsync() ? std::move(threadPool) : nullptr;
+    mHasCompressionThreadPool.store(mCompressionThreadPool != nullptr, std::memory_order_relaxed);
+}
+
+void BlobCache::setDiskStore(std::unique_ptr<BlobCacheDiskStore> diskStore)
+{
+    // The compression tasks may be queuing writes to the current store.
+    finishPendingCompression();
+    finishPendingDiskWrites();
+
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    mDiskStore = std::move(diskStore);
+    mHasDiskStore.store(mDiskStore != nullptr, std::memory_order_release);
+}
+
+void BlobCache::setDiskWriteThreadPool(std::shared_ptr<angle::WorkerThreadPool> threadPool)
+{
+    finishPendingDiskWrites();
+
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mDiskWriteThreadPool = threadPool && threadPool->isAsync() ? std::move(threadPool) : nullptr;
+}
+
+void BlobCache::finishPendingDiskWrites()
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        waitEvents = mDiskWriteWaitEvents;
+    }
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
 
 void BlobCache::put(const gl::Context *context,
                     const BlobCache::Key &key,
                     angle::MemoryBuffer &&value)
 {
+    // Don't let an older blob that is still being compressed overwrite this one.
+    erasePendingBlob(key);
+
     if (areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()))
     {
         putApplication(context, key, value);
     }
     else
     {
+        putDiskStore(key, value);
         populate(key, std::move(value), CacheSource::Memory);
     }
 }
 
+bool BlobCache::mayCompressInBackground(const gl::Context *context, size_t size) const
+{
+    // Blobs for the context's callbacks are handed over right away, as the context may not outlive
+    // a background task.
+    const bool usesContextCallbacks = context && context->areBlobCacheFuncsSet();
+    return !usesContextCallbacks && size >= kMinBackgroundCompressionSize &&
+           mHasCompressionThreadPool.load(std::memory_order_relaxed);
+}
+
+bool BlobCache::compressAndPut(const gl::Context *context,
+                               const BlobCache::Key &key,
+                               const angle::MemoryBuffer &uncompressedValue,
+                               CompressedBlobCallback compressedCallback)
+{
+    if (mayCompressInBackground(context, uncompressedValue.size()))
+    {
+        angle::MemoryBuffer uncompressedCopy;
+        if (uncompressedCopy.resize(uncompressedValue.size()))
+        {
+            ANGLE_UNSAFE_TODO(memcpy(uncompressedCopy.data(), uncompressedValue.data(),
+                                     uncompressedValue.size()));
+            return compressAndPut(context, key, std::move(uncompressedCopy), compressedCallback);
+        }
+    }
+
+    return compressAndPutImpl(context, key, uncompressedValue, compressedCallback);
+}
+
 bool BlobCache::compressAndPut(const gl::Context *context,
                                const BlobCache::Key &key,
                                angle::MemoryBuffer &&uncompressedValue,
-                               size_t *compressedSize)
+                               CompressedBlobCallback compressedCallback)
+{
+    notifyCompressedBlobs();
+
+    if (mayCompressInBackground(context, uncompressedValue.size()))
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+
+        const size_t size = uncompressedValue.size();
+        if (mCompressionThreadPool &&
+            mPendingBlobsSize.load(std::memory_order_relaxed) + size <= kMaxPendingBlobsSize)
+        {
+            auto blob                = std::make_shared<PendingBlob>();
+            blob->uncompressedValue  = std::move(uncompressedValue);
+            blob->compressedCallback = compressedCallback;
+            blob->postingThread      = std::this_thread::get_id();
+
+            // The task can't complete before the blob is recorded below, as that needs the lock.
+            blob->waitEvent = mCompressionThreadPool->postWorkerTask(
+                std::make_shared<CompressTask>(this, key, blob),
+                angle::WorkerTaskPriority::CacheCompression);
+            if (blob->waitEvent)
+            {
+                {
+                    Shard &shard = getShard(key);
+                    std::scoped_lock<angle::SimpleMutex> shardLock(shard.mutex);
+
+                    auto iter = shard.pendingBlobs.find(key);
+                    if (iter != shard.pendingBlobs.end())
+                    {
+                        // The older blob's task finds it replaced and drops it.
+                        mPendingBlobsSize.fetch_sub(iter->second->uncompressedValue.size(),
+                                                    std::memory_order_relaxed);
+                        iter->second = blob;
+                    }
+                    else
+                    {
+                        shard.pendingBlobs.emplace(key, blob);
+                        mPendingBlobCount.fetch_add(1, std::memory_order_release);
+                    }
+                    mPendingBlobsSize.fetch_add(size, std::memory_order_relaxed);
+
+                    // An older compressed copy is now stale.
+                    eraseMemoryLocked(&shard, key);
+                }
+
+                mCompressionWaitEvents.erase(
+                    std::remove_if(mCompressionWaitEvents.begin(), mCompressionWaitEvents.end(),
+                                   [](const std::shared_ptr<angle::WaitableEvent> &waitEvent) {
+                                       return waitEvent->isReady();
+                                   }),
+                    mCompressionWaitEvents.end());
+                mCompressionWaitEvents.push_back(blob->waitEvent);
+                return true;
+            }
+
+            uncompressedValue = std::move(blob->uncompressedValue);
+        }
+    }
+
+    return compressAndPutImpl(context, key, uncompressedValue, compressedCallback);
+}
+
+bool BlobCache::compressAndPutImpl(const gl::Context *context,
+                                   const BlobCache::Key &key,
+                                   const angle::MemoryBuffer &uncompressedValue,
+                                   CompressedBlobCallback compressedCallback)
 {
     angle::MemoryBuffer compressedValue;
     if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue))
     {
         return false;
     }
-    if (compressedSize != nullptr)
-        *compressedSize = compressedValue.size();
+
+    if (compressedCallback != nullptr)
+    {
+        compressedCallback(key, compressedValue);
+    }
+
     put(context, key, std::move(compressedValue));
     return true;
 }
 
+void BlobCache::finishCompression(const BlobCache::Key &key,
+                                  const std::shared_ptr<PendingBlob> &blob)
+{
+    angle::MemoryBuffer compressedValue;
+    const bool compressed = angle::CompressBlob(blob->uncompressedValue.size(),
+                                                blob->uncompressedValue.data(), &compressedValue);
+
+    // The copies for the on-disk store and for the callback are made before taking the lock.
+    std::shared_ptr<const angle::MemoryBuffer> diskStoreValue;
+    const bool hasDiskStore = compressed && mHasDiskStore.load(std::memory_order_acquire);
+    if (hasDiskStore)
+    {
+        diskStoreValue = CopySharedBlob(compressedValue);
+    }
+    std::shared_ptr<const angle::MemoryBuffer> callbackValue;
+    if (compressed && blob->compressedCallback != nullptr)
+    {
+        callbackValue = CopySharedBlob(compressedValue);
+    }
+
+    // Room is also made in the memory cache before taking the locks, as that may evict blobs from
+    // other shards.
+    const size_t compressedSize = compressedValue.size();
+    const bool reserved         = compressed && reserveMemory(compressedSize);
+
+    // The application's callback is made once the locks are released, so that it neither blocks
+    // the lookups nor deadlocks if it calls back into the cache.
+    EGLSetBlobFuncANDROID setBlobFunc = nullptr;
+    bool storedInMemory               = false;
+    bool flushDiskStore               = false;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        Shard &shard = getShard(key);
+        std::scoped_lock<angle::SimpleMutex> shardLock(shard.mutex);
+
+        // Drop the blob if it was removed or replaced in the meantime.
+        auto iter = shard.pendingBlobs.find(key);
+        if (iter != shard.pendingBlobs.end() && iter->second == blob)
+        {
+            erasePendingBlobLocked(&shard, key);
+
+            if (!compressed)
+            {
+                WARN() << "Failed to compress blob for the blob cache";
+            }
+            else
+            {
+                if (callbackValue)
+                {
+                    mCompressedBlobNotifications.push_back(
+                        {key, blob->compressedCallback, blob->postingThread, callbackValue});
+                    mCompressedBlobNotificationCount.fetch_add(1, std::memory_order_release);
+                }
+
+                if (mSetBlobFunc != nullptr)
+                {
+                    setBlobFunc = mSetBlobFunc;
+                }
+                else
+                {
+                    if (hasDiskStore)
+                    {
+                        flushDiskStore = queueDiskStoreUpdate(key, std::move(diskStoreValue));
+                    }
+                    if (reserved)
+                    {
+                        insertMemoryLocked(&shard, key, std::move(compressedValue),
+                                           CacheSource::Memory);
+                        storedInMemory = true;
+                    }
+                }
+            }
+        }
+    }
+
+    if (reserved && !storedInMemory)
+    {
+        mSize.fetch_sub(compressedSize, std::memory_order_relaxed);
+    }
+    if (setBlobFunc != nullptr)
+    {
+        setBlobFunc(key.data(), key.size(), compressedValue.data(), compressedValue.size());
+    }
+    if (flushDiskStore)
+    {
+        flushDiskStoreUpdates();
+    }
+}
+
+void BlobCache::waitForPendingBlob(const BlobCache::Key &key) const
+{
+    if (!hasPendingBlobs())
+    {
+        return;
+    }
+
+    std::shared_ptr<angle::WaitableEvent> waitEvent;
+    {
+        const Shard &shard = getShard(key);
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        auto iter = shard.pendingBlobs.find(key);
+        if (iter == shard.pendingBlobs.end())
+        {
+            return;
+        }
+        waitEvent = iter->second->waitEvent;
+    }
+    waitEvent->wait();
+}
+
+void BlobCache::notifyCompressedBlobs() const
+{
+    if (mCompressedBlobNotificationCount.load(std::memory_order_acquire) == 0)
+    {
+        return;
+    }
+
+    const std::thread::id thisThread = std::this_thread::get_id();
+    std::vector<CompressedBlobNotification> notifications;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        auto otherThreads = std::stable_partition(
+            mCompressedBlobNotifications.begin(), mCompressedBlobNotifications.end(),
+            [thisThread](const CompressedBlobNotification &notification) {
+                return notification.postingThread != thisThread;
+            });
+        notifications.assign(std::make_move_iterator(otherThreads),
+                             std::make_move_iterator(mCompressedBlobNotifications.end()));
+        mCompressedBlobNotifications.erase(otherThreads, mCompressedBlobNotifications.end());
+        mCompressedBlobNotificationCount.store(mCompressedBlobNotifications.size(),
+                                               std::memory_order_release);
+    }
+
+    for (const CompressedBlobNotification &notification : notifications)
+    {
+        notification.compressedCallback(notification.key, *notification.compressedValue);
+    }
+}
+
+void BlobCache::finishPendingCompression() const
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        waitEvents = mCompressionWaitEvents;
+    }
+    angle::WaitableEvent::WaitMany(&waitEvents);
+
+    notifyCompressedBlobs();
+}
+
+void BlobCache::erasePendingBlob(const BlobCache::Key &key)
+{
+    if (!hasPendingBlobs())
+    {
+        return;
+    }
+
+    Shard &shard = getShard(key);
+    std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+    erasePendingBlobLocked(&shard, key);
+}
+
+void BlobCache::erasePendingBlobLocked(Shard *shard, const BlobCache::Key &key)
+{
+    auto iter = shard->pendingBlobs.find(key);
+    if (iter != shard->pendingBlobs.end())
+    {
+        mPendingBlobsSize.fetch_sub(iter->second->uncompressedValue.size(),
+                                    std::memory_order_relaxed);
+        shard->pendingBlobs.erase(iter);
+        mPendingBlobCount.fetch_sub(1, std::memory_order_release);
+    }
+}
+
 void BlobCache::putApplication(const gl::Context *context,
                                const BlobCache::Key &key,
                                const angle::MemoryBuffer &value)
@@ -64,22 +466,302 @@ void BlobCache::putApplication(const gl::Context *context,
         contextCallbacks.setFunction(key.data(), key.size(), value.data(), value.size(),
                                      contextCallbacks.userParam);
     }
-    else if (areBlobCacheFuncsSet())
+    else
+    {
+        {
+            std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+            if (mSetBlobFunc != nullptr)
+            {
+                mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
+                return;
+            }
+        }
+        putDiskStore(key, value);
+    }
+}
+
+void BlobCache::putDiskStore(const BlobCache::Key &key, const angle::MemoryBuffer &value)
+{
+    if (!mHasDiskStore.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::shared_ptr<const angle::MemoryBuffer> diskStoreValue = CopySharedBlob(value);
+    bool flushDiskStore;
     {
         std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-        mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
+        flushDiskStore = queueDiskStoreUpdate(key, std::move(diskStoreValue));
+    }
+    if (flushDiskStore)
+    {
+        flushDiskStoreUpdates();
     }
 }
 
-void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
+void BlobCache::removeDiskStore(const BlobCache::Key &key)
+{
+    if (!mHasDiskStore.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    bool flushDiskStore;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        flushDiskStore = queueDiskStoreUpdate(key, nullptr);
+    }
+    if (flushDiskStore)
+    {
+        flushDiskStoreUpdates();
+    }
+}
+
+bool BlobCache::queueDiskStoreUpdate(const BlobCache::Key &key,
+                                     std::shared_ptr<const angle::MemoryBuffer> &&value)
+{
+    // Called with |mBlobCacheMutex| held.  Returns whether the caller should write the updates
+    // itself once it releases the lock, because there is no thread pool to do it.
+    mPendingDiskStoreUpdates[key] = std::move(value);
+
+    if (mDiskWriteScheduled)
+    {
+        // The task that's already posted picks this update up.
+        return false;
+    }
+    if (mDiskWriteThreadPool)
+    {
+        std::shared_ptr<angle::WaitableEvent> waitEvent = mDiskWriteThreadPool->postWorkerTask(
+            std::make_shared<DiskWriteTask>(this), angle::WorkerTaskPriority::CacheCompression);
+        if (waitEvent)
+        {
+            mDiskWriteWaitEvents.erase(
+                std::remove_if(mDiskWriteWaitEvents.begin(), mDiskWriteWaitEvents.end(),
+                               [](const std::shared_ptr<angle::WaitableEvent> &event) {
+                                   return event->isReady();
+                               }),
+                mDiskWriteWaitEvents.end());
+            mDiskWriteWaitEvents.push_back(std::move(waitEvent));
+            mDiskWriteScheduled = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+void BlobCache::flushDiskStoreUpdates()
+{
+    // The store's lock is held while the updates are written, so that they are applied in the
+    // order they were queued.  The cache's lock is only taken to grab the queued updates.
+    std::scoped_lock<angle::SimpleMutex> diskStoreLock(mDiskStoreMutex);
+    while (true)
+    {
+        angle::HashMap<BlobCache::Key, std::shared_ptr<const angle::MemoryBuffer>> updates;
+        {
+            std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+            if (mPendingDiskStoreUpdates.empty())
+            {
+                mDiskWriteScheduled = false;
+                return;
+            }
+            updates.swap(mPendingDiskStoreUpdates);
+        }
+
+        if (!mDiskStore)
+        {
+            continue;
+        }
+
+        ANGLE_TRACE_EVENT0("gpu.angle", "BlobCache::flushDiskStoreUpdates");
+        for (const auto &update : updates)
+        {
+            if (update.second)
+            {
+                mDiskStore->put(update.first, angle::Span<const uint8_t>(update.second->data(),
+                                                                         update.second->size()));
+            }
+            else
+            {
+                mDiskStore->remove(update.first);
+            }
+        }
+    }
+}
+
+bool BlobCache::getPendingDiskStoreUpdate(
+    const BlobCache::Key &key,
+    std::shared_ptr<const angle::MemoryBuffer> *valueOut) const
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    CacheEntry newEntry;
-    newEntry.first  = std::move(value);
-    newEntry.second = source;
+    auto iter = mPendingDiskStoreUpdates.find(key);
+    if (iter == mPendingDiskStoreUpdates.end())
+    {
+        return false;
+    }
+    *valueOut = iter->second;
+    return true;
+}
 
+void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
+{
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    putMemory(key, std::move(value), source);
+}
+
+BlobCache::Shard &BlobCache::getShard(const BlobCache::Key &key)
+{
+    // The keys are hashes, so any of their bytes is evenly distributed.
+    return mShards[key[0] % kShardCount];
+}
+
+const BlobCache::Shard &BlobCache::getShard(const BlobCache::Key &key) const
+{
+    return mShards[key[0] % kShardCount];
+}
+
+void BlobCache::putMemory(const BlobCache::Key &key,
+                          angle::MemoryBuffer &&value,
+                          CacheSource source)
+{
+    if (!reserveMemory(value.size()))
+    {
+        return;
+    }
+
+    Shard &shard = getShard(key);
+    std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+    insertMemoryLocked(&shard, key, std::move(value), source);
+}
+
+bool BlobCache::reserveMemory(size_t size)
+{
+    const size_t limit = maxSize();
+    if (size > limit)
+    {
+        return false;
+    }
+
+    size_t currentSize = mSize.load(std::memory_order_relaxed);
+    while (true)
+    {
+        if (currentSize + size <= limit)
+        {
+            if (mSize.compare_exchange_weak(currentSize, currentSize + size,
+                                            std::memory_order_relaxed))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        // Give up if nothing can be evicted, as the rest of the budget is reserved by blobs that
+        // are being inserted by other threads.
+        if (evictLeastRecentlyUsedMemory() == 0)
+        {
+            return false;
+        }
+        currentSize = mSize.load(std::memory_order_relaxed);
+    }
+}
+
+void BlobCache::insertMemoryLocked(Shard *shard,
+                                   const BlobCache::Key &key,
+                                   angle::MemoryBuffer &&value,
+                                   CacheSource source)
+{
+    const size_t size       = value.size();
+    const size_t sizeBefore = shard->cache.size();
+
+    CacheEntry newEntry;
+    newEntry.value   = std::move(value);
+    newEntry.source  = source;
+    newEntry.lastUse = nextUse();
+    shard->cache.put(key, std::move(newEntry), size);
+
+    // The blob's size is already reserved in the total, so only the size of the blob it replaced
+    // is released.
+    mSize.fetch_sub(sizeBefore + size - shard->cache.size(), std::memory_order_relaxed);
+}
+
+void BlobCache::eraseMemoryLocked(Shard *shard, const BlobCache::Key &key)
+{
+    const size_t sizeBefore = shard->cache.size();
+    shard->cache.eraseByKey(key);
+    updateMemorySize(sizeBefore, shard->cache.size());
+}
+
+void BlobCache::updateMemorySize(size_t sizeBefore, size_t sizeAfter)
+{
+    if (sizeAfter >= sizeBefore)
+    {
+        mSize.fetch_add(sizeAfter - sizeBefore, std::memory_order_relaxed);
+    }
+    else
+    {
+        mSize.fetch_sub(sizeBefore - sizeAfter, std::memory_order_relaxed);
+    }
+}
+
+size_t BlobCache::evictLeastRecentlyUsedMemory()
+{
+    // Find the shard whose least recently used blob is the oldest.  The shards are locked one at a
+    // time, so this is only approximately LRU when the cache is used concurrently.
+    Shard *oldestShard = nullptr;
+    uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+    for (Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        const CacheEntry *entry;
+        if (shard.cache.peekLeastRecentlyUsed(&entry) && entry->lastUse < oldestUse)
+        {
+            oldestShard = &shard;
+            oldestUse   = entry->lastUse;
+        }
+    }
+
+    if (oldestShard == nullptr)
+    {
+        return 0;
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(oldestShard->mutex);
+    const size_t evictedSize = oldestShard->cache.evictLeastRecentlyUsed();
+    mSize.fetch_sub(evictedSize, std::memory_order_relaxed);
+    return evictedSize;
+}
+
+size_t BlobCache::evictMemoryToSize(size_t limit)
+{
+    size_t freedSize = 0;
+    while (mSize.load(std::memory_order_relaxed) > limit)
+    {
+        const size_t evictedSize = evictLeastRecentlyUsedMemory();
+        if (evictedSize == 0)
+        {
+            break;
+        }
+        freedSize += evictedSize;
+    }
+    return freedSize;
+}
+
+void BlobCache::clearShards()
+{
+    for (Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        for (const auto &pendingBlob : shard.pendingBlobs)
+        {
+            mPendingBlobsSize.fetch_sub(pendingBlob.second->uncompressedValue.size(),
+                                        std::memory_order_relaxed);
+        }
+        mPendingBlobCount.fetch_sub(shard.pendingBlobs.size(), std::memory_order_release);
+        shard.pendingBlobs.clear();
+
+        const size_t sizeBefore = shard.cache.size();
+        shard.cache.clear();
+        updateMemorySize(sizeBefore, 0);
+    }
 }
 
 bool BlobCache::get(const gl::Context *context,
@@ -87,6 +769,11 @@ bool BlobCache::get(const gl::Context *context,
                     const BlobCache::Key &key,
                     BlobCache::Value *valueOut)
 {
+    notifyCompressedBlobs();
+
+    // The compressed blob only exists once compression is done.
+    waitForPendingBlob(key);
+
     // Look into the application's cache, if there is such a cache
     if (areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()))
     {
@@ -125,29 +812,86 @@ bool BlobCache::get(const gl::Context *context,
         return true;
     }
 
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    // Otherwise we are doing caching internally, so try to find it there
-    const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    {
+        // Otherwise we are doing caching internally, so try to find it there
+        Shard &shard = getShard(key);
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        const CacheEntry *entry;
+        if (shard.cache.get(key, &entry))
+        {
+            entry->lastUse = nextUse();
+            *valueOut      = BlobCache::Value(entry->value.data(), entry->value.size());
+            return true;
+        }
+    }
+
+    if (!mHasDiskStore.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    // A blob that is yet to be written is found in the queue.
+    std::shared_ptr<const angle::MemoryBuffer> pendingValue;
+    if (getPendingDiskStoreUpdate(key, &pendingValue))
+    {
+        angle::MemoryBuffer *scratchMemory;
+        if (!pendingValue || !scratchBuffer->get(pendingValue->size(), &scratchMemory))
+        {
+            return false;
+        }
+        ANGLE_UNSAFE_TODO(
+            memcpy(scratchMemory->data(), pendingValue->data(), pendingValue->size()));
+        *valueOut = BlobCache::Value(scratchMemory->data(), pendingValue->size());
+        return true;
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    if (!mDiskStore)
+    {
+        return false;
+    }
 
-    if (result)
+    // The data in the on-disk store is only valid while the lock is held, so it's copied.
+    angle::Span<const uint8_t> diskValue;
+    if (!mDiskStore->get(key, &diskValue))
     {
-        *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
+        return false;
     }
 
-    return result;
+    angle::MemoryBuffer *scratchMemory;
+    if (!scratchBuffer->get(diskValue.size(), &scratchMemory))
+    {
+        ERR() << "Failed to allocate memory for binary blob";
+        return false;
+    }
+    ANGLE_UNSAFE_TODO(memcpy(scratchMemory->data(), diskValue.data(), diskValue.size()));
+    *valueOut = BlobCache::Value(scratchMemory->data(), diskValue.size());
+    return true;
 }
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    const CacheEntry *valueBuf;
-    bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
-    if (result)
+    finishPendingCompression();
+
+    for (Shard &shard : mShards)
     {
-        *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        const size_t shardEntryCount = shard.cache.entryCount();
+        if (index >= shardEntryCount)
+        {
+            index -= shardEntryCount;
+            continue;
+        }
+
+        const CacheEntry *valueBuf;
+        bool result = shard.cache.getAt(index, keyOut, &valueBuf);
+        if (result)
+        {
+            *valueOut = BlobCache::Value(valueBuf->value.data(), valueBuf->value.size());
+        }
+        return result;
     }
-    return result;
+    return false;
 }
 
 BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
@@ -159,6 +903,83 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 {
     ASSERT(uncompressedValueOut);
 
+    notifyCompressedBlobs();
+
+    if (hasPendingBlobs())
+    {
+        // A blob that is still being compressed is returned as is.
+        Shard &shard = getShard(key);
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        auto iter = shard.pendingBlobs.find(key);
+        if (iter != shard.pendingBlobs.end())
+        {
+            const angle::MemoryBuffer &pendingValue = iter->second->uncompressedValue;
+            if (pendingValue.size() > maxUncompressedDataSize ||
+                !uncompressedValueOut->resize(pendingValue.size()))
+            {
+                return GetAndDecompressResult::DecompressFailure;
+            }
+            ANGLE_UNSAFE_TODO(
+                memcpy(uncompressedValueOut->data(), pendingValue.data(), pendingValue.size()));
+            return GetAndDecompressResult::Success;
+        }
+    }
+
+    if (!areBlobCacheFuncsSet() && !(context && context->areBlobCacheFuncsSet()))
+    {
+        // Blobs are decompressed in place, whether in the memory cache or in the file mapped by
+        // the on-disk store.  Only the shard holding the blob is locked in the common case.
+        {
+            Shard &shard = getShard(key);
+            std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+            const CacheEntry *entry;
+            if (shard.cache.get(key, &entry))
+            {
+                entry->lastUse = nextUse();
+                if (!angle::DecompressBlob(entry->value.data(), entry->value.size(),
+                                           maxUncompressedDataSize, uncompressedValueOut))
+                {
+                    return GetAndDecompressResult::DecompressFailure;
+                }
+                return GetAndDecompressResult::Success;
+            }
+        }
+
+        if (!mHasDiskStore.load(std::memory_order_acquire))
+        {
+            return GetAndDecompressResult::NotFound;
+        }
+
+        std::shared_ptr<const angle::MemoryBuffer> pendingValue;
+        if (getPendingDiskStoreUpdate(key, &pendingValue))
+        {
+            if (!pendingValue)
+            {
+                return GetAndDecompressResult::NotFound;
+            }
+            if (!angle::DecompressBlob(pendingValue->data(), pendingValue->size(),
+                                       maxUncompressedDataSize, uncompressedValueOut))
+            {
+                return GetAndDecompressResult::DecompressFailure;
+            }
+            return GetAndDecompressResult::Success;
+        }
+
+        std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+        angle::Span<const uint8_t> compressedValue;
+        if (!mDiskStore || !mDiskStore->get(key, &compressedValue))
+        {
+            return GetAndDecompressResult::NotFound;
+        }
+
+        if (!angle::DecompressBlob(compressedValue.data(), compressedValue.size(),
+                                   maxUncompressedDataSize, uncompressedValueOut))
+        {
+            return GetAndDecompressResult::DecompressFailure;
+        }
+        return GetAndDecompressResult::Success;
+    }
+
     Value compressedValue;
     if (!get(context, scratchBuffer, key, &compressedValue))
     {
@@ -181,8 +1002,65 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    mBlobCache.eraseByKey(key);
+    {
+        Shard &shard = getShard(key);
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        erasePendingBlobLocked(&shard, key);
+        eraseMemoryLocked(&shard, key);
+    }
+    removeDiskStore(key);
+}
+
+void BlobCache::clear()
+{
+    clearShards();
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    mMaxSize.store(maxCacheSizeBytes, std::memory_order_relaxed);
+    clearShards();
+    for (Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        const size_t sizeBefore = shard.cache.size();
+        shard.cache.resize(maxCacheSizeBytes);
+        updateMemorySize(sizeBefore, 0);
+    }
+}
+
+size_t BlobCache::entryCount() const
+{
+    finishPendingCompression();
+
+    size_t count = 0;
+    for (const Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        count += shard.cache.entryCount();
+    }
+    return count;
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    finishPendingCompression();
+
+    return evictMemoryToSize(limit);
+}
+
+size_t BlobCache::size() const
+{
+    finishPendingCompression();
+
+    return mSize.load(std::memory_order_relaxed);
+}
+
+bool BlobCache::empty() const
+{
+    finishPendingCompression();
+
+    return entryCount() == 0;
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
@@ -190,20 +1068,22 @@ void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDRO
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     mSetBlobFunc = set;
     mGetBlobFunc = get;
-}
 
-bool BlobCache::areBlobCacheFuncsSet() const
-{
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     // Either none or both of the callbacks should be set.
     ASSERT((mSetBlobFunc != nullptr) == (mGetBlobFunc != nullptr));
+    mBlobCacheFuncsSet.store(mSetBlobFunc != nullptr && mGetBlobFunc != nullptr,
+                             std::memory_order_release);
+}
 
-    return mSetBlobFunc != nullptr && mGetBlobFunc != nullptr;
+bool BlobCache::areBlobCacheFuncsSet() const
+{
+    return mBlobCacheFuncsSet.load(std::memory_order_acquire);
 }
 
 bool BlobCache::isCachingEnabled(const gl::Context *context) const
 {
-    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) || maxSize() > 0;
+    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) ||
+           maxSize() > 0 || mHasDiskStore.load(std::memory_order_acquire);
 }
 
 size_t BlobCache::callBlobGetCallback(const gl::Context *context,
@@ -6,18 +6,36 @@
 // BlobCache: Stores compiled and linked programs in memory so they don't
 //   always have to be re-compiled. Can be used in conjunction with the platform
 //   layer to warm up the cache from disk.
+//
+//   Without the application's callbacks, the blobs can also be kept in an on-disk store (see
+//   BlobCacheDiskStore), which backs the in-memory cache and persists across runs.
+//
+//   Blobs stored with compressAndPut() can be compressed on a worker thread.  Until then, they
+//   are kept uncompressed in a small "pending" tier, which lookups check before the main cache
+//   (or the application's cache) that holds the compressed blobs.
 
 #ifndef LIBANGLE_BLOB_CACHE_H_
 #define LIBANGLE_BLOB_CACHE_H_
 
 #include <array>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "common/SimpleMutex.h"
+#include "common/hash_containers.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/angletypes.h"
 
+namespace angle
+{
+class WaitableEvent;
+class WorkerThreadPool;
+}  // namespace angle
+
 namespace gl
 {
 class Context;
@@ -25,6 +43,7 @@ class Context;
 
 namespace egl
 {
+class BlobCacheDiskStore;
 
 // Used by MemoryProgramCache and MemoryShaderCache, this result indicates whether program/shader
 // cache load from blob was successful.
@@ -50,21 +69,53 @@ class BlobCache final : angle::NonCopyable
         Disk,
     };
 
+    // Called with each blob once it's compressed, on the thread that passed the blob and without
+    // the cache's locks held.  For a blob compressed in the background, this happens during a later
+    // call from that thread to compressAndPut(), a lookup or finishPendingCompression().
+    using CompressedBlobCallback = void (*)(const BlobCache::Key &key,
+                                            const angle::MemoryBuffer &compressedValue);
+
     explicit BlobCache(size_t maxCacheSizeBytes);
     ~BlobCache();
 
+    // Sets the pool used to compress blobs in the background.  If null or synchronous,
+    // compressAndPut() compresses on the calling thread.  Waits for the blobs that are being
+    // compressed with the previous pool.
+    void setCompressionThreadPool(std::shared_ptr<angle::WorkerThreadPool> threadPool);
+
+    // Sets the on-disk store used when the application doesn't provide blob cache callbacks.  The
+    // blobs stored in the cache are written through to it, and the lookups that miss the memory
+    // cache fall back to it.  Pass nullptr to close the store.
+    void setDiskStore(std::unique_ptr<BlobCacheDiskStore> diskStore);
+
+    // Sets the pool used to write blobs to the on-disk store.  If null or synchronous, the blobs
+    // are written on the calling thread, though without holding the cache's lock.  Waits for the
+    // writes queued with the previous pool.
+    void setDiskWriteThreadPool(std::shared_ptr<angle::WorkerThreadPool> threadPool);
+
+    // Waits until all the blobs stored or removed so far have reached the on-disk store.
+    void finishPendingDiskWrites();
+
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
     // will be used.  Otherwise the value is cached in this object.
     void put(const gl::Context *context, const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
-    // Store a key-blob pair in the cache, but compress the blob before insertion. Returns false if
-    // compression fails, returns true otherwise.
+    // Store a key-blob pair in the cache, but compress the blob before insertion.  If a
+    // compression thread pool is set, the blob may be compressed and stored later; a failure to
+    // compress then drops the blob.  Returns false if compression on the calling thread fails,
+    // returns true otherwise.
     bool compressAndPut(const gl::Context *context,
                         const BlobCache::Key &key,
                         angle::MemoryBuffer &&uncompressedValue,
-                        size_t *compressedSize);
+                        CompressedBlobCallback compressedCallback = nullptr);
+    // Same as above, but the blob is only copied if it's compressed in the background.
+    bool compressAndPut(const gl::Context *context,
+                        const BlobCache::Key &key,
+                        const angle::MemoryBuffer &uncompressedValue,
+                        CompressedBlobCallback compressedCallback = nullptr);
 
     // Store a key-blob pair in the application cache, only if application callbacks are set.
+    // Otherwise, the pair is only stored in the on-disk store, if any.
     void putApplication(const gl::Context *context,
                         const BlobCache::Key &key,
                         const angle::MemoryBuffer &value);
@@ -76,7 +127,8 @@ class BlobCache final : angle::NonCopyable
                   CacheSource source = CacheSource::Disk);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
-    // set, those will be used.  Otherwise they key is looked up in this object's cache.
+    // set, those will be used.  Otherwise they key is looked up in this object's cache.  If the
+    // blob is still being compressed, waits for it.
     [[nodiscard]] bool get(const gl::Context *context,
                            angle::ScratchBuffer *scratchBuffer,
                            const BlobCache::Key &key,
@@ -100,29 +152,33 @@ class BlobCache final : angle::NonCopyable
         size_t maxUncompressedDataSize,
         angle::MemoryBuffer *uncompressedValueOut);
 
-    // Evict a blob from the binary cache.
+    // Evict a blob from the binary cache, including the on-disk store.
     void remove(const BlobCache::Key &key);
 
-    // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    // Empty the cache.  The on-disk store is kept.
+    void clear();
 
-    // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    // Resize the cache. Discards current contents, except for the on-disk store.
+    void resize(size_t maxCacheSizeBytes);
+
+    // Waits until all blobs passed to compressAndPut() are compressed and stored.  The queries
+    // below do this first, so that they include those blobs.
+    void finishPendingCompression() const;
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const;
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const;
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const { return mMaxSize.load(std::memory_order_relaxed); }
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
@@ -133,20 +189,137 @@ class BlobCache final : angle::NonCopyable
     angle::SimpleMutex &getMutex() { return mBlobCacheMutex; }
 
   private:
+    class CompressTask;
+    class DiskWriteTask;
+
+    // A blob waiting to be compressed.
+    struct PendingBlob
+    {
+        angle::MemoryBuffer uncompressedValue;
+        CompressedBlobCallback compressedCallback;
+        std::thread::id postingThread;
+        std::shared_ptr<angle::WaitableEvent> waitEvent;
+    };
+
+    // A blob compressed in the background, waiting for its callback to be made on the thread that
+    // passed it.
+    struct CompressedBlobNotification
+    {
+        BlobCache::Key key;
+        CompressedBlobCallback compressedCallback;
+        std::thread::id postingThread;
+        std::shared_ptr<const angle::MemoryBuffer> compressedValue;
+    };
+
+    bool mayCompressInBackground(const gl::Context *context, size_t size) const;
+    bool compressAndPutImpl(const gl::Context *context,
+                            const BlobCache::Key &key,
+                            const angle::MemoryBuffer &uncompressedValue,
+                            CompressedBlobCallback compressedCallback);
+    void finishCompression(const BlobCache::Key &key, const std::shared_ptr<PendingBlob> &blob);
+    void waitForPendingBlob(const BlobCache::Key &key) const;
+    void notifyCompressedBlobs() const;
+    void putDiskStore(const BlobCache::Key &key, const angle::MemoryBuffer &value);
+    void removeDiskStore(const BlobCache::Key &key);
+    bool queueDiskStoreUpdate(const BlobCache::Key &key,
+                              std::shared_ptr<const angle::MemoryBuffer> &&value);
+    void flushDiskStoreUpdates();
+    bool getPendingDiskStoreUpdate(const BlobCache::Key &key,
+                                   std::shared_ptr<const angle::MemoryBuffer> *valueOut) const;
+    bool hasPendingBlobs() const
+    {
+        return mPendingBlobCount.load(std::memory_order_acquire) > 0;
+    }
+
     size_t callBlobGetCallback(const gl::Context *context,
                                const void *key,
                                size_t keySize,
                                void *value,
                                size_t valueSize);
 
-    // This internal cache is used only if the application is not providing caching callbacks
-    using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
+    // This internal cache is used only if the application is not providing caching callbacks.
+    // It's split into shards by key, each with its own lock and LRU list, so that the contexts
+    // using the cache concurrently rarely contend.  The byte budget is shared by all shards: a
+    // blob's size is reserved in the shared total before it's inserted, evicting the least
+    // recently used blob of the shard holding the oldest one until it fits.  The shards together
+    // thus never exceed the budget, and behave like a single LRU list.
+    struct CacheEntry
+    {
+        angle::MemoryBuffer value;
+        CacheSource source;
+        // Updated by lookups, with the shard's lock held.
+        mutable uint64_t lastUse;
+    };
+
+    struct Shard
+    {
+        Shard() : cache(0) {}
 
+        mutable angle::SimpleMutex mutex;
+        angle::SizedMRUCache<BlobCache::Key, CacheEntry> cache;
+        // Blobs of this shard that are being compressed in the background.
+        angle::HashMap<BlobCache::Key, std::shared_ptr<PendingBlob>> pendingBlobs;
+    };
+    static constexpr size_t kShardCount = 16;
+
+    Shard &getShard(const BlobCache::Key &key);
+    const Shard &getShard(const BlobCache::Key &key) const;
+    uint64_t nextUse() { return mUseCounter.fetch_add(1, std::memory_order_relaxed) + 1; }
+    void putMemory(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source);
+    bool reserveMemory(size_t size);
+    void insertMemoryLocked(Shard *shard,
+                            const BlobCache::Key &key,
+                            angle::MemoryBuffer &&value,
+                            CacheSource source);
+    void eraseMemoryLocked(Shard *shard, const BlobCache::Key &key);
+    void updateMemorySize(size_t sizeBefore, size_t sizeAfter);
+    size_t evictLeastRecentlyUsedMemory();
+    size_t evictMemoryToSize(size_t limit);
+    void erasePendingBlob(const BlobCache::Key &key);
+    void erasePendingBlobLocked(Shard *shard, const BlobCache::Key &key);
+    void clearShards();
+
+    std::array<Shard, kShardCount> mShards;
+    std::atomic<size_t> mMaxSize;
+    std::atomic<size_t> mSize;
+    std::atomic<uint64_t> mUseCounter;
+
+    // The number of blobs being compressed in the background, and the total size of their
+    // uncompressed data.  The count lets lookups skip the shards' pending blobs altogether.
+    std::atomic<size_t> mPendingBlobCount;
+    std::atomic<size_t> mPendingBlobsSize;
+
+    // The on-disk store is only written to by one thread at a time, which applies the updates
+    // queued by the cache in order.  Its lock is taken before |mBlobCacheMutex| when both are held.
+    mutable angle::SimpleMutex mDiskStoreMutex;
+    std::unique_ptr<BlobCacheDiskStore> mDiskStore;
+    std::atomic<bool> mHasDiskStore;
+
+    // Protects everything below.
     mutable angle::SimpleMutex mBlobCacheMutex;
-    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
+
+    // The pool compressing blobs in the background.  The wait events of all outstanding
+    // compression tasks are kept, as blobs that are removed or replaced while being compressed
+    // still have a task referencing the cache.
+    std::shared_ptr<angle::WorkerThreadPool> mCompressionThreadPool;
+    // Lets callers skip copying blobs that would be compressed on the calling thread anyway.
+    std::atomic<bool> mHasCompressionThreadPool;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mCompressionWaitEvents;
+    // The count lets the posting threads skip the lock when no callback is waiting.
+    mutable std::vector<CompressedBlobNotification> mCompressedBlobNotifications;
+    mutable std::atomic<size_t> mCompressedBlobNotificationCount;
+
+    // Updates waiting to be written to the on-disk store, the latest for each key.  A null value
+    // removes the blob.  Lookups check these before the store.
+    std::shared_ptr<angle::WorkerThreadPool> mDiskWriteThreadPool;
+    angle::HashMap<BlobCache::Key, std::shared_ptr<const angle::MemoryBuffer>>
+        mPendingDiskStoreUpdates;
+    bool mDiskWriteScheduled;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mDiskWriteWaitEvents;
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+    std::atomic<bool> mBlobCacheFuncsSet;
 };
 
 }  // namespace egl
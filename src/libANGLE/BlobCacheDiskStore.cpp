@@ -0,0 +1,503 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore.cpp: Implements the on-disk backend of BlobCache.
+
+#include "libANGLE/BlobCacheDiskStore.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/system_utils.h"
+#include "common/unsafe_buffers.h"
+#include "libANGLE/trace.h"
+#include "xxhash.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <stdio.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace egl
+{
+namespace
+{
+constexpr char kFileName[]     = "angle_blob_cache.bin";
+constexpr char kLockFileName[] = "angle_blob_cache.lock";
+
+// The file starts with a FileHeader, followed by the records.  Each record is a RecordHeader
+// followed by the value, padded to kRecordAlignment.  A record with the kRecordRemoved flag has no
+// value, and removes the key's earlier records.
+constexpr uint32_t kFileMagic     = 0x42474E41;  // "ANGB"
+constexpr uint32_t kRecordMagic   = 0x52474E41;  // "ANGR"
+constexpr uint32_t kFormatVersion = 1;
+constexpr uint32_t kRecordRemoved = 1;
+constexpr size_t kRecordAlignment = 8;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t keyLength;
+    uint32_t reserved;
+};
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t flags;
+    uint64_t valueSize;
+    // Covers the key, the flags and the value.
+    uint64_t checksum;
+    BlobCacheDiskStore::Key key;
+};
+static_assert(sizeof(FileHeader) % kRecordAlignment == 0);
+static_assert(sizeof(RecordHeader) % kRecordAlignment == 0);
+
+size_t GetRecordSize(size_t valueSize)
+{
+    return rx::roundUpPow2(sizeof(RecordHeader) + valueSize, kRecordAlignment);
+}
+
+uint64_t ComputeChecksum(const BlobCacheDiskStore::Key &key,
+                         uint32_t flags,
+                         angle::Span<const uint8_t> value)
+{
+    const uint64_t seed = XXH3_64bits(key.data(), key.size()) ^ flags;
+    return XXH3_64bits_withSeed(value.data(), value.size(), seed);
+}
+
+#if defined(ANGLE_PLATFORM_POSIX)
+bool WriteAll(int fd, const void *data, size_t size, size_t offset)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    while (size > 0)
+    {
+        const ssize_t written = pwrite(fd, bytes, size, static_cast<off_t>(offset));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        bytes = ANGLE_UNSAFE_TODO(bytes + written);
+        size -= static_cast<size_t>(written);
+        offset += static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool WriteFileHeader(int fd)
+{
+    FileHeader header = {};
+    header.magic      = kFileMagic;
+    header.version    = kFormatVersion;
+    header.keyLength  = static_cast<uint32_t>(angle::kBlobCacheKeyLength);
+    return WriteAll(fd, &header, sizeof(header), 0);
+}
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}  // anonymous namespace
+
+// static
+const char *BlobCacheDiskStore::GetFileName()
+{
+    return kFileName;
+}
+
+BlobCacheDiskStore::BlobCacheDiskStore(const std::string &directory, size_t maxSizeBytes)
+    : mDirectory(directory),
+      mPath(angle::ConcatenatePath(directory, kFileName)),
+      mMaxSize(std::max(maxSizeBytes, sizeof(FileHeader) + 4 * GetRecordSize(0))),
+      mFd(-1),
+      mLockFd(-1),
+      mMapping(nullptr),
+      mMappingSize(0),
+      mFileSize(0),
+      mUseCounter(0)
+{}
+
+BlobCacheDiskStore::~BlobCacheDiskStore()
+{
+    close();
+}
+
+#if defined(ANGLE_PLATFORM_POSIX)
+
+// static
+std::unique_ptr<BlobCacheDiskStore> BlobCacheDiskStore::Open(const std::string &directory,
+                                                             size_t maxSizeBytes)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "BlobCacheDiskStore::Open");
+
+    std::unique_ptr<BlobCacheDiskStore> store(new BlobCacheDiskStore(directory, maxSizeBytes));
+    if (!store->open())
+    {
+        return nullptr;
+    }
+    return store;
+}
+
+bool BlobCacheDiskStore::open()
+{
+    if (!angle::IsDirectory(mDirectory.c_str()) && !angle::CreateDirectories(mDirectory))
+    {
+        WARN() << "Failed to create the blob cache directory " << mDirectory;
+        return false;
+    }
+
+    // Two processes appending to the same file would corrupt each other's records.
+    const std::string lockPath = angle::ConcatenatePath(mDirectory, kLockFileName);
+    mLockFd                    = ::open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (mLockFd < 0 || flock(mLockFd, LOCK_EX | LOCK_NB) != 0)
+    {
+        WARN() << "The blob cache in " << mDirectory << " is in use by another process";
+        close();
+        return false;
+    }
+
+    mFd = ::open(mPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    struct stat fileStat;
+    if (mFd < 0 || fstat(mFd, &fileStat) != 0)
+    {
+        WARN() << "Failed to open the blob cache file " << mPath;
+        close();
+        return false;
+    }
+    mFileSize = static_cast<size_t>(fileStat.st_size);
+
+    if (!map() || !readIndex())
+    {
+        close();
+        return false;
+    }
+
+    // The limit may have been lowered since the file was written.
+    if (mFileSize > mMaxSize && !compact(0))
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void BlobCacheDiskStore::close()
+{
+    unmap();
+    if (mFd >= 0)
+    {
+        ::close(mFd);
+        mFd = -1;
+    }
+    if (mLockFd >= 0)
+    {
+        ::close(mLockFd);
+        mLockFd = -1;
+    }
+    mEntries.clear();
+}
+
+bool BlobCacheDiskStore::map()
+{
+    // The file is mapped up to the maximum size, so that the records appended later are readable
+    // without remapping.  Only the part that is within the file is ever accessed.
+    const size_t mappingSize = std::max(mMaxSize, mFileSize);
+    void *mapping            = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, mFd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        WARN() << "Failed to map the blob cache file " << mPath;
+        return false;
+    }
+    mMapping     = static_cast<const uint8_t *>(mapping);
+    mMappingSize = mappingSize;
+    return true;
+}
+
+void BlobCacheDiskStore::unmap()
+{
+    if (mMapping != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mMapping), mMappingSize);
+        mMapping     = nullptr;
+        mMappingSize = 0;
+    }
+}
+
+bool BlobCacheDiskStore::readIndex()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "BlobCacheDiskStore::readIndex");
+
+    FileHeader fileHeader;
+    if (mFileSize < sizeof(fileHeader))
+    {
+        return reset();
+    }
+    ANGLE_UNSAFE_TODO(memcpy(&fileHeader, mMapping, sizeof(fileHeader)));
+    if (fileHeader.magic != kFileMagic || fileHeader.version != kFormatVersion ||
+        fileHeader.keyLength != angle::kBlobCacheKeyLength)
+    {
+        INFO() << "Discarding the blob cache file " << mPath << ", as its format is unknown";
+        return reset();
+    }
+
+    // Later records for a key supersede the earlier ones, and are also more recently used.  The
+    // checksums are verified when the blobs are first looked up, to keep this fast.
+    size_t offset = sizeof(fileHeader);
+    while (offset + sizeof(RecordHeader) <= mFileSize)
+    {
+        RecordHeader header;
+        ANGLE_UNSAFE_TODO(memcpy(&header, mMapping + offset, sizeof(header)));
+        if (header.magic != kRecordMagic || header.valueSize > mFileSize ||
+            offset + GetRecordSize(header.valueSize) > mFileSize)
+        {
+            break;
+        }
+
+        if ((header.flags & kRecordRemoved) != 0)
+        {
+            mEntries.erase(header.key);
+        }
+        else
+        {
+            mEntries[header.key] = {offset, static_cast<size_t>(header.valueSize), ++mUseCounter,
+                                    false};
+        }
+        offset += GetRecordSize(header.valueSize);
+    }
+
+    // Anything past the last complete record is left over from an interrupted write.
+    if (offset != mFileSize)
+    {
+        INFO() << "Truncating the blob cache file " << mPath << " from " << mFileSize << " to "
+               << offset << " bytes";
+        if (ftruncate(mFd, static_cast<off_t>(offset)) != 0)
+        {
+            return false;
+        }
+        mFileSize = offset;
+    }
+
+    return true;
+}
+
+bool BlobCacheDiskStore::reset()
+{
+    mEntries.clear();
+    mFileSize = 0;
+    if (ftruncate(mFd, 0) != 0 || !WriteFileHeader(mFd))
+    {
+        WARN() << "Failed to reset the blob cache file " << mPath;
+        return false;
+    }
+    mFileSize = sizeof(FileHeader);
+    return true;
+}
+
+bool BlobCacheDiskStore::append(const Key &key, uint32_t flags, angle::Span<const uint8_t> value)
+{
+    const size_t recordSize = GetRecordSize(value.size());
+    if (mFileSize + recordSize > mMaxSize && !compact(recordSize))
+    {
+        return false;
+    }
+
+    RecordHeader header = {};
+    header.magic        = kRecordMagic;
+    header.flags        = flags;
+    header.valueSize    = value.size();
+    header.checksum     = ComputeChecksum(key, flags, value);
+    header.key          = key;
+
+    // The file is extended first, so that the header is zero (and so the record invalid) until the
+    // value is completely written.  The header itself is written last.
+    const size_t offset = mFileSize;
+    if (ftruncate(mFd, static_cast<off_t>(offset + recordSize)) != 0 ||
+        !WriteAll(mFd, value.data(), value.size(), offset + sizeof(header)) ||
+        !WriteAll(mFd, &header, sizeof(header), offset))
+    {
+        WARN() << "Failed to write to the blob cache file " << mPath;
+        // Drop the partial record, so that the next record is not appended after it.
+        if (ftruncate(mFd, static_cast<off_t>(offset)) != 0)
+        {
+            reset();
+        }
+        return false;
+    }
+    mFileSize = offset + recordSize;
+
+    if ((flags & kRecordRemoved) != 0)
+    {
+        mEntries.erase(key);
+    }
+    else
+    {
+        mEntries[key] = {offset, value.size(), ++mUseCounter, true};
+    }
+    return true;
+}
+
+bool BlobCacheDiskStore::compact(size_t extraBytes)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "BlobCacheDiskStore::compact");
+
+    // Keep the most recently used blobs, filling up to half the limit so that compaction doesn't
+    // happen too often.
+    std::vector<std::pair<Key, Entry>> entries(mEntries.begin(), mEntries.end());
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+        return a.second.lastUse > b.second.lastUse;
+    });
+
+    const size_t budget = mMaxSize / 2 > extraBytes ? mMaxSize / 2 - extraBytes : 0;
+    size_t keptSize     = 0;
+    size_t keptCount    = 0;
+    while (keptCount < entries.size())
+    {
+        const size_t recordSize = GetRecordSize(entries[keptCount].second.valueSize);
+        if (sizeof(FileHeader) + keptSize + recordSize > budget)
+        {
+            break;
+        }
+        keptSize += recordSize;
+        ++keptCount;
+    }
+    entries.resize(keptCount);
+
+    // The compacted file is written next to the old one, and atomically replaces it once it's
+    // complete.  The records are written oldest first, so the file order reflects the LRU order
+    // when the file is opened again.
+    const std::string tempPath = mPath + ".tmp";
+    const int tempFd = ::open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    bool success     = tempFd >= 0 && WriteFileHeader(tempFd);
+
+    size_t offset = sizeof(FileHeader);
+    for (auto iter = entries.rbegin(); success && iter != entries.rend(); ++iter)
+    {
+        // Records are copied as is, including their padding and checksum.
+        Entry &entry            = iter->second;
+        const size_t recordSize = GetRecordSize(entry.valueSize);
+        success = WriteAll(tempFd, ANGLE_UNSAFE_TODO(mMapping + entry.offset), recordSize, offset);
+        entry.offset = offset;
+        offset += recordSize;
+    }
+
+    success = success && fsync(tempFd) == 0 && rename(tempPath.c_str(), mPath.c_str()) == 0;
+    if (!success)
+    {
+        WARN() << "Failed to compact the blob cache file " << mPath;
+        if (tempFd >= 0)
+        {
+            ::close(tempFd);
+            unlink(tempPath.c_str());
+        }
+        // Start over rather than growing past the limit.
+        return reset();
+    }
+
+    unmap();
+    ::close(mFd);
+    mFd       = tempFd;
+    mFileSize = offset;
+
+    mEntries.clear();
+    for (const auto &entry : entries)
+    {
+        mEntries.insert(entry);
+    }
+
+    if (!map())
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool BlobCacheDiskStore::put(const Key &key, angle::Span<const uint8_t> value)
+{
+    if (mMapping == nullptr || value.size() > mMaxSize / 4)
+    {
+        return false;
+    }
+    return append(key, 0, value);
+}
+
+bool BlobCacheDiskStore::get(const Key &key, angle::Span<const uint8_t> *valueOut)
+{
+    auto iter = mEntries.find(key);
+    if (iter == mEntries.end())
+    {
+        return false;
+    }
+
+    Entry &entry = iter->second;
+    const angle::Span<const uint8_t> value(
+        ANGLE_UNSAFE_TODO(mMapping + entry.offset + sizeof(RecordHeader)), entry.valueSize);
+
+    if (!entry.verified)
+    {
+        RecordHeader header;
+        ANGLE_UNSAFE_TODO(memcpy(&header, mMapping + entry.offset, sizeof(header)));
+        if (header.checksum != ComputeChecksum(key, header.flags, value))
+        {
+            WARN() << "Discarding a corrupted blob from the blob cache file " << mPath;
+            mEntries.erase(iter);
+            return false;
+        }
+        entry.verified = true;
+    }
+
+    entry.lastUse = ++mUseCounter;
+    *valueOut     = value;
+    return true;
+}
+
+void BlobCacheDiskStore::remove(const Key &key)
+{
+    if (mMapping != nullptr && mEntries.count(key) != 0)
+    {
+        append(key, kRecordRemoved, {});
+    }
+}
+
+#else  // defined(ANGLE_PLATFORM_POSIX)
+
+// static
+std::unique_ptr<BlobCacheDiskStore> BlobCacheDiskStore::Open(const std::string &directory,
+                                                             size_t maxSizeBytes)
+{
+    WARN() << "The on-disk blob cache is not supported on this platform";
+    return nullptr;
+}
+
+void BlobCacheDiskStore::close() {}
+
+bool BlobCacheDiskStore::put(const Key &key, angle::Span<const uint8_t> value)
+{
+    UNREACHABLE();
+    return false;
+}
+
+bool BlobCacheDiskStore::get(const Key &key, angle::Span<const uint8_t> *valueOut)
+{
+    UNREACHABLE();
+    return false;
+}
+
+void BlobCacheDiskStore::remove(const Key &key)
+{
+    UNREACHABLE();
+}
+
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}  // namespace egl
@@ -0,0 +1,99 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore: A persistent, on-disk backend for BlobCache.  It's used when the
+//   application doesn't provide EGL_ANDROID_blob_cache callbacks, so that programs and pipeline
+//   caches survive process restarts.
+//
+//   The blobs are appended to a single file, which is memory-mapped so that lookups read straight
+//   out of the page cache.  The index is rebuilt by walking the record headers when the store is
+//   opened.  Every record carries a checksum, so a record torn by a crash (or otherwise
+//   corrupted) is detected and ignored.  Once the file reaches its size limit, it's compacted
+//   into a new file holding the most recently used blobs, which atomically replaces the old one.
+//
+//   The store is locked for exclusive use by one process; other processes fail to open it and run
+//   without it.  The store itself is not thread-safe: BlobCache serializes access to it.
+
+#ifndef LIBANGLE_BLOB_CACHE_DISK_STORE_H_
+#define LIBANGLE_BLOB_CACHE_DISK_STORE_H_
+
+#include <memory>
+#include <string>
+
+#include "common/hash_containers.h"
+#include "common/span.h"
+#include "libANGLE/angletypes.h"
+
+namespace egl
+{
+class BlobCacheDiskStore final : angle::NonCopyable
+{
+  public:
+    using Key = angle::BlobCacheKey;
+
+    // Opens the store in |directory|, creating it if needed.  Returns nullptr if the store can't
+    // be used, for example because another process has it open or the platform isn't supported.
+    static std::unique_ptr<BlobCacheDiskStore> Open(const std::string &directory,
+                                                    size_t maxSizeBytes);
+
+    ~BlobCacheDiskStore();
+
+    // Appends a blob, replacing any blob with the same key.  Blobs larger than a quarter of the
+    // maximum size are not stored.  Returns whether the blob was stored.
+    bool put(const Key &key, angle::Span<const uint8_t> value);
+
+    // Looks up a blob.  The returned data points into the mapped file, and stays valid until the
+    // next call to put() or remove().
+    bool get(const Key &key, angle::Span<const uint8_t> *valueOut);
+
+    // Removes a blob.  The removal is recorded, so that the blob isn't found again after a
+    // restart.
+    void remove(const Key &key);
+
+    size_t entryCount() const { return mEntries.size(); }
+    size_t fileSize() const { return mFileSize; }
+    size_t maxSize() const { return mMaxSize; }
+
+    // Name of the file holding the blobs.
+    static const char *GetFileName();
+
+  private:
+    struct Entry
+    {
+        // Offset of the record header in the file.
+        size_t offset;
+        size_t valueSize;
+        // Position in the LRU order; larger values were used more recently.
+        uint64_t lastUse;
+        bool verified;
+    };
+
+    BlobCacheDiskStore(const std::string &directory, size_t maxSizeBytes);
+
+    bool open();
+    void close();
+    bool map();
+    void unmap();
+    bool readIndex();
+    bool reset();
+    bool append(const Key &key, uint32_t flags, angle::Span<const uint8_t> value);
+    bool compact(size_t extraBytes);
+
+    std::string mDirectory;
+    std::string mPath;
+    size_t mMaxSize;
+
+    int mFd;
+    int mLockFd;
+    const uint8_t *mMapping;
+    size_t mMappingSize;
+    size_t mFileSize;
+
+    angle::HashMap<Key, Entry> mEntries;
+    uint64_t mUseCounter;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_CACHE_DISK_STORE_H_
@@ -0,0 +1,341 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore_unittest.cpp: Unit tests for the on-disk backend of the blob cache.
+
+#include <gtest/gtest.h>
+
+#include "common/platform.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+
+#    include <stdio.h>
+#    include <unistd.h>
+
+#    include "common/WorkerThread.h"
+#    include "common/system_utils.h"
+#    include "libANGLE/BlobCache.h"
+#    include "libANGLE/BlobCacheDiskStore.h"
+
+namespace egl
+{
+namespace
+{
+using Key = BlobCacheDiskStore::Key;
+
+Key MakeKey(uint8_t start)
+{
+    Key key;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<uint8_t>(start + i);
+    }
+    return key;
+}
+
+std::vector<uint8_t> MakeValue(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> value(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        value[i] = static_cast<uint8_t>(start + i * 7);
+    }
+    return value;
+}
+
+bool ValueMatches(BlobCacheDiskStore *store, const Key &key, const std::vector<uint8_t> &expected)
+{
+    angle::Span<const uint8_t> value;
+    return store->get(key, &value) && value.size() == expected.size() &&
+           std::equal(value.begin(), value.end(), expected.begin());
+}
+
+class BlobCacheDiskStoreTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // The unique name of a temporary file is used for the store's directory.
+        Optional<std::string> tempFile = angle::CreateTemporaryFile();
+        ASSERT_TRUE(tempFile.valid());
+        mDirectory = tempFile.value();
+        unlink(mDirectory.c_str());
+    }
+
+    void TearDown() override
+    {
+        unlink(getFilePath().c_str());
+        unlink(angle::ConcatenatePath(mDirectory, "angle_blob_cache.lock").c_str());
+        rmdir(mDirectory.c_str());
+    }
+
+    std::unique_ptr<BlobCacheDiskStore> open(size_t maxSize = kMaxSize)
+    {
+        return BlobCacheDiskStore::Open(mDirectory, maxSize);
+    }
+
+    std::string getFilePath() const
+    {
+        return angle::ConcatenatePath(mDirectory, BlobCacheDiskStore::GetFileName());
+    }
+
+    static constexpr size_t kMaxSize = 1024 * 1024;
+    std::string mDirectory;
+};
+
+// Test that blobs are found again after the store is reopened.
+TEST_F(BlobCacheDiskStoreTest, PersistsAcrossOpen)
+{
+    {
+        std::unique_ptr<BlobCacheDiskStore> store = open();
+        ASSERT_NE(store, nullptr);
+        for (uint8_t i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(store->put(MakeKey(i), MakeValue(100 + i * 1000, i)));
+        }
+        EXPECT_TRUE(ValueMatches(store.get(), MakeKey(3), MakeValue(3100, 3)));
+    }
+
+    std::unique_ptr<BlobCacheDiskStore> store = open();
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(store->entryCount(), 10u);
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(ValueMatches(store.get(), MakeKey(i), MakeValue(100 + i * 1000, i)));
+    }
+
+    angle::Span<const uint8_t> value;
+    EXPECT_FALSE(store->get(MakeKey(100), &value));
+}
+
+// Test that replaced and removed blobs stay that way after the store is reopened.
+TEST_F(BlobCacheDiskStoreTest, ReplaceAndRemove)
+{
+    {
+        std::unique_ptr<BlobCacheDiskStore> store = open();
+        ASSERT_NE(store, nullptr);
+        EXPECT_TRUE(store->put(MakeKey(0), MakeValue(100, 0)));
+        EXPECT_TRUE(store->put(MakeKey(1), MakeValue(200, 1)));
+        EXPECT_TRUE(store->put(MakeKey(0), MakeValue(300, 2)));
+        store->remove(MakeKey(1));
+        EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(300, 2)));
+    }
+
+    std::unique_ptr<BlobCacheDiskStore> store = open();
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(store->entryCount(), 1u);
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(300, 2)));
+
+    angle::Span<const uint8_t> value;
+    EXPECT_FALSE(store->get(MakeKey(1), &value));
+}
+
+// Test that a record cut short, as by a crash while writing it, is dropped.
+TEST_F(BlobCacheDiskStoreTest, TruncatedRecord)
+{
+    size_t fileSize = 0;
+    {
+        std::unique_ptr<BlobCacheDiskStore> store = open();
+        ASSERT_NE(store, nullptr);
+        EXPECT_TRUE(store->put(MakeKey(0), MakeValue(1000, 0)));
+        EXPECT_TRUE(store->put(MakeKey(1), MakeValue(1000, 1)));
+        fileSize = store->fileSize();
+    }
+    ASSERT_EQ(truncate(getFilePath().c_str(), static_cast<off_t>(fileSize - 100)), 0);
+
+    {
+        std::unique_ptr<BlobCacheDiskStore> store = open();
+        ASSERT_NE(store, nullptr);
+        EXPECT_EQ(store->entryCount(), 1u);
+        EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(1000, 0)));
+
+        // New records are appended after the last complete one.
+        EXPECT_TRUE(store->put(MakeKey(2), MakeValue(500, 2)));
+    }
+
+    std::unique_ptr<BlobCacheDiskStore> store = open();
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(store->entryCount(), 2u);
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(1000, 0)));
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(2), MakeValue(500, 2)));
+}
+
+// Test that a corrupted blob is not returned.
+TEST_F(BlobCacheDiskStoreTest, CorruptedValue)
+{
+    size_t fileSize = 0;
+    {
+        std::unique_ptr<BlobCacheDiskStore> store = open();
+        ASSERT_NE(store, nullptr);
+        EXPECT_TRUE(store->put(MakeKey(0), MakeValue(1000, 0)));
+        EXPECT_TRUE(store->put(MakeKey(1), MakeValue(1000, 1)));
+        fileSize = store->fileSize();
+    }
+
+    // Flip a byte in the second value.
+    FILE *file = fopen(getFilePath().c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fseek(file, static_cast<long>(fileSize - 500), SEEK_SET), 0);
+    const int byte = fgetc(file);
+    ASSERT_EQ(fseek(file, static_cast<long>(fileSize - 500), SEEK_SET), 0);
+    fputc(byte ^ 0xFF, file);
+    fclose(file);
+
+    std::unique_ptr<BlobCacheDiskStore> store = open();
+    ASSERT_NE(store, nullptr);
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(1000, 0)));
+
+    angle::Span<const uint8_t> value;
+    EXPECT_FALSE(store->get(MakeKey(1), &value));
+    EXPECT_EQ(store->entryCount(), 1u);
+}
+
+// Test that the file stays within the size limit, keeping the most recently used blobs.
+TEST_F(BlobCacheDiskStoreTest, Compaction)
+{
+    constexpr size_t kMaxSize   = 64 * 1024;
+    constexpr size_t kValueSize = 4000;
+
+    {
+        std::unique_ptr<BlobCacheDiskStore> store = open(kMaxSize);
+        ASSERT_NE(store, nullptr);
+
+        // Blobs larger than a quarter of the limit are not stored.
+        EXPECT_FALSE(store->put(MakeKey(200), MakeValue(kMaxSize / 2, 0)));
+
+        for (uint8_t i = 0; i < 100; ++i)
+        {
+            EXPECT_TRUE(store->put(MakeKey(i), MakeValue(kValueSize, i)));
+            EXPECT_LE(store->fileSize(), kMaxSize);
+
+            // Keep using the first blob, so it's never evicted.
+            EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(kValueSize, 0)));
+        }
+        EXPECT_LT(store->entryCount(), 16u);
+        EXPECT_TRUE(ValueMatches(store.get(), MakeKey(99), MakeValue(kValueSize, 99)));
+    }
+
+    std::unique_ptr<BlobCacheDiskStore> store = open(kMaxSize);
+    ASSERT_NE(store, nullptr);
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(0), MakeValue(kValueSize, 0)));
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(99), MakeValue(kValueSize, 99)));
+
+    // Lowering the limit compacts the file when it's opened.
+    store.reset();
+    store = open(kMaxSize / 4);
+    ASSERT_NE(store, nullptr);
+    EXPECT_LE(store->fileSize(), kMaxSize / 4);
+    EXPECT_TRUE(ValueMatches(store.get(), MakeKey(99), MakeValue(kValueSize, 99)));
+}
+
+// Test that only one store can use a directory at a time.
+TEST_F(BlobCacheDiskStoreTest, ExclusiveUse)
+{
+    std::unique_ptr<BlobCacheDiskStore> store = open();
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(open(), nullptr);
+
+    store.reset();
+    EXPECT_NE(open(), nullptr);
+}
+
+// Test that BlobCache finds the blobs stored in a previous run through the on-disk store, and keeps
+// them when the memory cache is discarded.
+TEST_F(BlobCacheDiskStoreTest, BlobCacheWarmStart)
+{
+    constexpr size_t kValueSize = 10000;
+    const Key key                    = MakeKey(0);
+    const std::vector<uint8_t> value = MakeValue(kValueSize, 0);
+
+    {
+        BlobCache blobCache(kMaxSize);
+        blobCache.setDiskStore(open());
+
+        angle::MemoryBuffer uncompressed;
+        ASSERT_TRUE(uncompressed.resize(kValueSize));
+        std::copy(value.begin(), value.end(), uncompressed.data());
+        EXPECT_TRUE(blobCache.compressAndPut(nullptr, key, std::move(uncompressed)));
+    }
+
+    BlobCache blobCache(kMaxSize);
+    blobCache.setDiskStore(open());
+    blobCache.resize(kMaxSize);
+    EXPECT_TRUE(blobCache.empty());
+
+    angle::ScratchBuffer scratchBuffer;
+    angle::MemoryBuffer uncompressed;
+    EXPECT_EQ(blobCache.getAndDecompress(nullptr, &scratchBuffer, key, kValueSize, &uncompressed),
+              BlobCache::GetAndDecompressResult::Success);
+    ASSERT_EQ(uncompressed.size(), kValueSize);
+    EXPECT_TRUE(std::equal(value.begin(), value.end(), uncompressed.data()));
+
+    // get() returns the compressed blob.
+    BlobCache::Value compressedValue;
+    EXPECT_TRUE(blobCache.get(nullptr, &scratchBuffer, key, &compressedValue));
+    EXPECT_GT(compressedValue.size(), 0u);
+
+    // Removal reaches the on-disk store.
+    blobCache.remove(key);
+    blobCache.setDiskStore(nullptr);
+    blobCache.setDiskStore(open());
+    EXPECT_EQ(blobCache.getAndDecompress(nullptr, &scratchBuffer, key, kValueSize, &uncompressed),
+              BlobCache::GetAndDecompressResult::NotFound);
+}
+
+// Test that blobs written to the on-disk store by a worker thread are found before they are
+// written, and that stores and removals reach the file in order.
+TEST_F(BlobCacheDiskStoreTest, BlobCacheBackgroundWrites)
+{
+    constexpr size_t kValueSize = 1000;
+    constexpr uint8_t kCount    = 32;
+
+    std::shared_ptr<angle::WorkerThreadPool> threadPool =
+        angle::WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 2, nullptr);
+    angle::ScratchBuffer scratchBuffer;
+    BlobCache::Value value;
+
+    BlobCache blobCache(kMaxSize);
+    blobCache.setDiskStore(open());
+    blobCache.setDiskWriteThreadPool(threadPool);
+
+    for (uint8_t index = 0; index < kCount; ++index)
+    {
+        const std::vector<uint8_t> expected = MakeValue(kValueSize, index);
+        angle::MemoryBuffer buffer;
+        ASSERT_TRUE(buffer.resize(kValueSize));
+        std::copy(expected.begin(), expected.end(), buffer.data());
+        blobCache.put(nullptr, MakeKey(index), std::move(buffer));
+    }
+    blobCache.remove(MakeKey(0));
+
+    // Drop the memory cache, so that the blobs are looked up in the queue or the store.
+    blobCache.resize(kMaxSize);
+    EXPECT_FALSE(blobCache.get(nullptr, &scratchBuffer, MakeKey(0), &value));
+    for (uint8_t index = 1; index < kCount; ++index)
+    {
+        const std::vector<uint8_t> expected = MakeValue(kValueSize, index);
+        ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(index), &value));
+        ASSERT_EQ(value.size(), kValueSize);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), value.data()));
+    }
+
+    // Closing the store waits for the writes.
+    blobCache.setDiskWriteThreadPool(nullptr);
+    blobCache.setDiskStore(nullptr);
+
+    std::unique_ptr<BlobCacheDiskStore> store = open();
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(store->entryCount(), kCount - 1u);
+    angle::Span<const uint8_t> diskValue;
+    EXPECT_FALSE(store->get(MakeKey(0), &diskValue));
+    for (uint8_t index = 1; index < kCount; ++index)
+    {
+        EXPECT_TRUE(ValueMatches(store.get(), MakeKey(index), MakeValue(kValueSize, index)));
+    }
+}
+}  // anonymous namespace
+}  // namespace egl
+
+#endif  // defined(ANGLE_PLATFORM_POSIX)
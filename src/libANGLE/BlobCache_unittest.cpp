@@ -7,6 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <random>
+#include <thread>
+
+#include "common/WorkerThread.h"
 #include "libANGLE/BlobCache.h"
 
 namespace egl
@@ -127,4 +132,378 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(5), &qvalue));
 }
 
+// Tests that eviction is least recently used across all keys, and that all blobs are enumerated,
+// however the keys are spread over the cache's shards.
+TEST(BlobCacheTest, LeastRecentlyUsedAcrossKeys)
+{
+    constexpr size_t kSize      = 64;
+    constexpr size_t kBlobSize  = 4;
+    constexpr size_t kBlobCount = kSize / kBlobSize;
+    BlobCache blobCache(kSize);
+
+    for (size_t value = 0; value < kBlobCount; ++value)
+    {
+        blobCache.populate(MakeKey(static_cast<uint8_t>(value * 7)), MakeBlob(kBlobSize, value));
+    }
+    EXPECT_EQ(kBlobCount, blobCache.entryCount());
+
+    // Use the oldest blob, so the second oldest is evicted next.
+    Blob qvalue;
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &qvalue));
+    blobCache.populate(MakeKey(200), MakeBlob(kBlobSize, 200));
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &qvalue));
+    EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(7), &qvalue));
+    EXPECT_EQ(kSize, blobCache.size());
+
+    size_t total = 0;
+    for (size_t index = 0; index < blobCache.entryCount(); ++index)
+    {
+        const Key *key = nullptr;
+        EXPECT_TRUE(blobCache.getAt(index, &key, &qvalue));
+        ASSERT_NE(nullptr, key);
+        total += qvalue.size();
+    }
+    EXPECT_EQ(kSize, total);
+    const Key *key = nullptr;
+    EXPECT_FALSE(blobCache.getAt(kBlobCount, &key, &qvalue));
+
+    // Trimming evicts the oldest blobs first.
+    EXPECT_EQ(kSize / 2, blobCache.trim(kSize / 2));
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(200), &qvalue));
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &qvalue));
+    EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(14), &qvalue));
+}
+
+// Blobs large enough to be compressed in the background.
+constexpr size_t kBackgroundBlobSize = 64 * 1024;
+
+BlobPut MakeLargeBlob(size_t size, uint8_t start)
+{
+    BlobPut blob;
+    EXPECT_TRUE(blob.resize(size));
+    for (size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<uint8_t>(i + start);
+    }
+    return blob;
+}
+
+std::shared_ptr<angle::WorkerThreadPool> CreateCompressionThreadPool()
+{
+    return angle::WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 4, nullptr);
+}
+
+bool BlobMatches(const angle::MemoryBuffer &blob, size_t size, uint8_t start)
+{
+    if (blob.size() != size)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (blob[i] != static_cast<uint8_t>(i + start))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tests that the cache stays within its size limit when many threads add and look up blobs.
+TEST(BlobCacheTest, ConcurrentPopulateAndGet)
+{
+    constexpr size_t kThreadCount    = 8;
+    constexpr size_t kIterationCount = 2000;
+    constexpr size_t kBlobSize       = 64;
+    constexpr size_t kMaxCacheSize   = 32 * kBlobSize;
+    BlobCache blobCache(kMaxCacheSize);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&blobCache, threadIndex]() {
+            std::mt19937 rng(static_cast<uint32_t>(threadIndex));
+            std::uniform_int_distribution<int> keyDistribution(0, 255);
+
+            for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                const uint8_t keyIndex = static_cast<uint8_t>(keyDistribution(rng));
+                angle::MemoryBuffer uncompressed;
+                if (blobCache.getAndDecompress(nullptr, nullptr, MakeKey(keyIndex), kBlobSize,
+                                               &uncompressed) ==
+                    BlobCache::GetAndDecompressResult::Success)
+                {
+                    EXPECT_TRUE(BlobMatches(uncompressed, kBlobSize, keyIndex));
+                }
+                else
+                {
+                    EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(keyIndex),
+                                                         MakeLargeBlob(kBlobSize, keyIndex)));
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(blobCache.size(), kMaxCacheSize);
+    EXPECT_GT(blobCache.entryCount(), 0u);
+}
+
+// Tests that the shards together never hold more than the cache's budget, even while blobs are
+// being inserted concurrently.
+TEST(BlobCacheTest, ConcurrentPopulateWithinBudget)
+{
+    constexpr size_t kThreadCount    = 8;
+    constexpr size_t kIterationCount = 2000;
+    constexpr size_t kBlobSize       = 128;
+    constexpr size_t kMaxCacheSize   = 4 * kBlobSize;
+    BlobCache blobCache(kMaxCacheSize);
+
+    std::atomic<bool> done(false);
+    std::thread sizeChecker([&blobCache, &done, maxCacheSize = kMaxCacheSize]() {
+        while (!done)
+        {
+            ASSERT_LE(blobCache.size(), maxCacheSize);
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&blobCache, threadIndex]() {
+            for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                const uint8_t keyIndex =
+                    static_cast<uint8_t>(threadIndex * kIterationCount + iteration);
+                blobCache.populate(MakeKey(keyIndex), MakeBlob(kBlobSize, keyIndex));
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    done = true;
+    sizeChecker.join();
+
+    EXPECT_LE(blobCache.size(), kMaxCacheSize);
+    EXPECT_EQ(blobCache.entryCount(), kMaxCacheSize / kBlobSize);
+}
+
+// Tests that blobs are found both while and after they are compressed in the background.
+TEST(BlobCacheTest, BackgroundCompression)
+{
+    constexpr size_t kCount = 16;
+    BlobCache blobCache(kCount * kBackgroundBlobSize);
+    blobCache.setCompressionThreadPool(CreateCompressionThreadPool());
+
+    for (uint8_t value = 0; value < kCount; ++value)
+    {
+        EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(value),
+                                             MakeLargeBlob(kBackgroundBlobSize, value)));
+    }
+
+    for (uint8_t value = 0; value < kCount; ++value)
+    {
+        angle::MemoryBuffer uncompressed;
+        EXPECT_EQ(BlobCache::GetAndDecompressResult::Success,
+                  blobCache.getAndDecompress(nullptr, nullptr, MakeKey(value), kBackgroundBlobSize,
+                                             &uncompressed));
+        EXPECT_TRUE(BlobMatches(uncompressed, kBackgroundBlobSize, value));
+    }
+
+    // Queries include all blobs, compressed.
+    EXPECT_EQ(kCount, blobCache.entryCount());
+    EXPECT_LT(blobCache.size(), kCount * kBackgroundBlobSize);
+
+    for (uint8_t value = 0; value < kCount; ++value)
+    {
+        angle::MemoryBuffer uncompressed;
+        EXPECT_EQ(BlobCache::GetAndDecompressResult::Success,
+                  blobCache.getAndDecompress(nullptr, nullptr, MakeKey(value), kBackgroundBlobSize,
+                                             &uncompressed));
+        EXPECT_TRUE(BlobMatches(uncompressed, kBackgroundBlobSize, value));
+    }
+
+    blobCache.setCompressionThreadPool(nullptr);
+}
+
+// Tests that replacing or removing a blob while it's being compressed wins over the compression.
+TEST(BlobCacheTest, BackgroundCompressionReplaceAndRemove)
+{
+    BlobCache blobCache(4 * kBackgroundBlobSize);
+    blobCache.setCompressionThreadPool(CreateCompressionThreadPool());
+
+    EXPECT_TRUE(
+        blobCache.compressAndPut(nullptr, MakeKey(0), MakeLargeBlob(kBackgroundBlobSize, 1)));
+    EXPECT_TRUE(
+        blobCache.compressAndPut(nullptr, MakeKey(0), MakeLargeBlob(kBackgroundBlobSize, 2)));
+    EXPECT_TRUE(
+        blobCache.compressAndPut(nullptr, MakeKey(1), MakeLargeBlob(kBackgroundBlobSize, 3)));
+    blobCache.remove(MakeKey(1));
+    blobCache.finishPendingCompression();
+
+    angle::MemoryBuffer uncompressed;
+    EXPECT_EQ(BlobCache::GetAndDecompressResult::Success,
+              blobCache.getAndDecompress(nullptr, nullptr, MakeKey(0), kBackgroundBlobSize,
+                                         &uncompressed));
+    EXPECT_TRUE(BlobMatches(uncompressed, kBackgroundBlobSize, 2));
+    EXPECT_EQ(BlobCache::GetAndDecompressResult::NotFound,
+              blobCache.getAndDecompress(nullptr, nullptr, MakeKey(1), kBackgroundBlobSize,
+                                         &uncompressed));
+    EXPECT_EQ(1u, blobCache.entryCount());
+
+    // Clearing drops blobs that are still being compressed.
+    EXPECT_TRUE(
+        blobCache.compressAndPut(nullptr, MakeKey(2), MakeLargeBlob(kBackgroundBlobSize, 4)));
+    blobCache.clear();
+    EXPECT_TRUE(blobCache.empty());
+}
+
+BlobCache *gReentrantBlobCache = nullptr;
+std::atomic<size_t> gSetBlobCount(0);
+std::atomic<size_t> gCompressedBlobCount(0);
+std::thread::id gCompressedBlobThread;
+
+void SetBlobAndLookUp(const void *key,
+                      EGLsizeiANDROID keySize,
+                      const void *value,
+                      EGLsizeiANDROID valueSize)
+{
+    // Looking up another blob takes the cache's lock.
+    BlobCache::Value lookedUpValue;
+    EXPECT_FALSE(gReentrantBlobCache->get(nullptr, nullptr, MakeKey(200), &lookedUpValue));
+    gSetBlobCount++;
+}
+
+EGLsizeiANDROID GetNoBlob(const void *key,
+                          EGLsizeiANDROID keySize,
+                          void *value,
+                          EGLsizeiANDROID valueSize)
+{
+    return 0;
+}
+
+void RecordCompressedBlob(const Key &key, const angle::MemoryBuffer &compressedValue)
+{
+    gCompressedBlobThread = std::this_thread::get_id();
+    gCompressedBlobCount++;
+}
+
+// Tests that the callbacks for blobs compressed in the background are made without the cache's
+// locks held, and that the compressed blob callback is made on the thread that passed the blob.
+TEST(BlobCacheTest, BackgroundCompressionCallbacks)
+{
+    constexpr size_t kCount = 4;
+    BlobCache blobCache(kCount * kBackgroundBlobSize);
+    gReentrantBlobCache  = &blobCache;
+    gSetBlobCount        = 0;
+    gCompressedBlobCount = 0;
+    blobCache.setBlobCacheFuncs(SetBlobAndLookUp, GetNoBlob);
+    blobCache.setCompressionThreadPool(CreateCompressionThreadPool());
+
+    for (uint8_t value = 0; value < kCount; ++value)
+    {
+        EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(value),
+                                             MakeLargeBlob(kBackgroundBlobSize, value),
+                                             RecordCompressedBlob));
+    }
+
+    // A blob passed by another thread gets its callback on that thread only.
+    std::thread otherThread([&blobCache]() {
+        EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(kCount),
+                                             MakeLargeBlob(kBackgroundBlobSize, kCount),
+                                             RecordCompressedBlob));
+    });
+    otherThread.join();
+
+    blobCache.finishPendingCompression();
+    EXPECT_EQ(kCount + 1, gSetBlobCount);
+    EXPECT_EQ(kCount, gCompressedBlobCount);
+    EXPECT_EQ(std::this_thread::get_id(), gCompressedBlobThread);
+
+    blobCache.setCompressionThreadPool(nullptr);
+    gReentrantBlobCache = nullptr;
+}
+
+// Stress test for the background compression: several threads put, get, remove and trim a small
+// set of keys concurrently.  Each key's blobs have a recognizable pattern, so that a lookup can
+// tell if it got a blob that is torn or belongs to another key.
+TEST(BlobCacheTest, BackgroundCompressionStress)
+{
+    constexpr size_t kThreadCount     = 8;
+    constexpr size_t kIterationCount  = 500;
+    constexpr size_t kKeyCount        = 16;
+    constexpr size_t kMaxCacheSize    = 8 * kBackgroundBlobSize;
+    constexpr size_t kMaxBlobSize     = 2 * kBackgroundBlobSize;
+    BlobCache blobCache(kMaxCacheSize);
+    blobCache.setCompressionThreadPool(CreateCompressionThreadPool());
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&blobCache, threadIndex]() {
+            std::mt19937 rng(static_cast<uint32_t>(threadIndex));
+            std::uniform_int_distribution<size_t> keyDistribution(0, kKeyCount - 1);
+            std::uniform_int_distribution<size_t> sizeDistribution(kBackgroundBlobSize / 4,
+                                                                   kMaxBlobSize);
+            std::uniform_int_distribution<int> operationDistribution(0, 99);
+
+            for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                const uint8_t keyIndex = static_cast<uint8_t>(keyDistribution(rng));
+                const Key key          = MakeKey(keyIndex);
+                const int operation    = operationDistribution(rng);
+
+                if (operation < 40)
+                {
+                    // The low bits of the first byte identify the key.
+                    const uint8_t start =
+                        static_cast<uint8_t>(keyIndex + kKeyCount * (iteration % 16));
+                    EXPECT_TRUE(blobCache.compressAndPut(
+                        nullptr, key, MakeLargeBlob(sizeDistribution(rng), start)));
+                }
+                else if (operation < 90)
+                {
+                    angle::MemoryBuffer uncompressed;
+                    BlobCache::GetAndDecompressResult result = blobCache.getAndDecompress(
+                        nullptr, nullptr, key, kMaxBlobSize, &uncompressed);
+                    EXPECT_NE(BlobCache::GetAndDecompressResult::DecompressFailure, result);
+                    if (result == BlobCache::GetAndDecompressResult::Success)
+                    {
+                        ASSERT_FALSE(uncompressed.empty());
+                        EXPECT_EQ(keyIndex, uncompressed[0] % kKeyCount);
+                        EXPECT_TRUE(
+                            BlobMatches(uncompressed, uncompressed.size(), uncompressed[0]));
+                    }
+                }
+                else if (operation < 98)
+                {
+                    blobCache.remove(key);
+                }
+                else
+                {
+                    blobCache.trim(kMaxCacheSize / 2);
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    blobCache.finishPendingCompression();
+    EXPECT_LE(blobCache.size(), kMaxCacheSize);
+    EXPECT_LE(blobCache.entryCount(), kKeyCount);
+
+    blobCache.setCompressionThreadPool(nullptr);
+}
+
 }  // namespace egl
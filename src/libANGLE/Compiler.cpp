@@ -14,6 +14,7 @@
 #include "libANGLE/State.h"
 #include "libANGLE/renderer/CompilerImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
+#include "platform/PlatformMethods.h"
 
 namespace gl
 {
@@ -311,6 +312,8 @@ ShCompilerInstance Compiler::getInstance(ShaderType type)
     {
         ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
         ASSERT(handle);
+        // Let the phases of the compilations show up in traces.
+        sh::SetTracePlatform(handle, ANGLEPlatformCurrent());
         return ShCompilerInstance(handle, mOutputType, type);
     }
     else
@@ -7252,13 +7252,9 @@ void Context::detachShader(ShaderProgramID program, ShaderProgramID shader)
 
 void Context::genBuffers(GLsizei n, BufferID *buffers)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mBufferManager->createBuffers(static_cast<size_t>(n), buffers))
     {
-        if (!createBuffer(&buffers[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenBuffers);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenBuffers);
     }
 }
 
@@ -7276,25 +7272,17 @@ void Context::genFramebuffers(GLsizei n, FramebufferID *framebuffers)
 
 void Context::genRenderbuffers(GLsizei n, RenderbufferID *renderbuffers)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mRenderbufferManager->createRenderbuffers(static_cast<size_t>(n), renderbuffers))
     {
-        if (!createRenderbuffer(&renderbuffers[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenRenderbuffers);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenRenderbuffers);
     }
 }
 
 void Context::genTextures(GLsizei n, TextureID *textures)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mTextureManager->createTextures(static_cast<size_t>(n), textures))
     {
-        if (!createTexture(&textures[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenTextures);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenTextures);
     }
 }
 
@@ -9927,7 +9915,7 @@ void Context::getPerfMonitorCounterData(GLuint monitor,
         case GL_PERFMON_RESULT_AMD:
         {
             const PerfMonitorCounterGroups &perfMonitorGroups =
-                mImplementation->getPerfMonitorCounters();
+                mImplementation->getPerfMonitorCounters(this);
             PerfMonitorTriplet *resultsOut = reinterpret_cast<PerfMonitorTriplet *>(data);
             GLsizei maxResults             = dataSize / sizeof(PerfMonitorTriplet);
             GLsizei resultCount            = 0;
@@ -30,6 +30,7 @@
 #include "common/utilities.h"
 #include "gpu_info_util/SystemInfo.h"
 #include "image_util/loadimage.h"
+#include "libANGLE/BlobCacheDiskStore.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Device.h"
@@ -854,6 +855,12 @@ void UpdateAttribsFromEnvironment(AttributeMap &attribMap)
 
 static constexpr uint32_t kScratchBufferLifetime = 64u;
 
+// When set, blobs are persisted in this directory if the application doesn't provide
+// EGL_ANDROID_blob_cache callbacks.
+constexpr char kBlobCacheDirectoryVarName[]      = "ANGLE_BLOB_CACHE_DIR";
+constexpr char kBlobCacheDirectoryPropertyName[] = "debug.angle.blob_cache_dir";
+constexpr size_t kMaxBlobCacheDiskStoreBytes     = 128 * 1024 * 1024;
+
 }  // anonymous namespace
 
 // DisplayState
@@ -1180,11 +1187,21 @@ Error Display::initialize()
         return NoError();
     }
 
+    // Opened before the implementation is initialized, as that loads the pipeline cache.
+    const std::string blobCacheDirectory = angle::GetEnvironmentVarOrAndroidProperty(
+        kBlobCacheDirectoryVarName, kBlobCacheDirectoryPropertyName);
+    if (!blobCacheDirectory.empty())
+    {
+        mBlobCache.setDiskStore(
+            BlobCacheDiskStore::Open(blobCacheDirectory, kMaxBlobCacheDiskStoreBytes));
+    }
+
     Error error = mImplementation->initialize(this);
     if (error.isError())
     {
         // Log extended error message here
         ERR() << "ANGLE Display::initialize error " << error.getID() << ": " << error.getMessage();
+        mBlobCache.setDiskStore(nullptr);
         return error;
     }
 
@@ -1194,6 +1211,7 @@ Error Display::initialize()
     if (mConfigSet.size() == 0)
     {
         mImplementation->terminate();
+        mBlobCache.setDiskStore(nullptr);
         return egl::Error(EGL_NOT_INITIALIZED, "No configs were generated.");
     }
 
@@ -1239,6 +1257,7 @@ Error Display::initialize()
             ERR() << "Failed to initialize display because device creation failed: "
                   << error.getMessage();
             mImplementation->terminate();
+            mBlobCache.setDiskStore(nullptr);
             return error;
         }
         // Don't leak Device memory.
@@ -1255,6 +1274,12 @@ Error Display::initialize()
     mState.multiThreadPool = angle::WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 0,
                                                              ANGLEPlatformCurrent());
 
+    if (mFrontendFeatures.compressBlobCacheInBackground.enabled)
+    {
+        mBlobCache.setCompressionThreadPool(mState.multiThreadPool);
+    }
+    mBlobCache.setDiskWriteThreadPool(mState.multiThreadPool);
+
     if (kIsContextMutexEnabled)
     {
         ASSERT(mManagersMutex == nullptr);
@@ -1425,6 +1450,9 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
 
     mImplementation->terminate();
 
+    mBlobCache.setCompressionThreadPool(nullptr);
+    mBlobCache.setDiskWriteThreadPool(nullptr);
+    mBlobCache.setDiskStore(nullptr);
     mMemoryProgramCache.clear();
     mMemoryShaderCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
@@ -2512,6 +2540,9 @@ void Display::initializeFrontendFeatures()
 
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, forceMinimumMaxVertexAttributes, false);
 
+    // Off by default, as it delays the application's blob cache callbacks past link time.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, compressBlobCacheInBackground, false);
+
     // When the IR is built, use it by default.
 #ifdef ANGLE_IR
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, useIr, true);
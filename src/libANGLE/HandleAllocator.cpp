@@ -18,90 +18,243 @@
 namespace gl
 {
 
-struct HandleAllocator::HandleRangeComparator
-{
-    bool operator()(const HandleRange &range, GLuint handle) const { return (range.end < handle); }
-};
-
 HandleAllocator::HandleAllocator(GLuint maximumHandleValue, GLuint minimumReleasedToKeep)
     : mMaxValue(maximumHandleValue),
       mMinimumReleasedToKeep(minimumReleasedToKeep),
+      mNextUnusedHandle(1),
+      mFreeHandleCount(0),
       mLoggingEnabled(false)
+{}
+
+HandleAllocator::~HandleAllocator() = default;
+
+uint64_t HandleAllocator::getUnusedHandleCount() const
 {
-    mUnallocatedList.push_back(HandleRange(1, mMaxValue));
+    // All reserved handles are in [mNextUnusedHandle, mMaxValue).
+    return static_cast<uint64_t>(mMaxValue) + 1 - mNextUnusedHandle -
+           mReservedUnusedHandles.size();
 }
 
-HandleAllocator::~HandleAllocator() = default;
+bool HandleAllocator::allocateUnused(GLuint *outId)
+{
+    while (mNextUnusedHandle <= mMaxValue)
+    {
+        GLuint handle = static_cast<GLuint>(mNextUnusedHandle++);
+        if (!mReservedUnusedHandles.empty() && *mReservedUnusedHandles.begin() == handle)
+        {
+            mReservedUnusedHandles.erase(mReservedUnusedHandles.begin());
+            continue;
+        }
 
-bool HandleAllocator::allocate(GLuint *outId)
+        *outId = handle;
+        return true;
+    }
+    return false;
+}
+
+bool HandleAllocator::isFree(GLuint handle) const
+{
+    const size_t wordIndex = handle / kBitsPerWord;
+    return !mFreeBits.empty() && wordIndex < mFreeBits[0].size() &&
+           (mFreeBits[0][wordIndex] >> (handle % kBitsPerWord) & 1) != 0;
+}
+
+void HandleAllocator::markFree(GLuint handle)
 {
-    // Allocate from released list, constant time for FIFO pop_front.
-    if (mReleasedList.size() > mMinimumReleasedToKeep)
+    ASSERT(handle < mNextUnusedHandle && !isFree(handle));
+
+    // Grow the bitmap to cover the handle, adding levels until the last one has a single word.  A
+    // new level starts with the summary of the level below.
+    size_t wordCount = handle / kBitsPerWord + 1;
+    for (size_t level = 0;; ++level)
     {
-        GLuint reusedHandle = mReleasedList.front();
-        mReleasedList.pop_front();
+        const bool isNewLevel = level == mFreeBits.size();
+        if (isNewLevel)
+        {
+            mFreeBits.emplace_back();
+        }
 
-        if (mLoggingEnabled)
+        std::vector<uint64_t> &bits = mFreeBits[level];
+        if (bits.size() < wordCount)
+        {
+            bits.resize(wordCount, 0);
+        }
+        if (isNewLevel && level > 0)
         {
-            WARN() << "HandleAllocator::allocate reusing " << reusedHandle << std::endl;
+            const std::vector<uint64_t> &lowerBits = mFreeBits[level - 1];
+            for (size_t index = 0; index < lowerBits.size(); ++index)
+            {
+                if (lowerBits[index] != 0)
+                {
+                    bits[index / kBitsPerWord] |= uint64_t(1) << (index % kBitsPerWord);
+                }
+            }
         }
 
-        if (outId)
+        if (level + 1 == mFreeBits.size() && bits.size() == 1)
         {
-            *outId = reusedHandle;
+            break;
         }
-        return true;
+        wordCount = (bits.size() + kBitsPerWord - 1) / kBitsPerWord;
     }
 
-    if (!mUnallocatedList.empty())
+    // Set the bit, and the summary bits of the words that were empty.
+    size_t index = handle;
+    for (std::vector<uint64_t> &bits : mFreeBits)
     {
-        // Allocate from unallocated list, constant time.
-        auto listIt = mUnallocatedList.begin();
+        uint64_t &word      = bits[index / kBitsPerWord];
+        const bool wasEmpty = word == 0;
 
-        GLuint freeListHandle = listIt->begin;
-        ASSERT(freeListHandle > 0);
-
-        if (listIt->begin == listIt->end)
+        word |= uint64_t(1) << (index % kBitsPerWord);
+        if (!wasEmpty)
         {
-            mUnallocatedList.erase(listIt);
+            break;
         }
-        else
+        index /= kBitsPerWord;
+    }
+
+    ++mFreeHandleCount;
+}
+
+void HandleAllocator::clearFreeBits(size_t wordIndex, uint64_t bits)
+{
+    ASSERT((mFreeBits[0][wordIndex] & bits) == bits);
+    mFreeHandleCount -= gl::BitCount(bits);
+
+    // Clear the bits, and the summary bits of the words that became empty.
+    size_t index = wordIndex;
+    for (std::vector<uint64_t> &levelBits : mFreeBits)
+    {
+        levelBits[index] &= ~bits;
+        if (levelBits[index] != 0)
         {
-            angle::CheckedNumeric<GLuint> checkedBegin = listIt->begin;
-            checkedBegin++;
-            listIt->begin = checkedBegin.ValueOrDie();
+            break;
         }
 
+        bits = uint64_t(1) << (index % kBitsPerWord);
+        index /= kBitsPerWord;
+    }
+}
+
+void HandleAllocator::markUsed(GLuint handle)
+{
+    clearFreeBits(handle / kBitsPerWord, uint64_t(1) << (handle % kBitsPerWord));
+}
+
+size_t HandleAllocator::findLowestFreeWord() const
+{
+    ASSERT(mFreeHandleCount > 0);
+
+    // Descend from the single word of the last level.
+    size_t index = 0;
+    for (size_t level = mFreeBits.size() - 1; level > 0; --level)
+    {
+        index = index * kBitsPerWord + gl::ScanForward(mFreeBits[level][index]);
+    }
+    return index;
+}
+
+bool HandleAllocator::allocate(GLuint *outId)
+{
+    GLuint handle = 0;
+    if (mFreeHandleCount > 0)
+    {
+        // Allocate the lowest released handle.
+        const size_t wordIndex = findLowestFreeWord();
+        const uint64_t word    = mFreeBits[0][wordIndex];
+        const uint64_t bit     = word & (~word + 1);
+
+        handle = static_cast<GLuint>(wordIndex * kBitsPerWord + gl::ScanForward(bit));
+        clearFreeBits(wordIndex, bit);
+
         if (mLoggingEnabled)
         {
-            WARN() << "HandleAllocator::allocate allocating " << freeListHandle << std::endl;
+            WARN() << "HandleAllocator::allocate reusing " << handle << std::endl;
         }
-
-        if (outId)
+    }
+    else if (allocateUnused(&handle))
+    {
+        if (mLoggingEnabled)
         {
-            *outId = freeListHandle;
+            WARN() << "HandleAllocator::allocate allocating " << handle << std::endl;
         }
-        return true;
     }
-
-    if (!mReleasedList.empty())
+    else if (!mReleasedList.empty())
     {
-        GLuint reusedHandle = mReleasedList.front();
+        // All other handles are exhausted, so recycle the kept handles.
+        handle = mReleasedList.front();
         mReleasedList.pop_front();
 
         if (mLoggingEnabled)
         {
-            WARN() << "HandleAllocator::allocate reusing " << reusedHandle << std::endl;
+            WARN() << "HandleAllocator::allocate reusing " << handle << std::endl;
         }
+    }
+    else
+    {
+        return false;
+    }
+
+    if (outId)
+    {
+        *outId = handle;
+    }
+    return true;
+}
 
-        if (outId)
+bool HandleAllocator::allocateMultiple(size_t count, GLuint *outIds)
+{
+    if (count > mFreeHandleCount + getUnusedHandleCount() + mReleasedList.size())
+    {
+        return false;
+    }
+
+    size_t allocated = 0;
+
+    // Take the released handles a word at a time.
+    while (allocated < count && mFreeHandleCount > 0)
+    {
+        const size_t wordIndex   = findLowestFreeWord();
+        const size_t firstHandle = wordIndex * kBitsPerWord;
+        uint64_t word            = mFreeBits[0][wordIndex];
+        uint64_t taken           = 0;
+        for (; word != 0 && allocated < count; ++allocated)
         {
-            *outId = reusedHandle;
+            const uint64_t bit = word & (~word + 1);
+            outIds[allocated]  = static_cast<GLuint>(firstHandle + gl::ScanForward(bit));
+
+            taken |= bit;
+            word  &= ~bit;
         }
-        return true;
+        clearFreeBits(wordIndex, taken);
     }
 
-    return false;
+    // Then the never allocated handles, which are contiguous unless some were reserved.
+    for (; allocated < count; ++allocated)
+    {
+        if (!allocateUnused(&outIds[allocated]))
+        {
+            break;
+        }
+    }
+
+    for (; allocated < count; ++allocated)
+    {
+        ASSERT(!mReleasedList.empty());
+        outIds[allocated] = mReleasedList.front();
+        mReleasedList.pop_front();
+    }
+
+    if (mLoggingEnabled)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            WARN() << "HandleAllocator::allocateMultiple allocating " << outIds[index]
+                   << std::endl;
+        }
+    }
+
+    return true;
 }
 
 void HandleAllocator::release(GLuint handle)
@@ -111,33 +264,37 @@ void HandleAllocator::release(GLuint handle)
         WARN() << "HandleAllocator::release releasing " << handle << std::endl;
     }
 
-    if (handle >= mMaxValue)
+    if (handle == 0 || handle >= mMaxValue)
     {
         // Handle is outside the range of allocated handles, do not reclaim it.
         return;
     }
 
-    // Try consolidating the ranges first.
-    for (HandleRange &handleRange : mUnallocatedList)
+    if (handle >= mNextUnusedHandle)
     {
-        angle::CheckedNumeric<GLuint> checkedBegin = handleRange.begin;
-        angle::CheckedNumeric<GLuint> checkedEnd   = handleRange.end;
+        // The handle was reserved but never allocated, so it only needs to be unreserved.
+        mReservedUnusedHandles.erase(handle);
+        return;
+    }
 
-        if ((checkedBegin - 1).ValueOrDie() == handle)
-        {
-            handleRange.begin = (checkedBegin - 1).ValueOrDie();
-            return;
-        }
+    if (isFree(handle))
+    {
+        return;
+    }
 
-        if (checkedEnd.ValueOrDie() == (handle - 1))
+    if (mMinimumReleasedToKeep > 0)
+    {
+        // Keep the handle out of circulation until enough other handles have been released.
+        mReleasedList.push_back(handle);
+        if (mReleasedList.size() <= mMinimumReleasedToKeep)
         {
-            handleRange.end = (checkedEnd + 1).ValueOrDie();
             return;
         }
+        handle = mReleasedList.front();
+        mReleasedList.pop_front();
     }
 
-    // Add to released list, constant time for FIFO push_back.
-    mReleasedList.push_back(handle);
+    markFree(handle);
 }
 
 void HandleAllocator::reserve(GLuint handle)
@@ -147,69 +304,59 @@ void HandleAllocator::reserve(GLuint handle)
         WARN() << "HandleAllocator::reserve reserving " << handle << std::endl;
     }
 
-    if (handle >= mMaxValue)
+    if (handle == 0 || handle >= mMaxValue)
     {
         // Handle being reserved is outside the range of allocated handles. Allow this and don't
         // update the tracking.
         return;
     }
 
-    // Clear from released list -- might be a slow operation.
-    if (!mReleasedList.empty())
+    if (handle == mNextUnusedHandle)
     {
-        auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
-        if (releasedIt != mReleasedList.end())
+        // Names reserved in increasing order from the watermark just move it, along with any
+        // names reserved right above.
+        ++mNextUnusedHandle;
+        while (!mReservedUnusedHandles.empty() &&
+               *mReservedUnusedHandles.begin() == mNextUnusedHandle)
         {
-            mReleasedList.erase(releasedIt);
-            return;
+            mReservedUnusedHandles.erase(mReservedUnusedHandles.begin());
+            ++mNextUnusedHandle;
         }
+        return;
     }
 
-    // Not in released list, reserve in the unallocated list.
-    auto boundIt = std::lower_bound(mUnallocatedList.begin(), mUnallocatedList.end(), handle,
-                                    HandleRangeComparator());
-
-    ASSERT(boundIt != mUnallocatedList.end());
-
-    GLuint begin = boundIt->begin;
-    GLuint end   = boundIt->end;
-
-    if (handle == begin || handle == end)
+    if (handle > mNextUnusedHandle)
     {
-        if (begin == end)
-        {
-            mUnallocatedList.erase(boundIt);
-        }
-        else if (handle == begin)
-        {
-            boundIt->begin++;
-        }
-        else
-        {
-            ASSERT(handle == end);
-            boundIt->end--;
-        }
+        mReservedUnusedHandles.insert(handle);
         return;
     }
 
-    ASSERT(begin < handle && handle < end);
+    if (isFree(handle))
+    {
+        markUsed(handle);
+        return;
+    }
 
-    // need to split the range
-    auto placementIt = mUnallocatedList.erase(boundIt);
-    placementIt      = mUnallocatedList.insert(placementIt, HandleRange(handle + 1, end));
-    mUnallocatedList.insert(placementIt, HandleRange(begin, handle - 1));
+    // Clear from released list -- might be a slow operation.
+    auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
+    if (releasedIt != mReleasedList.end())
+    {
+        mReleasedList.erase(releasedIt);
+    }
 }
 
 void HandleAllocator::reset()
 {
-    mUnallocatedList.clear();
-    mUnallocatedList.push_back(HandleRange(1, mMaxValue));
+    mNextUnusedHandle = 1;
+    mReservedUnusedHandles.clear();
+    mFreeBits.clear();
+    mFreeHandleCount = 0;
     mReleasedList.clear();
 }
 
 bool HandleAllocator::anyHandleAvailableForAllocation() const
 {
-    return !mUnallocatedList.empty() || !mReleasedList.empty();
+    return mFreeHandleCount > 0 || getUnusedHandleCount() > 0 || !mReleasedList.empty();
 }
 
 void HandleAllocator::enableLogging(bool enabled)
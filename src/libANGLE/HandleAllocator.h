@@ -11,6 +11,7 @@
 #define LIBANGLE_HANDLEALLOCATOR_H_
 
 #include <deque>
+#include <set>
 #include <vector>
 
 #include "common/angleutils.h"
@@ -27,7 +28,10 @@ class HandleAllocator final : angle::NonCopyable
 
     ~HandleAllocator();
 
+    // Allocates the lowest free handle.
     bool allocate(GLuint *outId);
+    // Allocates |count| handles in increasing order, or none if there are not enough free handles.
+    bool allocateMultiple(size_t count, GLuint *outIds);
     void release(GLuint handle);
     void reserve(GLuint handle);
     void reset();
@@ -36,24 +40,33 @@ class HandleAllocator final : angle::NonCopyable
     void enableLogging(bool enabled);
 
   private:
+    static constexpr uint32_t kBitsPerWord = 64;
+
+    uint64_t getUnusedHandleCount() const;
+    bool allocateUnused(GLuint *outId);
+    bool isFree(GLuint handle) const;
+    void markFree(GLuint handle);
+    void markUsed(GLuint handle);
+    void clearFreeBits(size_t wordIndex, uint64_t bits);
+    size_t findLowestFreeWord() const;
+
     const GLuint mMaxValue;
     const GLuint mMinimumReleasedToKeep;
 
-    // Represents an inclusive range [begin, end]
-    struct HandleRange
-    {
-        HandleRange(GLuint beginIn, GLuint endIn) : begin(beginIn), end(endIn) {}
-
-        GLuint begin;
-        GLuint end;
-    };
+    // Handles at or above mNextUnusedHandle have never been allocated, except for those in
+    // mReservedUnusedHandles.  A set keeps reserving names in any order logarithmic.
+    uint64_t mNextUnusedHandle;
+    std::set<GLuint> mReservedUnusedHandles;
 
-    struct HandleRangeComparator;
+    // Handles below mNextUnusedHandle that were released are tracked in a hierarchical bitmap.
+    // mFreeBits[0] has one bit per handle, set if the handle is free.  Each bit of
+    // mFreeBits[level + 1] is set if the corresponding word of mFreeBits[level] is not zero.  The
+    // last level has a single word, so the lowest free handle is found in one step per level.
+    std::vector<std::vector<uint64_t>> mFreeBits;
+    size_t mFreeHandleCount;
 
-    // The freelist consists of never-allocated handles, stored
-    // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
-    std::vector<HandleRange> mUnallocatedList;
+    // With mMinimumReleasedToKeep, the most recently released handles are held in a FIFO so they
+    // are not reused immediately.
     std::deque<GLuint> mReleasedList;
 
     bool mLoggingEnabled;
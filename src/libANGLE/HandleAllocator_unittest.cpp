@@ -6,6 +6,8 @@
 // Unit tests for HandleAllocator.
 //
 
+#include <algorithm>
+#include <random>
 #include <unordered_set>
 #include "common/unsafe_buffers.h"
 
@@ -292,8 +294,8 @@ TEST(HandleAllocatorTest, HandleExhaustion)
     EXPECT_FALSE(allocator.anyHandleAvailableForAllocation());
 }
 
-// Verifies that released handles are reused in FIFO order.
-TEST(HandleAllocatorTest, ReleaseThenReuseInFIFO)
+// Verifies that released handles are reused lowest first, regardless of the release order.
+TEST(HandleAllocatorTest, ReleaseThenReuseLowestFirst)
 {
     gl::HandleAllocator allocator(1000);
 
@@ -304,21 +306,25 @@ TEST(HandleAllocatorTest, ReleaseThenReuseInFIFO)
         ANGLE_UNSAFE_TODO(EXPECT_TRUE(allocator.allocate(&handles[i])));
     }
 
-    // Release handles in a non-sorted order. None is adjacent to 12, so all go into mReleasedList
-    // rather than being consolidated into mUnallocatedList.
+    // Release handles in a non-sorted order.
     constexpr GLuint kReleaseOrder[] = {3, 1, 5, 2, 4, 8, 6, 10, 7, 9};
     for (GLuint i : kReleaseOrder)
     {
         allocator.release(i);
     }
 
-    // Each allocation should return the next handle in the same order they were released.
-    for (GLuint expected : kReleaseOrder)
+    // Each allocation should return the lowest released handle.
+    for (GLuint expected = 1; expected <= 10; expected++)
     {
         GLuint handle = 0;
         EXPECT_TRUE(allocator.allocate(&handle));
         EXPECT_EQ(expected, handle);
     }
+
+    // Once the released handles are exhausted, allocation continues after the highest handle.
+    GLuint handle = 0;
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(12u, handle);
 }
 
 // Verifies that reserve() correctly removes handles from the released list even when the released
@@ -395,7 +401,8 @@ TEST(HandleAllocatorTest, InterleavedReleaseAllocate)
         releasedHandles2.push_back(pool[i]);
     }
 
-    // Allocate them back. It should return in FIFO order.
+    // Allocate them back. The pool was allocated in increasing order, so the handles are returned
+    // in the same order they were released.
     for (GLuint handle : releasedHandles)
     {
         GLuint newHandle;
@@ -482,4 +489,145 @@ TEST(HandleAllocatorTest, MinimumReleasedToKeepExhaustionFallback)
     EXPECT_EQ(1u, handle);
 }
 
+// Test that allocateMultiple returns the lowest free handles in increasing order.
+TEST(HandleAllocatorTest, AllocateMultiple)
+{
+    gl::HandleAllocator allocator(kMaxHandleForTesting);
+
+    std::vector<GLuint> handles(200);
+    EXPECT_TRUE(allocator.allocateMultiple(handles.size(), handles.data()));
+    for (GLuint i = 0; i < handles.size(); i++)
+    {
+        EXPECT_EQ(i + 1, handles[i]);
+    }
+
+    // Release a few handles spanning multiple bitmap words and reserve one past the end.
+    constexpr GLuint kReleased[] = {150, 3, 70, 64, 65, 200};
+    for (GLuint handle : kReleased)
+    {
+        allocator.release(handle);
+    }
+    allocator.reserve(202);
+
+    // The released handles are reused first, then new handles are allocated, skipping the
+    // reserved one.
+    constexpr GLuint kExpected[] = {3, 64, 65, 70, 150, 200, 201, 203, 204};
+    GLuint allocated[ArraySize(kExpected)] = {};
+    EXPECT_TRUE(allocator.allocateMultiple(ArraySize(kExpected), allocated));
+    for (size_t i = 0; i < ArraySize(kExpected); i++)
+    {
+        ANGLE_UNSAFE_TODO(EXPECT_EQ(kExpected[i], allocated[i]));
+    }
+
+    // Allocating nothing always succeeds.
+    EXPECT_TRUE(allocator.allocateMultiple(0, nullptr));
+}
+
+// Test that allocateMultiple fails without allocating anything when there are not enough handles.
+TEST(HandleAllocatorTest, AllocateMultipleExhaustion)
+{
+    gl::HandleAllocator allocator(10);
+
+    GLuint handles[10] = {};
+    EXPECT_TRUE(allocator.allocateMultiple(5, handles));
+    allocator.release(2);
+    allocator.release(4);
+
+    // Only 7 handles are available.
+    EXPECT_FALSE(allocator.allocateMultiple(8, handles));
+
+    EXPECT_TRUE(allocator.allocateMultiple(7, handles));
+    constexpr GLuint kExpected[] = {2, 4, 6, 7, 8, 9, 10};
+    for (size_t i = 0; i < ArraySize(kExpected); i++)
+    {
+        ANGLE_UNSAFE_TODO(EXPECT_EQ(kExpected[i], handles[i]));
+    }
+    EXPECT_FALSE(allocator.anyHandleAvailableForAllocation());
+}
+
+// Test that allocateMultiple honors MinimumReleasedToKeep the same way allocate does.
+TEST(HandleAllocatorTest, AllocateMultipleMinimumReleasedToKeep)
+{
+    gl::HandleAllocator allocator(100, 2);
+
+    GLuint handles[5] = {};
+    EXPECT_TRUE(allocator.allocateMultiple(5, handles));
+
+    // Handle 1 is no longer quarantined once 3 handles have been released.
+    allocator.release(1);
+    allocator.release(2);
+    allocator.release(3);
+
+    EXPECT_TRUE(allocator.allocateMultiple(2, handles));
+    EXPECT_EQ(1u, handles[0]);
+    EXPECT_EQ(6u, handles[1]);
+}
+
+// Test that heavy allocate/release churn keeps reusing the lowest handles instead of growing.
+TEST(HandleAllocatorTest, ChurnReusesLowestHandles)
+{
+    gl::HandleAllocator allocator(kMaxHandleForTesting);
+    constexpr size_t kBatchSize = 1000;
+
+    std::vector<GLuint> handles(kBatchSize);
+    std::mt19937 generator(42);
+    for (int iteration = 0; iteration < 100; iteration++)
+    {
+        EXPECT_TRUE(allocator.allocateMultiple(kBatchSize, handles.data()));
+        for (size_t i = 0; i < kBatchSize; i++)
+        {
+            EXPECT_EQ(i + 1, handles[i]);
+        }
+
+        std::shuffle(handles.begin(), handles.end(), generator);
+        for (GLuint handle : handles)
+        {
+            allocator.release(handle);
+        }
+    }
+}
+
+// Test that names reserved in increasing order, starting at or above the next unused handle, are
+// skipped by allocation and become available again once released.
+TEST(HandleAllocatorTest, ReserveAscending)
+{
+    gl::HandleAllocator allocator(kMaxHandleForTesting);
+    constexpr GLuint kReserveCount = 1000;
+
+    // Reserve the names right after the next unused handle, plus a range further up.
+    for (GLuint handle = 1; handle <= kReserveCount; ++handle)
+    {
+        allocator.reserve(handle);
+    }
+    for (GLuint handle = kReserveCount + 10; handle < kReserveCount * 2; ++handle)
+    {
+        allocator.reserve(handle);
+    }
+    // Filling the gap joins the two ranges.
+    for (GLuint handle = kReserveCount + 1; handle < kReserveCount + 10; ++handle)
+    {
+        allocator.reserve(handle);
+    }
+
+    GLuint handle = 0;
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(kReserveCount * 2, handle);
+
+    // A released reserved name is reused first.
+    allocator.release(5);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(5u, handle);
+
+    // Reserved names above the next unused handle that are released are not skipped anymore.
+    allocator.reserve(kReserveCount * 2 + 2);
+    allocator.reserve(kReserveCount * 2 + 3);
+    allocator.release(kReserveCount * 2 + 2);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(kReserveCount * 2 + 1, handle);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(kReserveCount * 2 + 2, handle);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(kReserveCount * 2 + 4, handle);
+}
+
 }  // anonymous namespace
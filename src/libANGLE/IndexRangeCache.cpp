@@ -9,12 +9,23 @@
 
 #include "libANGLE/IndexRangeCache.h"
 
+#include "common/FastVector.h"
+#include "common/bitset_utils.h"
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "libANGLE/formatutils.h"
 
+#include <algorithm>
+
 namespace gl
 {
 
+size_t IndexRangeKeyHash::operator()(const IndexRangeKey &key) const
+{
+    return angle::HashMultiple(static_cast<uint8_t>(key.type), key.offset, key.count,
+                               key.primitiveRestartEnabled);
+}
+
 IndexRangeCache::IndexRangeCache() {}
 
 IndexRangeCache::~IndexRangeCache() {}
@@ -25,7 +36,31 @@ void IndexRangeCache::addRange(DrawElementsType type,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    const IndexRangeKey key(type, offset, count, primitiveRestartEnabled);
+
+    auto iter = mLookup.find(key);
+    if (iter != mLookup.end())
+    {
+        mEntries[iter->second].range = range;
+        return;
+    }
+
+    const uint32_t slot = allocateSlot();
+    Entry &entry        = mEntries[slot];
+    entry.key           = key;
+    entry.range         = range;
+    entry.byteStart     = offset;
+    entry.byteEnd       = offset + GetDrawElementsTypeSize(type) * count;
+    const size_t span   = entry.byteEnd - entry.byteStart;
+    entry.sizeClass =
+        span == 0 ? 0 : static_cast<uint8_t>(gl::ScanReverse(static_cast<uint64_t>(span)));
+    // A new entry has to be looked up again to survive the next eviction sweep, so that ranges
+    // that are only ever drawn once are the first to go.
+    entry.referenced = false;
+    entry.inUse      = true;
+
+    mLookup.emplace(key, slot);
+    insertInterval(slot);
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
@@ -34,12 +69,14 @@ bool IndexRangeCache::findRange(DrawElementsType type,
                                 bool primitiveRestartEnabled,
                                 IndexRange *outRange) const
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    auto i = mLookup.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
+    if (i != mLookup.end())
     {
+        const Entry &entry = mEntries[i->second];
+        entry.referenced   = true;
         if (outRange)
         {
-            *outRange = i->second;
+            *outRange = entry.range;
         }
         return true;
     }
@@ -55,51 +92,145 @@ bool IndexRangeCache::findRange(DrawElementsType type,
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
-    size_t invalidateStart = offset;
-    size_t invalidateEnd   = offset + size;
+    const size_t invalidateStart = offset;
+    const size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    angle::FastVector<uint32_t, 16> invalidatedSlots;
+
+    for (size_t sizeClass : angle::BitSet64<kSizeClassCount>(mNonEmptySizeClasses))
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd =
-            i->first.offset + (GetDrawElementsTypeSize(i->first.type) * i->first.count);
+        // Entries of this size class span less than 2^(sizeClass + 1) bytes, so only those that
+        // start less than that before |invalidateStart| can reach it.
+        const size_t maxSpan = sizeClass + 1 >= kSizeClassCount
+                                   ? std::numeric_limits<size_t>::max()
+                                   : (static_cast<size_t>(1) << (sizeClass + 1)) - 1;
+        const size_t searchStart = invalidateStart > maxSpan ? invalidateStart - maxSpan : 0;
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
-        {
-            ++i;
-        }
-        else
+        const IntervalList &intervals = mIntervals[sizeClass];
+        auto iter = std::lower_bound(intervals.begin(), intervals.end(), searchStart,
+                                     [](const IntervalRef &interval, size_t start) {
+                                         return interval.byteStart < start;
+                                     });
+        for (; iter != intervals.end() && iter->byteStart <= invalidateEnd; ++iter)
         {
-            mIndexRangeCache.erase(i++);
+            if (mEntries[iter->slot].byteEnd >= invalidateStart)
+            {
+                invalidatedSlots.push_back(iter->slot);
+            }
         }
     }
+
+    for (uint32_t slot : invalidatedSlots)
+    {
+        eraseSlot(slot);
+    }
 }
 
 void IndexRangeCache::clear()
 {
-    mIndexRangeCache.clear();
+    mEntries.clear();
+    mFreeSlots.clear();
+    mLookup.clear();
+    for (IntervalList &intervals : mIntervals)
+    {
+        intervals.clear();
+    }
+    mNonEmptySizeClasses = 0;
+    mClockHand           = 0;
 }
 
-bool IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+uint32_t IndexRangeCache::allocateSlot()
 {
-    if (type != rhs.type)
+    if (mLookup.size() >= kMaxEntries)
     {
-        return type < rhs.type;
+        evictOne();
     }
-    if (offset != rhs.offset)
+
+    if (!mFreeSlots.empty())
+    {
+        const uint32_t slot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+        return slot;
+    }
+
+    mEntries.emplace_back();
+    return static_cast<uint32_t>(mEntries.size() - 1);
+}
+
+void IndexRangeCache::evictOne()
+{
+    ASSERT(!mLookup.empty());
+
+    // Second-chance (clock) eviction: referenced entries get their bit cleared and are skipped,
+    // so this finishes within two sweeps of the entries.
+    while (true)
     {
-        return offset < rhs.offset;
+        if (mClockHand >= mEntries.size())
+        {
+            mClockHand = 0;
+        }
+        const uint32_t slot = mClockHand++;
+        Entry &entry        = mEntries[slot];
+
+        if (!entry.inUse)
+        {
+            continue;
+        }
+        if (entry.referenced)
+        {
+            entry.referenced = false;
+            continue;
+        }
+
+        eraseSlot(slot);
+        return;
     }
-    if (count != rhs.count)
+}
+
+void IndexRangeCache::eraseSlot(uint32_t slot)
+{
+    Entry &entry = mEntries[slot];
+    ASSERT(entry.inUse);
+
+    eraseInterval(slot);
+    mLookup.erase(entry.key);
+    entry.inUse = false;
+    mFreeSlots.push_back(slot);
+}
+
+void IndexRangeCache::insertInterval(uint32_t slot)
+{
+    const Entry &entry      = mEntries[slot];
+    IntervalList &intervals = mIntervals[entry.sizeClass];
+
+    auto iter = std::upper_bound(intervals.begin(), intervals.end(), entry.byteStart,
+                                 [](size_t start, const IntervalRef &interval) {
+                                     return start < interval.byteStart;
+                                 });
+    intervals.insert(iter, {entry.byteStart, slot});
+    mNonEmptySizeClasses |= static_cast<uint64_t>(1) << entry.sizeClass;
+}
+
+void IndexRangeCache::eraseInterval(uint32_t slot)
+{
+    const Entry &entry      = mEntries[slot];
+    IntervalList &intervals = mIntervals[entry.sizeClass];
+
+    auto iter = std::lower_bound(intervals.begin(), intervals.end(), entry.byteStart,
+                                 [](const IntervalRef &interval, size_t start) {
+                                     return interval.byteStart < start;
+                                 });
+    while (iter->slot != slot)
     {
-        return count < rhs.count;
+        ++iter;
+        ASSERT(iter != intervals.end() && iter->byteStart == entry.byteStart);
     }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
+    intervals.erase(iter);
+
+    if (intervals.empty())
     {
-        return primitiveRestartEnabled;
+        mNonEmptySizeClasses &= ~(static_cast<uint64_t>(1) << entry.sizeClass);
     }
-    return false;
 }
 
 }  // namespace gl
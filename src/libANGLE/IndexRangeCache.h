@@ -13,9 +13,11 @@
 #include "angle_gl.h"
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
+#include "common/hash_containers.h"
 #include "common/mathutil.h"
 
-#include <map>
+#include <array>
+#include <vector>
 
 namespace gl
 {
@@ -24,7 +26,6 @@ struct IndexRangeKey
 {
     IndexRangeKey() = default;
     IndexRangeKey(DrawElementsType type, size_t offset, size_t count, bool primitiveRestart);
-    bool operator<(const IndexRangeKey &rhs) const;
     bool operator==(const IndexRangeKey &rhs) const;
 
     DrawElementsType type{DrawElementsType::InvalidEnum};
@@ -33,9 +34,22 @@ struct IndexRangeKey
     bool primitiveRestartEnabled{false};
 };
 
-class IndexRangeCache
+struct IndexRangeKeyHash
+{
+    size_t operator()(const IndexRangeKey &key) const;
+};
+
+// Caches the index ranges computed for (type, offset, count, primitive restart) draws of a buffer.
+// Lookups are hashed.  For invalidation, entries are additionally indexed by the byte interval
+// they cover, bucketed by the power-of-two size class of that interval, so that a
+// glBufferSubData only visits entries whose start offset is close enough to the written range to
+// possibly overlap it.  The number of entries is bounded; when full, an entry that was not used
+// recently is evicted.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
+    static constexpr size_t kMaxEntries = 4096;
+
     IndexRangeCache();
     ~IndexRangeCache();
 
@@ -50,11 +64,50 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // Removes all ranges touching the bytes [offset, offset + size].
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    size_t size() const { return mLookup.size(); }
+
   private:
-    std::map<IndexRangeKey, IndexRange> mIndexRangeCache;
+    static constexpr size_t kSizeClassCount = sizeof(size_t) * 8;
+    static constexpr uint32_t kInvalidSlot  = 0xFFFFFFFFu;
+
+    struct Entry
+    {
+        IndexRangeKey key;
+        IndexRange range;
+        // Inclusive byte interval [byteStart, byteEnd] that the indices were read from.
+        size_t byteStart  = 0;
+        size_t byteEnd    = 0;
+        uint8_t sizeClass = 0;
+        // Set on lookup and cleared by the eviction clock; entries with the bit clear are evicted.
+        mutable bool referenced = false;
+        bool inUse              = false;
+    };
+
+    // An entry in the interval index.  Each size class is kept sorted by byteStart.
+    struct IntervalRef
+    {
+        size_t byteStart;
+        uint32_t slot;
+    };
+    using IntervalList = std::vector<IntervalRef>;
+
+    uint32_t allocateSlot();
+    void evictOne();
+    void eraseSlot(uint32_t slot);
+    void insertInterval(uint32_t slot);
+    void eraseInterval(uint32_t slot);
+
+    std::vector<Entry> mEntries;
+    std::vector<uint32_t> mFreeSlots;
+    angle::HashMap<IndexRangeKey, uint32_t, IndexRangeKeyHash> mLookup;
+    std::array<IntervalList, kSizeClassCount> mIntervals;
+    // Bit i is set if mIntervals[i] is non-empty.
+    uint64_t mNonEmptySizeClasses = 0;
+    uint32_t mClockHand           = 0;
 };
 
 // First level cache stored inline at the query site.
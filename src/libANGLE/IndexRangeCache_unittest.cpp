@@ -0,0 +1,120 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range cache.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace gl
+{
+namespace
+{
+constexpr DrawElementsType kUShort = DrawElementsType::UnsignedShort;
+constexpr DrawElementsType kUInt   = DrawElementsType::UnsignedInt;
+
+// Tests that ranges are found by their exact key only.
+TEST(IndexRangeCacheTest, AddAndFind)
+{
+    IndexRangeCache cache;
+    cache.addRange(kUShort, 0, 6, false, IndexRange(0, 5));
+    cache.addRange(kUShort, 0, 6, true, IndexRange(1, 4));
+    cache.addRange(kUInt, 0, 6, false, IndexRange(2, 3));
+    EXPECT_EQ(3u, cache.size());
+
+    IndexRange range;
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 6, false, &range));
+    EXPECT_EQ(IndexRange(0, 5), range);
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 6, true, &range));
+    EXPECT_EQ(IndexRange(1, 4), range);
+    EXPECT_TRUE(cache.findRange(kUInt, 0, 6, false, &range));
+    EXPECT_EQ(IndexRange(2, 3), range);
+
+    EXPECT_FALSE(cache.findRange(kUShort, 2, 6, false, &range));
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 3, false, &range));
+
+    // Re-adding a key replaces its range.
+    cache.addRange(kUShort, 0, 6, false, IndexRange(7, 9));
+    EXPECT_EQ(3u, cache.size());
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 6, false, &range));
+    EXPECT_EQ(IndexRange(7, 9), range);
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 6, false, &range));
+}
+
+// Tests that invalidation removes exactly the ranges touching the written bytes.
+TEST(IndexRangeCacheTest, InvalidateOverlapping)
+{
+    IndexRangeCache cache;
+
+    // 100 ranges of 8 ushort indices each, covering bytes [i * 32, i * 32 + 16].
+    for (size_t i = 0; i < 100; ++i)
+    {
+        cache.addRange(kUShort, i * 32, 8, false, IndexRange(0, 1));
+    }
+    // A large range covering the first 1000 bytes.
+    cache.addRange(kUInt, 0, 250, false, IndexRange(0, 1));
+    EXPECT_EQ(101u, cache.size());
+
+    // Write between two ranges, without touching either.
+    cache.invalidateRange(32 * 10 + 17, 10);
+    EXPECT_EQ(100u, cache.size());
+    EXPECT_FALSE(cache.findRange(kUInt, 0, 250, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 32 * 10, 8, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 32 * 11, 8, false, nullptr));
+
+    // Write one byte in the middle of a range.
+    cache.invalidateRange(32 * 50 + 4, 1);
+    EXPECT_EQ(99u, cache.size());
+    EXPECT_FALSE(cache.findRange(kUShort, 32 * 50, 8, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 32 * 49, 8, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 32 * 51, 8, false, nullptr));
+
+    // Ranges whose end touches the written bytes are invalidated too.
+    cache.invalidateRange(32 * 60 + 16, 0);
+    EXPECT_EQ(98u, cache.size());
+    EXPECT_FALSE(cache.findRange(kUShort, 32 * 60, 8, false, nullptr));
+
+    // A write spanning several ranges.
+    cache.invalidateRange(32 * 70, 32 * 5);
+    EXPECT_EQ(92u, cache.size());
+    for (size_t i = 70; i <= 75; ++i)
+    {
+        EXPECT_FALSE(cache.findRange(kUShort, i * 32, 8, false, nullptr));
+    }
+    EXPECT_TRUE(cache.findRange(kUShort, 32 * 69, 8, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 32 * 76, 8, false, nullptr));
+}
+
+// Tests that the cache is bounded, and that recently used ranges survive eviction.
+TEST(IndexRangeCacheTest, Eviction)
+{
+    IndexRangeCache cache;
+
+    for (size_t i = 0; i < IndexRangeCache::kMaxEntries; ++i)
+    {
+        cache.addRange(kUShort, i * 2, 1, false, IndexRange(0, 1));
+    }
+    EXPECT_EQ(IndexRangeCache::kMaxEntries, cache.size());
+
+    // Keep using the first range while many new ranges are added.
+    for (size_t i = 0; i < IndexRangeCache::kMaxEntries; ++i)
+    {
+        EXPECT_TRUE(cache.findRange(kUShort, 0, 1, false, nullptr));
+        cache.addRange(kUShort, (IndexRangeCache::kMaxEntries + i) * 2, 1, false,
+                       IndexRange(0, 1));
+        EXPECT_EQ(IndexRangeCache::kMaxEntries, cache.size());
+    }
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 1, false, nullptr));
+
+    // Evicted entries are no longer invalidated, and the remaining ones still are.
+    cache.invalidateRange(0, IndexRangeCache::kMaxEntries * 4);
+    EXPECT_EQ(0u, cache.size());
+}
+}  // anonymous namespace
+}  // namespace gl
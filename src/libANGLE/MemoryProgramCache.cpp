@@ -58,6 +58,19 @@ void AppendProgramAliasedBindings(angle::BlobCacheHasher &hasher,
     }
 }
 
+void CacheProgramOnPlatform(const egl::BlobCache::Key &programHash,
+                            const angle::MemoryBuffer &compressedData)
+{
+    // TODO: http://anglebug.com/42266037
+    // This was a workaround for Chrome until it added support for EGL_ANDROID_blob_cache,
+    // tracked by http://anglebug.com/42261225. This issue has since been closed, but removing
+    // this still causes a test failure.
+    auto *platform            = ANGLEPlatformCurrent();
+    angle::ProgramKeyType key = {};
+    ANGLE_UNSAFE_TODO(memcpy(key.data(), programHash.data(), angle::kBlobCacheKeyLength));
+    platform->cacheProgram(platform, key, compressedData.size(), compressedData.data());
+}
+
 }  // anonymous namespace
 
 MemoryProgramCache::MemoryProgramCache(egl::BlobCache &blobCache) : mBlobCache(blobCache) {}
@@ -205,27 +218,14 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
         return angle::Result::Continue;
     }
 
-    angle::MemoryBuffer compressedData;
-    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData))
+    // The blob cache copies the program only if it compresses it in the background, as the
+    // serialized binary is kept for glGetProgramBinary.
+    if (!mBlobCache.compressAndPut(context, programHash, serializedProgram,
+                                   CacheProgramOnPlatform))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing binary data.");
-        return angle::Result::Continue;
     }
-
-    {
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCache.getMutex());
-        // TODO: http://anglebug.com/42266037
-        // This was a workaround for Chrome until it added support for EGL_ANDROID_blob_cache,
-        // tracked by http://anglebug.com/42261225. This issue has since been closed, but removing
-        // this still causes a test failure.
-        auto *platform = ANGLEPlatformCurrent();
-        angle::ProgramKeyType key = {};
-        ANGLE_UNSAFE_TODO(memcpy(key.data(), programHash.data(), angle::kBlobCacheKeyLength));
-        platform->cacheProgram(platform, key, compressedData.size(), compressedData.data());
-    }
-
-    mBlobCache.put(context, programHash, std::move(compressedData));
     return angle::Result::Continue;
 }
 
@@ -33,7 +33,13 @@ namespace
 static constexpr size_t kMaxUncompressedShaderSize = 5 * 1024 * 1024;
 }  // namespace
 
-MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache) : mBlobCache(blobCache) {}
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache)
+    : mBlobCache(blobCache),
+      mHits(0),
+      mMisses(0),
+      mNormalizedSourceHits(0),
+      mSavedCompileMicroseconds(0)
+{}
 
 MemoryShaderCache::~MemoryShaderCache() {}
 
@@ -58,15 +64,25 @@ egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
             ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                                "Error decompressing shader binary data from cache.");
             mBlobCache.remove(shaderHash);
+            mMisses.fetch_add(1, std::memory_order_relaxed);
             return egl::CacheGetResult::NotFound;
 
         case egl::BlobCache::GetAndDecompressResult::NotFound:
+            mMisses.fetch_add(1, std::memory_order_relaxed);
             return egl::CacheGetResult::NotFound;
 
         case egl::BlobCache::GetAndDecompressResult::Success:
             if (shader->loadBinary(context, uncompressedData.data(),
                                    static_cast<int>(uncompressedData.size()), resultExpectancy))
             {
+                mHits.fetch_add(1, std::memory_order_relaxed);
+                if (shader->getCacheEntrySourceHash() != shader->getSourceHash())
+                {
+                    mNormalizedSourceHits.fetch_add(1, std::memory_order_relaxed);
+                }
+                mSavedCompileMicroseconds.fetch_add(
+                    static_cast<uint64_t>(shader->getCompileSeconds() * 1e6),
+                    std::memory_order_relaxed);
                 return egl::CacheGetResult::Success;
             }
 
@@ -74,6 +90,7 @@ egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
             ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                                "Failed to load shader binary from cache.");
             mBlobCache.remove(shaderHash);
+            mMisses.fetch_add(1, std::memory_order_relaxed);
             return egl::CacheGetResult::Rejected;
     }
 
@@ -105,9 +122,7 @@ angle::Result MemoryShaderCache::putShader(const Context *context,
         return angle::Result::Continue;
     }
 
-    size_t compressedSize;
-    if (!mBlobCache.compressAndPut(context, shaderHash, std::move(serializedShader),
-                                   &compressedSize))
+    if (!mBlobCache.compressAndPut(context, shaderHash, std::move(serializedShader)))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing shader binary data for insertion into cache.");
@@ -127,4 +142,14 @@ size_t MemoryShaderCache::maxSize() const
     return mBlobCache.maxSize();
 }
 
+MemoryShaderCache::Statistics MemoryShaderCache::getStatistics() const
+{
+    Statistics statistics;
+    statistics.hits                     = mHits.load(std::memory_order_relaxed);
+    statistics.misses                   = mMisses.load(std::memory_order_relaxed);
+    statistics.normalizedSourceHits     = mNormalizedSourceHits.load(std::memory_order_relaxed);
+    statistics.savedCompileMicroseconds = mSavedCompileMicroseconds.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 }  // namespace gl
@@ -11,6 +11,7 @@
 #define LIBANGLE_MEMORY_SHADER_CACHE_H_
 
 #include <array>
+#include <atomic>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/MemoryBuffer.h"
@@ -48,8 +49,28 @@ class MemoryShaderCache final : angle::NonCopyable
     // Returns the maximum cache size in bytes.
     size_t maxSize() const;
 
+    struct Statistics
+    {
+        uint64_t hits   = 0;
+        uint64_t misses = 0;
+        // Hits on entries compiled from a different source with the same normalized source, i.e.
+        // one that differs only in comments, white space and #line directives.
+        uint64_t normalizedSourceHits = 0;
+        // The translation time of the compilations that hits avoided.
+        uint64_t savedCompileMicroseconds = 0;
+    };
+
+    // Returns the statistics of the lookups made since the cache was created.  These are reported
+    // through the shaderCache* performance counters.
+    Statistics getStatistics() const;
+
   private:
     egl::BlobCache &mBlobCache;
+
+    std::atomic<uint64_t> mHits;
+    std::atomic<uint64_t> mMisses;
+    std::atomic<uint64_t> mNormalizedSourceHits;
+    std::atomic<uint64_t> mSavedCompileMicroseconds;
 };
 
 }  // namespace gl
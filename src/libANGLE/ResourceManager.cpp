@@ -42,6 +42,24 @@ bool AllocateEmptyObject(HandleAllocator *handleAllocator,
     return true;
 }
 
+template <typename ResourceType, typename IDType>
+bool AllocateEmptyObjects(HandleAllocator *handleAllocator,
+                          ResourceMap<ResourceType, IDType> *objectMap,
+                          size_t count,
+                          IDType *outIDs)
+{
+    static_assert(sizeof(IDType) == sizeof(GLuint));
+    if (!handleAllocator->allocateMultiple(count, reinterpret_cast<GLuint *>(outIDs)))
+    {
+        return false;
+    }
+    for (size_t index = 0; index < count; ++index)
+    {
+        objectMap->assign(outIDs[index], nullptr);
+    }
+    return true;
+}
+
 }  // anonymous namespace
 
 ResourceManagerBase::ResourceManagerBase()
@@ -141,6 +159,11 @@ bool BufferManager::createBuffer(BufferID *outBuffer)
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap, outBuffer);
 }
 
+bool BufferManager::createBuffers(size_t count, BufferID *outBuffers)
+{
+    return AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, outBuffers);
+}
+
 Buffer *BufferManager::getBuffer(BufferID handle) const
 {
     return mObjectMap.query(handle);
@@ -266,6 +289,11 @@ bool TextureManager::createTexture(TextureID *outTexture)
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap, outTexture);
 }
 
+bool TextureManager::createTextures(size_t count, TextureID *outTextures)
+{
+    return AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, outTextures);
+}
+
 void TextureManager::signalAllTexturesDirty() const
 {
     // Note: this function is called with glRequestExtensionANGLE.  The
@@ -326,6 +354,11 @@ bool RenderbufferManager::createRenderbuffer(RenderbufferID *outRenderbuffer)
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap, outRenderbuffer);
 }
 
+bool RenderbufferManager::createRenderbuffers(size_t count, RenderbufferID *outRenderbuffers)
+{
+    return AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, outRenderbuffers);
+}
+
 Renderbuffer *RenderbufferManager::getRenderbuffer(RenderbufferID handle) const
 {
     return mObjectMap.query(handle);
@@ -155,6 +155,8 @@ class BufferManager
 {
   public:
     bool createBuffer(BufferID *outBuffer);
+    // Allocates all |count| buffer names, or none if the handles are exhausted.
+    bool createBuffers(size_t count, BufferID *outBuffers);
     Buffer *getBuffer(BufferID handle) const;
 
     ANGLE_INLINE Buffer *checkBufferAllocation(rx::GLImplFactory *factory, BufferID handle)
@@ -216,6 +218,7 @@ class TextureManager : public TypedResourceManager<Texture, TextureManager, Text
 {
   public:
     bool createTexture(TextureID *outTexture);
+    bool createTextures(size_t count, TextureID *outTextures);
     ANGLE_INLINE Texture *getTexture(TextureID handle) const
     {
         ASSERT(mObjectMap.query({0}) == nullptr);
@@ -250,6 +253,7 @@ class RenderbufferManager : public TypedResourceManagerWithTotalMemorySize<Rende
 {
   public:
     bool createRenderbuffer(RenderbufferID *outRenderbuffer);
+    bool createRenderbuffers(size_t count, RenderbufferID *outRenderbuffers);
     Renderbuffer *getRenderbuffer(RenderbufferID handle) const;
 
     Renderbuffer *checkRenderbufferAllocation(rx::GLImplFactory *factory, RenderbufferID handle)
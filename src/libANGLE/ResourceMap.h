@@ -5,14 +5,16 @@
 //
 // ResourceMap:
 //   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   flat array, and then falls back to an unordered map for the higher handle values.  Maps that
+//   are accessed concurrently instead fall back to a lock-free segmented array.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <algorithm>
+#include <array>
 #include <atomic>
-#include <mutex>
 #include <type_traits>
 #include "common/unsafe_buffers.h"
 
@@ -31,18 +33,6 @@ using ResourceMapMutex = angle::SimpleMutex;
 using ResourceMapMutex = angle::NoOpMutex;
 #endif
 
-template <bool NeedsLock = true>
-struct SelectResourceMapMutex
-{
-    using type = ResourceMapMutex;
-};
-
-template <>
-struct SelectResourceMapMutex<false>
-{
-    using type = angle::NoOpMutex;
-};
-
 // Analysis of ANGLE's traces as well as Chrome usage reveals the following:
 //
 // - Buffers: Typical applications use no more than 4000 ids.  Very few use over 6000.
@@ -56,18 +46,12 @@ struct SelectResourceMapMutex<false>
 // thousands.
 //
 // The initial size of the flat resource map is based on the above, rounded up to a multiple of
-// 1536.  Resource maps that need a lock (kNeedsLock == true) have an initial flat size and the
-// maximum flat size can be extended when an additional flat size is specified.  For others, the
-// maps start small and can grow.
-//
-// kAdditionalFlatResourcesSize defines the size of the additional flat resource map.
-// Handles in [kInitialFlatResourcesSize, kInitialFlatResourcesSize + kAdditionalFlatResourcesSize)
-// are stored in mAdditionalFlatResources.  0 means the additional flat map is disabled.
+// 1536.  Resource maps that need a lock (kNeedsLock == true) have a fixed flat size, and store the
+// handles above it in a SegmentedResourceArray.  For others, the maps start small and can grow.
 template <typename IDType>
 struct ResourceMapParams
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 0xC0;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0;
+    static constexpr size_t kInitialFlatResourcesSize = 0xC0;
 
     // The following are private to the context and don't need a lock:
     //
@@ -84,32 +68,229 @@ struct ResourceMapParams
 template <>
 struct ResourceMapParams<BufferID>
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 0x1800;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0x7800 - kInitialFlatResourcesSize;
-    static constexpr bool kNeedsLock                     = true;
+    static constexpr size_t kInitialFlatResourcesSize = 0x1800;
+    static constexpr bool kNeedsLock                  = true;
 };
 template <>
 struct ResourceMapParams<TextureID>
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 0x600;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0;
-    static constexpr bool kNeedsLock                     = false;
+    static constexpr size_t kInitialFlatResourcesSize = 0x600;
+    static constexpr bool kNeedsLock                  = false;
 };
 template <>
 struct ResourceMapParams<ShaderProgramID>
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 0x600;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0;
-    static constexpr bool kNeedsLock                     = false;
+    static constexpr size_t kInitialFlatResourcesSize = 0x600;
+    static constexpr bool kNeedsLock                  = false;
 };
 template <>
 struct ResourceMapParams<SyncID>
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 0x600;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0;
-    static constexpr bool kNeedsLock                     = false;
+    static constexpr size_t kInitialFlatResourcesSize = 0x600;
+    static constexpr bool kNeedsLock                  = false;
+};
+
+// A sparse array of pointers indexed by any GLuint handle, where lookups are wait-free and
+// allocations are lock-free.  The handle is split in a root index, a directory index and a segment
+// index.  Directories and segments are allocated on first use and published with a
+// compare-exchange, where the losing thread deletes its own unpublished allocation.  Once
+// published, they are never moved or freed until the array is destroyed, so a reader can never
+// observe reclaimed memory regardless of what other threads do.
+//
+// Like the flat array of ResourceMap, the slots themselves are not atomic; the application is not
+// allowed to access the same handle from different threads without synchronization.
+template <typename T, intptr_t kEmptyValue>
+class SegmentedResourceArray final : angle::NonCopyable
+{
+  public:
+    static constexpr uint32_t kSegmentBits   = 12;
+    static constexpr uint32_t kDirectoryBits = 12;
+    static constexpr uint32_t kRootBits      = 32 - kSegmentBits - kDirectoryBits;
+
+    static constexpr size_t kSegmentSize   = size_t(1) << kSegmentBits;
+    static constexpr size_t kDirectorySize = size_t(1) << kDirectoryBits;
+    static constexpr size_t kRootSize      = size_t(1) << kRootBits;
+
+    // One past the largest handle.
+    static constexpr uint64_t kHandleLimit = uint64_t(1) << 32;
+
+    SegmentedResourceArray();
+    ~SegmentedResourceArray();
+
+    // Returns the slot of |handle|, or nullptr if its segment is not allocated.
+    ANGLE_INLINE T **find(GLuint handle) const
+    {
+        Directory *directory =
+            mRoot[handle >> (kSegmentBits + kDirectoryBits)].load(std::memory_order_acquire);
+        if (directory == nullptr)
+        {
+            return nullptr;
+        }
+        T **segment = (*directory)[(handle >> kSegmentBits) & (kDirectorySize - 1)].load(
+            std::memory_order_acquire);
+        if (segment == nullptr)
+        {
+            return nullptr;
+        }
+        return ANGLE_UNSAFE_TODO(&segment[handle & (kSegmentSize - 1)]);
+    }
+
+    // Returns the slot of |handle|, allocating its segment if needed.
+    T **findOrAllocate(GLuint handle);
+
+    // Returns the first handle in [first, kHandleLimit) whose slot satisfies |isMatch|, or
+    // kHandleLimit if there is none.  Not thread safe.
+    template <typename IsMatch>
+    uint64_t findNext(uint64_t first, IsMatch &&isMatch) const;
+
+    // Resets all slots to kEmptyValue without freeing the segments.  Not thread safe.
+    void clear();
+
+  private:
+    using Directory = std::array<std::atomic<T **>, kDirectorySize>;
+
+    template <typename Element>
+    static Element *Publish(std::atomic<Element *> *slot, Element *allocation);
+
+    std::array<std::atomic<Directory *>, kRootSize> mRoot;
 };
 
+template <typename T, intptr_t kEmptyValue>
+SegmentedResourceArray<T, kEmptyValue>::SegmentedResourceArray()
+{
+    for (std::atomic<Directory *> &directory : mRoot)
+    {
+        directory.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, intptr_t kEmptyValue>
+SegmentedResourceArray<T, kEmptyValue>::~SegmentedResourceArray()
+{
+    for (std::atomic<Directory *> &directoryPtr : mRoot)
+    {
+        Directory *directory = directoryPtr.load(std::memory_order_acquire);
+        if (directory == nullptr)
+        {
+            continue;
+        }
+        for (std::atomic<T **> &segment : *directory)
+        {
+            delete[] segment.load(std::memory_order_acquire);
+        }
+        delete directory;
+    }
+}
+
+template <typename T, intptr_t kEmptyValue>
+template <typename Element>
+// static
+Element *SegmentedResourceArray<T, kEmptyValue>::Publish(std::atomic<Element *> *slot,
+                                                         Element *allocation)
+{
+    // The release ordering makes the initialization of |allocation| visible to the readers that
+    // acquire it.  If another thread published first, use its allocation instead.
+    Element *expected = nullptr;
+    if (slot->compare_exchange_strong(expected, allocation, std::memory_order_acq_rel,
+                                      std::memory_order_acquire))
+    {
+        return allocation;
+    }
+    return expected;
+}
+
+template <typename T, intptr_t kEmptyValue>
+T **SegmentedResourceArray<T, kEmptyValue>::findOrAllocate(GLuint handle)
+{
+    std::atomic<Directory *> &directoryPtr = mRoot[handle >> (kSegmentBits + kDirectoryBits)];
+    Directory *directory                   = directoryPtr.load(std::memory_order_acquire);
+    if (ANGLE_UNLIKELY(directory == nullptr))
+    {
+        Directory *newDirectory = new Directory;
+        for (std::atomic<T **> &segment : *newDirectory)
+        {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+        directory = Publish(&directoryPtr, newDirectory);
+        if (directory != newDirectory)
+        {
+            delete newDirectory;
+        }
+    }
+
+    std::atomic<T **> &segmentPtr = (*directory)[(handle >> kSegmentBits) & (kDirectorySize - 1)];
+    T **segment                   = segmentPtr.load(std::memory_order_acquire);
+    if (ANGLE_UNLIKELY(segment == nullptr))
+    {
+        T **newSegment = new T *[kSegmentSize];
+        std::fill_n(newSegment, kSegmentSize, reinterpret_cast<T *>(kEmptyValue));
+        segment = Publish(&segmentPtr, newSegment);
+        if (segment != newSegment)
+        {
+            delete[] newSegment;
+        }
+    }
+
+    return ANGLE_UNSAFE_TODO(&segment[handle & (kSegmentSize - 1)]);
+}
+
+template <typename T, intptr_t kEmptyValue>
+template <typename IsMatch>
+uint64_t SegmentedResourceArray<T, kEmptyValue>::findNext(uint64_t first, IsMatch &&isMatch) const
+{
+    constexpr uint64_t kDirectorySpan = uint64_t(1) << (kSegmentBits + kDirectoryBits);
+
+    uint64_t handle = first;
+    while (handle < kHandleLimit)
+    {
+        Directory *directory =
+            mRoot[handle >> (kSegmentBits + kDirectoryBits)].load(std::memory_order_acquire);
+        if (directory == nullptr)
+        {
+            handle = (handle / kDirectorySpan + 1) * kDirectorySpan;
+            continue;
+        }
+
+        T **segment = (*directory)[(handle >> kSegmentBits) & (kDirectorySize - 1)].load(
+            std::memory_order_acquire);
+        const uint64_t segmentEnd = (handle / kSegmentSize + 1) * kSegmentSize;
+        if (segment != nullptr)
+        {
+            for (; handle < segmentEnd; ++handle)
+            {
+                if (isMatch(ANGLE_UNSAFE_TODO(segment[handle & (kSegmentSize - 1)])))
+                {
+                    return handle;
+                }
+            }
+        }
+        handle = segmentEnd;
+    }
+
+    return kHandleLimit;
+}
+
+template <typename T, intptr_t kEmptyValue>
+void SegmentedResourceArray<T, kEmptyValue>::clear()
+{
+    for (std::atomic<Directory *> &directoryPtr : mRoot)
+    {
+        Directory *directory = directoryPtr.load(std::memory_order_acquire);
+        if (directory == nullptr)
+        {
+            continue;
+        }
+        for (std::atomic<T **> &segmentPtr : *directory)
+        {
+            T **segment = segmentPtr.load(std::memory_order_acquire);
+            if (segment != nullptr)
+            {
+                std::fill_n(segment, kSegmentSize, reinterpret_cast<T *>(kEmptyValue));
+            }
+        }
+    }
+}
+
 template <typename ResourceType, typename IDType>
 class ResourceMap final : angle::NonCopyable
 {
@@ -130,24 +311,21 @@ class ResourceMap final : angle::NonCopyable
             return (value == InvalidPointer() ? nullptr : value);
         }
 
-        if constexpr (kAdditionalFlatResourcesSize > 0)
+        if constexpr (kNeedsLock)
         {
-            if (handle < kLocklessFlatResourcesLimit)
+            // Wait-free for any handle.
+            ResourceType **slot = mSegmentedResources.find(handle);
+            if (slot == nullptr)
             {
-                ASSERT(handle >= kInitialFlatResourcesSize);
-                ResourceType **additionalResources =
-                    mAdditionalFlatResources.load(std::memory_order_acquire);
-                if (additionalResources != nullptr)
-                {
-                    ResourceType *value =
-                        ANGLE_UNSAFE_TODO(additionalResources[handle - kInitialFlatResourcesSize]);
-                    return (value == InvalidPointer() ? nullptr : value);
-                }
                 return nullptr;
             }
+            ResourceType *value = *slot;
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+        else
+        {
+            return findInHashedResources(handle);
         }
-
-        return findInHashedResources(handle);
     }
 
     // Returns true if the handle was reserved. Not necessarily if the resource is created.
@@ -176,13 +354,13 @@ class ResourceMap final : angle::NonCopyable
       private:
         friend class ResourceMap;
         Iterator(const ResourceMap &origin,
-                 GLuint flatIndex,
+                 uint64_t flatIndex,
                  typename HashMap::const_iterator hashIndex,
                  bool skipNulls);
         void updateValue();
 
         const ResourceMap &mOrigin;
-        GLuint mFlatIndex;
+        uint64_t mFlatIndex;
         typename HashMap::const_iterator mHashIndex;
         IndexAndResource mValue;
         bool mSkipNulls;
@@ -200,9 +378,10 @@ class ResourceMap final : angle::NonCopyable
     Iterator beginWithNull() const;
     Iterator endWithNull() const;
 
-    // Used by iterators and related functions only (due to lack of thread safety).
-    GLuint nextResource(size_t flatIndex, bool skipNulls) const;
-    GLuint getFlatEndIndex() const;
+    // Used by iterators and related functions only (due to lack of thread safety).  The flat
+    // indices include the segmented array, if any, which extends past the largest handle.
+    uint64_t nextResource(uint64_t flatIndex, bool skipNulls) const;
+    uint64_t getFlatEndIndex() const;
 
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
@@ -212,8 +391,6 @@ class ResourceMap final : angle::NonCopyable
     static constexpr bool kNeedsLock = ResourceMapParams<IDType>::kNeedsLock;
     static constexpr size_t kInitialFlatResourcesSize =
         ResourceMapParams<IDType>::kInitialFlatResourcesSize;
-    static constexpr size_t kAdditionalFlatResourcesSize =
-        ResourceMapParams<IDType>::kAdditionalFlatResourcesSize;
 #else
     // When share group locks are disabled, we are already in an thread-unsafe state so disable
     // locking in the ResourceManager too.
@@ -222,21 +399,8 @@ class ResourceMap final : angle::NonCopyable
     // Always grow from a small initial allocation when locks are disabled. Chromium uses very few
     // total resources.
     static constexpr size_t kInitialFlatResourcesSize = 192;
-
-    // Additional flat array requires the share group lock for safe lazy allocation.  Disable lazy
-    // allocation when locks are unavailable.
-    static constexpr size_t kAdditionalFlatResourcesSize = 0;
 #endif
 
-    // Both mFlatResources and mAdditionalFlatResources are valid when kNeedsLock is true.
-    static constexpr size_t kLocklessFlatResourcesLimit =
-        kInitialFlatResourcesSize + kAdditionalFlatResourcesSize;
-    static_assert(
-        kAdditionalFlatResourcesSize == 0 || kNeedsLock,
-        "kAdditionalFlatResourcesSize > 0 requires kNeedsLock to ensure safe lazy allocation");
-
-    using Mutex = typename SelectResourceMapMutex<kNeedsLock>::type;
-
     // For the lock-free flat map, experimental testing suggests that 10K is a reasonable upper
     // limit, rounded up to 0x3000 here for simplicity.  For the map that needs a lock, the flat
     // array size is fixed based on observed usage.
@@ -254,30 +418,31 @@ class ResourceMap final : angle::NonCopyable
 
     size_t mFlatResourcesSize;
     ResourceType **mFlatResources;
-    // Additional flat array is allocated lazily on first use under mMutex and published through
-    // store/load, enabling lock-free reads in query().
-    std::atomic<ResourceType **> mAdditionalFlatResources;
-
-    // A map of GL objects indexed by object ID.
-    HashMap mHashedResources;
 
     // mFlatResources is allocated at object creation time, with a default size of
     // |kInitialFlatResourcesSize|.  This is thread safe, because the allocation is done by the
     // first context in the share group.  The flat map is allowed to grow up to
     // |kFlatResourcesLimit|, but only for maps that don't need a lock (kNeedsLock == false).
+    // Beyond that, the handles are stored in |mHashedResources|.
     //
-    // For maps that don't need a lock, this mutex is a no-op.  For those that do, the mutex is
-    // taken when allocating / deleting objects, as well as when accessing |mHashedResources|.
-    // Otherwise, access to the flat map (which never gets reallocated due to
-    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) is lockless.  This latter is possible
-    // because the application is not allowed to gen/delete and bind the same ID in different
-    // threads at the same time.
+    // For maps that need a lock, the flat map never gets reallocated due to
+    // |kInitialFlatResourcesSize == kFlatResourcesLimit|, and the handles above it are stored in
+    // |mSegmentedResources| instead, which never reallocates either.  Access to both is lockless.
+    // This is possible because the application is not allowed to gen/delete and bind the same ID
+    // in different threads at the same time.
     //
     // Note that because HandleAllocator is not yet thread-safe, glGen* and glDelete* functions
-    // cannot be free of the share group mutex yet.  To remove the share group mutex from those
-    // functions, likely the HandleAllocator class should be merged with this class, and the
-    // necessary insert/erase operations done under this same lock.
-    mutable Mutex mMutex;
+    // cannot be free of the share group mutex yet.
+    struct NoSegmentedResources
+    {};
+    using SegmentedResources =
+        std::conditional_t<kNeedsLock,
+                           SegmentedResourceArray<ResourceType, kInvalidPointer>,
+                           NoSegmentedResources>;
+    SegmentedResources mSegmentedResources;
+
+    // A map of GL objects indexed by object ID.  Only used by maps that don't need a lock.
+    HashMap mHashedResources;
 };
 
 // A helper to retrieve the resource map iterators while being explicit that this is not thread
@@ -307,8 +472,7 @@ class UnsafeResourceMapIter
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::ResourceMap()
     : mFlatResourcesSize(kInitialFlatResourcesSize),
-      mFlatResources(new ResourceType *[kInitialFlatResourcesSize]),
-      mAdditionalFlatResources(nullptr)
+      mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
 {
     ANGLE_UNSAFE_TODO(
         memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * sizeof(mFlatResources[0])));
@@ -319,22 +483,17 @@ ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(begin() == end());
     delete[] mFlatResources;
-    delete[] mAdditionalFlatResources.load(std::memory_order_acquire);
 }
 
 template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::containsInHashedResources(GLuint handle) const
 {
-    std::lock_guard<Mutex> lock(mMutex);
-
     return mHashedResources.find(handle) != mHashedResources.end();
 }
 
 template <typename ResourceType, typename IDType>
 ResourceType *ResourceMap<ResourceType, IDType>::findInHashedResources(GLuint handle) const
 {
-    std::lock_guard<Mutex> lock(mMutex);
-
     auto it = mHashedResources.find(handle);
     // Note: it->second can also be nullptr, so nullptr check doesn't work for "contains"
     return (it == mHashedResources.end() ? nullptr : it->second);
@@ -344,8 +503,6 @@ template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::eraseFromHashedResources(GLuint handle,
                                                                  ResourceType **resourceOut)
 {
-    std::lock_guard<Mutex> lock(mMutex);
-
     auto it = mHashedResources.find(handle);
     if (it == mHashedResources.end())
     {
@@ -365,22 +522,15 @@ ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
         return ANGLE_UNSAFE_TODO(mFlatResources[handle]) != InvalidPointer();
     }
 
-    if constexpr (kAdditionalFlatResourcesSize > 0)
+    if constexpr (kNeedsLock)
     {
-        if (handle < kLocklessFlatResourcesLimit)
-        {
-            ResourceType **additionalResources =
-                mAdditionalFlatResources.load(std::memory_order_acquire);
-            if (additionalResources != nullptr)
-            {
-                return ANGLE_UNSAFE_TODO(additionalResources[handle - kInitialFlatResourcesSize]) !=
-                       InvalidPointer();
-            }
-            return false;
-        }
+        ResourceType **slot = mSegmentedResources.find(handle);
+        return slot != nullptr && *slot != InvalidPointer();
+    }
+    else
+    {
+        return containsInHashedResources(handle);
     }
-
-    return containsInHashedResources(handle);
 }
 
 template <typename ResourceType, typename IDType>
@@ -399,40 +549,37 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
         return true;
     }
 
-    if constexpr (kAdditionalFlatResourcesSize > 0)
+    if constexpr (kNeedsLock)
     {
-        if (handle < kLocklessFlatResourcesLimit)
+        ResourceType **slot = mSegmentedResources.find(handle);
+        if (slot == nullptr || *slot == InvalidPointer())
         {
-            ResourceType **additionalResources =
-                mAdditionalFlatResources.load(std::memory_order_acquire);
-            if (additionalResources != nullptr)
-            {
-                ResourceType **value =
-                    ANGLE_UNSAFE_TODO(&additionalResources[handle - kInitialFlatResourcesSize]);
-                if (*value == InvalidPointer())
-                {
-                    return false;
-                }
-                *resourceOut = *value;
-                *value       = InvalidPointer();
-                return true;
-            }
             return false;
         }
+        *resourceOut = *slot;
+        *slot        = InvalidPointer();
+        return true;
+    }
+    else
+    {
+        return eraseFromHashedResources(handle, resourceOut);
     }
-
-    return eraseFromHashedResources(handle, resourceOut);
 }
 
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::assignAboveCurrentFlatSize(GLuint handle,
                                                                    ResourceType *resource)
 {
-    if (ANGLE_LIKELY(handle < kFlatResourcesLimit))
+    if constexpr (kNeedsLock)
     {
-        // No need for a lock as the flat map never grows when locking is needed.
-        static_assert(!kNeedsLock || kInitialFlatResourcesSize == kFlatResourcesLimit);
+        // The flat map never grows when locking is needed.  The segment holding the handle is
+        // allocated without a lock if needed.
+        *mSegmentedResources.findOrAllocate(handle) = resource;
+        return;
+    }
 
+    if (ANGLE_LIKELY(handle < kFlatResourcesLimit))
+    {
         // Use power-of-two.
         size_t newSize = mFlatResourcesSize;
         while (newSize <= handle)
@@ -456,42 +603,6 @@ void ResourceMap<ResourceType, IDType>::assignAboveCurrentFlatSize(GLuint handle
         return;
     }
 
-    if constexpr (kAdditionalFlatResourcesSize > 0)
-    {
-        // This should only possible when lock is needed. Otherwise we could just grow
-        // mFlatResources.
-        static_assert(kNeedsLock);
-        if (handle < kLocklessFlatResourcesLimit)
-        {
-            ResourceType **additionalResources =
-                mAdditionalFlatResources.load(std::memory_order_acquire);
-            if (ANGLE_UNLIKELY(additionalResources == nullptr))
-            {
-                std::lock_guard<Mutex> lock(mMutex);
-                // Re-read under lock to avoid double allocation if two threads raced here.
-                // memory_order_relaxed is sufficient as the mutex provides the memory barrier.
-                additionalResources = mAdditionalFlatResources.load(std::memory_order_relaxed);
-                if (additionalResources == nullptr)
-                {
-                    additionalResources = new ResourceType *[kAdditionalFlatResourcesSize];
-                    ANGLE_UNSAFE_TODO(
-                        memset(additionalResources, kInvalidPointer,
-                               kAdditionalFlatResourcesSize * sizeof(additionalResources[0])));
-                    // Write the elements before the release-store so that a concurrent reader
-                    // loading the pointer with memory_order_acquire observes a fully initialized
-                    // array.
-                    ANGLE_UNSAFE_TODO(additionalResources[handle - kInitialFlatResourcesSize]) =
-                        resource;
-                    mAdditionalFlatResources.store(additionalResources, std::memory_order_release);
-                    return;
-                }
-            }
-            ANGLE_UNSAFE_TODO(additionalResources[handle - kInitialFlatResourcesSize]) = resource;
-            return;
-        }
-    }
-
-    std::lock_guard<Mutex> lock(mMutex);
     mHashedResources[handle] = resource;
 }
 
@@ -549,63 +660,44 @@ void ResourceMap<ResourceType, IDType>::clear()
     ANGLE_UNSAFE_TODO(memset(mFlatResources, kInvalidPointer,
                              kInitialFlatResourcesSize * sizeof(mFlatResources[0])));
     mFlatResourcesSize = kInitialFlatResourcesSize;
-    if constexpr (kAdditionalFlatResourcesSize > 0)
+    if constexpr (kNeedsLock)
     {
-        ResourceType **additionalResources =
-            mAdditionalFlatResources.load(std::memory_order_acquire);
-        if (additionalResources != nullptr)
-        {
-            ANGLE_UNSAFE_TODO(
-                memset(additionalResources, kInvalidPointer,
-                       kAdditionalFlatResourcesSize * sizeof(additionalResources[0])));
-        }
+        mSegmentedResources.clear();
     }
     mHashedResources.clear();
 }
 
 template <typename ResourceType, typename IDType>
-GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool skipNulls) const
+uint64_t ResourceMap<ResourceType, IDType>::nextResource(uint64_t flatIndex, bool skipNulls) const
 {
     // This function is only used by the iterators, access to which is marked by
     // UnsafeResourceMapIter.  Locking is the responsibility of the caller.
-    size_t index = flatIndex;
+    uint64_t index = flatIndex;
     for (; index < mFlatResourcesSize; index++)
     {
         if ((ANGLE_UNSAFE_TODO(mFlatResources[index]) != nullptr || !skipNulls) &&
             ANGLE_UNSAFE_TODO(mFlatResources[index]) != InvalidPointer())
         {
-            return static_cast<GLuint>(index);
+            return index;
         }
     }
-    if constexpr (kAdditionalFlatResourcesSize > 0)
+    if constexpr (kNeedsLock)
     {
-        ResourceType **additionalResources =
-            mAdditionalFlatResources.load(std::memory_order_acquire);
-        if (additionalResources != nullptr)
-        {
-            for (; index < kLocklessFlatResourcesLimit; index++)
-            {
-                ResourceType *value =
-                    ANGLE_UNSAFE_TODO(additionalResources[index - kInitialFlatResourcesSize]);
-                if ((value != nullptr || !skipNulls) && value != InvalidPointer())
-                {
-                    return static_cast<GLuint>(index);
-                }
-            }
-        }
-        return static_cast<GLuint>(kLocklessFlatResourcesLimit);
+        return mSegmentedResources.findNext(index, [skipNulls](ResourceType *value) {
+            return (value != nullptr || !skipNulls) && value != InvalidPointer();
+        });
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+    return index;
 }
 
 template <typename ResourceType, typename IDType>
-GLuint ResourceMap<ResourceType, IDType>::getFlatEndIndex() const
+uint64_t ResourceMap<ResourceType, IDType>::getFlatEndIndex() const
 {
-    if constexpr (kAdditionalFlatResourcesSize > 0)
+    if constexpr (kNeedsLock)
     {
-        return static_cast<GLuint>(kLocklessFlatResourcesLimit);
+        return SegmentedResources::kHandleLimit;
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+    return mFlatResourcesSize;
 }
 
 template <typename ResourceType, typename IDType>
@@ -618,7 +710,7 @@ ResourceType *ResourceMap<ResourceType, IDType>::InvalidPointer()
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::Iterator::Iterator(
     const ResourceMap &origin,
-    GLuint flatIndex,
+    uint64_t flatIndex,
     typename ResourceMap<ResourceType, IDType>::HashMap::const_iterator hashIndex,
     bool skipNulls)
     : mOrigin(origin), mFlatIndex(flatIndex), mHashIndex(hashIndex), mSkipNulls(skipNulls)
@@ -673,19 +765,16 @@ void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
 {
     if (mFlatIndex < mOrigin.getFlatEndIndex())
     {
-        if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+        mValue.first = static_cast<GLuint>(mFlatIndex);
+        if (mFlatIndex < mOrigin.mFlatResourcesSize)
         {
-            mValue.first  = mFlatIndex;
             mValue.second = ANGLE_UNSAFE_TODO(mOrigin.mFlatResources[mFlatIndex]);
         }
-        else
+        else if constexpr (kNeedsLock)
         {
-            ResourceType **additionalResources =
-                mOrigin.mAdditionalFlatResources.load(std::memory_order_acquire);
-            ASSERT(additionalResources != nullptr);
-            mValue.first = mFlatIndex;
-            mValue.second = ANGLE_UNSAFE_TODO(
-                additionalResources[mFlatIndex - ResourceMap::kInitialFlatResourcesSize]);
+            ResourceType **slot = mOrigin.mSegmentedResources.find(mValue.first);
+            ASSERT(slot != nullptr);
+            mValue.second = *slot;
         }
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
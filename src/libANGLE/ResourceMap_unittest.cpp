@@ -33,29 +33,27 @@ inline GLuint GetIDValue(uint16_t id)
 }
 // For the purpose of unit testing, |int| is considered private (not needing lock), |unsigned int|
 // is considered shared (needing lock), and |uint16_t| additionally has a small flat array to
-// exercise all three storage levels.
+// exercise both the flat array and the segmented array.
 template <>
 struct ResourceMapParams<unsigned int>
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 0xC0;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0;
-    static constexpr bool kNeedsLock                     = true;
+    static constexpr size_t kInitialFlatResourcesSize = 0xC0;
+    static constexpr bool kNeedsLock                  = true;
 };
 template <>
 struct ResourceMapParams<uint16_t>
 {
-    static constexpr size_t kInitialFlatResourcesSize    = 3;
-    static constexpr size_t kAdditionalFlatResourcesSize = 7;
-    static constexpr bool kNeedsLock                     = true;
+    static constexpr size_t kInitialFlatResourcesSize = 3;
+    static constexpr bool kNeedsLock                  = true;
 };
 }  // namespace gl
 
 namespace
 {
 // The resourceMap class uses a lock for "unsigned int" types to support this unit test.
-using LocklessType = int;
-using LockedType   = unsigned int;
-using AdditionalFlatType = uint16_t;
+using LocklessType  = int;
+using LockedType    = unsigned int;
+using SmallFlatType = uint16_t;
 
 template <typename T>
 void AssignAndErase()
@@ -335,263 +333,300 @@ TEST(ResourceMapTest, ConcurrentAccessLargeIds)
 {
     ConcurrentAccess<LockedType>(10'000, 20'000);
 }
-// Tests that concurrent access to thread-safe resource maps works for the initial flat array, the
-// secondary flat array and the hashmap.
-TEST(ResourceMapTest, ConcurrentAccessFlatArraysAndHashMap)
+// Tests that concurrent access to thread-safe resource maps works for the flat array and the
+// segmented array.
+TEST(ResourceMapTest, ConcurrentAccessFlatAndSegmentedArrays)
 {
-    // Set idCycleSize to 26 (2 * kThreadCount) so that each thread gets 2 IDs and covers the flat
-    // arrays and the hashmap.
-    ConcurrentAccess<AdditionalFlatType>(20'000, 26);
+    // Set idCycleSize to 26 (2 * kThreadCount) so that each thread gets 2 IDs and covers both
+    // arrays.
+    ConcurrentAccess<SmallFlatType>(20'000, 26);
 }
 
-// Tests growth across the initial flat array, the secondary flat array, and the hashmap.
-TEST(ResourceMapTest, GrowthAcrossFlatArraysAndHashMap)
+template <typename IDType>
+std::map<GLuint, size_t *> CollectResources(const ResourceMap<size_t, IDType> &resourceMap)
+{
+    // The iterator must visit each assigned handle exactly once.
+    std::map<GLuint, size_t *> visitedHandleMap;
+    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    {
+        EXPECT_EQ(visitedHandleMap.count(idValue.first), 0u) << "duplicate id=" << idValue.first;
+        visitedHandleMap[idValue.first] = idValue.second;
+    }
+    return visitedHandleMap;
+}
+
+// Tests growth across the flat array and the segmented array.
+TEST(ResourceMapTest, GrowthAcrossFlatAndSegmentedArrays)
 {
     // Handle Layout
-    // - initial flat array     : 1, 2
-    // - additional flat array  : 3, 4, 5, 6, 7, 8, 9
-    // - hashmap                : 10, 11, 12
-    constexpr size_t kTotalHandle = 12;
-    std::vector<size_t> objects(kTotalHandle);
-    for (size_t index = 0; index < kTotalHandle; ++index)
+    // - flat array      : 1, 2
+    // - first segment   : 3, ..., 12, 4095
+    // - second segment  : 4096
+    // - last segment    : 65535
+    std::vector<SmallFlatType> handles = {4095, 4096, 65535};
+    for (SmallFlatType handle = 1; handle <= 12; ++handle)
     {
-        objects[index] = index + 1;
+        handles.push_back(handle);
     }
+    std::vector<size_t> objects(handles.begin(), handles.end());
 
-    ResourceMap<size_t, AdditionalFlatType> resourceMap;
+    ResourceMap<size_t, SmallFlatType> resourceMap;
 
-    for (size_t index = 0; index < kTotalHandle; ++index)
+    for (size_t index = 0; index < handles.size(); ++index)
     {
-        resourceMap.assign(static_cast<AdditionalFlatType>(index + 1), &objects[index]);
+        resourceMap.assign(handles[index], &objects[index]);
     }
 
-    for (size_t index = 0; index < kTotalHandle; ++index)
+    for (size_t index = 0; index < handles.size(); ++index)
     {
-        const AdditionalFlatType handle = static_cast<AdditionalFlatType>(index + 1);
-        EXPECT_TRUE(resourceMap.contains(handle)) << "handle=" << handle;
-        EXPECT_EQ(resourceMap.query(handle), &objects[index]) << "handle=" << handle;
+        EXPECT_TRUE(resourceMap.contains(handles[index])) << "handle=" << handles[index];
+        EXPECT_EQ(resourceMap.query(handles[index]), &objects[index])
+            << "handle=" << handles[index];
     }
 
-    // Handles that have never been assigned must not be found.
-    EXPECT_FALSE(resourceMap.contains(static_cast<AdditionalFlatType>(0)));
-    EXPECT_EQ(resourceMap.query(static_cast<AdditionalFlatType>(0)), nullptr);
-    EXPECT_FALSE(resourceMap.contains(static_cast<AdditionalFlatType>(kTotalHandle + 1)));
-    EXPECT_EQ(resourceMap.query(static_cast<AdditionalFlatType>(kTotalHandle + 1)), nullptr);
-
-    // The iterator must visit each assigned handle exactly once across all flat arrays and the
-    // hashmap.
-    std::map<GLuint, size_t *> visitedHandleMap;
-    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    // Handles that have never been assigned must not be found, whether their segment is allocated
+    // or not.
+    for (SmallFlatType handle : {0, 13, 4094, 4097, 8192, 65534})
     {
-        EXPECT_EQ(visitedHandleMap.count(idValue.first), 0u) << "duplicate id=" << idValue.first;
-        visitedHandleMap[idValue.first] = idValue.second;
+        EXPECT_FALSE(resourceMap.contains(handle)) << "handle=" << handle;
+        EXPECT_EQ(resourceMap.query(handle), nullptr) << "handle=" << handle;
     }
-    EXPECT_EQ(visitedHandleMap.size(), kTotalHandle);
 
-    for (size_t index = 0; index < kTotalHandle; ++index)
+    std::map<GLuint, size_t *> visitedHandleMap = CollectResources(resourceMap);
+    EXPECT_EQ(visitedHandleMap.size(), handles.size());
+    for (size_t index = 0; index < handles.size(); ++index)
     {
-        const GLuint handle = static_cast<GLuint>(index + 1);
-        ASSERT_EQ(visitedHandleMap.count(handle), 1u) << "missing handle=" << handle;
-        EXPECT_EQ(visitedHandleMap[handle], &objects[index]);
+        ASSERT_EQ(visitedHandleMap.count(handles[index]), 1u)
+            << "missing handle=" << handles[index];
+        EXPECT_EQ(visitedHandleMap[handles[index]], &objects[index]);
     }
 
-    for (size_t index = 0; index < kTotalHandle; ++index)
+    for (size_t index = 0; index < handles.size(); ++index)
     {
-        const AdditionalFlatType handle = static_cast<AdditionalFlatType>(index + 1);
-        size_t *erased                  = nullptr;
-        EXPECT_TRUE(resourceMap.erase(handle, &erased)) << "handle=" << handle;
-        EXPECT_EQ(erased, &objects[index]) << "handle=" << handle;
-        EXPECT_FALSE(resourceMap.contains(handle)) << "handle is still present after erase";
+        size_t *erased = nullptr;
+        EXPECT_TRUE(resourceMap.erase(handles[index], &erased)) << "handle=" << handles[index];
+        EXPECT_EQ(erased, &objects[index]) << "handle=" << handles[index];
+        EXPECT_FALSE(resourceMap.contains(handles[index])) << "handle is still present after erase";
+        EXPECT_FALSE(resourceMap.erase(handles[index], &erased)) << "handle=" << handles[index];
     }
 
     EXPECT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
 }
 
-// Tests that the iterator visits all valid handles when resources exist only in the hash map, and
-// no ID in the additional flat array has ever been assigned.
-TEST(ResourceMapTest, IteratorVisitsHashMapWithoutAdditionalFlatArray)
+// Tests that the iterator visits all valid handles when resources exist only in the segmented
+// array, and that reserved handles (with a null resource) are visited only with beginWithNull().
+TEST(ResourceMapTest, IteratorVisitsSegmentedArrayOnly)
 {
-    // Assign handles in the hashmap range to keep mAdditionalFlatResources nullptr.
-    // kHashmapIdx0, kHashmapIdx1 >= kInitialFlatResourcesSize + kAdditionalFlatResourcesSize
-    //                            >= kLocklessFlatResourcesLimit = 3 + 7 = 10
-    constexpr AdditionalFlatType kHashmapIdx0 = 10;
-    constexpr AdditionalFlatType kHashmapIdx1 = 11;
-    size_t hashmapValue0                      = 100;
-    size_t hashmapValue1                      = 200;
-
-    ResourceMap<size_t, AdditionalFlatType> resourceMap;
-    resourceMap.assign(kHashmapIdx0, &hashmapValue0);
-    resourceMap.assign(kHashmapIdx1, &hashmapValue1);
-
-    EXPECT_TRUE(resourceMap.contains(kHashmapIdx0));
-    EXPECT_EQ(resourceMap.query(kHashmapIdx0), &hashmapValue0);
-    EXPECT_TRUE(resourceMap.contains(kHashmapIdx1));
-    EXPECT_EQ(resourceMap.query(kHashmapIdx1), &hashmapValue1);
-
-    constexpr AdditionalFlatType kInitialArrayIdx    = 1;
-    constexpr AdditionalFlatType kAdditionalArrayIdx = 5;
-
-    // Since IDs in the initial and additional flat arrays are never allocated, they should always
-    // return false or nullptr.
-    EXPECT_FALSE(resourceMap.contains(kInitialArrayIdx));
-    EXPECT_EQ(resourceMap.query(kInitialArrayIdx), nullptr);
-    EXPECT_FALSE(resourceMap.contains(kAdditionalArrayIdx));
-    EXPECT_EQ(resourceMap.query(kAdditionalArrayIdx), nullptr);
-
-    // The iterator must visit both hashmap entries.
-    std::map<GLuint, size_t *> visitedHandleMap;
-    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    constexpr SmallFlatType kSegmentedIdx0 = 10;
+    constexpr SmallFlatType kSegmentedIdx1 = 5000;
+    constexpr SmallFlatType kReservedIdx   = 6000;
+    size_t segmentedValue0                 = 100;
+    size_t segmentedValue1                 = 200;
+
+    ResourceMap<size_t, SmallFlatType> resourceMap;
+    resourceMap.assign(kSegmentedIdx0, &segmentedValue0);
+    resourceMap.assign(kSegmentedIdx1, &segmentedValue1);
+    resourceMap.assign(kReservedIdx, nullptr);
+
+    EXPECT_TRUE(resourceMap.contains(kReservedIdx));
+    EXPECT_EQ(resourceMap.query(kReservedIdx), nullptr);
+
+    // Since IDs in the flat array are never allocated, they should always return false or nullptr.
+    constexpr SmallFlatType kFlatArrayIdx = 1;
+    EXPECT_FALSE(resourceMap.contains(kFlatArrayIdx));
+    EXPECT_EQ(resourceMap.query(kFlatArrayIdx), nullptr);
+
+    std::map<GLuint, size_t *> visitedHandleMap = CollectResources(resourceMap);
+    EXPECT_EQ(visitedHandleMap.size(), 2u);
+    EXPECT_EQ(visitedHandleMap[kSegmentedIdx0], &segmentedValue0);
+    EXPECT_EQ(visitedHandleMap[kSegmentedIdx1], &segmentedValue1);
+
+    std::vector<GLuint> visitedWithNull;
+    UnsafeResourceMapIter<size_t, SmallFlatType> iter(resourceMap);
+    for (auto it = iter.beginWithNull(); it != iter.endWithNull(); ++it)
     {
-        visitedHandleMap[idValue.first] = idValue.second;
+        visitedWithNull.push_back(it->first);
     }
-    EXPECT_EQ(visitedHandleMap.size(), 2u);
-    EXPECT_EQ(visitedHandleMap.count(kHashmapIdx0), 1u);
-    EXPECT_EQ(visitedHandleMap[kHashmapIdx0], &hashmapValue0);
-    EXPECT_EQ(visitedHandleMap.count(kHashmapIdx1), 1u);
-    EXPECT_EQ(visitedHandleMap[kHashmapIdx1], &hashmapValue1);
+    EXPECT_EQ(visitedWithNull,
+              (std::vector<GLuint>{kSegmentedIdx0, kSegmentedIdx1, kReservedIdx}));
 
     resourceMap.clear();
 }
 
-// Tests that the iterator correctly visits all valid handles stored in the upper portion of the
-// additional flat array.
-TEST(ResourceMapTest, IteratorVisitsUpperAdditionalFlatArray)
+// Tests handles spread over the whole handle range, including the largest handle.
+TEST(ResourceMapTest, SparseLargeHandles)
 {
-    // Additional flat range = [kInitialFlatResourcesSize, kLocklessFlatResourcesLimit) = [3, 10)
-    // Assign handles in the upper portion of the additional flat array.
-    constexpr AdditionalFlatType kFirstIdx = 7;
-    constexpr AdditionalFlatType kLastIdx  = 9;
-    size_t value7                          = 7;
-    size_t value8                          = 8;
-    size_t value9                          = 9;
-
-    ResourceMap<size_t, AdditionalFlatType> resourceMap;
-    resourceMap.assign(kFirstIdx, &value7);
-    resourceMap.assign(kFirstIdx + 1, &value8);
-    resourceMap.assign(kLastIdx, &value9);
-
-    EXPECT_TRUE(resourceMap.contains(kFirstIdx));
-    EXPECT_EQ(resourceMap.query(kFirstIdx), &value7);
-    EXPECT_TRUE(resourceMap.contains(kFirstIdx + 1));
-    EXPECT_EQ(resourceMap.query(kFirstIdx + 1), &value8);
-    EXPECT_TRUE(resourceMap.contains(kLastIdx));
-    EXPECT_EQ(resourceMap.query(kLastIdx), &value9);
-
-    // Iterator must visit all three handles.
-    std::map<GLuint, size_t *> visitedHandleMap;
-    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    const std::vector<LockedType> handles = {1,          0xC0,       0xFFF,      0x1000,
+                                             0x123456,   0xFFFFFF,   0x1000000,  0x80000000,
+                                             0xFFFFFFFE, 0xFFFFFFFF};
+    std::vector<size_t> objects(handles.begin(), handles.end());
+
+    ResourceMap<size_t, LockedType> resourceMap;
+    for (size_t index = 0; index < handles.size(); ++index)
     {
-        visitedHandleMap[idValue.first] = idValue.second;
+        resourceMap.assign(handles[index], &objects[index]);
+    }
+
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        EXPECT_EQ(resourceMap.query(handles[index]), &objects[index])
+            << "handle=" << handles[index];
+        EXPECT_FALSE(resourceMap.contains(handles[index] ^ 0x10000)) << "handle=" << handles[index];
+    }
+
+    std::map<GLuint, size_t *> visitedHandleMap = CollectResources(resourceMap);
+    EXPECT_EQ(visitedHandleMap.size(), handles.size());
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        EXPECT_EQ(visitedHandleMap[handles[index]], &objects[index]);
     }
-    EXPECT_EQ(visitedHandleMap.size(), 3u);
-    EXPECT_EQ(visitedHandleMap[kFirstIdx], &value7);
-    EXPECT_EQ(visitedHandleMap[kFirstIdx + 1], &value8);
-    EXPECT_EQ(visitedHandleMap[kLastIdx], &value9);
 
+    // Clearing the map keeps it usable.
     resourceMap.clear();
+    EXPECT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
+    for (LockedType handle : handles)
+    {
+        EXPECT_FALSE(resourceMap.contains(handle)) << "handle=" << handle;
+        EXPECT_EQ(resourceMap.query(handle), nullptr) << "handle=" << handle;
+    }
+
+    resourceMap.assign(handles.back(), &objects.back());
+    EXPECT_EQ(resourceMap.query(handles.back()), &objects.back());
+
+    size_t *erased = nullptr;
+    EXPECT_TRUE(resourceMap.erase(handles.back(), &erased));
+    EXPECT_EQ(erased, &objects.back());
+    EXPECT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
 }
 
-// Tests that the iterator visits all valid handles when they are assigned only in the additional
-// flat array and the hash map.
-TEST(ResourceMapTest, IteratorVisitsAdditionalFlatArrayAndHashMap)
+// Tests that threads allocating the same segments at the same time all end up in the same
+// segments.
+TEST(ResourceMapTest, ConcurrentSegmentAllocation)
 {
-    // Assign handles in the additional flat range [3, 10) and the hashmap (>= 10).  No handles are
-    // assigned in the initial flat array [0, 3)
-    constexpr AdditionalFlatType kAdditionalIdx0 = 4;
-    constexpr AdditionalFlatType kAdditionalIdx1 = 8;
-    constexpr AdditionalFlatType kHashmapIdx0    = 20;
-    constexpr AdditionalFlatType kHashmapIdx1    = 21;
-    size_t additionalValue0                      = 100;
-    size_t additionalValue1                      = 200;
-    size_t hashmapValue0                         = 300;
-    size_t hashmapValue1                         = 400;
-
-    ResourceMap<size_t, AdditionalFlatType> resourceMap;
-    resourceMap.assign(kAdditionalIdx0, &additionalValue0);
-    resourceMap.assign(kAdditionalIdx1, &additionalValue1);
-    resourceMap.assign(kHashmapIdx0, &hashmapValue0);
-    resourceMap.assign(kHashmapIdx1, &hashmapValue1);
-
-    EXPECT_TRUE(resourceMap.contains(kAdditionalIdx0));
-    EXPECT_EQ(resourceMap.query(kAdditionalIdx0), &additionalValue0);
-    EXPECT_TRUE(resourceMap.contains(kAdditionalIdx1));
-    EXPECT_EQ(resourceMap.query(kAdditionalIdx1), &additionalValue1);
-    EXPECT_TRUE(resourceMap.contains(kHashmapIdx0));
-    EXPECT_EQ(resourceMap.query(kHashmapIdx0), &hashmapValue0);
-    EXPECT_TRUE(resourceMap.contains(kHashmapIdx1));
-    EXPECT_EQ(resourceMap.query(kHashmapIdx1), &hashmapValue1);
-
-    constexpr AdditionalFlatType kInitialArrayIdx = 1;
-
-    // Since IDs in the initial flat array are never allocated, the lookup should always return
-    // false or nullptr.
-    EXPECT_FALSE(resourceMap.contains(kInitialArrayIdx));
-    EXPECT_EQ(resourceMap.query(kInitialArrayIdx), nullptr);
-
-    // The iterator must visit all four handles.
-    std::map<GLuint, size_t *> visitedHandleMap;
-    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
     {
-        visitedHandleMap[idValue.first] = idValue.second;
+        GTEST_SKIP() << "Test skipped: Locking is disabled in build.";
     }
-    EXPECT_EQ(visitedHandleMap.size(), 4u);
-    EXPECT_EQ(visitedHandleMap[kAdditionalIdx0], &additionalValue0);
-    EXPECT_EQ(visitedHandleMap[kAdditionalIdx1], &additionalValue1);
-    EXPECT_EQ(visitedHandleMap[kHashmapIdx0], &hashmapValue0);
-    EXPECT_EQ(visitedHandleMap[kHashmapIdx1], &hashmapValue1);
 
+    constexpr size_t kThreadCount   = 8;
+    constexpr size_t kIdsPerThread  = 2000;
+    constexpr LockedType kIdSpacing = 37;
+
+    // Spread the ids over several directories and segments, interleaved between the threads so
+    // that they race to allocate them.
+    constexpr std::array<LockedType, 4> kIdBases = {0x1000, 0x00FFF000, 0x7FFF0000, 0xFFF00000};
+
+    ResourceMap<size_t, LockedType> resourceMap;
+    std::atomic<size_t> readyCount(0);
+
+    auto idOf = [&](size_t threadIndex, size_t idIndex) {
+        return static_cast<LockedType>(kIdBases[idIndex % kIdBases.size()] +
+                                       (idIndex / kIdBases.size() * kThreadCount + threadIndex) *
+                                           kIdSpacing);
+    };
+
+    std::array<std::thread, kThreadCount> threads;
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        threads[i] = std::thread([&, i]() {
+            readyCount++;
+            while (readyCount < kThreadCount)
+            {
+                std::this_thread::yield();
+            }
+
+            for (size_t j = 0; j < kIdsPerThread; ++j)
+            {
+                const LockedType id = idOf(i, j);
+                size_t *value       = reinterpret_cast<size_t *>(static_cast<uintptr_t>(id) + 1);
+                resourceMap.assign(id, value);
+                EXPECT_EQ(resourceMap.query(id), value);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        for (size_t j = 0; j < kIdsPerThread; ++j)
+        {
+            const LockedType id = idOf(i, j);
+            size_t *expected    = reinterpret_cast<size_t *>(static_cast<uintptr_t>(id) + 1);
+            ASSERT_EQ(resourceMap.query(id), expected) << "id=" << id;
+        }
+    }
+
+    EXPECT_EQ(CollectResources(resourceMap).size(), kThreadCount * kIdsPerThread);
     resourceMap.clear();
 }
 
-// Tests that the iterator correctly transitions from the initial flat array to the hash map when
-// the additional flat array has never been allocated.  This verifies that nextResource() skips the
-// additional flat range when additionalResources is nullptr, so updateValue() never dereferences a
-// null pointer.
-TEST(ResourceMapTest, IteratorVisitsInitialFlatArrayAndHashMap)
+// Tests that lookups of existing handles are not disturbed by other threads allocating new
+// segments.
+TEST(ResourceMapTest, ConcurrentQueryDuringGrowth)
 {
-    // Assign handles in the initial flat array (1, 2) and in the hashmap (>= 10).  Since no handles
-    // are assigned in the additional flat range [3, 10), mAdditionalFlatResources remains nullptr.
-    constexpr AdditionalFlatType kInitialIdx0 = 1;
-    constexpr AdditionalFlatType kInitialIdx1 = 2;
-    constexpr AdditionalFlatType kHashmapIdx0 = 10;
-    constexpr AdditionalFlatType kHashmapIdx1 = 18;
-    size_t initialValue0                      = 100;
-    size_t initialValue1                      = 200;
-    size_t hashmapValue0                      = 300;
-    size_t hashmapValue1                      = 400;
-
-    ResourceMap<size_t, AdditionalFlatType> resourceMap;
-    resourceMap.assign(kInitialIdx0, &initialValue0);
-    resourceMap.assign(kInitialIdx1, &initialValue1);
-    resourceMap.assign(kHashmapIdx0, &hashmapValue0);
-    resourceMap.assign(kHashmapIdx1, &hashmapValue1);
-
-    EXPECT_TRUE(resourceMap.contains(kInitialIdx0));
-    EXPECT_EQ(resourceMap.query(kInitialIdx0), &initialValue0);
-    EXPECT_TRUE(resourceMap.contains(kInitialIdx1));
-    EXPECT_EQ(resourceMap.query(kInitialIdx1), &initialValue1);
-    EXPECT_TRUE(resourceMap.contains(kHashmapIdx0));
-    EXPECT_EQ(resourceMap.query(kHashmapIdx0), &hashmapValue0);
-    EXPECT_TRUE(resourceMap.contains(kHashmapIdx1));
-    EXPECT_EQ(resourceMap.query(kHashmapIdx1), &hashmapValue1);
-
-    // Since IDs in the additional flat array are never allocated, the lookup should always return
-    // false or nullptr.
-    constexpr AdditionalFlatType kAdditionalArrayIdx = 5;
-    EXPECT_FALSE(resourceMap.contains(kAdditionalArrayIdx));
-    EXPECT_EQ(resourceMap.query(kAdditionalArrayIdx), nullptr);
-
-    // The iterator must visit all four handles.
-    std::map<GLuint, size_t *> visitedHandleMap;
-    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
     {
-        visitedHandleMap[idValue.first] = idValue.second;
+        GTEST_SKIP() << "Test skipped: Locking is disabled in build.";
+    }
+
+    constexpr size_t kReaderCount     = 4;
+    constexpr size_t kWriterCount     = 4;
+    constexpr LockedType kStableCount = 512;
+    constexpr LockedType kStableBase  = 0x2000;
+    constexpr LockedType kGrowthCount = 128;
+
+    ResourceMap<size_t, LockedType> resourceMap;
+    std::vector<size_t> stableObjects(kStableCount);
+    for (LockedType index = 0; index < kStableCount; ++index)
+    {
+        resourceMap.assign(kStableBase + index, &stableObjects[index]);
+    }
+
+    std::atomic<size_t> writersDone(0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < kReaderCount; ++i)
+    {
+        threads.emplace_back([&]() {
+            while (writersDone < kWriterCount)
+            {
+                for (LockedType index = 0; index < kStableCount; ++index)
+                {
+                    ASSERT_EQ(resourceMap.query(kStableBase + index), &stableObjects[index]);
+                }
+            }
+        });
+    }
+    for (size_t i = 0; i < kWriterCount; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            // Every handle is in a new segment, and every 16th one in a new directory.
+            for (LockedType index = 0; index < kGrowthCount; ++index)
+            {
+                const LockedType id =
+                    static_cast<LockedType>((index * kWriterCount + i + 1) << 20) + 1;
+                resourceMap.assign(id, nullptr);
+                EXPECT_TRUE(resourceMap.contains(id));
+            }
+            writersDone++;
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    UnsafeResourceMapIter<size_t, LockedType> iter(resourceMap);
+    size_t visitedCount = 0;
+    for (auto it = iter.beginWithNull(); it != iter.endWithNull(); ++it)
+    {
+        ++visitedCount;
     }
-    EXPECT_EQ(visitedHandleMap.size(), 4u);
-    EXPECT_EQ(visitedHandleMap[kInitialIdx0], &initialValue0);
-    EXPECT_EQ(visitedHandleMap[kInitialIdx1], &initialValue1);
-    EXPECT_EQ(visitedHandleMap[kHashmapIdx0], &hashmapValue0);
-    EXPECT_EQ(visitedHandleMap[kHashmapIdx1], &hashmapValue1);
+    EXPECT_EQ(visitedCount, kStableCount + kWriterCount * kGrowthCount);
 
     resourceMap.clear();
 }
@@ -39,7 +39,7 @@ namespace gl
 
 namespace
 {
-constexpr uint32_t kShaderCacheIdentifier = 0x12345678;
+constexpr uint32_t kShaderCacheIdentifier = 0x12345679;
 
 // Environment variable (and associated Android property) for the path to read and write shader
 // dumps
@@ -138,6 +138,7 @@ class CompileTask final : public angle::Closure
     bool isCompilingInternally() { return mTranslateTask->isCompilingInternally(); }
 
     std::string &&getInfoLog() { return std::move(mInfoLog); }
+    double getCompileSeconds() const { return mCompileSeconds; }
 
   private:
     angle::Result compileImpl();
@@ -160,6 +161,7 @@ class CompileTask final : public angle::Closure
     std::shared_ptr<rx::ShaderTranslateTask> mTranslateTask;
     angle::Result mResult;
     std::string mInfoLog;
+    double mCompileSeconds = 0;
 };
 
 class CompileEvent final
@@ -185,6 +187,7 @@ class CompileEvent final
     }
 
     std::string &&getInfoLog() { return std::move(mCompileTask->getInfoLog()); }
+    double getCompileSeconds() const { return mCompileTask->getCompileSeconds(); }
 
   private:
     std::shared_ptr<CompileTask> mCompileTask;
@@ -196,6 +199,7 @@ angle::Result CompileTask::compileImpl()
     if (mCompilerHandle)
     {
         // Compiling from source
+        const double startTime = angle::GetCurrentSystemTime();
 
         // Call the translator and get the info log
         bool result = mTranslateTask->translate(mCompilerHandle, mOptions, *mSource);
@@ -207,7 +211,12 @@ angle::Result CompileTask::compileImpl()
 
         // Process the translation results itself; gather compilation info, substitute the shader if
         // being overriden, etc.
-        return postTranslate();
+        const angle::Result postTranslateResult = postTranslate();
+
+        // Recorded in the shader cache, to tell how much time hits on the cache save.
+        mCompileSeconds = angle::GetCurrentSystemTime() - startTime;
+
+        return postTranslateResult;
     }
     else
     {
@@ -773,6 +782,8 @@ void Shader::resolveCompile(const Context *context)
         // Only save this shader to the cache if it was a compile from source (not load from binary)
         if (success)
         {
+            mCompileSeconds = mCompileJob->compileEvent->getCompileSeconds();
+
             MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
             if (shaderCache != nullptr)
             {
@@ -856,6 +867,8 @@ angle::Result Shader::serialize(const Context *context, angle::MemoryBuffer *bin
     BinaryOutputStream stream;
 
     stream.writeInt(kShaderCacheIdentifier);
+    stream.writeInt<uint64_t>(mState.mSourceHash);
+    stream.writeFloat(static_cast<float>(mCompileSeconds));
     mState.mCompiledState->serialize(stream);
 
     if (!binaryOut->resize(stream.size()))
@@ -954,6 +967,11 @@ bool Shader::loadBinaryImpl(const Context *context,
         {
             return false;
         }
+
+        // The source the cache entry was compiled from may differ from this shader's if they have
+        // the same normalized source.
+        mCacheEntrySourceHash = static_cast<size_t>(stream.readInt<uint64_t>());
+        mCompileSeconds       = stream.readFloat();
     }
 
     if (!deserialize(stream))
@@ -1014,9 +1032,30 @@ void Shader::setShaderKey(const Context *context,
     angle::BlobCacheHasher hasher;
     hasher.Init();
 
-    // Start with the shader type and source.
+    // Start with the shader type and source.  Sources that differ only in comments, white space and
+    // #line directives compile to the same result, so the normalized source is used when possible.
+    // HLSL output is an exception as it carries the line numbers of the source in #line directives.
+    // So is translated shader substitution, which looks up the substitute by the source itself.
+    const bool normalizeSource =
+        outputType != SH_HLSL_4_1_OUTPUT &&
+        !context->getFrontendFeatures().enableTranslatedShaderSubstitution.enabled;
+
+    const char *source = mState.getSource().c_str();
+    std::string normalizedSource;
+    const bool isSourceNormalized =
+        normalizeSource && sh::GetNormalizedSource(&source, 1, &normalizedSource);
+
     angle::UpdateHashWithValue(hasher, mState.getShaderType());
-    hasher.Update(mState.getSource().data(), mState.getSource().size());
+    // Tell normalized sources apart from raw ones that happen to look the same.
+    angle::UpdateHashWithValue(hasher, isSourceNormalized);
+    if (isSourceNormalized)
+    {
+        hasher.Update(normalizedSource.data(), normalizedSource.size());
+    }
+    else
+    {
+        hasher.Update(mState.getSource().data(), mState.getSource().size());
+    }
 
     // Include the shader program version hash.
     hasher.Update(angle::GetANGLEShaderProgramVersion(),
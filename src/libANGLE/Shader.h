@@ -193,6 +193,12 @@ class Shader final : angle::NonCopyable, public LabeledObject
     void writeShaderKey(BinaryOutputStream *streamOut) const { streamOut->writeBytes(mShaderHash); }
     const egl::BlobCache::Key &getShaderHash() const { return mShaderHash; }
 
+    // The hash of the source that a shader loaded from the shader cache was compiled from, which
+    // differs from getSourceHash() if the sources only normalize to the same tokens, and the time
+    // spent translating it.
+    size_t getCacheEntrySourceHash() const { return mCacheEntrySourceHash; }
+    double getCompileSeconds() const { return mCompileSeconds; }
+
   private:
     ~Shader() override;
 
@@ -223,6 +229,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
     BindingPointer<Compiler> mBoundCompiler;
     SharedCompileJob mCompileJob;
     egl::BlobCache::Key mShaderHash;
+    size_t mCacheEntrySourceHash = 0;
+    double mCompileSeconds       = 0;
 
     ShaderProgramManager *mResourceManager;
 };
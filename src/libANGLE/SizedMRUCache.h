@@ -115,6 +115,31 @@ class SizedMRUCache final : angle::NonCopyable
 
     size_t maxSize() const { return mMaximumTotalSize; }
 
+    // Returns the least recently used value, without making it the most recently used.
+    bool peekLeastRecentlyUsed(const Value **valueOut) const
+    {
+        if (mStore.empty())
+        {
+            return false;
+        }
+        *valueOut = &mStore.rbegin()->second.value;
+        return true;
+    }
+
+    // Evicts the least recently used value and returns its size.
+    size_t evictLeastRecentlyUsed()
+    {
+        if (mStore.empty())
+        {
+            return 0;
+        }
+        auto iter         = mStore.rbegin();
+        const size_t size = iter->second.size;
+        mCurrentSize -= size;
+        mStore.Erase(iter);
+        return size;
+    }
+
   private:
     struct ValueAndSize
     {
@@ -107,4 +107,35 @@ TEST(SizedMRUCacheTest, OversizeValue)
     EXPECT_FALSE(sizedCache.put(5, 5, 100));
 }
 
+// Tests peeking at and evicting the least recently used element.
+TEST(SizedMRUCacheTest, LeastRecentlyUsed)
+{
+    constexpr size_t kSize = 32;
+    SizedMRUCache<size_t, size_t> sizedCache(kSize);
+
+    const size_t *qvalue = nullptr;
+    EXPECT_FALSE(sizedCache.peekLeastRecentlyUsed(&qvalue));
+    EXPECT_EQ(0u, sizedCache.evictLeastRecentlyUsed());
+
+    EXPECT_TRUE(sizedCache.put(1, 1, 2));
+    EXPECT_TRUE(sizedCache.put(2, 2, 3));
+    EXPECT_TRUE(sizedCache.put(3, 3, 4));
+
+    // Using an element moves it to the front.
+    EXPECT_TRUE(sizedCache.get(1, &qvalue));
+    EXPECT_TRUE(sizedCache.peekLeastRecentlyUsed(&qvalue));
+    EXPECT_EQ(2u, *qvalue);
+
+    // Peeking doesn't.
+    EXPECT_TRUE(sizedCache.peekLeastRecentlyUsed(&qvalue));
+    EXPECT_EQ(2u, *qvalue);
+
+    EXPECT_EQ(3u, sizedCache.evictLeastRecentlyUsed());
+    EXPECT_EQ(6u, sizedCache.size());
+    EXPECT_FALSE(sizedCache.get(2, &qvalue));
+
+    EXPECT_TRUE(sizedCache.peekLeastRecentlyUsed(&qvalue));
+    EXPECT_EQ(3u, *qvalue);
+}
+
 }  // namespace angle
@@ -104,7 +104,8 @@ const angle::PerfMonitorCounterGroupsInfo &ContextImpl::getPerfMonitorCountersIn
     return *sCountersInfo;
 }
 
-const angle::PerfMonitorCounterGroups &ContextImpl::getPerfMonitorCounters()
+const angle::PerfMonitorCounterGroups &ContextImpl::getPerfMonitorCounters(
+    const gl::Context *context)
 {
     static angle::base::NoDestructor<angle::PerfMonitorCounterGroups> sCounters;
     return *sCounters;
@@ -278,7 +278,8 @@ class ContextImpl : public GLImplFactory
 
     // AMD_performance_monitor
     virtual const angle::PerfMonitorCounterGroupsInfo &getPerfMonitorCountersInfo() const;
-    virtual const angle::PerfMonitorCounterGroups &getPerfMonitorCounters();
+    virtual const angle::PerfMonitorCounterGroups &getPerfMonitorCounters(
+        const gl::Context *context);
 
   protected:
     const gl::State &mState;
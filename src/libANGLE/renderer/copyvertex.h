@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_COPYVERTEX_H_
 
 #include "common/mathutil.h"
+#include "libANGLE/renderer/copyvertex_simd.h"
 
 namespace rx
 {
@@ -197,7 +197,10 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
 {
     static const float divisor = 1.0f / (1 << 16);
 
-    for (size_t i = 0; i < count; i++)
+    const size_t simdCount = priv::Copy32FixedTo32FVertexDataSIMD(
+        input, stride, count, inputComponentCount, outputComponentCount, output);
+
+    for (size_t i = simdCount; i < count; i++)
     {
         const uint8_t *offsetInput = input + i * stride;
         float *offsetOutput        = reinterpret_cast<float *>(output) + i * outputComponentCount;
@@ -246,7 +249,10 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
-    for (size_t i = 0; i < count; i++)
+    const size_t simdCount = priv::CopyToFloatVertexDataSIMD<T>(
+        input, stride, count, inputComponentCount, outputComponentCount, normalized, toHalf, output);
+
+    for (size_t i = simdCount; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
         outputType *offsetOutput =
@@ -556,7 +562,14 @@ inline void CopyXYZ10W2ToXYZWFloatVertexData(const uint8_t *input,
     const uint32_t alphaMask = 0x3;  // 1 set in bits 0 and 1
     const size_t alphaShift  = 30;   // Alpha is the 30 and 31 bits
 
-    for (size_t i = 0; i < count; i++)
+    size_t simdCount = 0;
+    if (toFloat || toHalf)
+    {
+        simdCount = priv::CopyXYZ10W2ToXYZWFloatVertexDataSIMD(input, stride, count, isSigned,
+                                                               normalized, toHalf, output);
+    }
+
+    for (size_t i = simdCount; i < count; i++)
     {
         GLuint packedValue    = *reinterpret_cast<const GLuint *>(input + (i * stride));
         uint8_t *offsetOutput = output + (i * outputComponentSize * componentCount);
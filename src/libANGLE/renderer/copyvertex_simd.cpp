@@ -0,0 +1,714 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// copyvertex_simd.cpp: Vectorized vertex conversion kernels used by the functions of copyvertex.h.
+
+#include "libANGLE/renderer/copyvertex_simd.h"
+
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "common/debug.h"
+#include "common/simd_utils.h"
+#include "image_util/float16_simd.h"
+
+namespace rx
+{
+namespace priv
+{
+namespace
+{
+// How the converted components are scaled.  Normalize divides by the largest value of the input
+// type (and clamps signed values to -1), while Fixed converts from 16.16 fixed point.
+enum class ComponentScale
+{
+    None,
+    Normalize,
+    Fixed,
+};
+
+// Number of bytes read from the start of each vertex by the kernels that convert one vertex at a
+// time.  This may be more than the size of the attribute; GetSIMDVertexCount accounts for it.
+template <typename T>
+constexpr size_t kVertexLoadBytes = sizeof(T) < 4 ? sizeof(T) * 4 : 16;
+
+// Returns how many leading vertices can be converted by a kernel that reads |loadBytes| from the
+// start of each input vertex and writes |storeBytes| to the start of each output vertex without
+// accessing memory past the last input attribute and the last output vertex.  Overlapping writes
+// are harmless as the vertices are written in order and the remainder is written by the caller.
+size_t GetSIMDVertexCount(size_t stride,
+                          size_t count,
+                          size_t attribSize,
+                          size_t loadBytes,
+                          size_t outputStride,
+                          size_t storeBytes)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    size_t simdCount = count;
+
+    const size_t inputEnd = (count - 1) * stride + attribSize;
+    if (loadBytes > attribSize)
+    {
+        if (inputEnd < loadBytes)
+        {
+            return 0;
+        }
+        if (stride != 0)
+        {
+            simdCount = std::min(simdCount, (inputEnd - loadBytes) / stride + 1);
+        }
+    }
+
+    const size_t outputEnd = count * outputStride;
+    if (storeBytes > outputStride)
+    {
+        if (outputEnd < storeBytes)
+        {
+            return 0;
+        }
+        simdCount = std::min(simdCount, (outputEnd - storeBytes) / outputStride + 1);
+    }
+
+    return simdCount;
+}
+
+bool IsDefaultAlphaOne(size_t inputComponentCount, size_t outputComponentCount)
+{
+    return inputComponentCount < 4 && outputComponentCount == 4;
+}
+
+#if defined(ANGLE_SIMD_X86)
+// Loads the (up to) four components of a vertex and converts them to float.  Components past the
+// attribute hold garbage that the caller masks off.
+template <typename T>
+ANGLE_SIMD_TARGET_SSE41 inline __m128 LoadVertexSSE41(const uint8_t *input)
+{
+    if constexpr (std::is_same<T, GLfloat>::value)
+    {
+        return _mm_loadu_ps(reinterpret_cast<const float *>(input));
+    }
+    else if constexpr (std::is_same<T, GLint>::value)
+    {
+        return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        const __m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+        return _mm_cvtepi32_ps(std::is_signed<T>::value ? _mm_cvtepi16_epi32(shorts)
+                                                        : _mm_cvtepu16_epi32(shorts));
+    }
+    else
+    {
+        int32_t packed;
+        memcpy(&packed, input, sizeof(packed));
+        const __m128i bytes = _mm_cvtsi32_si128(packed);
+        return _mm_cvtepi32_ps(std::is_signed<T>::value ? _mm_cvtepi8_epi32(bytes)
+                                                        : _mm_cvtepu8_epi32(bytes));
+    }
+}
+
+// Converts the components of a vertex like CopyToFloatVertexData and Copy32FixedTo32FVertexData.
+// |keepMask| selects the components of the attribute, and the others are taken from |defaults|.
+template <typename T, ComponentScale scale>
+ANGLE_SIMD_TARGET_SSE41 inline __m128 ConvertVertexSSE41(const uint8_t *input,
+                                                         __m128 keepMask,
+                                                         __m128 defaults)
+{
+    __m128 value = LoadVertexSSE41<T>(input);
+    if constexpr (scale == ComponentScale::Normalize)
+    {
+        const float maxValue = static_cast<float>(std::numeric_limits<T>::max());
+        value                = _mm_div_ps(value, _mm_set1_ps(maxValue));
+        if constexpr (std::is_signed<T>::value)
+        {
+            value = _mm_max_ps(value, _mm_set1_ps(-1.0f));
+        }
+    }
+    else if constexpr (scale == ComponentScale::Fixed)
+    {
+        value = _mm_mul_ps(value, _mm_set1_ps(1.0f / (1 << 16)));
+    }
+    return _mm_or_ps(_mm_and_ps(value, keepMask), defaults);
+}
+
+ANGLE_SIMD_TARGET_SSE41
+inline void GetComponentMasksSSE41(size_t inputComponentCount,
+                                   size_t outputComponentCount,
+                                   __m128 *keepMaskOut,
+                                   __m128 *defaultsOut)
+{
+    *keepMaskOut = _mm_castsi128_ps(_mm_cmpgt_epi32(
+        _mm_set1_epi32(static_cast<int>(inputComponentCount)), _mm_setr_epi32(0, 1, 2, 3)));
+    *defaultsOut = _mm_setr_ps(
+        0.0f, 0.0f, 0.0f,
+        IsDefaultAlphaOne(inputComponentCount, outputComponentCount) ? 1.0f : 0.0f);
+}
+
+template <typename T, ComponentScale scale>
+ANGLE_SIMD_TARGET_SSE41 size_t CopyToFloatVertexDataSSE41(const uint8_t *input,
+                                                          size_t stride,
+                                                          size_t simdCount,
+                                                          size_t inputComponentCount,
+                                                          size_t outputComponentCount,
+                                                          uint8_t *output)
+{
+    __m128 keepMask, defaults;
+    GetComponentMasksSSE41(inputComponentCount, outputComponentCount, &keepMask, &defaults);
+
+    const size_t outputStride = outputComponentCount * sizeof(float);
+    for (size_t i = 0; i < simdCount; ++i)
+    {
+        _mm_storeu_ps(reinterpret_cast<float *>(output + i * outputStride),
+                      ConvertVertexSSE41<T, scale>(input + i * stride, keepMask, defaults));
+    }
+    return simdCount;
+}
+
+// Converts two vertices of four floats to half floats and stores 8 bytes at each output.
+ANGLE_SIMD_TARGET_AVX2
+inline void StoreTwoVerticesAsHalfAVX2(__m128 vertex0,
+                                       __m128 vertex1,
+                                       uint8_t *output0,
+                                       uint8_t *output1)
+{
+    const __m256i halves =
+        angle::priv::Float32ToFloat16AVX2(_mm256_castps_si256(_mm256_set_m128(vertex1, vertex0)));
+    const __m256i packed = _mm256_packus_epi32(halves, halves);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output0), _mm256_castsi256_si128(packed));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output1), _mm256_extracti128_si256(packed, 1));
+}
+
+template <typename T, ComponentScale scale>
+ANGLE_SIMD_TARGET_AVX2 size_t CopyToHalfVertexDataAVX2(const uint8_t *input,
+                                                       size_t stride,
+                                                       size_t simdCount,
+                                                       size_t inputComponentCount,
+                                                       size_t outputComponentCount,
+                                                       uint8_t *output)
+{
+    __m128 keepMask, defaults;
+    GetComponentMasksSSE41(inputComponentCount, outputComponentCount, &keepMask, &defaults);
+
+    const size_t outputStride = outputComponentCount * sizeof(GLhalf);
+    size_t i                  = 0;
+    for (; i + 2 <= simdCount; i += 2)
+    {
+        const __m128 vertex0 = ConvertVertexSSE41<T, scale>(input + i * stride, keepMask, defaults);
+        const __m128 vertex1 =
+            ConvertVertexSSE41<T, scale>(input + (i + 1) * stride, keepMask, defaults);
+        StoreTwoVerticesAsHalfAVX2(vertex0, vertex1, output + i * outputStride,
+                                   output + (i + 1) * outputStride);
+    }
+    return i;
+}
+
+// Unpacks the four channels of four XYZ10W2 vertices and converts them to float like
+// priv::CopyPackedRGB and priv::CopyPackedAlpha.
+template <bool isSigned, bool normalized>
+ANGLE_SIMD_TARGET_SSE41 inline void UnpackXYZ10W2SSE41(__m128i packed, __m128 *channelsOut)
+{
+    if constexpr (isSigned)
+    {
+        // Shift each channel to the top of the lane and sign extend it back down.
+        channelsOut[0] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 22), 22));
+        channelsOut[1] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 12), 22));
+        channelsOut[2] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 2), 22));
+        channelsOut[3] = _mm_cvtepi32_ps(_mm_srai_epi32(packed, 30));
+        if constexpr (normalized)
+        {
+            // Same operations as CopyPackedRGB, including the clamp of -512 to -511.
+            const __m128 minValue  = _mm_set1_ps(-511.0f);
+            const __m128 halfRange = _mm_set1_ps(511.0f);
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                const __m128 clamped = _mm_max_ps(channelsOut[channel], minValue);
+                channelsOut[channel] = _mm_sub_ps(
+                    _mm_div_ps(_mm_sub_ps(clamped, minValue), halfRange), _mm_set1_ps(1.0f));
+            }
+            channelsOut[3] = _mm_max_ps(channelsOut[3], _mm_set1_ps(-1.0f));
+        }
+    }
+    else
+    {
+        const __m128i rgbMask = _mm_set1_epi32(0x3FF);
+        channelsOut[0]        = _mm_cvtepi32_ps(_mm_and_si128(packed, rgbMask));
+        channelsOut[1]        = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 10), rgbMask));
+        channelsOut[2]        = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 20), rgbMask));
+        channelsOut[3]        = _mm_cvtepi32_ps(_mm_srli_epi32(packed, 30));
+        if constexpr (normalized)
+        {
+            const __m128 maxValue = _mm_set1_ps(1023.0f);
+            channelsOut[0]        = _mm_div_ps(channelsOut[0], maxValue);
+            channelsOut[1]        = _mm_div_ps(channelsOut[1], maxValue);
+            channelsOut[2]        = _mm_div_ps(channelsOut[2], maxValue);
+            channelsOut[3]        = _mm_div_ps(channelsOut[3], _mm_set1_ps(3.0f));
+        }
+    }
+}
+
+// Loads four packed vertices and returns them as four vectors of XYZW floats.
+template <bool isSigned, bool normalized>
+ANGLE_SIMD_TARGET_SSE41 inline void LoadFourXYZ10W2VerticesSSE41(const uint8_t *input,
+                                                                  size_t stride,
+                                                                  __m128 *verticesOut)
+{
+    uint32_t packed[4];
+    for (size_t vertex = 0; vertex < 4; ++vertex)
+    {
+        memcpy(&packed[vertex], input + vertex * stride, sizeof(uint32_t));
+    }
+
+    UnpackXYZ10W2SSE41<isSigned, normalized>(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(packed)), verticesOut);
+    _MM_TRANSPOSE4_PS(verticesOut[0], verticesOut[1], verticesOut[2], verticesOut[3]);
+}
+
+template <bool isSigned, bool normalized>
+ANGLE_SIMD_TARGET_SSE41 size_t CopyXYZ10W2ToXYZW32FVertexDataSSE41(const uint8_t *input,
+                                                                   size_t stride,
+                                                                   size_t count,
+                                                                   uint8_t *output)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vertices[4];
+        LoadFourXYZ10W2VerticesSSE41<isSigned, normalized>(input + i * stride, stride, vertices);
+        for (size_t vertex = 0; vertex < 4; ++vertex)
+        {
+            _mm_storeu_ps(reinterpret_cast<float *>(output + (i + vertex) * 16), vertices[vertex]);
+        }
+    }
+    return i;
+}
+
+template <bool isSigned, bool normalized>
+ANGLE_SIMD_TARGET_AVX2 size_t CopyXYZ10W2ToXYZW16FVertexDataAVX2(const uint8_t *input,
+                                                                 size_t stride,
+                                                                 size_t count,
+                                                                 uint8_t *output)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vertices[4];
+        LoadFourXYZ10W2VerticesSSE41<isSigned, normalized>(input + i * stride, stride, vertices);
+        StoreTwoVerticesAsHalfAVX2(vertices[0], vertices[1], output + i * 8, output + i * 8 + 8);
+        StoreTwoVerticesAsHalfAVX2(vertices[2], vertices[3], output + i * 8 + 16,
+                                   output + i * 8 + 24);
+    }
+    return i;
+}
+#elif defined(ANGLE_SIMD_NEON)
+template <typename T>
+inline float32x4_t LoadVertexNEON(const uint8_t *input)
+{
+    if constexpr (std::is_same<T, GLfloat>::value)
+    {
+        return vreinterpretq_f32_u8(vld1q_u8(input));
+    }
+    else if constexpr (std::is_same<T, GLint>::value)
+    {
+        return vcvtq_f32_s32(vreinterpretq_s32_u8(vld1q_u8(input)));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        const uint8x8_t shorts = vld1_u8(input);
+        if constexpr (std::is_signed<T>::value)
+        {
+            return vcvtq_f32_s32(vmovl_s16(vreinterpret_s16_u8(shorts)));
+        }
+        else
+        {
+            return vcvtq_f32_u32(vmovl_u16(vreinterpret_u16_u8(shorts)));
+        }
+    }
+    else
+    {
+        uint32_t packed;
+        memcpy(&packed, input, sizeof(packed));
+        const uint8x8_t bytes = vcreate_u8(packed);
+        if constexpr (std::is_signed<T>::value)
+        {
+            return vcvtq_f32_s32(vmovl_s16(vget_low_s16(vmovl_s8(vreinterpret_s8_u8(bytes)))));
+        }
+        else
+        {
+            return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(bytes))));
+        }
+    }
+}
+
+template <typename T, ComponentScale scale>
+inline float32x4_t ConvertVertexNEON(const uint8_t *input,
+                                     uint32x4_t keepMask,
+                                     float32x4_t defaults)
+{
+    float32x4_t value = LoadVertexNEON<T>(input);
+    if constexpr (scale == ComponentScale::Normalize)
+    {
+        const float maxValue = static_cast<float>(std::numeric_limits<T>::max());
+        value                = vdivq_f32(value, vdupq_n_f32(maxValue));
+        if constexpr (std::is_signed<T>::value)
+        {
+            value = vmaxq_f32(value, vdupq_n_f32(-1.0f));
+        }
+    }
+    else if constexpr (scale == ComponentScale::Fixed)
+    {
+        value = vmulq_n_f32(value, 1.0f / (1 << 16));
+    }
+    return vbslq_f32(keepMask, value, defaults);
+}
+
+template <typename T, ComponentScale scale, bool toHalf>
+size_t CopyToFloatVertexDataNEON(const uint8_t *input,
+                                 size_t stride,
+                                 size_t simdCount,
+                                 size_t inputComponentCount,
+                                 size_t outputComponentCount,
+                                 uint8_t *output)
+{
+    const uint32_t kLanes[4]   = {0, 1, 2, 3};
+    const uint32x4_t keepMask  = vcltq_u32(vld1q_u32(kLanes),
+                                           vdupq_n_u32(static_cast<uint32_t>(inputComponentCount)));
+    const float32x4_t defaults = vsetq_lane_f32(
+        IsDefaultAlphaOne(inputComponentCount, outputComponentCount) ? 1.0f : 0.0f,
+        vdupq_n_f32(0.0f), 3);
+
+    const size_t outputStride = outputComponentCount * (toHalf ? sizeof(GLhalf) : sizeof(float));
+    for (size_t i = 0; i < simdCount; ++i)
+    {
+        const float32x4_t vertex =
+            ConvertVertexNEON<T, scale>(input + i * stride, keepMask, defaults);
+        if constexpr (toHalf)
+        {
+            vst1_u8(output + i * outputStride,
+                    vreinterpret_u8_u16(vmovn_u32(
+                        angle::priv::Float32ToFloat16NEON(vreinterpretq_u32_f32(vertex)))));
+        }
+        else
+        {
+            vst1q_u8(output + i * outputStride, vreinterpretq_u8_f32(vertex));
+        }
+    }
+    return simdCount;
+}
+
+template <bool isSigned, bool normalized>
+inline float32x4x4_t UnpackXYZ10W2NEON(uint32x4_t packed)
+{
+    float32x4x4_t channels;
+    if constexpr (isSigned)
+    {
+        const int32x4_t signedPacked = vreinterpretq_s32_u32(packed);
+        channels.val[0] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(signedPacked, 22), 22));
+        channels.val[1] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(signedPacked, 12), 22));
+        channels.val[2] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(signedPacked, 2), 22));
+        channels.val[3] = vcvtq_f32_s32(vshrq_n_s32(signedPacked, 30));
+        if constexpr (normalized)
+        {
+            const float32x4_t minValue  = vdupq_n_f32(-511.0f);
+            const float32x4_t halfRange = vdupq_n_f32(511.0f);
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                const float32x4_t clamped = vmaxq_f32(channels.val[channel], minValue);
+                channels.val[channel] = vsubq_f32(
+                    vdivq_f32(vsubq_f32(clamped, minValue), halfRange), vdupq_n_f32(1.0f));
+            }
+            channels.val[3] = vmaxq_f32(channels.val[3], vdupq_n_f32(-1.0f));
+        }
+    }
+    else
+    {
+        const uint32x4_t rgbMask = vdupq_n_u32(0x3FF);
+        channels.val[0]          = vcvtq_f32_u32(vandq_u32(packed, rgbMask));
+        channels.val[1]          = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 10), rgbMask));
+        channels.val[2]          = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 20), rgbMask));
+        channels.val[3]          = vcvtq_f32_u32(vshrq_n_u32(packed, 30));
+        if constexpr (normalized)
+        {
+            const float32x4_t maxValue = vdupq_n_f32(1023.0f);
+            channels.val[0]            = vdivq_f32(channels.val[0], maxValue);
+            channels.val[1]            = vdivq_f32(channels.val[1], maxValue);
+            channels.val[2]            = vdivq_f32(channels.val[2], maxValue);
+            channels.val[3]            = vdivq_f32(channels.val[3], vdupq_n_f32(3.0f));
+        }
+    }
+    return channels;
+}
+
+template <bool isSigned, bool normalized, bool toHalf>
+size_t CopyXYZ10W2ToXYZWFloatVertexDataNEON(const uint8_t *input,
+                                            size_t stride,
+                                            size_t count,
+                                            uint8_t *output)
+{
+    const size_t outputStride = 4 * (toHalf ? sizeof(GLhalf) : sizeof(float));
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32_t packed[4];
+        for (size_t vertex = 0; vertex < 4; ++vertex)
+        {
+            memcpy(&packed[vertex], input + (i + vertex) * stride, sizeof(uint32_t));
+        }
+
+        // vst4 interleaves the channels back into vertices.
+        const float32x4x4_t channels = UnpackXYZ10W2NEON<isSigned, normalized>(vld1q_u32(packed));
+        if constexpr (toHalf)
+        {
+            uint16x4x4_t halves;
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                halves.val[channel] = vmovn_u32(angle::priv::Float32ToFloat16NEON(
+                    vreinterpretq_u32_f32(channels.val[channel])));
+            }
+            vst4_u16(reinterpret_cast<uint16_t *>(output + i * outputStride), halves);
+        }
+        else
+        {
+            vst4q_f32(reinterpret_cast<float *>(output + i * outputStride), channels);
+        }
+    }
+    return i;
+}
+#endif
+
+template <typename T, ComponentScale scale>
+size_t CopyToFloatVertexDataImpl(const uint8_t *input,
+                                 size_t stride,
+                                 size_t count,
+                                 size_t inputComponentCount,
+                                 size_t outputComponentCount,
+                                 bool toHalf,
+                                 uint8_t *output)
+{
+    const size_t outputStride = outputComponentCount * (toHalf ? sizeof(GLhalf) : sizeof(float));
+    const size_t simdCount    = GetSIMDVertexCount(stride, count, inputComponentCount * sizeof(T),
+                                                   kVertexLoadBytes<T>, outputStride,
+                                                   toHalf ? 4 * sizeof(GLhalf) : 4 * sizeof(float));
+    if (simdCount == 0)
+    {
+        return 0;
+    }
+
+#if defined(ANGLE_SIMD_X86)
+    // The half float conversion needs the per-lane shifts of AVX2.
+    if (toHalf)
+    {
+        if (angle::HasCPUFeature(angle::CPUFeature::AVX2))
+        {
+            return CopyToHalfVertexDataAVX2<T, scale>(input, stride, simdCount,
+                                                      inputComponentCount, outputComponentCount,
+                                                      output);
+        }
+        return 0;
+    }
+    if (angle::HasCPUFeature(angle::CPUFeature::SSE41))
+    {
+        return CopyToFloatVertexDataSSE41<T, scale>(input, stride, simdCount, inputComponentCount,
+                                                    outputComponentCount, output);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (angle::HasCPUFeature(angle::CPUFeature::NEON))
+    {
+        return toHalf ? CopyToFloatVertexDataNEON<T, scale, true>(input, stride, simdCount,
+                                                                  inputComponentCount,
+                                                                  outputComponentCount, output)
+                      : CopyToFloatVertexDataNEON<T, scale, false>(input, stride, simdCount,
+                                                                   inputComponentCount,
+                                                                   outputComponentCount, output);
+    }
+#endif
+    return 0;
+}
+
+template <typename T>
+size_t CopyToFloatVertexDataDispatch(const uint8_t *input,
+                                     size_t stride,
+                                     size_t count,
+                                     size_t inputComponentCount,
+                                     size_t outputComponentCount,
+                                     bool normalized,
+                                     bool toHalf,
+                                     uint8_t *output)
+{
+    return normalized ? CopyToFloatVertexDataImpl<T, ComponentScale::Normalize>(
+                            input, stride, count, inputComponentCount, outputComponentCount,
+                            toHalf, output)
+                      : CopyToFloatVertexDataImpl<T, ComponentScale::None>(
+                            input, stride, count, inputComponentCount, outputComponentCount,
+                            toHalf, output);
+}
+
+template <bool isSigned, bool normalized>
+size_t CopyXYZ10W2ToXYZWFloatVertexDataImpl(const uint8_t *input,
+                                            size_t stride,
+                                            size_t count,
+                                            bool toHalf,
+                                            uint8_t *output)
+{
+#if defined(ANGLE_SIMD_X86)
+    if (toHalf)
+    {
+        if (angle::HasCPUFeature(angle::CPUFeature::AVX2))
+        {
+            return CopyXYZ10W2ToXYZW16FVertexDataAVX2<isSigned, normalized>(input, stride, count,
+                                                                            output);
+        }
+        return 0;
+    }
+    if (angle::HasCPUFeature(angle::CPUFeature::SSE41))
+    {
+        return CopyXYZ10W2ToXYZW32FVertexDataSSE41<isSigned, normalized>(input, stride, count,
+                                                                         output);
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (angle::HasCPUFeature(angle::CPUFeature::NEON))
+    {
+        return toHalf ? CopyXYZ10W2ToXYZWFloatVertexDataNEON<isSigned, normalized, true>(
+                            input, stride, count, output)
+                      : CopyXYZ10W2ToXYZWFloatVertexDataNEON<isSigned, normalized, false>(
+                            input, stride, count, output);
+    }
+#endif
+    return 0;
+}
+}  // anonymous namespace
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLbyte>(const uint8_t *input,
+                                         size_t stride,
+                                         size_t count,
+                                         size_t inputComponentCount,
+                                         size_t outputComponentCount,
+                                         bool normalized,
+                                         bool toHalf,
+                                         uint8_t *output)
+{
+    return CopyToFloatVertexDataDispatch<GLbyte>(input, stride, count, inputComponentCount,
+                                                 outputComponentCount, normalized, toHalf, output);
+}
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLubyte>(const uint8_t *input,
+                                          size_t stride,
+                                          size_t count,
+                                          size_t inputComponentCount,
+                                          size_t outputComponentCount,
+                                          bool normalized,
+                                          bool toHalf,
+                                          uint8_t *output)
+{
+    return CopyToFloatVertexDataDispatch<GLubyte>(input, stride, count, inputComponentCount,
+                                                  outputComponentCount, normalized, toHalf, output);
+}
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLshort>(const uint8_t *input,
+                                          size_t stride,
+                                          size_t count,
+                                          size_t inputComponentCount,
+                                          size_t outputComponentCount,
+                                          bool normalized,
+                                          bool toHalf,
+                                          uint8_t *output)
+{
+    return CopyToFloatVertexDataDispatch<GLshort>(input, stride, count, inputComponentCount,
+                                                  outputComponentCount, normalized, toHalf, output);
+}
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLushort>(const uint8_t *input,
+                                           size_t stride,
+                                           size_t count,
+                                           size_t inputComponentCount,
+                                           size_t outputComponentCount,
+                                           bool normalized,
+                                           bool toHalf,
+                                           uint8_t *output)
+{
+    return CopyToFloatVertexDataDispatch<GLushort>(input, stride, count, inputComponentCount,
+                                                   outputComponentCount, normalized, toHalf,
+                                                   output);
+}
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLint>(const uint8_t *input,
+                                        size_t stride,
+                                        size_t count,
+                                        size_t inputComponentCount,
+                                        size_t outputComponentCount,
+                                        bool normalized,
+                                        bool toHalf,
+                                        uint8_t *output)
+{
+    return CopyToFloatVertexDataDispatch<GLint>(input, stride, count, inputComponentCount,
+                                                outputComponentCount, normalized, toHalf, output);
+}
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLfloat>(const uint8_t *input,
+                                          size_t stride,
+                                          size_t count,
+                                          size_t inputComponentCount,
+                                          size_t outputComponentCount,
+                                          bool normalized,
+                                          bool toHalf,
+                                          uint8_t *output)
+{
+    ASSERT(!normalized);
+    return CopyToFloatVertexDataImpl<GLfloat, ComponentScale::None>(
+        input, stride, count, inputComponentCount, outputComponentCount, toHalf, output);
+}
+
+size_t Copy32FixedTo32FVertexDataSIMD(const uint8_t *input,
+                                      size_t stride,
+                                      size_t count,
+                                      size_t inputComponentCount,
+                                      size_t outputComponentCount,
+                                      uint8_t *output)
+{
+    // GLfixed is loaded like GLint and scaled instead of normalized.
+    ASSERT(!IsDefaultAlphaOne(inputComponentCount, outputComponentCount));
+    return CopyToFloatVertexDataImpl<GLfixed, ComponentScale::Fixed>(
+        input, stride, count, inputComponentCount, outputComponentCount, false, output);
+}
+
+size_t CopyXYZ10W2ToXYZWFloatVertexDataSIMD(const uint8_t *input,
+                                            size_t stride,
+                                            size_t count,
+                                            bool isSigned,
+                                            bool normalized,
+                                            bool toHalf,
+                                            uint8_t *output)
+{
+    if (isSigned)
+    {
+        return normalized ? CopyXYZ10W2ToXYZWFloatVertexDataImpl<true, true>(input, stride, count,
+                                                                             toHalf, output)
+                          : CopyXYZ10W2ToXYZWFloatVertexDataImpl<true, false>(input, stride, count,
+                                                                              toHalf, output);
+    }
+    return normalized ? CopyXYZ10W2ToXYZWFloatVertexDataImpl<false, true>(input, stride, count,
+                                                                          toHalf, output)
+                      : CopyXYZ10W2ToXYZWFloatVertexDataImpl<false, false>(input, stride, count,
+                                                                           toHalf, output);
+}
+}  // namespace priv
+}  // namespace rx
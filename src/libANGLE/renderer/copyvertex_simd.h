@@ -0,0 +1,115 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertex_simd.h: Vectorized vertex conversion kernels used by the functions of copyvertex.h.
+//
+// Each kernel converts a prefix of |count| vertices and returns the number of vertices it
+// converted, leaving the rest to the scalar loop of the caller.  They return 0 when no suitable
+// instruction set is available.  The kernels never access memory outside of the |count| input and
+// output vertices, so disjoint ranges of vertices can be converted concurrently, and the results
+// are bit-identical to the scalar code.
+
+#ifndef LIBANGLE_RENDERER_COPYVERTEX_SIMD_H_
+#define LIBANGLE_RENDERER_COPYVERTEX_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "angle_gl.h"
+
+namespace rx
+{
+namespace priv
+{
+// CopyToFloatVertexData.  Specialized for GLbyte, GLubyte, GLshort, GLushort, GLint and GLfloat.
+template <typename T>
+inline size_t CopyToFloatVertexDataSIMD(const uint8_t *input,
+                                        size_t stride,
+                                        size_t count,
+                                        size_t inputComponentCount,
+                                        size_t outputComponentCount,
+                                        bool normalized,
+                                        bool toHalf,
+                                        uint8_t *output)
+{
+    return 0;
+}
+
+template <>
+size_t CopyToFloatVertexDataSIMD<GLbyte>(const uint8_t *input,
+                                         size_t stride,
+                                         size_t count,
+                                         size_t inputComponentCount,
+                                         size_t outputComponentCount,
+                                         bool normalized,
+                                         bool toHalf,
+                                         uint8_t *output);
+template <>
+size_t CopyToFloatVertexDataSIMD<GLubyte>(const uint8_t *input,
+                                          size_t stride,
+                                          size_t count,
+                                          size_t inputComponentCount,
+                                          size_t outputComponentCount,
+                                          bool normalized,
+                                          bool toHalf,
+                                          uint8_t *output);
+template <>
+size_t CopyToFloatVertexDataSIMD<GLshort>(const uint8_t *input,
+                                          size_t stride,
+                                          size_t count,
+                                          size_t inputComponentCount,
+                                          size_t outputComponentCount,
+                                          bool normalized,
+                                          bool toHalf,
+                                          uint8_t *output);
+template <>
+size_t CopyToFloatVertexDataSIMD<GLushort>(const uint8_t *input,
+                                           size_t stride,
+                                           size_t count,
+                                           size_t inputComponentCount,
+                                           size_t outputComponentCount,
+                                           bool normalized,
+                                           bool toHalf,
+                                           uint8_t *output);
+template <>
+size_t CopyToFloatVertexDataSIMD<GLint>(const uint8_t *input,
+                                        size_t stride,
+                                        size_t count,
+                                        size_t inputComponentCount,
+                                        size_t outputComponentCount,
+                                        bool normalized,
+                                        bool toHalf,
+                                        uint8_t *output);
+template <>
+size_t CopyToFloatVertexDataSIMD<GLfloat>(const uint8_t *input,
+                                          size_t stride,
+                                          size_t count,
+                                          size_t inputComponentCount,
+                                          size_t outputComponentCount,
+                                          bool normalized,
+                                          bool toHalf,
+                                          uint8_t *output);
+
+// Copy32FixedTo32FVertexData.
+size_t Copy32FixedTo32FVertexDataSIMD(const uint8_t *input,
+                                      size_t stride,
+                                      size_t count,
+                                      size_t inputComponentCount,
+                                      size_t outputComponentCount,
+                                      uint8_t *output);
+
+// CopyXYZ10W2ToXYZWFloatVertexData with float or half float output.
+size_t CopyXYZ10W2ToXYZWFloatVertexDataSIMD(const uint8_t *input,
+                                            size_t stride,
+                                            size_t count,
+                                            bool isSigned,
+                                            bool normalized,
+                                            bool toHalf,
+                                            uint8_t *output);
+}  // namespace priv
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_COPYVERTEX_SIMD_H_
@@ -0,0 +1,148 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// copyvertex_unittest.cpp: Unit tests for the vertex conversion functions.
+
+#include <gmock/gmock.h>
+#include <random>
+#include <vector>
+#include "common/simd_utils.h"
+#include "libANGLE/renderer/copyvertex.h"
+
+using namespace angle;
+using namespace rx;
+using namespace testing;
+
+namespace
+{
+constexpr CPUFeatureMask kSIMDFeatureMasks[] = {
+    static_cast<CPUFeatureMask>(CPUFeature::SSE41),
+    static_cast<CPUFeatureMask>(CPUFeature::AVX2),
+    static_cast<CPUFeatureMask>(CPUFeature::NEON),
+    kAllCPUFeatures,
+};
+
+// Bytes of padding around the input and output, which must not be read or written.
+constexpr size_t kGuardSize = 32;
+
+// Converts random vertices with the scalar code and with each set of CPU features, and checks that
+// the results are identical.  The input is placed at the end of its allocation and the output is
+// followed by guard bytes, so overruns are caught by ASan and by the comparison respectively.  The
+// strides keep the components aligned to |componentSize|.
+void TestConversionMatchesScalar(VertexCopyFunction copyFunction,
+                                 size_t componentSize,
+                                 size_t attribSize,
+                                 size_t outputVertexSize)
+{
+    std::mt19937 generator(0x5EED);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    for (size_t stride : {attribSize, attribSize + componentSize, attribSize + componentSize * 3,
+                          attribSize * 2 + 4})
+    {
+        for (size_t count : {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 31u, 64u, 1000u})
+        {
+            const size_t inputSize = count == 0 ? 0 : (count - 1) * stride + attribSize;
+            std::vector<uint8_t> inputStorage(kGuardSize + inputSize);
+            for (uint8_t &byte : inputStorage)
+            {
+                byte = static_cast<uint8_t>(byteDistribution(generator));
+            }
+            const uint8_t *input = inputStorage.data() + kGuardSize;
+
+            const size_t outputSize = count * outputVertexSize + kGuardSize;
+
+            SetCPUFeatureMaskForTesting(0);
+            std::vector<uint8_t> expected(outputSize, 0xAA);
+            copyFunction(input, stride, count, expected.data());
+
+            for (CPUFeatureMask mask : kSIMDFeatureMasks)
+            {
+                SetCPUFeatureMaskForTesting(mask);
+                std::vector<uint8_t> actual(outputSize, 0xAA);
+                copyFunction(input, stride, count, actual.data());
+                EXPECT_EQ(expected, actual) << "stride " << stride << ", count " << count
+                                            << ", feature mask " << mask;
+            }
+        }
+    }
+
+    SetCPUFeatureMaskForTesting(kAllCPUFeatures);
+}
+
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+void TestCopyToFloat()
+{
+    TestConversionMatchesScalar(
+        CopyToFloatVertexData<T, inputComponentCount, outputComponentCount, normalized, false>,
+        sizeof(T), sizeof(T) * inputComponentCount, sizeof(float) * outputComponentCount);
+    TestConversionMatchesScalar(
+        CopyToFloatVertexData<T, inputComponentCount, outputComponentCount, normalized, true>,
+        sizeof(T), sizeof(T) * inputComponentCount, sizeof(GLhalf) * outputComponentCount);
+}
+
+template <typename T, bool normalized>
+void TestCopyToFloatAllComponentCounts()
+{
+    TestCopyToFloat<T, 1, 1, normalized>();
+    TestCopyToFloat<T, 2, 2, normalized>();
+    TestCopyToFloat<T, 3, 3, normalized>();
+    TestCopyToFloat<T, 3, 4, normalized>();
+    TestCopyToFloat<T, 4, 4, normalized>();
+}
+
+// Tests byte and short conversions to float and half float.
+TEST(CopyVertexTest, IntegerToFloat)
+{
+    TestCopyToFloatAllComponentCounts<GLbyte, false>();
+    TestCopyToFloatAllComponentCounts<GLbyte, true>();
+    TestCopyToFloatAllComponentCounts<GLubyte, false>();
+    TestCopyToFloatAllComponentCounts<GLubyte, true>();
+    TestCopyToFloatAllComponentCounts<GLshort, false>();
+    TestCopyToFloatAllComponentCounts<GLshort, true>();
+    TestCopyToFloatAllComponentCounts<GLushort, false>();
+    TestCopyToFloatAllComponentCounts<GLushort, true>();
+    TestCopyToFloatAllComponentCounts<GLint, false>();
+    TestCopyToFloatAllComponentCounts<GLint, true>();
+}
+
+// Tests float to half float conversions, including NaNs and denormals from the random input.
+TEST(CopyVertexTest, FloatToHalf)
+{
+    TestConversionMatchesScalar(CopyToFloatVertexData<GLfloat, 1, 1, false, true>, 4, 4, 2);
+    TestConversionMatchesScalar(CopyToFloatVertexData<GLfloat, 2, 2, false, true>, 4, 8, 4);
+    TestConversionMatchesScalar(CopyToFloatVertexData<GLfloat, 3, 3, false, true>, 4, 12, 6);
+    TestConversionMatchesScalar(CopyToFloatVertexData<GLfloat, 3, 4, false, true>, 4, 12, 8);
+    TestConversionMatchesScalar(CopyToFloatVertexData<GLfloat, 4, 4, false, true>, 4, 16, 8);
+}
+
+// Tests fixed point conversions.
+TEST(CopyVertexTest, FixedToFloat)
+{
+    // GLfixed supports unaligned input.
+    TestConversionMatchesScalar(Copy32FixedTo32FVertexData<1, 1>, 1, 4, 4);
+    TestConversionMatchesScalar(Copy32FixedTo32FVertexData<2, 2>, 1, 8, 8);
+    TestConversionMatchesScalar(Copy32FixedTo32FVertexData<3, 3>, 1, 12, 12);
+    TestConversionMatchesScalar(Copy32FixedTo32FVertexData<4, 4>, 1, 16, 16);
+}
+
+// Tests packed 2_10_10_10 conversions to float and half float.
+TEST(CopyVertexTest, PackedXYZ10W2ToFloat)
+{
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<false, false, true, false>, 4, 4,
+                                16);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<false, true, true, false>, 4, 4,
+                                16);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<true, false, true, false>, 4, 4,
+                                16);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<true, true, true, false>, 4, 4,
+                                16);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<false, false, true, true>, 4, 4,
+                                8);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<false, true, true, true>, 4, 4, 8);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<true, false, true, true>, 4, 4, 8);
+    TestConversionMatchesScalar(CopyXYZ10W2ToXYZWFloatVertexData<true, true, true, true>, 4, 4, 8);
+}
+}  // anonymous namespace
@@ -14,18 +14,74 @@ namespace rx
 {
 namespace vk
 {
+namespace
+{
+// Block sizes, as multiples of kBlockSize, that evenly divide the pool allocator pages.
+constexpr size_t kBlockSizeMultipliers[] = {1, 2, 3, 4, 6, 12};
+// The number of blocks a command buffer should ideally need.
+constexpr size_t kTargetBlockCount = 4;
+
+size_t GetNextBlockSize(size_t currentBlockSize, size_t allocatedBytes)
+{
+    const size_t targetBlockSize = allocatedBytes / kTargetBlockCount;
+
+    size_t nextBlockSize = DedicatedCommandBlockPool::kMaxBlockSize;
+    for (size_t multiplier : kBlockSizeMultipliers)
+    {
+        const size_t blockSize = DedicatedCommandBlockPool::kBlockSize * multiplier;
+        if (blockSize >= targetBlockSize)
+        {
+            nextBlockSize = blockSize;
+            break;
+        }
+    }
+
+    if (nextBlockSize >= currentBlockSize)
+    {
+        return nextBlockSize;
+    }
+
+    // Shrink one step at a time, so that an occasional small command buffer in between large
+    // ones doesn't throw away the history.
+    size_t previousBlockSize = DedicatedCommandBlockPool::kBlockSize;
+    for (size_t multiplier : kBlockSizeMultipliers)
+    {
+        const size_t blockSize = DedicatedCommandBlockPool::kBlockSize * multiplier;
+        if (blockSize >= currentBlockSize)
+        {
+            break;
+        }
+        previousBlockSize = blockSize;
+    }
+    return std::max(nextBlockSize, previousBlockSize);
+}
+}  // anonymous namespace
 
 void DedicatedCommandBlockAllocator::resetAllocator()
 {
     mAllocator.reset();
 }
 
+void DedicatedCommandBlockAllocator::setPageRecycler(angle::PoolPageRecycler *recycler)
+{
+    mAllocator.setPageRecycler(recycler);
+}
+
+void DedicatedCommandBlockAllocator::releaseFreePages()
+{
+    mAllocator.releaseFreePages();
+}
+
 void DedicatedCommandBlockPool::reset(CommandBufferCommandTracker *commandBufferTracker)
 {
     mCommandBuffer->clearCommands();
     mCurrentWritePointer   = nullptr;
     mCurrentBytesRemaining = 0;
     commandBufferTracker->reset();
+
+    mBlockSize      = GetNextBlockSize(mBlockSize, mAllocatedBytes);
+    mBlockCount     = 0;
+    mAllocatedBytes = 0;
 }
 
 // Initialize the SecondaryCommandBuffer by setting the allocator it will use
@@ -52,12 +108,16 @@ void DedicatedCommandBlockPool::allocateNewBlock(size_t blockSize)
     mCurrentWritePointer   = mAllocator->fastAllocate(blockSize);
     mCurrentBytesRemaining = blockSize;
     mCommandBuffer->pushToCommands(mCurrentWritePointer);
+
+    ++mBlockCount;
+    mAllocatedBytes += blockSize;
 }
 
 void DedicatedCommandBlockPool::getMemoryUsageStats(size_t *usedMemoryOut,
                                                     size_t *allocatedMemoryOut) const
 {
-    mCommandBuffer->getMemoryUsageStatsForPoolAlloc(kBlockSize, usedMemoryOut, allocatedMemoryOut);
+    mCommandBuffer->getMemoryUsageStatsForPoolAlloc(mAllocatedBytes, usedMemoryOut,
+                                                    allocatedMemoryOut);
 }
 
 }  // namespace vk
@@ -31,13 +31,20 @@ using DedicatedCommandMemoryAllocator = angle::PoolAllocator;
 class DedicatedCommandBlockAllocator
 {
   public:
+    static constexpr size_t kDefaultPoolAllocatorPageSize = 16 * 1024;
+
     DedicatedCommandBlockAllocator() = default;
     void resetAllocator();
 
+    // Share pages with other allocators through |recycler|.  Must be called before the allocator
+    // is first used.
+    void setPageRecycler(angle::PoolPageRecycler *recycler);
+    // Give the memory of the allocator back to the recycler while it's not in use.
+    void releaseFreePages();
+
     DedicatedCommandMemoryAllocator *getAllocator() { return &mAllocator; }
 
   private:
-    static constexpr size_t kDefaultPoolAllocatorPageSize = 16 * 1024;
     // Using a pool allocator per CBH to avoid threading issues that occur w/ shared allocator
     // between multiple CBHs.
     DedicatedCommandMemoryAllocator mAllocator{kDefaultPoolAllocatorPageSize, 1};
@@ -51,6 +58,9 @@ class DedicatedCommandBlockPool final
         : mAllocator(nullptr),
           mCurrentWritePointer(nullptr),
           mCurrentBytesRemaining(0),
+          mBlockSize(kBlockSize),
+          mBlockCount(0),
+          mAllocatedBytes(0),
           mCommandBuffer(nullptr)
     {}
 
@@ -63,6 +73,10 @@ class DedicatedCommandBlockPool final
     static constexpr size_t kBlockSize = 1360;
     // Make sure block size is 8-byte aligned to avoid ASAN errors.
     static_assert((kBlockSize % 8) == 0, "Check kBlockSize alignment");
+    // Command buffers that record a lot of commands use larger blocks, up to a whole page.
+    static constexpr size_t kMaxBlockSize = kBlockSize * 12;
+    static_assert(kMaxBlockSize + 64 <= DedicatedCommandBlockAllocator::kDefaultPoolAllocatorPageSize,
+                  "Check kMaxBlockSize fits in a page");
 
     void setCommandBuffer(priv::SecondaryCommandBuffer *commandBuffer)
     {
@@ -79,6 +93,13 @@ class DedicatedCommandBlockPool final
     bool empty() const;
 
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
+    // The number of blocks and bytes allocated since the last reset.
+    void getBlockStats(size_t *blockCountOut, size_t *allocatedBytesOut) const
+    {
+        *blockCountOut     = mBlockCount;
+        *allocatedBytesOut = mAllocatedBytes;
+    }
+    size_t getBlockSize() const { return mBlockSize; }
 
     void onNewVariableSizedCommand(const size_t requiredSize,
                                    const size_t allocationSize,
@@ -87,7 +108,7 @@ class DedicatedCommandBlockPool final
         if (mCurrentBytesRemaining < requiredSize)
         {
             // variable size command can potentially exceed default cmd allocation blockSize
-            if (requiredSize <= kBlockSize)
+            if (requiredSize <= mBlockSize)
             {
                 allocateNewBlock();
             }
@@ -115,7 +136,8 @@ class DedicatedCommandBlockPool final
     }
 
   private:
-    void allocateNewBlock(size_t blockSize = kBlockSize);
+    void allocateNewBlock() { allocateNewBlock(mBlockSize); }
+    void allocateNewBlock(size_t blockSize);
 
     uint8_t *updateHeaderAndAllocatorParams(size_t allocationSize)
     {
@@ -134,6 +156,13 @@ class DedicatedCommandBlockPool final
     uint8_t *mCurrentWritePointer;
     size_t mCurrentBytesRemaining;
 
+    // The size of the blocks commands are allocated from.  It's adjusted on reset() based on how
+    // much memory the previous commands needed, so that large render passes walk fewer blocks.
+    size_t mBlockSize;
+    // Blocks and bytes allocated since the last reset.
+    size_t mBlockCount;
+    size_t mAllocatedBytes;
+
     // Points to the parent command buffer.
     priv::SecondaryCommandBuffer *mCommandBuffer;
 };
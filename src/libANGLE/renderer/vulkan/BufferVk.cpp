@@ -35,6 +35,11 @@ VkBufferUsageFlags GetDefaultBufferUsageFlags(vk::Renderer *renderer)
         defaultBufferUsageFlags |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT |
                                    VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_COUNTER_BUFFER_BIT_EXT;
     }
+    if (renderer->getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // Descriptors written into descriptor buffers reference buffers by device address.
+        defaultBufferUsageFlags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
     return defaultBufferUsageFlags;
 }
 
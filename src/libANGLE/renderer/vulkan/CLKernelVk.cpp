@@ -439,8 +439,9 @@ angle::Result CLKernelVk::getOrCreateComputePipeline(vk::PipelineCacheAccess *pi
     };
 
     // Now get or create (on compute pipeline cache miss) compute pipeline and return it
-    vk::ComputePipelineOptions options = vk::GetComputePipelineOptions(
-        vk::PipelineRobustness::NonRobust, vk::PipelineProtectedAccess::Unprotected);
+    vk::ComputePipelineOptions options =
+        vk::GetComputePipelineOptions(vk::PipelineRobustness::NonRobust,
+                                      vk::PipelineProtectedAccess::Unprotected, false);
     return mShaderProgramHelper.getOrCreateComputePipeline(
         mContext, &mComputePipelineCache, pipelineCache, getPipelineLayout(), options,
         PipelineSource::Draw, pipelineOut, mName.c_str(), &computeSpecializationInfo);
@@ -306,6 +306,12 @@ void CLPlatformVk::putBlob(const angle::BlobCacheKey &key, const angle::MemoryBu
     mBlobCache.put(key, std::move(const_cast<angle::MemoryBuffer &>(value)), valueSize);
 }
 
+void CLPlatformVk::putCachedBlob(const angle::BlobCacheKey &key, angle::MemoryBuffer &&value)
+{
+    // The blobs are always kept in memory.
+    putBlob(key, value);
+}
+
 bool CLPlatformVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut)
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
@@ -319,9 +325,10 @@ bool CLPlatformVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue
 }
 
 std::shared_ptr<angle::WaitableEvent> CLPlatformVk::postMultiThreadWorkerTask(
-    const std::shared_ptr<angle::Closure> &task)
+    const std::shared_ptr<angle::Closure> &task,
+    angle::WorkerTaskPriority priority)
 {
-    return mPlatform.getMultiThreadPool()->postWorkerTask(task);
+    return mPlatform.getMultiThreadPool()->postWorkerTask(task, priority);
 }
 
 void CLPlatformVk::notifyDeviceLost()
@@ -55,8 +55,10 @@ class CLPlatformVk : public CLPlatformImpl, public vk::ErrorContext, public vk::
     // vk::GlobalOps
     void putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value) override;
     bool getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut) override;
+    void putCachedBlob(const angle::BlobCacheKey &key, angle::MemoryBuffer &&value) override;
     std::shared_ptr<angle::WaitableEvent> postMultiThreadWorkerTask(
-        const std::shared_ptr<angle::Closure> &task) override;
+        const std::shared_ptr<angle::Closure> &task,
+        angle::WorkerTaskPriority priority) override;
     void notifyDeviceLost() override;
     GlobalOps::Api getFrontendApi() const override { return GlobalOps::Api::OpenCL; }
 
@@ -217,10 +217,11 @@ angle::Result CLProgramVk::build(const cl::DevicePtrs &devices,
 
     if (notify)
     {
-        mAsyncBuildEvent =
-            getPlatform()->postMultiThreadWorkerTask(std::make_shared<CLAsyncBuildTask>(
-                this, devicePtrs, std::string(options ? options : ""), "", buildType,
-                LinkProgramsList{}, notify));
+        mAsyncBuildEvent = getPlatform()->postMultiThreadWorkerTask(
+            std::make_shared<CLAsyncBuildTask>(this, devicePtrs,
+                                               std::string(options ? options : ""), "", buildType,
+                                               LinkProgramsList{}, notify),
+            angle::WorkerTaskPriority::InteractiveLink);
         ASSERT(mAsyncBuildEvent != nullptr);
     }
     else
@@ -148,7 +148,9 @@ void FenceRecycler::recycle(Fence &&fence)
 
 // CommandBatch implementation.
 CommandBatch::CommandBatch()
-    : mProtectionType(ProtectionType::InvalidEnum), mCommandPoolAccess(nullptr)
+    : mProtectionType(ProtectionType::InvalidEnum),
+      mCommandPoolAccess(nullptr),
+      mTransferQueueWaitValue(0)
 {}
 
 CommandBatch::~CommandBatch() = default;
@@ -167,6 +169,7 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(mSecondaryCommands, other.mSecondaryCommands);
     std::swap(mFence, other.mFence);
     std::swap(mExternalFence, other.mExternalFence);
+    std::swap(mTransferQueueWaitValue, other.mTransferQueueWaitValue);
     return *this;
 }
 
@@ -467,13 +470,15 @@ CommandsState::CommandsState(Renderer *renderer,
                              egl::ContextPriority priority)
     : mCmdPoolMutex(renderer->getCommandPoolAccess().mCmdPoolMutex),
       mProtectionType(protectionType),
-      mPriority(priority)
+      mPriority(priority),
+      mTransferQueueWaitValue(0)
 {}
 
 CommandsState::~CommandsState()
 {
     ASSERT(mWaitSemaphores.empty());
     ASSERT(mWaitSemaphoreStageMasks.empty());
+    ASSERT(mTransferQueueWaitValue == 0);
     ASSERT(!mPrimaryCommands.valid());
 }
 
@@ -482,6 +487,7 @@ void CommandsState::destroy(VkDevice device)
     std::lock_guard<angle::SimpleMutex> lock(mCmdPoolMutex);
     mWaitSemaphores.clear();
     mWaitSemaphoreStageMasks.clear();
+    mTransferQueueWaitValue = 0;
     mPrimaryCommands.destroy(device);
     mSecondaryCommands.releaseCommandBuffers();
 }
@@ -491,7 +497,8 @@ angle::Result CommandsState::getCommandsAndWaitSemaphores(
     CommandPoolAccess *commandPoolAccess,
     CommandBatch *batch,
     std::vector<VkSemaphore> *waitSemaphoresOut,
-    std::vector<VkPipelineStageFlags> *waitSemaphoreStageMasksOut)
+    std::vector<VkPipelineStageFlags> *waitSemaphoreStageMasksOut,
+    uint64_t *transferQueueWaitValueOut)
 {
     std::lock_guard<angle::SimpleMutex> lock(mCmdPoolMutex);
 
@@ -510,6 +517,8 @@ angle::Result CommandsState::getCommandsAndWaitSemaphores(
     // Store wait semaphores.
     *waitSemaphoresOut          = std::move(mWaitSemaphores);
     *waitSemaphoreStageMasksOut = std::move(mWaitSemaphoreStageMasks);
+    *transferQueueWaitValueOut  = mTransferQueueWaitValue;
+    mTransferQueueWaitValue     = 0;
 
     return angle::Result::Continue;
 }
@@ -599,6 +608,143 @@ angle::Result CommandPoolAccess::collectPrimaryCommandBuffer(ErrorContext *conte
     return angle::Result::Continue;
 }
 
+// TransferQueue implementation.
+TransferQueue::TransferQueue()
+    : mQueue(VK_NULL_HANDLE), mLastSignaledValue(0), mLastFinishedValue(0)
+{}
+
+TransferQueue::~TransferQueue() = default;
+
+angle::Result TransferQueue::init(ErrorContext *context,
+                                  uint32_t queueFamilyIndex,
+                                  uint32_t queueIndex,
+                                  bool makeProtected)
+{
+    ASSERT(!valid());
+    ANGLE_VK_TRY(context, mSemaphore.init(context->getDevice(), VK_SEMAPHORE_TYPE_TIMELINE));
+
+    GetDeviceQueue(context->getDevice(), makeProtected, queueFamilyIndex, queueIndex, &mQueue);
+    mDeviceQueueIndex  = DeviceQueueIndex(queueFamilyIndex, queueIndex);
+    mLastSignaledValue = 0;
+    mLastFinishedValue = 0;
+
+    return angle::Result::Continue;
+}
+
+void TransferQueue::destroy(VkDevice device)
+{
+    waitIdle();
+
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    for (PendingCommands &pending : mPendingCommands)
+    {
+        pending.commandBuffer.releaseHandle();
+    }
+    mPendingCommands.clear();
+    mCommandPool.destroy(device);
+    mSemaphore.destroy(device);
+    mQueue            = VK_NULL_HANDLE;
+    mDeviceQueueIndex = kInvalidDeviceQueueIndex;
+}
+
+angle::Result TransferQueue::getCommandBuffer(ErrorContext *context,
+                                              ScopedPrimaryCommandBuffer *commandBufferOut)
+{
+    ASSERT(valid());
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    if (!mPendingCommands.empty() &&
+        mPendingCommands.front().signalValue <= mLastFinishedValue.load(std::memory_order_acquire))
+    {
+        commandBufferOut->assign(std::move(lock),
+                                 std::move(mPendingCommands.front().commandBuffer));
+        mPendingCommands.pop_front();
+    }
+    else
+    {
+        if (!mCommandPool.valid())
+        {
+            VkCommandPoolCreateInfo createInfo = {};
+            createInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            createInfo.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT |
+                                                 VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            createInfo.queueFamilyIndex        = mDeviceQueueIndex.familyIndex();
+            ANGLE_VK_TRY(context, mCommandPool.init(context->getDevice(), createInfo));
+        }
+
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount          = 1;
+        allocInfo.commandPool                 = mCommandPool.getHandle();
+
+        PrimaryCommandBuffer newCommandBuffer;
+        ANGLE_VK_TRY(context, newCommandBuffer.init(context->getDevice(), allocInfo));
+        commandBufferOut->assign(std::move(lock), std::move(newCommandBuffer));
+    }
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    beginInfo.pInheritanceInfo         = nullptr;
+    ANGLE_VK_TRY(context, commandBufferOut->get().begin(beginInfo));
+
+    return angle::Result::Continue;
+}
+
+void TransferQueue::releaseCommandBuffer(uint64_t signalValue, PrimaryCommandBuffer &&commandBuffer)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    mPendingCommands.push_back({signalValue, std::move(commandBuffer)});
+}
+
+angle::Result TransferQueue::submitLocked(ErrorContext *context,
+                                          const PrimaryCommandBuffer &commandBuffer,
+                                          uint64_t *signalValueOut)
+{
+    ASSERT(valid());
+    const uint64_t signalValue  = mLastSignaledValue + 1;
+    const VkSemaphore semaphore = mSemaphore.getHandle();
+
+    VkTimelineSemaphoreSubmitInfo timelineSubmitInfo = {};
+    timelineSubmitInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineSubmitInfo.signalSemaphoreValueCount = 1;
+    timelineSubmitInfo.pSignalSemaphoreValues    = &signalValue;
+
+    VkSubmitInfo submitInfo         = {};
+    submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext                = &timelineSubmitInfo;
+    submitInfo.commandBufferCount   = 1;
+    submitInfo.pCommandBuffers      = commandBuffer.ptr();
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores    = &semaphore;
+
+    ANGLE_VK_TRY(context, VK_CALL(vkQueueSubmit, mQueue, 1, &submitInfo, VK_NULL_HANDLE));
+
+    mLastSignaledValue = signalValue;
+    *signalValueOut    = signalValue;
+    return angle::Result::Continue;
+}
+
+void TransferQueue::onWaitValueFinished(uint64_t value)
+{
+    // Timeline semaphore signal operations happen in submission order, so all submissions up to
+    // |value| are finished.
+    if (value > mLastFinishedValue.load(std::memory_order_relaxed))
+    {
+        mLastFinishedValue.store(value, std::memory_order_release);
+    }
+}
+
+void TransferQueue::waitIdle()
+{
+    if (mQueue != VK_NULL_HANDLE)
+    {
+        VK_CALL(vkQueueWaitIdle, mQueue);
+        mLastFinishedValue.store(mLastSignaledValue, std::memory_order_release);
+    }
+}
+
 // CommandQueue public API implementation. These must be thread safe and never called from
 // CommandQueue class itself.
 CommandQueue::CommandQueue()
@@ -617,6 +763,7 @@ void CommandQueue::destroy(ErrorContext *context)
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
 
     mQueueMap.destroy();
+    mTransferQueue.destroy(context->getDevice());
 
     // Assigns an infinite "last completed" serial to force garbage to delete.
     mLastCompletedSerials.fill(Serial::Infinite());
@@ -667,6 +814,7 @@ void CommandQueue::handleDeviceLost(Renderer *renderer)
 
     // Work around a driver bug where resource clean up would cause a crash without vkQueueWaitIdle.
     mQueueMap.waitAllQueuesIdle();
+    mTransferQueue.waitIdle();
 
     while (!mInFlightCommands.empty())
     {
@@ -684,6 +832,32 @@ void CommandQueue::handleDeviceLost(Renderer *renderer)
     }
 }
 
+angle::Result CommandQueue::initTransferQueue(ErrorContext *context,
+                                              uint32_t queueFamilyIndex,
+                                              uint32_t queueIndex,
+                                              bool makeProtected)
+{
+    std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
+    return mTransferQueue.init(context, queueFamilyIndex, queueIndex, makeProtected);
+}
+
+angle::Result CommandQueue::submitTransferCommands(ErrorContext *context,
+                                                   ScopedPrimaryCommandBuffer &&commandBuffer,
+                                                   uint64_t *signalValueOut)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitTransferCommands");
+    DeviceScoped<PrimaryCommandBuffer> primary = commandBuffer.unlockAndRelease();
+
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+        ANGLE_TRY(mTransferQueue.submitLocked(context, primary.get(), signalValueOut));
+        mPerfCounters.vkQueueSubmitCallsTotal.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    mTransferQueue.releaseCommandBuffer(*signalValueOut, primary.release());
+    return angle::Result::Continue;
+}
+
 angle::Result CommandQueue::postSubmitCheck(ErrorContext *context)
 {
     Renderer *renderer = context->getRenderer();
@@ -858,9 +1032,24 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
 
     std::vector<VkSemaphore> waitSemaphores;
     std::vector<VkPipelineStageFlags> waitSemaphoreStageMasks;
+    uint64_t transferQueueWaitValue = 0;
+
+    ANGLE_TRY(commandsState.getCommandsAndWaitSemaphores(context, &mCommandPoolAccess, &batch,
+                                                         &waitSemaphores, &waitSemaphoreStageMasks,
+                                                         &transferQueueWaitValue));
 
-    ANGLE_TRY(commandsState.getCommandsAndWaitSemaphores(
-        context, &mCommandPoolAccess, &batch, &waitSemaphores, &waitSemaphoreStageMasks));
+    // Wait for the uploads made on the transfer queue.  The values of the other (binary)
+    // semaphores are ignored.
+    std::vector<uint64_t> waitSemaphoreValues;
+    if (transferQueueWaitValue != 0)
+    {
+        ASSERT(mTransferQueue.valid());
+        waitSemaphores.push_back(mTransferQueue.getSemaphore());
+        waitSemaphoreStageMasks.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+        waitSemaphoreValues.resize(waitSemaphores.size(), 0);
+        waitSemaphoreValues.back() = transferQueueWaitValue;
+        batch.setTransferQueueWaitValue(transferQueueWaitValue);
+    }
     mPerfCounters.queueWaitSemaphoresTotal.fetch_add(waitSemaphores.size(),
                                                      std::memory_order_relaxed);
 
@@ -868,14 +1057,24 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
     const bool needsQueueSubmit = batch.getPrimaryCommands().valid() ||
                                   signalSemaphore != VK_NULL_HANDLE || externalFence ||
                                   !waitSemaphores.empty();
-    VkSubmitInfo submitInfo                   = {};
-    VkProtectedSubmitInfo protectedSubmitInfo = {};
+    VkSubmitInfo submitInfo                                   = {};
+    VkProtectedSubmitInfo protectedSubmitInfo                 = {};
+    VkTimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo = {};
 
     if (needsQueueSubmit)
     {
         InitializeSubmitInfo(&submitInfo, batch.getPrimaryCommands(), waitSemaphores,
                              waitSemaphoreStageMasks, signalSemaphore);
 
+        if (!waitSemaphoreValues.empty())
+        {
+            timelineSemaphoreSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineSemaphoreSubmitInfo.waitSemaphoreValueCount =
+                static_cast<uint32_t>(waitSemaphoreValues.size());
+            timelineSemaphoreSubmitInfo.pWaitSemaphoreValues = waitSemaphoreValues.data();
+            AddToPNextChain(&submitInfo, &timelineSemaphoreSubmitInfo);
+        }
+
         // No need protected submission if no commands to submit.
         if (commandsState.getProtectionType() == ProtectionType::Protected &&
             batch.getPrimaryCommands().valid())
@@ -883,7 +1082,7 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
             protectedSubmitInfo.sType           = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
             protectedSubmitInfo.pNext           = nullptr;
             protectedSubmitInfo.protectedSubmit = true;
-            submitInfo.pNext                    = &protectedSubmitInfo;
+            AddToPNextChain(&submitInfo, &protectedSubmitInfo);
         }
 
         // Initializing a fence is not required if the batch already has an external fence and does
@@ -1149,6 +1348,10 @@ void CommandQueue::onCommandBatchFinishedLocked(CommandBatch &&batch)
 {
     // Finished.
     mLastCompletedSerials.setQueueSerial(batch.getQueueSerial());
+    if (batch.getTransferQueueWaitValue() != 0)
+    {
+        mTransferQueue.onWaitValueFinished(batch.getTransferQueueWaitValue());
+    }
 
     // Move command batch to mFinishedCommandBatches.
     moveInFlightBatchToFinishedQueueLocked(std::move(batch));
@@ -1349,5 +1552,39 @@ uint32_t QueueFamily::FindIndex(const std::vector<VkQueueFamilyProperties2> &que
     return static_cast<uint32_t>(std::distance(queueFamilyProperties2.begin(), it));
 }
 
+uint32_t QueueFamily::FindTransferIndex(
+    const std::vector<VkQueueFamilyProperties2> &queueFamilyProperties2,
+    uint32_t graphicsQueueFamilyIndex)
+{
+    uint32_t computeQueueFamilyIndex = kInvalidIndex;
+    for (uint32_t index = 0; index < queueFamilyProperties2.size(); ++index)
+    {
+        const VkQueueFamilyProperties &properties =
+            queueFamilyProperties2[index].queueFamilyProperties;
+        const VkExtent3D &granularity = properties.minImageTransferGranularity;
+        if (index == graphicsQueueFamilyIndex || properties.queueCount == 0 ||
+            (properties.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0 || granularity.width != 1 ||
+            granularity.height != 1 || granularity.depth != 1)
+        {
+            continue;
+        }
+
+        // Compute queues implicitly support transfer.
+        if ((properties.queueFlags & VK_QUEUE_COMPUTE_BIT) != 0)
+        {
+            if (computeQueueFamilyIndex == kInvalidIndex)
+            {
+                computeQueueFamilyIndex = index;
+            }
+        }
+        else if ((properties.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0)
+        {
+            return index;
+        }
+    }
+
+    return computeQueueFamilyIndex;
+}
+
 }  // namespace vk
 }  // namespace rx
@@ -10,8 +10,10 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_COMMAND_Queue_H_
 #define LIBANGLE_RENDERER_VULKAN_COMMAND_Queue_H_
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -124,10 +126,12 @@ class CommandBatch final : angle::NonCopyable
     void setSecondaryCommands(SecondaryCommandBufferCollector &&secondaryCommands);
     VkResult initFence(VkDevice device, FenceRecycler *recycler);
     void setExternalFence(SharedExternalFence &&externalFence);
+    void setTransferQueueWaitValue(uint64_t value) { mTransferQueueWaitValue = value; }
 
     const QueueSerial &getQueueSerial() const;
     const PrimaryCommandBuffer &getPrimaryCommands() const;
     const SharedExternalFence &getExternalFence();
+    uint64_t getTransferQueueWaitValue() const { return mTransferQueueWaitValue; }
 
     // Accessing the shared fence is prioritized before the shared external fence, since the shared
     // fence may be used in an extra empty submission after the external fence (via a feature flag).
@@ -148,6 +152,8 @@ class CommandBatch final : angle::NonCopyable
     SecondaryCommandBufferCollector mSecondaryCommands;
     SharedFence mFence;
     SharedExternalFence mExternalFence;
+    // The value of the transfer queue's timeline semaphore this batch waits on, or 0.
+    uint64_t mTransferQueueWaitValue;
 };
 using CommandBatchQueue = angle::FixedQueue<CommandBatch>;
 
@@ -163,6 +169,12 @@ class QueueFamily final : angle::NonCopyable
                               VkQueueFlags optionalFlags,
                               VkQueueFlags excludeFlags,
                               uint32_t *matchCount);
+    // Find a queue family other than |graphicsQueueFamilyIndex| suitable for uploads, preferring
+    // transfer-only families.  Families that can't copy to any region of an image are not
+    // considered.
+    static uint32_t FindTransferIndex(
+        const std::vector<VkQueueFamilyProperties2> &queueFamilyProperties2,
+        uint32_t graphicsQueueFamilyIndex);
 
     static constexpr float kQueuePriorityLow      = 0.0f;
     static constexpr float kQueuePriorityMedium   = 0.4f;
@@ -299,7 +311,8 @@ class CommandsState : angle::NonCopyable
         CommandPoolAccess *commandPoolAccess,
         CommandBatch *batch,
         std::vector<VkSemaphore> *waitSemaphoresOut,
-        std::vector<VkPipelineStageFlags> *waitSemaphoreStageMasksOut);
+        std::vector<VkPipelineStageFlags> *waitSemaphoreStageMasksOut,
+        uint64_t *transferQueueWaitValueOut);
 
     void addWaitSemaphore(VkSemaphore waitSemaphores, VkPipelineStageFlags waitSemaphoreStageMasks)
     {
@@ -307,7 +320,17 @@ class CommandsState : angle::NonCopyable
         mWaitSemaphoreStageMasks.emplace_back(waitSemaphoreStageMasks);
     }
 
-    bool hasWaitSemaphoresPendingSubmission() const { return !mWaitSemaphores.empty(); }
+    // Make the next submission wait for the transfer queue submission that signaled |value|.
+    void addTransferQueueWait(uint64_t value)
+    {
+        mTransferQueueWaitValue = std::max(mTransferQueueWaitValue, value);
+    }
+    uint64_t getTransferQueueWaitValue() const { return mTransferQueueWaitValue; }
+
+    bool hasWaitSemaphoresPendingSubmission() const
+    {
+        return !mWaitSemaphores.empty() || mTransferQueueWaitValue != 0;
+    }
 
     void setPriority(egl::ContextPriority newPriority) { mPriority = newPriority; }
     egl::ContextPriority getPriority() const { return mPriority; }
@@ -326,6 +349,7 @@ class CommandsState : angle::NonCopyable
 
     std::vector<VkSemaphore> mWaitSemaphores;
     std::vector<VkPipelineStageFlags> mWaitSemaphoreStageMasks;
+    uint64_t mTransferQueueWaitValue;
     PrimaryCommandBuffer mPrimaryCommands;
     SecondaryCommandBufferCollector mSecondaryCommands;
 };
@@ -368,6 +392,64 @@ class CommandPoolAccess : angle::NonCopyable
     PrimaryCommandPoolMap mPrimaryCommandPoolMap;
 };
 
+class ScopedPrimaryCommandBuffer;
+
+// A queue that image uploads are submitted to, so that they can overlap with rendering.  It is
+// preferably a queue of a transfer-only or compute-only queue family, otherwise one of the
+// graphics queues.  Each submission signals the next value of a timeline semaphore, which the
+// graphics submission using the upload results waits on.  The transfer queue's command buffers are
+// recycled once a graphics submission that waited on a later value is finished.
+//
+// Submissions are made by CommandQueue, under the same lock as the graphics queues' in case the
+// VkQueue is shared with one of them.
+class TransferQueue final : angle::NonCopyable
+{
+  public:
+    TransferQueue();
+    ~TransferQueue();
+
+    angle::Result init(ErrorContext *context,
+                       uint32_t queueFamilyIndex,
+                       uint32_t queueIndex,
+                       bool makeProtected);
+    void destroy(VkDevice device);
+
+    bool valid() const { return mQueue != VK_NULL_HANDLE; }
+    DeviceQueueIndex getDeviceQueueIndex() const { return mDeviceQueueIndex; }
+    VkSemaphore getSemaphore() const { return mSemaphore.getHandle(); }
+
+    angle::Result getCommandBuffer(ErrorContext *context,
+                                   ScopedPrimaryCommandBuffer *commandBufferOut);
+    void releaseCommandBuffer(uint64_t signalValue, PrimaryCommandBuffer &&commandBuffer);
+
+    // Called with the queue submit lock held.  Returns the value signaled by the submission.
+    angle::Result submitLocked(ErrorContext *context,
+                               const PrimaryCommandBuffer &commandBuffer,
+                               uint64_t *signalValueOut);
+
+    // Called when a graphics submission that waited on |value| has finished.
+    void onWaitValueFinished(uint64_t value);
+    // Called on device loss and destruction.
+    void waitIdle();
+
+  private:
+    VkQueue mQueue;
+    DeviceQueueIndex mDeviceQueueIndex;
+    Semaphore mSemaphore;
+    uint64_t mLastSignaledValue;
+    std::atomic<uint64_t> mLastFinishedValue;
+
+    // Protects the command pool and the list of pending command buffers.
+    angle::SimpleMutex mMutex;
+    CommandPool mCommandPool;
+    struct PendingCommands
+    {
+        uint64_t signalValue;
+        PrimaryCommandBuffer commandBuffer;
+    };
+    std::deque<PendingCommands> mPendingCommands;
+};
+
 // Note all public APIs of CommandQueue class must be thread safe.
 class CommandQueue : angle::NonCopyable
 {
@@ -384,6 +466,27 @@ class CommandQueue : angle::NonCopyable
 
     void handleDeviceLost(Renderer *renderer);
 
+    // Set up the queue used for uploads with the asyncTransferQueueUploads feature.
+    angle::Result initTransferQueue(ErrorContext *context,
+                                    uint32_t queueFamilyIndex,
+                                    uint32_t queueIndex,
+                                    bool makeProtected);
+    bool hasTransferQueue() const { return mTransferQueue.valid(); }
+    DeviceQueueIndex getTransferDeviceQueueIndex() const
+    {
+        return mTransferQueue.getDeviceQueueIndex();
+    }
+    angle::Result getTransferCommandBuffer(ErrorContext *context,
+                                           ScopedPrimaryCommandBuffer *commandBufferOut)
+    {
+        return mTransferQueue.getCommandBuffer(context, commandBufferOut);
+    }
+    // Submit the commands on the transfer queue, and return the value of the timeline semaphore
+    // to pass to CommandsState::addTransferQueueWait.
+    angle::Result submitTransferCommands(ErrorContext *context,
+                                         ScopedPrimaryCommandBuffer &&commandBuffer,
+                                         uint64_t *signalValueOut);
+
     // These public APIs are inherently thread safe. Thread unsafe methods must be protected methods
     // that are only accessed via ThreadSafeCommandQueue API.
     egl::ContextPriority getDriverPriority(egl::ContextPriority priority) const
@@ -559,6 +662,8 @@ class CommandQueue : angle::NonCopyable
     // QueueMap
     DeviceQueueMap mQueueMap;
 
+    TransferQueue mTransferQueue;
+
     CommandQueuePerfCounters mPerfCounters;
 };
 
@@ -133,6 +133,10 @@ constexpr VkBufferUsageFlags kVertexBufferUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_
 constexpr size_t kDynamicVertexDataSizeLarge    = 128 * 1024;
 constexpr size_t kDynamicVertexDataSizeSmall    = 16 * 1024;
 
+// Initial size of the ring the descriptors of the bound program are copied into with
+// VK_EXT_descriptor_buffer.  Each copy of the sets takes at most a few KB.
+constexpr size_t kDescriptorBufferStorageInitialSize = 256 * 1024;
+
 bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
                                 VertexArrayVk *vertexArray,
                                 gl::PrimitiveMode mode,
@@ -1276,6 +1280,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     mShareGroupVk->cleanupRefCountedEventGarbage();
 
     mDefaultUniformStorage.release(this);
+    mDescriptorBufferStorage.release(this);
     mEmptyBuffer.release(this);
 
     for (auto &entry : mNullStorageImages)
@@ -1285,7 +1290,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     }
     mNullStorageImages.clear();
 
-    for (vk::DynamicBuffer &defaultBuffer : mStreamedVertexBuffers)
+    for (vk::FrameRingBuffer &defaultBuffer : mStreamedVertexBuffers)
     {
         defaultBuffer.destroy(mRenderer);
     }
@@ -1453,16 +1458,19 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
     mGraphicsPipelineDesc.reset(new vk::GraphicsPipelineDesc());
     mGraphicsPipelineDesc->initDefaults(this, vk::GraphicsPipelineSubset::Complete,
                                         pipelineRobustness(), pipelineProtectedAccess());
+    if (getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        mGraphicsPipelineDesc->setUsesDescriptorBuffer(vk::GraphicsPipelineSubset::Complete);
+    }
 
     // Initialize current value/default attribute buffers.
     const size_t vertexBufferInitSize =
         (getFeatures().useLargeSizeForDynamicBuffers.enabled && mState.isGLES1())
             ? kDynamicVertexDataSizeLarge
             : kDynamicVertexDataSizeSmall;
-    for (vk::DynamicBuffer &buffer : mStreamedVertexBuffers)
+    for (vk::FrameRingBuffer &buffer : mStreamedVertexBuffers)
     {
-        buffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment, vertexBufferInitSize,
-                    true);
+        buffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment, vertexBufferInitSize);
     }
 
     // Assign initial command buffers from queue
@@ -1484,21 +1492,32 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
     mLastFlushedQueueSerial   = QueueSerial(mCurrentQueueSerialIndex, Serial());
     mLastSubmittedQueueSerial = mLastFlushedQueueSerial;
 
+    // Descriptors written into descriptor buffers reference buffers by device address.
+    const VkBufferUsageFlags deviceAddressUsage =
+        getFeatures().supportsDescriptorBuffer.enabled ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT
+                                                       : 0;
+
     size_t minAlignment = static_cast<size_t>(
         mRenderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
-    mDefaultUniformStorage.init(mRenderer, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, minAlignment,
-                                mRenderer->getDefaultUniformBufferSize(), true);
+    mDefaultUniformStorage.init(mRenderer, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | deviceAddressUsage,
+                                minAlignment, mRenderer->getDefaultUniformBufferSize());
+
+    if (getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // The descriptor sets of the bound program are copied into this ring when they change.
+        mDescriptorBufferStorage.init(mRenderer, kDescriptorBufferStorageInitialSize);
+    }
 
     // Initialize an "empty" buffer for use with default uniform blocks where there are no uniforms,
     // or atomic counter buffer array indices that are unused.
-    constexpr VkBufferUsageFlags kEmptyBufferUsage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
-                                                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-                                                     VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    const VkBufferUsageFlags emptyBufferUsage =
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | deviceAddressUsage;
     VkBufferCreateInfo emptyBufferInfo          = {};
     emptyBufferInfo.sType                       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     emptyBufferInfo.flags                       = 0;
     emptyBufferInfo.size                        = 16;
-    emptyBufferInfo.usage                       = kEmptyBufferUsage;
+    emptyBufferInfo.usage                       = emptyBufferUsage;
     emptyBufferInfo.sharingMode                 = VK_SHARING_MODE_EXCLUSIVE;
     emptyBufferInfo.queueFamilyIndexCount       = 0;
     emptyBufferInfo.pQueueFamilyIndices         = nullptr;
@@ -1636,6 +1655,13 @@ angle::Result ContextVk::finish(const gl::Context *context)
 
 angle::Result ContextVk::onFrameBoundary(const gl::Context *contextGL)
 {
+    // Move the per-frame ring buffers on to the buffers of the next frame.
+    mDefaultUniformStorage.onFrameBoundary();
+    for (vk::FrameRingBuffer &buffer : mStreamedVertexBuffers)
+    {
+        buffer.onFrameBoundary();
+    }
+
     mShareGroupVk->onFrameBoundary();
     return mRenderer->onFrameBoundary(contextGL);
 }
@@ -2505,15 +2531,16 @@ angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirt
     gl::Rectangle renderArea = drawFramebufferVk->getRenderArea(this);
     // Check to see if we can reactivate the current renderPass, if all arguments that we use to
     // start the render pass is the same. We don't need to check clear values since mid render pass
-    // clear are handled differently.
+    // clear are handled differently.  This merges render passes of the same framebuffer when the
+    // application switches away from it and back without anything in between requiring the render
+    // pass to close.
     // If a clear was staged in the framebuffer attachment by using another framebuffer (or
-    // glClearTexImage), the render pass is restarted so the clear is applied.  If needed, this can
-    // be optimized in the future by restoring the render pass and applying the clear as a mid
-    // render pass clear instead.
+    // glClearTexImage), it is applied as a mid render pass clear in the reactivated render pass.
     bool reactivateStartedRenderPass =
         hasStartedRenderPassWithQueueSerial(drawFramebufferVk->getLastRenderPassQueueSerial()) &&
         mAllowRenderPassToReactivate && renderArea == mRenderPassCommands->getRenderArea() &&
-        !drawFramebufferVk->hasDeferredClears();
+        (!drawFramebufferVk->hasDeferredClears() ||
+         drawFramebufferVk->canApplyDeferredClearsInRenderPass(this));
     if (reactivateStartedRenderPass)
     {
         INFO() << "Reactivate already started render pass on draw.";
@@ -2533,6 +2560,14 @@ angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirt
 
         ANGLE_TRY(resumeRenderPassQueriesIfActive());
 
+        // Only reactivations that would have otherwise started a new render pass to apply the
+        // deferred clears are counted.
+        if (drawFramebufferVk->hasDeferredClears())
+        {
+            ANGLE_TRY(drawFramebufferVk->applyDeferredClearsInRenderPass(this));
+            mPerfCounters.renderPassesMerged++;
+        }
+
         return angle::Result::Continue;
     }
 
@@ -3671,7 +3706,8 @@ angle::Result ContextVk::handleDirtyDescriptorSetsImpl(CommandBufferHelperT *com
 
     ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
     return executableVk->bindDescriptorSets(this, getCurrentFrameCount(), commandBufferHelper,
-                                            &commandBufferHelper->getCommandBuffer(), pipelineType);
+                                            &commandBufferHelper->getCommandBuffer(), pipelineType,
+                                            &mDescriptorBufferStorage);
 }
 
 void ContextVk::syncObjectPerfCounters(const vk::CommandQueuePerfCounters &commandQueuePerfCounters)
@@ -6624,7 +6660,16 @@ void ContextVk::invalidateGraphicsDescriptorSet(DescriptorSetIndex usedDescripto
     ASSERT(usedDescriptorSet == DescriptorSetIndex::Internal);
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
 
-    if (executable && executable->hasUniformBuffers())
+    // With descriptor buffers, binding the internal descriptor set unbinds the program's
+    // descriptor buffer as well.
+    if (getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        mRenderPassCommands->invalidateDescriptorBufferBindings();
+        mOutsideRenderPassCommands->invalidateDescriptorBufferBindings();
+    }
+
+    if (executable && (executable->hasUniformBuffers() ||
+                       getFeatures().supportsDescriptorBuffer.enabled))
     {
         mGraphicsDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
         return;
@@ -6637,7 +6682,16 @@ void ContextVk::invalidateComputeDescriptorSet(DescriptorSetIndex usedDescriptor
     ASSERT(usedDescriptorSet == DescriptorSetIndex::Internal);
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
 
-    if (executable && executable->hasUniformBuffers())
+    // With descriptor buffers, binding the internal descriptor set unbinds the program's
+    // descriptor buffer as well.
+    if (getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        mRenderPassCommands->invalidateDescriptorBufferBindings();
+        mOutsideRenderPassCommands->invalidateDescriptorBufferBindings();
+    }
+
+    if (executable && (executable->hasUniformBuffers() ||
+                       getFeatures().supportsDescriptorBuffer.enabled))
     {
         mComputeDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
         return;
@@ -7636,20 +7690,27 @@ angle::Result ContextVk::flushAndSubmitCommandsImpl(const vk::Semaphore *signalS
     }
 
     // We must add the per context dynamic buffers into resourceUseList before submission so that
-    // they get retained properly until GPU completes. We do not add current buffer into
-    // resourceUseList since they never get reused or freed until context gets destroyed, at which
-    // time we always wait for GPU to finish before destroying the dynamic buffers.
-    mDefaultUniformStorage.updateQueueSerialAndReleaseInFlightBuffers(this,
-                                                                      mLastFlushedQueueSerial);
+    // they get retained properly until GPU completes. We do not add the current buffer of dynamic
+    // buffers into resourceUseList since they never get reused or freed until context gets
+    // destroyed, at which time we always wait for GPU to finish before destroying the dynamic
+    // buffers.  The ring buffers are reused on later frames, so all their buffers written to since
+    // the last submission are marked as in use by it.
+    mDefaultUniformStorage.updateQueueSerialAndRetireReplacedBuffers(this,
+                                                                     mLastFlushedQueueSerial);
+    if (mDescriptorBufferStorage.valid())
+    {
+        mDescriptorBufferStorage.updateQueueSerialAndReleaseInFlightBuffers(
+            this, mLastFlushedQueueSerial);
+    }
 
-    if (mHasInFlightStreamedVertexBuffers.any())
+    if (mStreamedVertexBuffersPendingSubmission.any())
     {
-        for (size_t attribIndex : mHasInFlightStreamedVertexBuffers)
+        for (size_t attribIndex : mStreamedVertexBuffersPendingSubmission)
         {
-            mStreamedVertexBuffers[attribIndex].updateQueueSerialAndReleaseInFlightBuffers(
+            mStreamedVertexBuffers[attribIndex].updateQueueSerialAndRetireReplacedBuffers(
                 this, mLastFlushedQueueSerial);
         }
-        mHasInFlightStreamedVertexBuffers.reset();
+        mStreamedVertexBuffersPendingSubmission.reset();
     }
 
     prepareToSubmitAllCommands();
@@ -8008,6 +8069,12 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     mCommandsPendingSubmissionCount +=
         mRenderPassCommands->getCommandBuffer().getRenderPassWriteCommandCount();
 
+    size_t commandBlockCount = 0;
+    size_t commandBlockBytes = 0;
+    mRenderPassCommands->getCommandBlockStats(&commandBlockCount, &commandBlockBytes);
+    mPerfCounters.commandBufferBlockAllocations += commandBlockCount;
+    mPerfCounters.commandBufferBlockBytes += commandBlockBytes;
+
     ANGLE_TRY(mCommandState.flushRenderPassCommands(this, *renderPass, framebufferOverride,
                                                     &mRenderPassCommands));
 
@@ -8300,6 +8367,13 @@ angle::Result ContextVk::flushOutsideRenderPassCommands()
     {
         mIsAnyHostVisibleBufferWritten = true;
     }
+
+    size_t commandBlockCount = 0;
+    size_t commandBlockBytes = 0;
+    mOutsideRenderPassCommands->getCommandBlockStats(&commandBlockCount, &commandBlockBytes);
+    mPerfCounters.commandBufferBlockAllocations += commandBlockCount;
+    mPerfCounters.commandBufferBlockBytes += commandBlockBytes;
+
     ANGLE_TRY(mCommandState.flushOutsideRPCommands(this, &mOutsideRenderPassCommands));
 
     // Make sure appropriate dirty bits are set, in case another thread makes a submission before
@@ -8899,7 +8973,8 @@ const angle::PerfMonitorCounterGroupsInfo &ContextVk::getPerfMonitorCountersInfo
     return mPerfMonitorCountersInfo;
 }
 
-const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters()
+const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters(
+    const gl::Context *context)
 {
     if (!mState.isPerfMonitorActive())
     {
@@ -8908,6 +8983,17 @@ const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters()
     }
     syncObjectPerfCounters(mRenderer->getCommandQueuePerfCounters());
 
+    // The shader cache is shared by all contexts of the display.
+    const gl::MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    if (shaderCache != nullptr)
+    {
+        const gl::MemoryShaderCache::Statistics statistics = shaderCache->getStatistics();
+        mPerfCounters.shaderCacheHits                      = statistics.hits;
+        mPerfCounters.shaderCacheMisses                    = statistics.misses;
+        mPerfCounters.shaderCacheNormalizedSourceHits      = statistics.normalizedSourceHits;
+        mPerfCounters.shaderCacheSavedCompileDurationUs    = statistics.savedCompileMicroseconds;
+    }
+
     ASSERT(mPerfMonitorCountersInfo.size() == 1);
     ASSERT(mPerfMonitorCounters.size() == 1);
 
@@ -9093,6 +9179,10 @@ void ContextVk::resetPerFramePerfCounters()
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
     mPerfCounters.descriptorSetAllocations               = 0;
+    mPerfCounters.descriptorBufferSetCopies              = 0;
+    mPerfCounters.commandBufferBlockAllocations          = 0;
+    mPerfCounters.commandBufferBlockBytes                = 0;
+    mPerfCounters.frameRingBufferAllocations             = 0;
 
     mShareGroupVk->getMetaDescriptorPools()[DescriptorSetIndex::UniformsAndXfb]
         .resetDescriptorCacheStats();
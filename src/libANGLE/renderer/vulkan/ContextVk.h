@@ -507,6 +507,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     {
         mCommandState.addWaitSemaphore(semaphore, stageMask);
     }
+    void addTransferQueueWait(uint64_t value) { mCommandState.addTransferQueueWait(value); }
 
     template <typename T>
     void addGarbage(T *object)
@@ -808,13 +809,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                size_t bytesToAllocate,
                                                vk::BufferHelper **vertexBufferOut)
     {
-        bool newBufferOut;
         ANGLE_TRY(mStreamedVertexBuffers[attribIndex].allocate(this, bytesToAllocate,
-                                                               vertexBufferOut, &newBufferOut));
-        if (newBufferOut)
-        {
-            mHasInFlightStreamedVertexBuffers.set(attribIndex);
-        }
+                                                               vertexBufferOut, nullptr));
+        mStreamedVertexBuffersPendingSubmission.set(attribIndex);
         return angle::Result::Continue;
     }
 
@@ -829,7 +826,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     }
 
     const angle::PerfMonitorCounterGroupsInfo &getPerfMonitorCountersInfo() const override;
-    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters(
+        const gl::Context *context) override;
 
     void resetPerFramePerfCounters();
 
@@ -1588,11 +1586,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // "Current Value" aka default vertex attribute state.
     gl::AttributesMask mDirtyDefaultAttribsMask;
 
-    // DynamicBuffers for streaming vertex data from client memory pointer as well as for default
-    // attributes. mHasInFlightStreamedVertexBuffers indicates if the dynamic buffer has any
-    // in-flight buffer or not that we need to release at submission time.
-    gl::AttribArray<vk::DynamicBuffer> mStreamedVertexBuffers;
-    gl::AttributesMask mHasInFlightStreamedVertexBuffers;
+    // Ring buffers for streaming vertex data from client memory pointer as well as for default
+    // attributes. mStreamedVertexBuffersPendingSubmission indicates which ring buffers have been
+    // written to since the last submission, and need to be marked as in use by it.
+    gl::AttribArray<vk::FrameRingBuffer> mStreamedVertexBuffers;
+    gl::AttributesMask mStreamedVertexBuffersPendingSubmission;
 
     vk::ImageHelper *mImageWithTileMemory;
 
@@ -1711,7 +1709,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::HashMap<GLenum, std::unique_ptr<NullStorageImageEntry>> mNullStorageImages;
 
     // Storage for default uniforms of ProgramVks and ProgramPipelineVks.
-    vk::DynamicBuffer mDefaultUniformStorage;
+    vk::FrameRingBuffer mDefaultUniformStorage;
+    // With VK_EXT_descriptor_buffer, ring the descriptors of ProgramVks and ProgramPipelineVks are
+    // copied into when bound.
+    vk::DescriptorBufferRing mDescriptorBufferStorage;
 
     std::vector<std::string> mCommandBufferDiagnostics;
 
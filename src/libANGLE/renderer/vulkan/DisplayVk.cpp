@@ -676,10 +676,16 @@ bool DisplayVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *v
     return getBlobCache()->get(nullptr, &mScratchBuffer, key, valueOut);
 }
 
+void DisplayVk::putCachedBlob(const angle::BlobCacheKey &key, angle::MemoryBuffer &&value)
+{
+    getBlobCache()->put(nullptr, key, std::move(value));
+}
+
 std::shared_ptr<angle::WaitableEvent> DisplayVk::postMultiThreadWorkerTask(
-    const std::shared_ptr<angle::Closure> &task)
+    const std::shared_ptr<angle::Closure> &task,
+    angle::WorkerTaskPriority priority)
 {
-    return mState.multiThreadPool->postWorkerTask(task);
+    return mState.multiThreadPool->postWorkerTask(task, priority);
 }
 
 void DisplayVk::notifyDeviceLost()
@@ -3531,6 +3531,44 @@ void FramebufferVk::restageDeferredClearsAfterNoopDraw(ContextVk *contextVk)
     restageDeferredClearsImpl(contextVk);
 }
 
+bool FramebufferVk::canApplyDeferredClearsInRenderPass(ContextVk *contextVk) const
+{
+    // Clears that must be done with a draw call, or that cannot be deferred in the first place,
+    // are left to a new render pass.  See clearImpl().
+    const angle::FeaturesVk &features = contextVk->getFeatures();
+    if (features.preferDrawClearOverVkCmdClearAttachments.enabled ||
+        features.supportsTileMemoryHeap.enabled || features.simulateTileMemoryForTesting.enabled)
+    {
+        return false;
+    }
+
+    return !hasAnyExternalAttachments() &&
+           !IsAnyAttachment3DWithoutAllLayers(mRenderTargetCache, mState.getColorAttachmentsMask(),
+                                              mCurrentFramebufferDesc.getLayerCount());
+}
+
+angle::Result FramebufferVk::applyDeferredClearsInRenderPass(ContextVk *contextVk)
+{
+    ASSERT(contextVk->hasActiveRenderPass());
+    ASSERT(contextVk->hasStartedRenderPassWithQueueSerial(mLastRenderPassQueueSerial));
+    ASSERT(canApplyDeferredClearsInRenderPass(contextVk));
+
+    // Emit debug-util markers for this mid-render-pass clear
+    ANGLE_TRY(
+        contextVk->handleGraphicsEventLog(rx::GraphicsEventCmdBuf::InRenderPassCmdBufQueryCmd));
+
+    // Same as a mid-render-pass glClear; attachments that are not yet used by the render pass are
+    // cleared with loadOp.  The deferred clears always cover the whole framebuffer.
+    clearWithCommand(contextVk, false, getRotatedCompleteRenderArea(contextVk),
+                     ClearWithCommand::OptimizeWithLoadOp, &mDeferredClears);
+    if (mDeferredClears.any())
+    {
+        clearWithLoadOp(contextVk);
+    }
+
+    return angle::Result::Continue;
+}
+
 void FramebufferVk::restageDeferredClearsImpl(ContextVk *contextVk)
 {
     // Set the appropriate aspect and clear values for depth and stencil.
@@ -141,6 +141,11 @@ class FramebufferVk : public FramebufferImpl
     angle::Result flushDepthStencilDeferredClear(ContextVk *contextVk,
                                                  VkImageAspectFlagBits aspect);
     void restageDeferredClearsAfterNoopDraw(ContextVk *contextVk);
+    // When the render pass this framebuffer last started is reactivated, the deferred clears (for
+    // example staged through another framebuffer or glClearTexImage) can be applied as a
+    // mid-render-pass clear instead of closing the render pass and starting a new one.
+    bool canApplyDeferredClearsInRenderPass(ContextVk *contextVk) const;
+    angle::Result applyDeferredClearsInRenderPass(ContextVk *contextVk);
 
     void switchToColorFramebufferFetchMode(ContextVk *contextVk, bool hasColorFramebufferFetch);
 
@@ -10,6 +10,8 @@
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 #include "common/unsafe_buffers.h"
 
+#include "common/BinaryStream.h"
+#include "common/angle_version_info.h"
 #include "common/string_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
@@ -29,6 +31,49 @@ namespace
 // Limit decompressed vulkan pipelines to 10MB per program.
 static constexpr size_t kMaxLocalPipelineCacheSize = 10 * 1024 * 1024;
 
+// The pipeline warm up manifest holds at most this many pipeline descriptions per program.  Beyond
+// that, the cost of warming up would start to compete with the link itself.
+constexpr size_t kMaxPipelineManifestEntries = 16;
+// Bump when the format of the manifest changes.  Changes to GraphicsPipelineDesc are covered by
+// the ANGLE version being part of the key.
+constexpr uint32_t kPipelineManifestVersion = 1;
+constexpr size_t kMaxPipelineManifestSize =
+    sizeof(uint32_t) * 3 + kMaxPipelineManifestEntries * vk::kGraphicsPipelineDescSize;
+
+void ComputePipelineManifestKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                const gl::ShaderBitSet &linkedShaderStages,
+                                const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs,
+                                angle::BlobCacheKey *keyOut)
+{
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    const char *manifestName = "ANGLE Pipeline Manifest: ";
+    hasher.Update(manifestName, strlen(manifestName));
+    angle::UpdateHashWithValue(hasher, kPipelineManifestVersion);
+    hasher.Update(angle::GetANGLEShaderProgramVersion(),
+                  angle::GetANGLEShaderProgramVersionHashSize());
+
+    // The descriptions are only meaningful to the same driver on the same device.
+    hasher.Update(&physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.vendorID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.deviceID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.driverVersion);
+
+    // Identify the program by its shaders.  This is available the same way after link and after
+    // load from binary.
+    for (gl::ShaderType shaderType : linkedShaderStages)
+    {
+        const angle::spirv::Blob &spirv = spirvBlobs[shaderType];
+        angle::UpdateHashWithValue(hasher, static_cast<uint32_t>(shaderType));
+        angle::UpdateHashWithValue(hasher, spirv.size());
+        hasher.Update(spirv.data(), spirv.size() * sizeof(*spirv.data()));
+    }
+
+    hasher.Final();
+    ANGLE_UNSAFE_TODO(memcpy(keyOut->data(), hasher.Digest(), angle::kBlobCacheKeyLength));
+}
+
 bool ValidateTransformedSpirV(vk::ErrorContext *context,
                               const gl::ShaderBitSet &linkedShaderStages,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -98,6 +143,10 @@ void SetupDefaultPipelineState(const vk::ErrorContext *context,
 {
     graphicsPipelineDescOut->initDefaults(context, vk::GraphicsPipelineSubset::Complete,
                                           pipelineRobustness, pipelineProtectedAccess);
+    if (context->getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        graphicsPipelineDescOut->setUsesDescriptorBuffer(vk::GraphicsPipelineSubset::Complete);
+    }
 
     // Set render pass state, affecting both complete and shaders-only pipelines.
     graphicsPipelineDescOut->setTopology(mode);
@@ -345,6 +394,83 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
     return angle::Result::Continue;
 }
 
+// Same as UpdateFullTexturesDescriptorSet, but writes the descriptors into a descriptor buffer set.
+angle::Result UpdateFullTexturesDescriptorBuffer(
+    vk::ErrorContext *context,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const gl::ProgramExecutable &executable,
+    const gl::ActiveTextureArray<TextureVk *> &textures,
+    const gl::SamplerBindingVector &samplers,
+    vk::DescriptorBufferSet *descriptorBufferSet)
+{
+    vk::Renderer *renderer = context->getRenderer();
+
+    const std::vector<gl::SamplerBinding> &samplerBindings = executable.getSamplerBindings();
+    const std::vector<GLuint> &samplerBoundTextureUnits = executable.getSamplerBoundTextureUnits();
+    const std::vector<gl::LinkedUniform> &uniforms      = executable.getUniforms();
+    const gl::ActiveTextureTypeArray &textureTypes      = executable.getActiveSamplerTypes();
+
+    for (uint32_t samplerIndex = 0; samplerIndex < samplerBindings.size(); ++samplerIndex)
+    {
+        uint32_t uniformIndex = executable.getUniformIndexFromSamplerIndex(samplerIndex);
+        const gl::LinkedUniform &samplerUniform = uniforms[uniformIndex];
+        if (samplerUniform.activeShaders().none())
+        {
+            continue;
+        }
+
+        const gl::ShaderType firstShaderType = samplerUniform.getFirstActiveShaderType();
+        const ShaderInterfaceVariableInfo &info =
+            variableInfoMap.getVariableById(firstShaderType, samplerUniform.getId(firstShaderType));
+
+        const gl::SamplerBinding &samplerBinding = samplerBindings[samplerIndex];
+        uint32_t arraySize = static_cast<uint32_t>(samplerBinding.textureUnitsCount);
+
+        for (uint32_t arrayElement = 0; arrayElement < arraySize; ++arrayElement)
+        {
+            GLuint textureUnit =
+                samplerBinding.getTextureUnit(samplerBoundTextureUnits, arrayElement);
+            TextureVk *textureVk           = textures[textureUnit];
+            const uint32_t descriptorIndex = arrayElement + samplerUniform.getOuterArrayOffset();
+
+            if (textureTypes[textureUnit] == gl::TextureType::Buffer)
+            {
+                VkDescriptorAddressInfoEXT addressInfo;
+                textureVk->getBufferDescriptorAddressInfo(context, nullptr, &samplerBinding, false,
+                                                          &addressInfo);
+                descriptorBufferSet->writeTexelBuffer(renderer, info.binding, descriptorIndex,
+                                                      addressInfo);
+            }
+            else
+            {
+                bool isSamplerExternalY2Y =
+                    samplerBinding.samplerType == GL_SAMPLER_EXTERNAL_2D_Y2Y_EXT;
+                gl::Sampler *sampler       = samplers[textureUnit].get();
+                const SamplerVk *samplerVk = sampler ? vk::GetImpl(sampler) : nullptr;
+                const vk::SamplerHelper &samplerHelper =
+                    samplerVk ? samplerVk->getSampler()
+                              : textureVk->getSampler(isSamplerExternalY2Y);
+                const gl::SamplerState &samplerState =
+                    sampler ? sampler->getSamplerState() : textureVk->getState().getSamplerState();
+
+                vk::ImageAccess imageAccess    = textureVk->getImage().getCurrentImageAccess();
+                const vk::ImageView &imageView = textureVk->getReadImageView(
+                    samplerState.getSRGBDecode(), samplerUniform.isTexelFetchStaticUse(),
+                    isSamplerExternalY2Y);
+
+                VkDescriptorImageInfo imageInfo = {};
+                imageInfo.imageLayout           = renderer->getVkImageLayout(imageAccess);
+                imageInfo.imageView             = imageView.getHandle();
+                imageInfo.sampler               = samplerHelper.get().getHandle();
+                descriptorBufferSet->writeCombinedImageSampler(renderer, info.binding,
+                                                               descriptorIndex, imageInfo);
+            }
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
 void UpdateBufferWithSharedCacheKey(const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding,
                                     const vk::SharedDescriptorSetCacheKey &sharedCacheKey)
 {
@@ -482,6 +608,7 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
                        CompleteGraphicsPipelineCache &completePipelines,
                        ShadersGraphicsPipelineCache &shadersPipelines,
                        SharedRenderPass *compatibleRenderPass,
+                       vk::RenderPass &&ownRenderPass,
                        vk::PipelineHelper *placeholderPipelineHelper)
         : WarmUpTaskCommon(renderer, executableVk, pipelineRobustness, pipelineProtectedAccess),
           mPipelineSubset(subset),
@@ -490,7 +617,8 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
           mProgramInfo(programInfo),
           mCompletePipelines(completePipelines),
           mShadersPipelines(shadersPipelines),
-          mCompatibleRenderPass(compatibleRenderPass)
+          mCompatibleRenderPass(compatibleRenderPass),
+          mOwnRenderPass(std::move(ownRenderPass))
     {
         ASSERT(mCompatibleRenderPass);
         mCompatibleRenderPass->addRef();
@@ -499,12 +627,17 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
     void operator()() override
     {
+        // Pipelines from the manifest may need a render pass that differs from the shared one.
+        const vk::RenderPass &renderPass =
+            mOwnRenderPass.valid() ? mOwnRenderPass : mCompatibleRenderPass->get();
         angle::Result result = mExecutableVk->warmUpGraphicsPipelineCache(
             this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset,
-            mGraphicsPipelineDesc, mProgramInfo, mCompletePipelines, mShadersPipelines,
-            mCompatibleRenderPass->get(), mWarmUpPipelineHelper);
+            mGraphicsPipelineDesc, mProgramInfo, mCompletePipelines, mShadersPipelines, renderPass,
+            mWarmUpPipelineHelper);
         ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
 
+        mOwnRenderPass.destroy(getDevice());
+
         // Release reference to shared renderpass. If this is the last reference -
         // 1. merge ProgramExecutableVk's pipeline cache into the Renderer's cache
         // 2. cleanup temporary renderpass
@@ -548,6 +681,7 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
     // Temporary objects to clean up at the end
     SharedRenderPass *mCompatibleRenderPass;
+    vk::RenderPass mOwnRenderPass;
 };
 
 // ShaderInfo implementation.
@@ -638,8 +772,6 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
 {
     const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
     const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
-    gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
-    angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
 
     SpvTransformOptions options;
     options.shaderType               = shaderType;
@@ -661,10 +793,23 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
     options.ditherControl = (shaderType == gl::ShaderType::Fragment) ? optionBits.ditherControl : 0;
     options.roundOutputAfterDithering = context->getFeatures().roundOutputAfterDithering.enabled;
 
-    ANGLE_TRY(
-        SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
-    ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob.data(),
-                                   transformedSpirvBlob.size() * sizeof(uint32_t)));
+    // Programs that share this shader likely transform it the same way, in which case the
+    // transformed SPIR-V is taken from the renderer's cache.
+    SpvTransformCache::SharedBlob transformedSpirvBlob;
+    if (context->getFeatures().cacheTransformedSpirv.enabled)
+    {
+        ANGLE_TRY(context->getRenderer()->getSpvTransformCache().transformSpirvCode(
+            options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
+    }
+    else
+    {
+        auto uncachedSpirvBlob = std::make_shared<angle::spirv::Blob>();
+        ANGLE_TRY(SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob,
+                                        uncachedSpirvBlob.get()));
+        transformedSpirvBlob = std::move(uncachedSpirvBlob);
+    }
+    ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob->data(),
+                                   transformedSpirvBlob->size() * sizeof(uint32_t)));
 
     mProgramHelper.setShader(shaderType, mShaders[shaderType]);
 
@@ -686,7 +831,9 @@ ProgramExecutableVk::ProgramExecutableVk(const gl::ProgramExecutable *executable
       mImmutableSamplersMaxDescriptorCount(1),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
       mDefaultUniformDynamicDescriptorOffsets{},
-      mValidComputePermutations{}
+      mValidComputePermutations{},
+      mPipelineManifestKey{},
+      mPipelineManifestKeyValid(false)
 {
     for (std::shared_ptr<BufferAndLayout> &defaultBlock : mDefaultUniformBlocks)
     {
@@ -732,6 +879,10 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     {
         pool.reset();
     }
+    for (vk::DescriptorBufferSet &descriptorBufferSet : mDescriptorBufferSets)
+    {
+        descriptorBufferSet.reset();
+    }
 
     // Initialize with an invalid BufferSerial
     mCurrentDefaultUniformBufferSerial = vk::BufferSerial();
@@ -771,6 +922,9 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
     {
         mPipelineCache.destroy(contextVk->getDevice());
     }
+
+    mPipelineManifestKeyValid = false;
+    mPipelineManifest.clear();
 }
 
 angle::Result ProgramExecutableVk::initializePipelineCache(vk::ErrorContext *context,
@@ -969,7 +1123,45 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
             renderer, this, pipelineRobustness, pipelineProtectedAccess, subset,
             *graphicsPipelineDesc, mGraphicsProgramInfos[programIndex],
             mCompleteGraphicsPipelines[programIndex], mShadersGraphicsPipelines[programIndex],
-            sharedRenderPass, pipelineHelper));
+            sharedRenderPass, vk::RenderPass(), pipelineHelper));
+
+        // Additionally create the pipelines that were used by draw calls in previous runs.  Each
+        // gets its own task so they are created in parallel.
+        for (const vk::GraphicsPipelineDesc &manifestDesc : mPipelineManifest)
+        {
+            // Failing to warm up these pipelines is harmless; they are created at draw time
+            // instead.
+            vk::RenderPass manifestRenderPass;
+            if (makeWarmUpRenderPass(&prepForWarmUpContext, manifestDesc, &manifestRenderPass) !=
+                angle::Result::Continue)
+            {
+                continue;
+            }
+
+            // Skip descriptions that are already in the cache, such as the one above.
+            pipelineHelper = nullptr;
+            if (subset == vk::GraphicsPipelineSubset::Complete)
+            {
+                mCompleteGraphicsPipelines[programIndex].populate(manifestDesc, vk::Pipeline(),
+                                                                  &pipelineHelper);
+            }
+            else
+            {
+                mShadersGraphicsPipelines[programIndex].populate(manifestDesc, vk::Pipeline(),
+                                                                 &pipelineHelper);
+            }
+            if (pipelineHelper == nullptr)
+            {
+                manifestRenderPass.destroy(renderer->getDevice());
+                continue;
+            }
+
+            warmUpSubTasks.push_back(std::make_shared<WarmUpGraphicsTask>(
+                renderer, this, pipelineRobustness, pipelineProtectedAccess, subset, manifestDesc,
+                mGraphicsProgramInfos[programIndex], mCompleteGraphicsPipelines[programIndex],
+                mShadersGraphicsPipelines[programIndex], sharedRenderPass,
+                std::move(manifestRenderPass), pipelineHelper));
+        }
     }
 
     // If the caller hasn't provided a valid async task container, inline the warmUp tasks.
@@ -1023,8 +1215,9 @@ angle::Result ProgramExecutableVk::preparePipelineCacheForWarmUp(
     if (isCompute)
     {
         // Initialize compute program.
-        vk::ComputePipelineOptions pipelineOptions =
-            vk::GetComputePipelineOptions(pipelineRobustness, pipelineProtectedAccess);
+        vk::ComputePipelineOptions pipelineOptions = vk::GetComputePipelineOptions(
+            pipelineRobustness, pipelineProtectedAccess,
+            context->getFeatures().supportsDescriptorBuffer.enabled);
         ANGLE_TRY(
             initComputeProgram(context, &mComputeProgramInfo, mVariableInfoMap, pipelineOptions));
 
@@ -1044,16 +1237,7 @@ angle::Result ProgramExecutableVk::preparePipelineCacheForWarmUp(
     SetupDefaultPipelineState(context, *mExecutable, mode, pipelineRobustness,
                               pipelineProtectedAccess, subset, &mWarmUpGraphicsPipelineDesc);
 
-    // Create a temporary compatible RenderPass.  The render pass cache in ContextVk cannot be used
-    // because this function may be called from a worker thread.
-    vk::AttachmentOpsArray ops;
-    RenderPassCache::InitializeOpsForCompatibleRenderPass(
-        mWarmUpGraphicsPipelineDesc.getRenderPassDesc(), &ops);
-    if (!context->getFeatures().preferDynamicRendering.enabled)
-    {
-        ANGLE_TRY(RenderPassCache::MakeRenderPass(
-            context, mWarmUpGraphicsPipelineDesc.getRenderPassDesc(), ops, renderPassOut, nullptr));
-    }
+    ANGLE_TRY(makeWarmUpRenderPass(context, mWarmUpGraphicsPipelineDesc, renderPassOut));
 
     *graphicsPipelineDescOut = &mWarmUpGraphicsPipelineDesc;
 
@@ -1065,6 +1249,25 @@ angle::Result ProgramExecutableVk::preparePipelineCacheForWarmUp(
     return initGraphicsShaderPrograms(context, transformOptions);
 }
 
+angle::Result ProgramExecutableVk::makeWarmUpRenderPass(
+    vk::ErrorContext *context,
+    const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
+    vk::RenderPass *renderPassOut)
+{
+    // Create a temporary compatible RenderPass.  The render pass cache in ContextVk cannot be used
+    // because this function may be called from a worker thread.
+    if (context->getFeatures().preferDynamicRendering.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    vk::AttachmentOpsArray ops;
+    RenderPassCache::InitializeOpsForCompatibleRenderPass(graphicsPipelineDesc.getRenderPassDesc(),
+                                                          &ops);
+    return RenderPassCache::MakeRenderPass(context, graphicsPipelineDesc.getRenderPassDesc(), ops,
+                                           renderPassOut, nullptr);
+}
+
 angle::Result ProgramExecutableVk::warmUpComputePipelineCache(
     vk::ErrorContext *context,
     vk::PipelineRobustness pipelineRobustness,
@@ -1187,7 +1390,8 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
 
     const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(contextVk->getFeatures());
 
-    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset))
+    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset) &&
+        !isInPipelineManifest(currentGraphicsPipelineDesc, subset))
     {
         // The GraphicsPipelineDesc used for warm up differs from the one used by the draw call.
         // There is no need to wait for the warm up tasks to complete.
@@ -1205,6 +1409,91 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
     waitForPostLinkTasksImpl(contextVk);
 }
 
+void ProgramExecutableVk::initPipelineManifest(vk::Renderer *renderer)
+{
+    // Compute programs have a single pipeline, which the warm up always creates.
+    if (!renderer->getFeatures().warmUpPipelinesFromManifest.enabled ||
+        mExecutable->hasLinkedShaderStage(gl::ShaderType::Compute) || mPipelineManifestKeyValid)
+    {
+        return;
+    }
+
+    ComputePipelineManifestKey(renderer->getPhysicalDeviceProperties(),
+                               mExecutable->getLinkedShaderStages(),
+                               mOriginalShaderInfo.getSpirvBlobs(), &mPipelineManifestKey);
+    mPipelineManifestKeyValid = true;
+
+    angle::MemoryBuffer manifestData;
+    if (!renderer->getPipelineManifest(mPipelineManifestKey, kMaxPipelineManifestSize,
+                                       &manifestData))
+    {
+        return;
+    }
+
+    // A malformed manifest is ignored; it's replaced as soon as a draw call adds to it.
+    gl::BinaryInputStream stream(manifestData);
+    const uint32_t version  = stream.readInt<uint32_t>();
+    const uint32_t descSize = stream.readInt<uint32_t>();
+    const uint32_t count    = stream.readInt<uint32_t>();
+    if (stream.error() || version != kPipelineManifestVersion ||
+        descSize != vk::kGraphicsPipelineDescSize || count > kMaxPipelineManifestEntries)
+    {
+        return;
+    }
+
+    std::vector<vk::GraphicsPipelineDesc> manifest(count);
+    for (vk::GraphicsPipelineDesc &desc : manifest)
+    {
+        stream.readBytes(angle::byte_span_from_ref(desc));
+    }
+    if (stream.error() || !stream.endOfStream())
+    {
+        return;
+    }
+
+    mPipelineManifest = std::move(manifest);
+}
+
+bool ProgramExecutableVk::isInPipelineManifest(const vk::GraphicsPipelineDesc &desc,
+                                               vk::GraphicsPipelineSubset subset) const
+{
+    for (const vk::GraphicsPipelineDesc &manifestDesc : mPipelineManifest)
+    {
+        if (manifestDesc.keyEqual(desc, subset))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ProgramExecutableVk::recordPipelineManifestEntry(ContextVk *contextVk,
+                                                      const vk::GraphicsPipelineDesc &desc)
+{
+    const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(contextVk->getFeatures());
+
+    if (!mPipelineManifestKeyValid || mPipelineManifest.size() >= kMaxPipelineManifestEntries ||
+        mWarmUpGraphicsPipelineDesc.keyEqual(desc, subset) || isInPipelineManifest(desc, subset))
+    {
+        return;
+    }
+
+    mPipelineManifest.push_back(desc);
+
+    // Write the whole manifest out again.  This happens at most kMaxPipelineManifestEntries times
+    // per program, and the manifest is small.
+    gl::BinaryOutputStream stream;
+    stream.writeInt(kPipelineManifestVersion);
+    stream.writeInt(static_cast<uint32_t>(vk::kGraphicsPipelineDescSize));
+    stream.writeInt(static_cast<uint32_t>(mPipelineManifest.size()));
+    for (const vk::GraphicsPipelineDesc &manifestDesc : mPipelineManifest)
+    {
+        stream.writeBytes(angle::byte_span_from_ref(manifestDesc));
+    }
+
+    contextVk->getRenderer()->putPipelineManifest(mPipelineManifestKey, stream);
+}
+
 angle::Result ProgramExecutableVk::mergePipelineCacheToRenderer(vk::ErrorContext *context) const
 {
     // Merge the cache with Renderer's
@@ -1654,6 +1943,17 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
         mShadersGraphicsPipelines[programIndex].getPipeline(desc, descPtrOut, pipelineOut);
     }
 
+    // Count the draw calls that found a pipeline only because it was warmed up.
+    if (*pipelineOut != nullptr && pipelineSubset == GetWarmUpSubset(contextVk->getFeatures()))
+    {
+        const vk::CacheLookUpFeedback feedback = (*pipelineOut)->getCacheLookUpFeedback();
+        if (feedback == vk::CacheLookUpFeedback::WarmUpHit ||
+            feedback == vk::CacheLookUpFeedback::WarmUpMiss)
+        {
+            contextVk->getPerfCounters().warmedUpGraphicsPipelineMisses++;
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -1691,6 +1991,17 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
         contextVk, transformOptions, pipelineSubset, pipelineCache, source, desc,
         *compatibleRenderPass, descPtrOut, pipelineOut));
 
+    // The draw call could not use a warmed up pipeline.  Remember the pipeline so it's warmed up
+    // next time.  Only the default shader permutation is warmed up.
+    if (source == PipelineSource::Draw)
+    {
+        contextVk->getPerfCounters().coldGraphicsPipelineMisses++;
+        if (transformOptions.permutationIndex == 0)
+        {
+            recordPipelineManifestEntry(contextVk, desc);
+        }
+    }
+
     if (useProgramPipelineCache &&
         contextVk->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled)
     {
@@ -1753,7 +2064,8 @@ angle::Result ProgramExecutableVk::getOrCreateComputePipeline(
     ASSERT(mExecutable->hasLinkedShaderStage(gl::ShaderType::Compute));
 
     vk::ComputePipelineOptions pipelineOptions =
-        vk::GetComputePipelineOptions(pipelineRobustness, pipelineProtectedAccess);
+        vk::GetComputePipelineOptions(pipelineRobustness, pipelineProtectedAccess,
+                                      context->getFeatures().supportsDescriptorBuffer.enabled);
     ANGLE_TRY(initComputeProgram(context, &mComputeProgramInfo, mVariableInfoMap, pipelineOptions));
 
     return mComputeProgramInfo.getShaderProgram().getOrCreateComputePipeline(
@@ -1769,9 +2081,11 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
 {
     vk::Renderer *renderer                     = context->getRenderer();
     const gl::ShaderBitSet &linkedShaderStages = mExecutable->getLinkedShaderStages();
+    const bool useDescriptorBuffer = context->getFeatures().supportsDescriptorBuffer.enabled;
 
     // Store a reference to the pipeline and descriptor set layouts. This will create them if they
-    // don't already exist in the cache.
+    // don't already exist in the cache.  With VK_EXT_descriptor_buffer, every set layout is created
+    // for use with descriptor buffers.
 
     // Default uniforms and transform feedback:
     mDefaultUniformAndXfbSetDesc          = {};
@@ -1808,6 +2122,10 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
         }
     }
 
+    if (useDescriptorBuffer)
+    {
+        mDefaultUniformAndXfbSetDesc.setUsesDescriptorBuffer();
+    }
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mDefaultUniformAndXfbSetDesc,
         &mDescriptorSetLayouts[DescriptorSetIndex::UniformsAndXfb]));
@@ -1846,6 +2164,10 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     addInterfaceBlockDescriptorSetDesc(mExecutable->getUniformBlocks(), linkedShaderStages,
                                        mUniformBufferDescriptorType, &mUniformBuffersSetDesc);
 
+    if (useDescriptorBuffer)
+    {
+        mUniformBuffersSetDesc.setUsesDescriptorBuffer();
+    }
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mUniformBuffersSetDesc,
         &mDescriptorSetLayouts[DescriptorSetIndex::UniformBuffers]));
@@ -1860,6 +2182,10 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     addImageDescriptorSetDesc(&mShaderResourceSetDesc);
     addInputAttachmentDescriptorSetDesc(context, &mShaderResourceSetDesc);
 
+    if (useDescriptorBuffer)
+    {
+        mShaderResourceSetDesc.setUsesDescriptorBuffer();
+    }
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mShaderResourceSetDesc,
         &mDescriptorSetLayouts[DescriptorSetIndex::ShaderResource]));
@@ -1867,6 +2193,10 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     // Textures:
     mTextureSetDesc = {};
     ANGLE_TRY(addTextureDescriptorSetDesc(context, activeTextures, &mTextureSetDesc));
+    if (useDescriptorBuffer)
+    {
+        mTextureSetDesc.setUsesDescriptorBuffer();
+    }
 
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mTextureSetDesc, &mDescriptorSetLayouts[DescriptorSetIndex::Texture]));
@@ -1905,6 +2235,28 @@ angle::Result ProgramExecutableVk::initializeDescriptorPools(
     DescriptorSetLayoutCache *descriptorSetLayoutCache,
     vk::DescriptorSetArray<vk::MetaDescriptorPool> *metaDescriptorPools)
 {
+    if (context->getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // No descriptor pools are needed; each set's descriptors are kept in a CPU copy that is
+        // written into the context's descriptor ring when bound.
+        const vk::DescriptorSetArray<const vk::DescriptorSetLayoutDesc *> setDescs = {
+            {DescriptorSetIndex::UniformsAndXfb, &mDefaultUniformAndXfbSetDesc},
+            {DescriptorSetIndex::UniformBuffers, &mUniformBuffersSetDesc},
+            {DescriptorSetIndex::ShaderResource, &mShaderResourceSetDesc},
+            {DescriptorSetIndex::Texture, &mTextureSetDesc},
+        };
+        for (DescriptorSetIndex setIndex : angle::AllEnums<DescriptorSetIndex>())
+        {
+            if (!setDescs[setIndex]->empty())
+            {
+                mDescriptorBufferSets[setIndex].init(
+                    context->getRenderer(), *setDescs[setIndex], *mDescriptorSetLayouts[setIndex],
+                    mImmutableSamplersMaxDescriptorCount);
+            }
+        }
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::UniformsAndXfb].bindCachedDescriptorPool(
         context, mDefaultUniformAndXfbSetDesc, 1, descriptorSetLayoutCache,
         &mDynamicDescriptorPools[DescriptorSetIndex::UniformsAndXfb]));
@@ -2000,25 +2352,49 @@ angle::Result ProgramExecutableVk::getOrAllocateDescriptorSet(
     vk::Context *context,
     uint32_t currentFrame,
     UpdateDescriptorSetsBuilder *updateBuilder,
-    const vk::DescriptorSetDescBuilder &descriptorSetDesc,
+    vk::DescriptorSetDescBuilder *descriptorSetDesc,
     const vk::WriteDescriptorDescs &writeDescriptorDescs,
     DescriptorSetIndex setIndex,
     vk::SharedDescriptorSetCacheKey *newSharedCacheKeyOut)
 {
     vk::Renderer *renderer = context->getRenderer();
 
-    if (renderer->getFeatures().descriptorSetCache.enabled)
+    if (renderer->getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // There is no descriptor set to allocate or look up.  The descriptors are rewritten in
+        // place only if any of them changed.
+        ASSERT(mDescriptorBufferSets[setIndex].valid());
+        if (descriptorSetDesc->isDescChanged() || !mValidDescriptorSetIndices.test(setIndex))
+        {
+            mDescriptorBufferSets[setIndex].update(renderer, *descriptorSetDesc,
+                                                   writeDescriptorDescs);
+            descriptorSetDesc->resetDescChanged();
+        }
+        newSharedCacheKeyOut->reset();
+    }
+    else if (renderer->getFeatures().descriptorSetCache.enabled)
     {
+        if (!descriptorSetDesc->isDescChanged() && mValidDescriptorSetIndices.test(setIndex))
+        {
+            // None of the descriptors changed since the current descriptor set was retrieved, so
+            // it can be used again without hashing the desc and looking it up.
+            ASSERT(mDescriptorSets[setIndex]);
+            mDynamicDescriptorPools[setIndex]->onDescriptorSetReused();
+            newSharedCacheKeyOut->reset();
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(mDynamicDescriptorPools[setIndex]->getOrAllocateDescriptorSet(
-            context, currentFrame, descriptorSetDesc.getDesc(), *mDescriptorSetLayouts[setIndex],
+            context, currentFrame, descriptorSetDesc->getDesc(), *mDescriptorSetLayouts[setIndex],
             &mDescriptorSets[setIndex], newSharedCacheKeyOut));
         ASSERT(mDescriptorSets[setIndex]);
+        descriptorSetDesc->resetDescChanged();
 
         if (*newSharedCacheKeyOut)
         {
             ASSERT((*newSharedCacheKeyOut)->valid());
             // Cache miss. A new cache entry has been created.
-            updateBuilder->updateWriteDescriptorSet(renderer, descriptorSetDesc,
+            updateBuilder->updateWriteDescriptorSet(renderer, *descriptorSetDesc,
                                                     writeDescriptorDescs,
                                                     mDescriptorSets[setIndex]->getDescriptorSet());
         }
@@ -2029,7 +2405,7 @@ angle::Result ProgramExecutableVk::getOrAllocateDescriptorSet(
             context, *mDescriptorSetLayouts[setIndex], &mDescriptorSets[setIndex]));
         ASSERT(mDescriptorSets[setIndex]);
 
-        updateBuilder->updateWriteDescriptorSet(renderer, descriptorSetDesc, writeDescriptorDescs,
+        updateBuilder->updateWriteDescriptorSet(renderer, *descriptorSetDesc, writeDescriptorDescs,
                                                 mDescriptorSets[setIndex]->getDescriptorSet());
     }
 
@@ -2040,13 +2416,13 @@ angle::Result ProgramExecutableVk::getOrAllocateDescriptorSet(
 angle::Result ProgramExecutableVk::updateBuffersDescriptorSet(
     vk::Context *context,
     const uint32_t currentFrame,
-    const vk::DescriptorSetDescBuilder &descriptorSetDesc,
+    vk::DescriptorSetDescBuilder *descriptorSetDesc,
     const vk::WriteDescriptorDescs &writeDescriptorDescs,
     const DescriptorSetIndex setIndex,
     UpdateDescriptorSetsBuilder *updateBuilder,
     vk::SharedDescriptorSetCacheKey *newSharedCacheKeyOut)
 {
-    if (!mDynamicDescriptorPools[setIndex])
+    if (!mDynamicDescriptorPools[setIndex] && !mDescriptorBufferSets[setIndex].valid())
     {
         (*newSharedCacheKeyOut).reset();
         return angle::Result::Continue;
@@ -2067,7 +2443,7 @@ angle::Result ProgramExecutableVk::updateUniformsAndXfbDescriptorSet(
         defaultUniformBuffer ? defaultUniformBuffer->getBufferSerial() : vk::kInvalidBufferSerial;
 
     return getOrAllocateDescriptorSet(context, currentFrame, updateBuilder,
-                                      mDefaultUniformAndXfbDescriptorDescBuilder,
+                                      &mDefaultUniformAndXfbDescriptorDescBuilder,
                                       mDefaultUniformAndXfbWriteDescriptorDescs,
                                       DescriptorSetIndex::UniformsAndXfb, sharedCacheKeyOut);
 }
@@ -2080,7 +2456,24 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
     PipelineType pipelineType,
     UpdateDescriptorSetsBuilder *updateBuilder)
 {
-    if (context->getFeatures().descriptorSetCache.enabled)
+    if (context->getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // The texture desc is only used to detect changes; the descriptors are rewritten in place
+        // when any texture or sampler changed.
+        mTextureDescriptorDescBuilder.updatePreCacheActiveTextures(
+            context, *mExecutable, textures, samplers, mTextureWriteDescriptorDescs);
+
+        vk::DescriptorBufferSet &descriptorBufferSet =
+            mDescriptorBufferSets[DescriptorSetIndex::Texture];
+        if (mTextureDescriptorDescBuilder.isDescChanged() ||
+            !mValidDescriptorSetIndices.test(DescriptorSetIndex::Texture))
+        {
+            ANGLE_TRY(UpdateFullTexturesDescriptorBuffer(context, mVariableInfoMap, *mExecutable,
+                                                         textures, samplers, &descriptorBufferSet));
+            mTextureDescriptorDescBuilder.resetDescChanged();
+        }
+    }
+    else if (context->getFeatures().descriptorSetCache.enabled)
     {
         vk::SharedDescriptorSetCacheKey newSharedCacheKey;
 
@@ -2091,11 +2484,22 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         mTextureDescriptorDescBuilder.updatePreCacheActiveTextures(
             context, *mExecutable, textures, samplers, mTextureWriteDescriptorDescs);
 
+        // Typically only a few of the textures change between draws.  If none did, the current
+        // descriptor set is still good.
+        if (!mTextureDescriptorDescBuilder.isDescChanged() &&
+            mValidDescriptorSetIndices.test(DescriptorSetIndex::Texture))
+        {
+            ASSERT(mDescriptorSets[DescriptorSetIndex::Texture]);
+            mDynamicDescriptorPools[DescriptorSetIndex::Texture]->onDescriptorSetReused();
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(mDynamicDescriptorPools[DescriptorSetIndex::Texture]->getOrAllocateDescriptorSet(
             context, currentFrame, mTextureDescriptorDescBuilder.getDesc(),
             *mDescriptorSetLayouts[DescriptorSetIndex::Texture],
             &mDescriptorSets[DescriptorSetIndex::Texture], &newSharedCacheKey));
         ASSERT(mDescriptorSets[DescriptorSetIndex::Texture]);
+        mTextureDescriptorDescBuilder.resetDescChanged();
 
         if (newSharedCacheKey)
         {
@@ -2178,7 +2582,7 @@ angle::Result ProgramExecutableVk::updateUniformBuffersDescInfo(
 
     vk::SharedDescriptorSetCacheKey newSharedCacheKey;
     ANGLE_TRY(updateBuffersDescriptorSet(
-        context, currentFrameCount, mUniformBuffersDescriptorDescBuilder,
+        context, currentFrameCount, &mUniformBuffersDescriptorDescBuilder,
         mUniformBuffersWriteDescriptorDescs, DescriptorSetIndex::UniformBuffers, updateBuilder,
         &newSharedCacheKey));
 
@@ -2326,7 +2730,7 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescInfo(
 
     vk::SharedDescriptorSetCacheKey newSharedCacheKey;
     ANGLE_TRY(updateBuffersDescriptorSet(
-        contextVk, currentFrameCount, mShaderResourceDescriptorDescBuilder,
+        contextVk, currentFrameCount, &mShaderResourceDescriptorDescBuilder,
         mShaderResourceWriteDescriptorDescs, DescriptorSetIndex::ShaderResource, updateBuilder,
         &newSharedCacheKey));
 
@@ -2344,16 +2748,23 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescInfo(
 
 template <typename CommandBufferT>
 angle::Result ProgramExecutableVk::bindDescriptorSets(
-    vk::ErrorContext *context,
+    vk::Context *context,
     uint32_t currentFrame,
     vk::CommandBufferHelperCommon *commandBufferHelper,
     CommandBufferT *commandBuffer,
-    PipelineType pipelineType)
+    PipelineType pipelineType,
+    vk::DescriptorBufferRing *descriptorBufferStorage)
 {
     const VkPipelineBindPoint pipelineBindPoint = pipelineType == PipelineType::Compute
                                                       ? VK_PIPELINE_BIND_POINT_COMPUTE
                                                       : VK_PIPELINE_BIND_POINT_GRAPHICS;
 
+    if (context->getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        return bindDescriptorBuffers(context, commandBufferHelper, commandBuffer,
+                                     pipelineBindPoint, descriptorBufferStorage);
+    }
+
     for (DescriptorSetIndex descriptorSetIndex : mValidDescriptorSetIndices)
     {
         ASSERT(mDescriptorSets[descriptorSetIndex]);
@@ -2398,17 +2809,144 @@ angle::Result ProgramExecutableVk::bindDescriptorSets(
 }
 
 template angle::Result ProgramExecutableVk::bindDescriptorSets<vk::priv::SecondaryCommandBuffer>(
-    vk::ErrorContext *context,
+    vk::Context *context,
     uint32_t currentFrame,
     vk::CommandBufferHelperCommon *commandBufferHelper,
     vk::priv::SecondaryCommandBuffer *commandBuffer,
-    PipelineType pipelineType);
+    PipelineType pipelineType,
+    vk::DescriptorBufferRing *descriptorBufferStorage);
 template angle::Result ProgramExecutableVk::bindDescriptorSets<vk::VulkanSecondaryCommandBuffer>(
-    vk::ErrorContext *context,
+    vk::Context *context,
     uint32_t currentFrame,
     vk::CommandBufferHelperCommon *commandBufferHelper,
     vk::VulkanSecondaryCommandBuffer *commandBuffer,
-    PipelineType pipelineType);
+    PipelineType pipelineType,
+    vk::DescriptorBufferRing *descriptorBufferStorage);
+
+template <typename CommandBufferT>
+angle::Result ProgramExecutableVk::bindDescriptorBuffers(
+    vk::Context *context,
+    vk::CommandBufferHelperCommon *commandBufferHelper,
+    CommandBufferT *commandBuffer,
+    VkPipelineBindPoint pipelineBindPoint,
+    vk::DescriptorBufferRing *descriptorBufferStorage)
+{
+    if (mValidDescriptorSetIndices.none())
+    {
+        return angle::Result::Continue;
+    }
+
+    vk::Renderer *renderer = context->getRenderer();
+    const VkDeviceSize alignment =
+        renderer->getPhysicalDeviceDescriptorBufferProperties().descriptorBufferOffsetAlignment;
+
+    // Dynamic offsets are folded into the descriptors, which are only rewritten for the offsets
+    // that changed.
+    if (mValidDescriptorSetIndices.test(DescriptorSetIndex::UniformsAndXfb))
+    {
+        mDescriptorBufferSets[DescriptorSetIndex::UniformsAndXfb].updateDynamicDescriptors(
+            renderer, mDefaultUniformDynamicDescriptorOffsets.data());
+    }
+    if (mValidDescriptorSetIndices.test(DescriptorSetIndex::UniformBuffers))
+    {
+        mDescriptorBufferSets[DescriptorSetIndex::UniformBuffers].updateDynamicDescriptors(
+            renderer, mUniformBuffersDescriptorDescBuilder.getDynamicOffsets());
+    }
+
+    // Only the sets that changed, or whose copy is not in the ring's current buffer, are copied
+    // into the ring.  If they don't fit in the current buffer, all sets are copied into a new one.
+    const vk::BufferSerial currentBufferSerial = descriptorBufferStorage->getCurrentBufferSerial();
+    angle::PackedEnumBitSet<DescriptorSetIndex, uint8_t> setsToCopy;
+    VkDeviceSize copySize = 0;
+    VkDeviceSize fullSize = 0;
+    for (DescriptorSetIndex setIndex : mValidDescriptorSetIndices)
+    {
+        const VkDeviceSize setSize = roundUp(mDescriptorBufferSets[setIndex].getSize(), alignment);
+        if (mDescriptorBufferSets[setIndex].isDirty() || !currentBufferSerial.valid() ||
+            mDescriptorBufferCopySerials[setIndex] != currentBufferSerial)
+        {
+            setsToCopy.set(setIndex);
+            copySize += setSize;
+        }
+        fullSize += setSize;
+    }
+
+    if (setsToCopy.any())
+    {
+        vk::BufferHelper *descriptorBuffer = nullptr;
+        bool newBuffer                     = false;
+        ANGLE_TRY(descriptorBufferStorage->allocate(context, static_cast<size_t>(copySize),
+                                                    static_cast<size_t>(fullSize),
+                                                    &descriptorBuffer, &newBuffer));
+        if (newBuffer)
+        {
+            setsToCopy = mValidDescriptorSetIndices;
+        }
+
+        const vk::BufferSerial bufferSerial = descriptorBufferStorage->getCurrentBufferSerial();
+        uint8_t *bufferData                 = descriptorBuffer->getMappedMemory();
+        VkDeviceSize setOffset              = 0;
+        for (DescriptorSetIndex setIndex : setsToCopy)
+        {
+            mDescriptorBufferSets[setIndex].copyTo(&ANGLE_UNSAFE_TODO(bufferData[setOffset]));
+            mDescriptorBufferCopySerials[setIndex] = bufferSerial;
+            mDescriptorBufferCopyOffsets[setIndex] = descriptorBuffer->getOffset() + setOffset;
+            setOffset += roundUp(mDescriptorBufferSets[setIndex].getSize(), alignment);
+        }
+        ANGLE_TRY(descriptorBuffer->flush(renderer));
+
+        context->getPerfCounters().descriptorBufferSetCopies += setsToCopy.count();
+    }
+
+    const vk::BufferSerial bufferSerial = descriptorBufferStorage->getCurrentBufferSerial();
+    if (!commandBufferHelper->isDescriptorBufferBound(bufferSerial))
+    {
+        commandBuffer->bindDescriptorBuffer(descriptorBufferStorage->getCurrentBufferAddress(),
+                                            vk::kDescriptorBufferUsageFlags);
+        commandBufferHelper->onDescriptorBufferBound(bufferSerial);
+    }
+    commandBufferHelper->retainResource(descriptorBufferStorage->getCurrentBuffer());
+
+    // Only the offsets that differ from the ones already set in the command buffer are set.  Sets
+    // without bindings are given the offset of the first set.
+    const DescriptorSetIndex firstValidSet = mValidDescriptorSetIndices.first();
+    vk::DescriptorBufferOffsets &boundOffsets =
+        commandBufferHelper->getDescriptorBufferOffsets(pipelineBindPoint);
+    const bool isSameLayout = boundOffsets.pipelineLayout == getPipelineLayout().getHandle();
+
+    uint32_t firstSet = vk::kMaxDescriptorSetLayouts;
+    uint32_t lastSet  = 0;
+    for (uint32_t index = ToUnderlying(firstValidSet);
+         index <= ToUnderlying(mValidDescriptorSetIndices.last()); ++index)
+    {
+        const DescriptorSetIndex setIndex = static_cast<DescriptorSetIndex>(index);
+        const DescriptorSetIndex copiedSet =
+            mValidDescriptorSetIndices.test(setIndex) ? setIndex : firstValidSet;
+        const VkDeviceSize offset = mDescriptorBufferCopyOffsets[copiedSet];
+        if (!isSameLayout || boundOffsets.offsets[setIndex] != offset)
+        {
+            boundOffsets.offsets[setIndex] = offset;
+            firstSet                       = std::min(firstSet, index);
+            lastSet                        = index;
+        }
+    }
+    boundOffsets.pipelineLayout = getPipelineLayout().getHandle();
+
+    if (firstSet <= lastSet)
+    {
+        std::array<VkDeviceSize, vk::kMaxDescriptorSetLayouts> bufferOffsets;
+        for (uint32_t index = firstSet; index <= lastSet; ++index)
+        {
+            bufferOffsets[index - firstSet] =
+                boundOffsets.offsets[static_cast<DescriptorSetIndex>(index)];
+        }
+        commandBuffer->setDescriptorBufferOffsets(
+            getPipelineLayout(), pipelineBindPoint, static_cast<DescriptorSetIndex>(firstSet),
+            lastSet - firstSet + 1, bufferOffsets.data());
+    }
+
+    return angle::Result::Continue;
+}
 
 void ProgramExecutableVk::setAllDefaultUniformsDirty()
 {
@@ -2426,7 +2964,7 @@ angle::Result ProgramExecutableVk::updateUniforms(vk::Context *context,
                                                   uint32_t currentFrame,
                                                   UpdateDescriptorSetsBuilder *updateBuilder,
                                                   vk::BufferHelper *emptyBuffer,
-                                                  vk::DynamicBuffer *defaultUniformStorage,
+                                                  vk::FrameRingBuffer *defaultUniformStorage,
                                                   bool isTransformFeedbackActiveUnpaused,
                                                   TransformFeedbackVk *transformFeedbackVk)
 {
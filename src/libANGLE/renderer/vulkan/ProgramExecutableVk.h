@@ -220,12 +220,15 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               PipelineType pipelineType,
                                               UpdateDescriptorSetsBuilder *updateBuilder);
 
+    // |descriptorBufferStorage| is the ring the descriptors are copied into with
+    // VK_EXT_descriptor_buffer, and is unused otherwise.
     template <typename CommandBufferT>
-    angle::Result bindDescriptorSets(vk::ErrorContext *context,
+    angle::Result bindDescriptorSets(vk::Context *context,
                                      uint32_t currentFrame,
                                      vk::CommandBufferHelperCommon *commandBufferHelper,
                                      CommandBufferT *commandBuffer,
-                                     PipelineType pipelineType);
+                                     PipelineType pipelineType,
+                                     vk::DescriptorBufferRing *descriptorBufferStorage);
 
     bool usesDynamicUniformBufferDescriptors() const
     {
@@ -289,7 +292,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                  uint32_t currentFrame,
                                  UpdateDescriptorSetsBuilder *updateBuilder,
                                  vk::BufferHelper *emptyBuffer,
-                                 vk::DynamicBuffer *defaultUniformStorage,
+                                 vk::FrameRingBuffer *defaultUniformStorage,
                                  bool isTransformFeedbackActiveUnpaused,
                                  TransformFeedbackVk *transformFeedbackVk);
     void onProgramBind();
@@ -309,6 +312,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         vk::PipelineProtectedAccess pipelineProtectedAccess,
         std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
 
+    // The pipeline warm up manifest lists the graphics pipelines that draw calls have created with
+    // this program.  It's kept in the blob cache, keyed by the program's SPIR-V.  The next time the
+    // program is linked or loaded, the warm up tasks create the listed pipelines along with the
+    // placeholder one.  This must be called before getPipelineCacheWarmUpTasks() to use the
+    // manifest; it is otherwise ignored.
+    void initPipelineManifest(vk::Renderer *renderer);
+    bool hasPipelineManifestEntries() const { return !mPipelineManifest.empty(); }
+
     void waitForPostLinkTasks(const gl::Context *context) override
     {
         ContextVk *contextVk = vk::GetImpl(context);
@@ -504,10 +515,24 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               vk::PipelineHelper *placeholderPipelineHelper);
     void waitForPostLinkTasksImpl(ContextVk *contextVk);
 
+    angle::Result makeWarmUpRenderPass(vk::ErrorContext *context,
+                                       const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
+                                       vk::RenderPass *renderPassOut);
+    bool isInPipelineManifest(const vk::GraphicsPipelineDesc &desc,
+                              vk::GraphicsPipelineSubset subset) const;
+    void recordPipelineManifestEntry(ContextVk *contextVk, const vk::GraphicsPipelineDesc &desc);
+
+    template <typename CommandBufferT>
+    angle::Result bindDescriptorBuffers(vk::Context *context,
+                                        vk::CommandBufferHelperCommon *commandBufferHelper,
+                                        CommandBufferT *commandBuffer,
+                                        VkPipelineBindPoint pipelineBindPoint,
+                                        vk::DescriptorBufferRing *descriptorBufferStorage);
+
     angle::Result getOrAllocateDescriptorSet(vk::Context *context,
                                              uint32_t currentFrame,
                                              UpdateDescriptorSetsBuilder *updateBuilder,
-                                             const vk::DescriptorSetDescBuilder &descriptorSetDesc,
+                                             vk::DescriptorSetDescBuilder *descriptorSetDesc,
                                              const vk::WriteDescriptorDescs &writeDescriptorDescs,
                                              DescriptorSetIndex setIndex,
                                              vk::SharedDescriptorSetCacheKey *newSharedCacheKeyOut);
@@ -536,7 +561,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     angle::Result updateBuffersDescriptorSet(vk::Context *context,
                                              const uint32_t currentFrame,
-                                             const vk::DescriptorSetDescBuilder &descriptorSetDesc,
+                                             vk::DescriptorSetDescBuilder *descriptorSetDesc,
                                              const vk::WriteDescriptorDescs &writeDescriptorDescs,
                                              const DescriptorSetIndex setIndex,
                                              UpdateDescriptorSetsBuilder *updateBuilder,
@@ -546,6 +571,13 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     angle::PackedEnumBitSet<DescriptorSetIndex, uint8_t> mValidDescriptorSetIndices;
     vk::DescriptorSetArray<vk::DescriptorSetPointer> mDescriptorSets;
     vk::DescriptorSetArray<vk::DynamicDescriptorPoolPointer> mDynamicDescriptorPools;
+    // Used instead of the above with VK_EXT_descriptor_buffer.  Sets with no bindings are left
+    // uninitialized.
+    vk::DescriptorSetArray<vk::DescriptorBufferSet> mDescriptorBufferSets;
+    // Where each set was last copied into the descriptor ring: the serial of the ring buffer and
+    // the offset in it.
+    vk::DescriptorSetArray<vk::BufferSerial> mDescriptorBufferCopySerials;
+    vk::DescriptorSetArray<VkDeviceSize> mDescriptorBufferCopyOffsets;
     vk::BufferSerial mCurrentDefaultUniformBufferSerial;
 
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
@@ -561,8 +593,8 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     ShaderInterfaceVariableInfoMap mVariableInfoMap;
 
-    static_assert((vk::ComputePipelineOptions::kPermutationCount == 4),
-                  "ComputePipelineOptions::kPermutationCount must be 4.");
+    static_assert((vk::ComputePipelineOptions::kPermutationCount == 8),
+                  "ComputePipelineOptions::kPermutationCount must be 8.");
     angle::BitSet8<vk::ComputePipelineOptions::kPermutationCount> mValidComputePermutations;
 
     // We store all permutations of surface rotation and transformed SPIR-V programs here. We may
@@ -605,6 +637,12 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     vk::GraphicsPipelineDesc mWarmUpGraphicsPipelineDesc;
 
+    // The pipeline warm up manifest; see initPipelineManifest().  Draw calls only add to it when
+    // the key is valid.
+    angle::BlobCacheKey mPipelineManifestKey;
+    bool mPipelineManifestKeyValid;
+    std::vector<vk::GraphicsPipelineDesc> mPipelineManifest;
+
     // The "layout" information for descriptorSets
     vk::WriteDescriptorDescs mUniformBuffersWriteDescriptorDescs;
     vk::WriteDescriptorDescs mShaderResourceWriteDescriptorDescs;
@@ -229,6 +229,7 @@ angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
     // - Individual GLES1 tests are long, and this adds a considerable overhead to those tests
     if (!mState.isSeparable() && !mIsGLES1 && getFeatures().warmUpPipelineCacheAtLink.enabled)
     {
+        executableVk->initPipelineManifest(mRenderer);
         ANGLE_TRY(executableVk->getPipelineCacheWarmUpTasks(
             mRenderer, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut));
     }
@@ -358,6 +359,75 @@ void LinkTaskVk::initDefaultUniformLayoutMapping(gl::ShaderMap<sh::BlockLayoutMa
         }
     }
 }
+
+// The program binary includes everything needed to use the program, so the only work left after
+// load is to warm up the pipelines listed in the program's pipeline manifest, if any.
+class LoadTaskVk final : public vk::ErrorContext, public LinkTask
+{
+  public:
+    LoadTaskVk(vk::Renderer *renderer,
+               const gl::ProgramState &state,
+               vk::PipelineRobustness pipelineRobustness,
+               vk::PipelineProtectedAccess pipelineProtectedAccess)
+        : vk::ErrorContext(renderer),
+          mExecutable(&state.getExecutable()),
+          mPipelineRobustness(pipelineRobustness),
+          mPipelineProtectedAccess(pipelineProtectedAccess)
+    {}
+    ~LoadTaskVk() override = default;
+
+    void load(std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
+              std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut) override
+    {
+        ASSERT(linkSubTasksOut && linkSubTasksOut->empty());
+        ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
+
+        ProgramExecutableVk *executableVk = vk::GetImpl(mExecutable);
+
+        executableVk->initPipelineManifest(mRenderer);
+        if (!executableVk->hasPipelineManifestEntries())
+        {
+            return;
+        }
+
+        angle::Result result = executableVk->getPipelineCacheWarmUpTasks(
+            mRenderer, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut);
+        if (result != angle::Result::Continue)
+        {
+            mWarmUpFailed = true;
+        }
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mWarmUpFailed = true;
+    }
+
+    angle::Result getResult(const gl::Context *context, gl::InfoLog &infoLog) override
+    {
+        // The warm up is only an optimization, and the program is usable regardless.
+        if (mWarmUpFailed)
+        {
+            ContextVk *contextVk = vk::GetImpl(context);
+            ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_LOW,
+                               "Failed to warm up the pipelines of a loaded program");
+        }
+
+        return angle::Result::Continue;
+    }
+
+  private:
+    // The front-end ensures that the program is not accessed while loading, so it is safe to
+    // directly access the executable from a potentially parallel job.
+    const gl::ProgramExecutable *mExecutable;
+    const vk::PipelineRobustness mPipelineRobustness;
+    const vk::PipelineProtectedAccess mPipelineProtectedAccess;
+
+    bool mWarmUpFailed = false;
+};
 }  // anonymous namespace
 
 // ProgramVk implementation.
@@ -381,7 +451,21 @@ angle::Result ProgramVk::load(const gl::Context *context,
     // TODO: parallelize program load.  http://anglebug.com/41488637
     *loadTaskOut = {};
 
-    return getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut);
+    ANGLE_TRY(getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut));
+
+    // Like at link, warm up the pipeline cache.  After load, this is only done if the program's
+    // manifest lists the pipelines that are actually used.
+    if (*resultOut == egl::CacheGetResult::Success && !mState.isSeparable() &&
+        !context->getState().isGLES1() &&
+        contextVk->getFeatures().warmUpPipelineCacheAtLink.enabled &&
+        contextVk->getFeatures().warmUpPipelinesFromManifest.enabled)
+    {
+        *loadTaskOut = std::shared_ptr<LinkTask>(
+            new LoadTaskVk(contextVk->getRenderer(), mState, contextVk->pipelineRobustness(),
+                           contextVk->pipelineProtectedAccess()));
+    }
+
+    return angle::Result::Continue;
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
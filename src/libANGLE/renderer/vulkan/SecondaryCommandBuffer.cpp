@@ -35,6 +35,8 @@ const char *GetCommandString(CommandID id)
             return "BeginTransformFeedback";
         case CommandID::BindComputePipeline:
             return "BindComputePipeline";
+        case CommandID::BindDescriptorBuffer:
+            return "BindDescriptorBuffer";
         case CommandID::BindDescriptorSets:
             return "BindDescriptorSets";
         case CommandID::BindGraphicsPipeline:
@@ -149,6 +151,8 @@ const char *GetCommandString(CommandID id)
             return "SetDepthTestEnable";
         case CommandID::SetDepthWriteEnable:
             return "SetDepthWriteEnable";
+        case CommandID::SetDescriptorBufferOffsets:
+            return "SetDescriptorBufferOffsets";
         case CommandID::SetEvent:
             return "SetEvent";
         case CommandID::SetFragmentShadingRate:
@@ -273,6 +277,17 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, params->pipeline);
                     break;
                 }
+                case CommandID::BindDescriptorBuffer:
+                {
+                    const BindDescriptorBufferParams *params =
+                        getParamPtr<BindDescriptorBufferParams>(currentCommand);
+                    VkDescriptorBufferBindingInfoEXT bindingInfo = {};
+                    bindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+                    bindingInfo.address = params->address;
+                    bindingInfo.usage   = params->usage;
+                    vkCmdBindDescriptorBuffersEXT(cmdBuffer, 1, &bindingInfo);
+                    break;
+                }
                 case CommandID::BindDescriptorSets:
                 {
                     const BindDescriptorSetParams *params =
@@ -808,6 +823,21 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdSetDepthWriteEnableEXT(cmdBuffer, params->depthWriteEnable);
                     break;
                 }
+                case CommandID::SetDescriptorBufferOffsets:
+                {
+                    // All sets are in the one descriptor buffer bound by BindDescriptorBuffer.
+                    constexpr uint32_t kBufferIndices[4] = {};
+                    const SetDescriptorBufferOffsetsParams *params =
+                        getParamPtr<SetDescriptorBufferOffsetsParams>(currentCommand);
+                    ASSERT(params->setCount <= 4);
+                    const VkDeviceSize *offsets = GetFirstArrayParameter<VkDeviceSize>(params);
+                    const VkPipelineBindPoint pipelineBindPoint =
+                        static_cast<VkPipelineBindPoint>(params->pipelineBindPoint);
+                    vkCmdSetDescriptorBufferOffsetsEXT(cmdBuffer, pipelineBindPoint,
+                                                       params->layout, params->firstSet,
+                                                       params->setCount, kBufferIndices, offsets);
+                    break;
+                }
                 case CommandID::SetEvent:
                 {
                     const SetEventParams *params = getParamPtr<SetEventParams>(currentCommand);
@@ -988,11 +1018,11 @@ void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
     mCommandAllocator.getMemoryUsageStats(usedMemoryOut, allocatedMemoryOut);
 }
 
-void SecondaryCommandBuffer::getMemoryUsageStatsForPoolAlloc(size_t blockSize,
+void SecondaryCommandBuffer::getMemoryUsageStatsForPoolAlloc(size_t allocatedBytes,
                                                              size_t *usedMemoryOut,
                                                              size_t *allocatedMemoryOut) const
 {
-    *allocatedMemoryOut = blockSize * mCommands.size();
+    *allocatedMemoryOut = allocatedBytes;
 
     *usedMemoryOut = 0;
     for (const CommandHeader *command : mCommands)
@@ -45,6 +45,7 @@ enum class CommandID : uint16_t
     BeginQuery,
     BeginTransformFeedback,
     BindComputePipeline,
+    BindDescriptorBuffer,
     BindDescriptorSets,
     BindGraphicsPipeline,
     BindIndexBuffer,
@@ -102,6 +103,7 @@ enum class CommandID : uint16_t
     SetDepthCompareOp,
     SetDepthTestEnable,
     SetDepthWriteEnable,
+    SetDescriptorBufferOffsets,
     SetEvent,
     SetFragmentShadingRate,
     SetFrontFace,
@@ -156,6 +158,15 @@ struct BeginTransformFeedbackParams
 };
 VERIFY_8_BYTE_ALIGNMENT(BeginTransformFeedbackParams)
 
+struct BindDescriptorBufferParams
+{
+    CommandHeader header;
+
+    VkBufferUsageFlags usage;
+    VkDeviceAddress address;
+};
+VERIFY_8_BYTE_ALIGNMENT(BindDescriptorBufferParams)
+
 struct BindDescriptorSetParams
 {
     CommandHeader header;
@@ -671,6 +682,20 @@ struct SetDepthWriteEnableParams
 };
 VERIFY_8_BYTE_ALIGNMENT(SetDepthWriteEnableParams)
 
+struct SetDescriptorBufferOffsetsParams
+{
+    CommandHeader header;
+
+    // Actually a VkPipelineBindPoint; valid values are GRAPHICS or COMPUTE.
+    uint32_t pipelineBindPoint : 8;
+    uint32_t firstSet : 8;
+    uint32_t setCount : 8;
+    uint32_t padding : 8;
+
+    VkPipelineLayout layout;
+};
+VERIFY_8_BYTE_ALIGNMENT(SetDescriptorBufferOffsetsParams)
+
 struct SetEventParams
 {
     CommandHeader header;
@@ -895,6 +920,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     void bindComputePipeline(const Pipeline &pipeline);
 
+    void bindDescriptorBuffer(VkDeviceAddress address, VkBufferUsageFlags usage);
+
     void bindDescriptorSets(const PipelineLayout &layout,
                             VkPipelineBindPoint pipelineBindPoint,
                             DescriptorSetIndex firstSet,
@@ -1116,6 +1143,11 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     void setDepthCompareOp(VkCompareOp depthCompareOp);
     void setDepthTestEnable(VkBool32 depthTestEnable);
     void setDepthWriteEnable(VkBool32 depthWriteEnable);
+    void setDescriptorBufferOffsets(const PipelineLayout &layout,
+                                    VkPipelineBindPoint pipelineBindPoint,
+                                    DescriptorSetIndex firstSet,
+                                    uint32_t setCount,
+                                    const VkDeviceSize *offsets);
     void setEvent(VkEvent event, VkPipelineStageFlags stageMask);
     void setFragmentShadingRate(const VkExtent2D *fragmentSize,
                                 VkFragmentShadingRateCombinerOpKHR ops[2]);
@@ -1168,9 +1200,14 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     // Calculate memory usage of this command buffer for diagnostics.
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
-    void getMemoryUsageStatsForPoolAlloc(size_t blockSize,
+    void getMemoryUsageStatsForPoolAlloc(size_t allocatedBytes,
                                          size_t *usedMemoryOut,
                                          size_t *allocatedMemoryOut) const;
+    // The number of blocks and bytes the commands were allocated from.
+    void getCommandBlockStats(size_t *blockCountOut, size_t *allocatedBytesOut) const
+    {
+        mCommandAllocator.getBlockStats(blockCountOut, allocatedBytesOut);
+    }
 
     // Traverse the list of commands and build a summary for diagnostics.
     std::string dumpCommands(const char *separator) const;
@@ -1387,6 +1424,15 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindComputePipeline(const Pipeline &pi
     paramStruct->pipeline = pipeline.getHandle();
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorBuffer(VkDeviceAddress address,
+                                                               VkBufferUsageFlags usage)
+{
+    BindDescriptorBufferParams *paramStruct =
+        initCommand<BindDescriptorBufferParams>(CommandID::BindDescriptorBuffer);
+    paramStruct->usage   = usage;
+    paramStruct->address = address;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayout &layout,
                                                              VkPipelineBindPoint pipelineBindPoint,
                                                              DescriptorSetIndex firstSet,
@@ -2204,6 +2250,28 @@ ANGLE_INLINE void SecondaryCommandBuffer::setDepthWriteEnable(VkBool32 depthWrit
     paramStruct->depthWriteEnable = depthWriteEnable;
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::setDescriptorBufferOffsets(
+    const PipelineLayout &layout,
+    VkPipelineBindPoint pipelineBindPoint,
+    DescriptorSetIndex firstSet,
+    uint32_t setCount,
+    const VkDeviceSize *offsets)
+{
+    ASSERT(pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS ||
+           pipelineBindPoint == VK_PIPELINE_BIND_POINT_COMPUTE);
+    const ArrayParamSize offsetSize = calculateArrayParameterSize<VkDeviceSize>(setCount);
+    uint8_t *writePtr;
+    SetDescriptorBufferOffsetsParams *paramStruct =
+        initCommand<SetDescriptorBufferOffsetsParams>(CommandID::SetDescriptorBufferOffsets,
+                                                      offsetSize.allocateBytes, &writePtr);
+    paramStruct->layout = layout.getHandle();
+    SetBitField(paramStruct->pipelineBindPoint, pipelineBindPoint);
+    SetBitField(paramStruct->firstSet, ToUnderlying(firstSet));
+    SetBitField(paramStruct->setCount, setCount);
+    paramStruct->padding = 0;
+    storeArrayParameter(writePtr, offsets, offsetSize);
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::setEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     SetEventParams *paramStruct = initCommand<SetEventParams>(CommandID::SetEvent);
@@ -41,6 +41,39 @@ void SaveShaderInterfaceVariableXfbInfo(const ShaderInterfaceVariableXfbInfo &xf
         SaveShaderInterfaceVariableXfbInfo(arrayElement, stream);
     }
 }
+
+void HashShaderInterfaceVariableXfbInfo(const ShaderInterfaceVariableXfbInfo &xfb,
+                                        angle::BlobCacheHasher *hasher)
+{
+    hasher->Update(&xfb.pod, sizeof(xfb.pod));
+    angle::UpdateHashWithValue(*hasher, xfb.arrayElements.size());
+    for (const ShaderInterfaceVariableXfbInfo &arrayElement : xfb.arrayElements)
+    {
+        HashShaderInterfaceVariableXfbInfo(arrayElement, hasher);
+    }
+}
+
+void HashShaderInterfaceVariableInfo(const ShaderInterfaceVariableInfo &info,
+                                     angle::BlobCacheHasher *hasher)
+{
+    // The fields are hashed one by one, as the bits that the compiler may leave unused between the
+    // bit-fields are not initialized.
+    angle::UpdateHashWithValue(*hasher, info.descriptorSet);
+    angle::UpdateHashWithValue(*hasher, info.binding);
+    angle::UpdateHashWithValue(*hasher, info.location);
+    angle::UpdateHashWithValue(*hasher, info.component);
+    angle::UpdateHashWithValue(*hasher, info.index);
+    angle::UpdateHashWithValue(*hasher, info.activeStages.bits());
+    angle::UpdateHashWithValue(*hasher, info.useRelaxedPrecision);
+    angle::UpdateHashWithValue(*hasher, info.ditherType);
+    angle::UpdateHashWithValue(*hasher, info.varyingIsInput);
+    angle::UpdateHashWithValue(*hasher, info.varyingIsOutput);
+    angle::UpdateHashWithValue(*hasher, info.hasTransformFeedback);
+    angle::UpdateHashWithValue(*hasher, info.isArray);
+    angle::UpdateHashWithValue(*hasher, info.attributeComponentCount);
+    angle::UpdateHashWithValue(*hasher, info.attributeLocationCount);
+    angle::UpdateHashWithValue(*hasher, info.fragmentOutputArraySize);
+}
 }  // anonymous namespace
 
 // ShaderInterfaceVariableInfoMap implementation.
@@ -100,6 +133,42 @@ void ShaderInterfaceVariableInfoMap::save(gl::BinaryOutputStream *stream)
         ASSERT(xfbInfoCount == mPod.xfbInfoCount);
     }
 }
+
+void ShaderInterfaceVariableInfoMap::hashShaderStage(gl::ShaderType shaderType,
+                                                     angle::BlobCacheHasher *hasher) const
+{
+    // Only the variables of this stage are visible to the transformer, so programs that share a
+    // shader produce the same hash for it even if their other stages differ.
+    const IdToIndexMap &idToIndexMap = mIdToIndexMap[shaderType];
+    angle::UpdateHashWithValue(*hasher, idToIndexMap.size());
+    for (const VariableIndex &variableIndex : idToIndexMap)
+    {
+        if (variableIndex.index == VariableIndex::kInvalid)
+        {
+            angle::UpdateHashWithValue(*hasher, VariableIndex::kInvalid);
+            continue;
+        }
+
+        const ShaderInterfaceVariableInfo &info = mData[variableIndex.index];
+        HashShaderInterfaceVariableInfo(info, hasher);
+
+        if (info.hasTransformFeedback)
+        {
+            const XFBInterfaceVariableInfo &xfbInfo = getXFBDataForVariableInfo(&info);
+            HashShaderInterfaceVariableXfbInfo(xfbInfo.xfb, hasher);
+            angle::UpdateHashWithValue(*hasher, xfbInfo.fieldXfb.size());
+            for (const ShaderInterfaceVariableXfbInfo &xfb : xfbInfo.fieldXfb)
+            {
+                HashShaderInterfaceVariableXfbInfo(xfb, hasher);
+            }
+        }
+    }
+
+    angle::UpdateHashWithValue(*hasher, mPod.inputPerVertexActiveMembers[shaderType].bits());
+    angle::UpdateHashWithValue(*hasher, mPod.outputPerVertexActiveMembers[shaderType].bits());
+    angle::UpdateHashWithValue(*hasher, static_cast<bool>(mPod.hasAliasingAttributes));
+}
+
 void ShaderInterfaceVariableInfoMap::load(gl::BinaryInputStream *stream)
 {
     stream->readStruct(&mPod);
@@ -51,6 +51,10 @@ class ShaderInterfaceVariableInfoMap final : angle::NonCopyable
     void load(gl::BinaryInputStream *stream);
     void save(gl::BinaryOutputStream *stream);
 
+    // Hashes the information that the SPIR-V transformer uses when transforming the shader of the
+    // given stage.
+    void hashShaderStage(gl::ShaderType shaderType, angle::BlobCacheHasher *hasher) const;
+
     ShaderInterfaceVariableInfo &add(gl::ShaderType shaderType, uint32_t id);
     void addResource(gl::ShaderBitSet shaderTypes,
                      const gl::ShaderMap<uint32_t> &idInShaderTypes,
@@ -227,8 +227,8 @@ angle::Result ShareGroupVk::scheduleMonolithicPipelineCreationTask(
                                                  &compatibleRenderPass));
     taskOut->setRenderPass(compatibleRenderPass);
 
-    mMonolithicPipelineCreationEvent =
-        mRenderer->getGlobalOps()->postMultiThreadWorkerTask(taskOut->getTask());
+    mMonolithicPipelineCreationEvent = mRenderer->getGlobalOps()->postMultiThreadWorkerTask(
+        taskOut->getTask(), angle::WorkerTaskPriority::BackgroundPipeline);
 
     taskOut->onSchedule(mMonolithicPipelineCreationEvent);
 
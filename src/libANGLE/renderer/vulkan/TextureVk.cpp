@@ -9,8 +9,10 @@
 
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include <vulkan/vulkan.h>
+#include <thread>
 #include "common/unsafe_buffers.h"
 
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "image_util/generatemip.inc"
 #include "libANGLE/Config.h"
@@ -503,6 +505,108 @@ bool GetCompressionFixedRate(VkImageCompressionControlEXT *compressionInfo,
 
     return rtn;
 }
+
+// Mip levels smaller than this (in bytes) are generated on the calling thread, as the cost of
+// posting tasks would outweigh the benefit.
+constexpr size_t kMinMipLevelSizeForParallelGeneration = 256 * 1024;
+// The minimum number of destination rows generated by each task.
+constexpr size_t kMinMipRowsPerTask = 32;
+
+uint32_t MaxMipGenerationTaskCount()
+{
+    static const uint32_t taskCount = std::min(16u, std::thread::hardware_concurrency());
+    return taskCount;
+}
+
+// Generates a band of rows of a 2D mip level.
+class GenerateMipRowsTask final : public angle::Closure
+{
+  public:
+    GenerateMipRowsTask(MipGenerationFunction mipGenerationFunction,
+                        size_t sourceWidth,
+                        size_t sourceHeight,
+                        const uint8_t *sourceData,
+                        size_t sourceRowPitch,
+                        uint8_t *destData,
+                        size_t destRowPitch)
+        : mMipGenerationFunction(mipGenerationFunction),
+          mSourceWidth(sourceWidth),
+          mSourceHeight(sourceHeight),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "GenerateMipRowsTask");
+        const size_t destHeight = std::max<size_t>(1, mSourceHeight >> 1);
+        mMipGenerationFunction(mSourceWidth, mSourceHeight, 1, mSourceData, mSourceRowPitch,
+                               mSourceRowPitch * mSourceHeight, mDestData, mDestRowPitch,
+                               mDestRowPitch * destHeight);
+    }
+
+  private:
+    MipGenerationFunction mMipGenerationFunction;
+    size_t mSourceWidth;
+    size_t mSourceHeight;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+};
+
+// Generates a 2D mip level by splitting it in bands of rows, which are generated in parallel on
+// the worker pool and the calling thread.  Returns false if the level is too small to be worth
+// splitting, in which case nothing is generated.
+bool GenerateMipLevelInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                                MipGenerationFunction mipGenerationFunction,
+                                size_t sourceWidth,
+                                size_t sourceHeight,
+                                const uint8_t *sourceData,
+                                size_t sourceRowPitch,
+                                uint8_t *destData,
+                                size_t destRowPitch)
+{
+    // Each destination row is generated from two source rows, so the level can be split at any
+    // destination row as long as the source has more than one row.
+    const size_t destHeight = sourceHeight >> 1;
+    if (workerPool == nullptr || !workerPool->isAsync() ||
+        destHeight * destRowPitch < kMinMipLevelSizeForParallelGeneration)
+    {
+        return false;
+    }
+
+    const size_t taskCount =
+        std::min<size_t>(MaxMipGenerationTaskCount(), destHeight / kMinMipRowsPerTask);
+    if (taskCount < 2)
+    {
+        return false;
+    }
+
+    const size_t rowsPerTask = (destHeight + taskCount - 1) / taskCount;
+    std::vector<std::shared_ptr<GenerateMipRowsTask>> tasks;
+    for (size_t firstRow = 0; firstRow < destHeight; firstRow += rowsPerTask)
+    {
+        const size_t rowCount = std::min(rowsPerTask, destHeight - firstRow);
+        tasks.push_back(std::make_shared<GenerateMipRowsTask>(
+            mipGenerationFunction, sourceWidth, rowCount * 2,
+            ANGLE_UNSAFE_TODO(sourceData + firstRow * 2 * sourceRowPitch), sourceRowPitch,
+            ANGLE_UNSAFE_TODO(destData + firstRow * destRowPitch), destRowPitch));
+    }
+
+    // The first band is generated on this thread while the others are on the pool.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (size_t taskIndex = 1; taskIndex < tasks.size(); ++taskIndex)
+    {
+        waitEvents.push_back(workerPool->postWorkerTask(tasks[taskIndex]));
+    }
+    (*tasks[0])();
+    angle::WaitableEvent::WaitMany(&waitEvents);
+
+    return true;
+}
 }  // anonymous namespace
 
 // TextureVk implementation.
@@ -2935,6 +3039,11 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
             gl::IsMipmapFiltered(mState.getSamplerState().getMinFilter()));
     }
 
+    if (renderer->getFeatures().forceGenerateMipmapOnCPU.enabled)
+    {
+        return generateMipmapsWithCPU(context);
+    }
+
     // If it's possible to generate mipmap in compute, that would give the best possible
     // performance on some hardware.
     if (CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getActualFormatID(),
@@ -4220,15 +4329,12 @@ vk::BufferHelper *TextureVk::getPossiblyEmulatedTextureBuffer(vk::ErrorContext *
     return &bufferVk->getBuffer();
 }
 
-angle::Result TextureVk::getBufferView(vk::ErrorContext *context,
-                                       const vk::Format *imageUniformFormat,
-                                       const gl::SamplerBinding *samplerBinding,
-                                       bool isImage,
-                                       const vk::BufferView **viewOut,
-                                       VkFormat *viewVkFormatOut)
+const vk::Format *TextureVk::getBufferViewBufferAndFormat(vk::Renderer *renderer,
+                                                          const vk::Format *imageUniformFormat,
+                                                          const gl::SamplerBinding *samplerBinding,
+                                                          bool isImage,
+                                                          const vk::BufferHelper **bufferOut) const
 {
-    vk::Renderer *renderer = context->getRenderer();
-
     ASSERT(mState.getBuffer().get() != nullptr);
 
     // Use the format specified by glTexBuffer if no format specified by the shader.
@@ -4243,11 +4349,12 @@ angle::Result TextureVk::getBufferView(vk::ErrorContext *context,
                                                                    getRequiredFormatSupport());
     }
 
-    const vk::BufferHelper *buffer = &vk::GetImpl(mState.getBuffer().get())->getBuffer();
+    *bufferOut = &vk::GetImpl(mState.getBuffer().get())->getBuffer();
 
     if (NeedsRGBAEmulation(renderer, imageUniformFormat->getIntendedFormatID()))
     {
-        buffer = getRGBAConversionBufferHelper(renderer, imageUniformFormat->getIntendedFormatID());
+        *bufferOut =
+            getRGBAConversionBufferHelper(renderer, imageUniformFormat->getIntendedFormatID());
         imageUniformFormat = &renderer->getFormat(
             GetRGBAEmulationDstFormat(imageUniformFormat->getIntendedFormatID()));
     }
@@ -4258,11 +4365,39 @@ angle::Result TextureVk::getBufferView(vk::ErrorContext *context,
             AdjustViewFormatForSampler(renderer, imageUniformFormat, samplerBinding->format);
     }
 
+    return imageUniformFormat;
+}
+
+angle::Result TextureVk::getBufferView(vk::ErrorContext *context,
+                                       const vk::Format *imageUniformFormat,
+                                       const gl::SamplerBinding *samplerBinding,
+                                       bool isImage,
+                                       const vk::BufferView **viewOut,
+                                       VkFormat *viewVkFormatOut)
+{
+    const vk::BufferHelper *buffer = nullptr;
+    const vk::Format *viewFormat   = getBufferViewBufferAndFormat(
+        context->getRenderer(), imageUniformFormat, samplerBinding, isImage, &buffer);
+
     // Create a view for the required format.
-    return mBufferViews.getView(context, *buffer, buffer->getOffset(), *imageUniformFormat, viewOut,
+    return mBufferViews.getView(context, *buffer, buffer->getOffset(), *viewFormat, viewOut,
                                 viewVkFormatOut);
 }
 
+void TextureVk::getBufferDescriptorAddressInfo(vk::ErrorContext *context,
+                                               const vk::Format *imageUniformFormat,
+                                               const gl::SamplerBinding *samplerBinding,
+                                               bool isImage,
+                                               VkDescriptorAddressInfoEXT *addressInfoOut)
+{
+    const vk::BufferHelper *buffer = nullptr;
+    const vk::Format *viewFormat   = getBufferViewBufferAndFormat(
+        context->getRenderer(), imageUniformFormat, samplerBinding, isImage, &buffer);
+
+    mBufferViews.getDescriptorAddressInfo(context, *buffer, buffer->getOffset(), *viewFormat,
+                                          addressInfoOut);
+}
+
 angle::Result TextureVk::initImage(ContextVk *contextVk,
                                    angle::FormatID intendedImageFormatID,
                                    angle::FormatID actualImageFormatID,
@@ -4708,10 +4843,21 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             gl::OwnerImageIndex::MakeFromType(mState.getType(), currentMipLevel, layer),
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
-        // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        // Generate the mipmap into that new buffer.  Large 2D levels are split across the worker
+        // threads.
+        const bool generatedInParallel =
+            previousLevelDepth == 1 && previousLevelHeight > 1 &&
+            GenerateMipLevelInParallel(contextVk->getImageLoadContext().multiThreadPool,
+                                       sourceFormat.mipGenerationFunction, previousLevelWidth,
+                                       previousLevelHeight, previousLevelData,
+                                       previousLevelRowPitch, destData, destRowPitch);
+        if (!generatedInParallel)
+        {
+            sourceFormat.mipGenerationFunction(previousLevelWidth, previousLevelHeight,
+                                               previousLevelDepth, previousLevelData,
+                                               previousLevelRowPitch, previousLevelDepthPitch,
+                                               destData, destRowPitch, destDepthPitch);
+        }
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
@@ -242,6 +242,12 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
                                 bool isImage,
                                 const vk::BufferView **viewOut,
                                 VkFormat *viewVkFormatOut);
+    // Used instead of getBufferView() with VK_EXT_descriptor_buffer.
+    void getBufferDescriptorAddressInfo(vk::ErrorContext *context,
+                                        const vk::Format *imageUniformFormat,
+                                        const gl::SamplerBinding *samplerBinding,
+                                        bool isImage,
+                                        VkDescriptorAddressInfoEXT *addressInfoOut);
 
     // A special view used for texture copies that shouldn't perform swizzle.
     const vk::ImageView &getCopyImageView() const;
@@ -633,6 +639,13 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
 
     vk::BufferHelper *getRGBAConversionBufferHelper(vk::Renderer *renderer,
                                                     angle::FormatID formatID) const;
+    // Selects the buffer and format a texture buffer is viewed with, taking the format specified in
+    // the shader and RGBA emulation into account.
+    const vk::Format *getBufferViewBufferAndFormat(vk::Renderer *renderer,
+                                                   const vk::Format *imageUniformFormat,
+                                                   const gl::SamplerBinding *samplerBinding,
+                                                   bool isImage,
+                                                   const vk::BufferHelper **bufferOut) const;
     angle::Result convertBufferToRGBA(ContextVk *contextVk, size_t &conversionBufferSize);
     bool isCompressedFormatEmulated(const gl::Context *context,
                                     const gl::TextureTarget target,
@@ -1970,7 +1970,7 @@ angle::Result UtilsVk::setupComputeProgram(
     ANGLE_TRY(programAndPipelines->program.getOrCreateComputePipeline(
         contextVk, &programAndPipelines->pipelines, &pipelineCache, *pipelineLayout,
         vk::GetComputePipelineOptions(contextVk->pipelineRobustness(),
-                                      contextVk->pipelineProtectedAccess()),
+                                      contextVk->pipelineProtectedAccess(), false),
         PipelineSource::Utils, &pipeline, nullptr, nullptr));
     commandBufferHelper->retainResource(pipeline);
 
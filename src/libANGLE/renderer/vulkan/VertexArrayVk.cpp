@@ -10,6 +10,9 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "common/unsafe_buffers.h"
 
+#include <thread>
+
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
@@ -214,6 +217,117 @@ void WarnOnVertexFormatConversion(ContextVk *contextVk, const vk::Format &vertex
         vertexFormat.getActualBufferFormat().glInternalFormat);
 }
 
+// Conversions that write less than this (in bytes) are done on the calling thread, as the cost of
+// posting tasks would outweigh the benefit.
+constexpr size_t kMinVertexConversionSizeForParallelism = 256 * 1024;
+// The minimum number of vertices converted by each task.
+constexpr size_t kMinVerticesPerConversionTask = 4096;
+
+uint32_t MaxVertexConversionTaskCount()
+{
+    static const uint32_t taskCount = std::min(16u, std::thread::hardware_concurrency());
+    return taskCount;
+}
+
+// A run of consecutive vertices converted with a VertexCopyFunction.
+struct VertexConversionRange
+{
+    const uint8_t *src;
+    uint8_t *dst;
+    size_t vertexCount;
+};
+
+// Converts a list of vertex ranges.  Used to split a large conversion across the worker threads.
+class ConvertVertexRangesTask final : public angle::Closure
+{
+  public:
+    ConvertVertexRangesTask(VertexCopyFunction vertexLoadFunction, size_t srcStride)
+        : mVertexLoadFunction(vertexLoadFunction), mSrcStride(srcStride)
+    {}
+
+    void addRange(const VertexConversionRange &range) { mRanges.push_back(range); }
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ConvertVertexRangesTask");
+        for (const VertexConversionRange &range : mRanges)
+        {
+            mVertexLoadFunction(range.src, mSrcStride, range.vertexCount, range.dst);
+        }
+    }
+
+  private:
+    VertexCopyFunction mVertexLoadFunction;
+    size_t mSrcStride;
+    std::vector<VertexConversionRange> mRanges;
+};
+
+// Converts |ranges|, whose destinations must not overlap.  When there is enough work, the vertices
+// are split in equal parts that are converted in parallel on the worker pool and the calling
+// thread; the conversion functions never write outside of the vertices they are given.
+void ConvertVertexRanges(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                         VertexCopyFunction vertexLoadFunction,
+                         size_t srcStride,
+                         size_t dstStride,
+                         const std::vector<VertexConversionRange> &ranges)
+{
+    size_t totalVertexCount = 0;
+    for (const VertexConversionRange &range : ranges)
+    {
+        totalVertexCount += range.vertexCount;
+    }
+
+    const size_t taskCount =
+        workerPool != nullptr && workerPool->isAsync() &&
+                totalVertexCount * dstStride >= kMinVertexConversionSizeForParallelism
+            ? std::min<size_t>(MaxVertexConversionTaskCount(),
+                               totalVertexCount / kMinVerticesPerConversionTask)
+            : 1;
+    if (taskCount < 2)
+    {
+        for (const VertexConversionRange &range : ranges)
+        {
+            vertexLoadFunction(range.src, srcStride, range.vertexCount, range.dst);
+        }
+        return;
+    }
+
+    // Deal the ranges out to the tasks, splitting them where a task is full.
+    const size_t verticesPerTask = (totalVertexCount + taskCount - 1) / taskCount;
+    std::vector<std::shared_ptr<ConvertVertexRangesTask>> tasks;
+    size_t taskVertexCount = verticesPerTask;
+    for (VertexConversionRange range : ranges)
+    {
+        while (range.vertexCount > 0)
+        {
+            if (taskVertexCount == verticesPerTask)
+            {
+                tasks.push_back(
+                    std::make_shared<ConvertVertexRangesTask>(vertexLoadFunction, srcStride));
+                taskVertexCount = 0;
+            }
+
+            VertexConversionRange part = range;
+            part.vertexCount = std::min(range.vertexCount, verticesPerTask - taskVertexCount);
+            tasks.back()->addRange(part);
+            taskVertexCount += part.vertexCount;
+
+            range.src = ANGLE_UNSAFE_TODO(range.src + part.vertexCount * srcStride);
+            range.dst = ANGLE_UNSAFE_TODO(range.dst + part.vertexCount * dstStride);
+            range.vertexCount -= part.vertexCount;
+        }
+    }
+
+    // The first part is converted on this thread while the others are on the pool.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (size_t taskIndex = 1; taskIndex < tasks.size(); ++taskIndex)
+    {
+        waitEvents.push_back(workerPool->postWorkerTask(tasks[taskIndex]));
+    }
+    (*tasks[0])();
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
+
 angle::Result StreamVertexData(ContextVk *contextVk,
                                vk::BufferHelper *dstBufferHelper,
                                const uint8_t *srcData,
@@ -870,16 +984,18 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
 
     uint8_t *src = nullptr;
     ANGLE_TRY(srcBuffer->mapForReadAccessOnly(contextVk, reinterpret_cast<void **>(&src)));
-    uint32_t srcStride      = conversion->getCacheKey().stride;
+    uint32_t srcStride = conversion->getCacheKey().stride;
+
+    vk::BufferHelper *dstBuffer = conversion->getBuffer();
+    uint8_t *dst                = dstBuffer->getMappedMemory();
 
+    // Gather the ranges to convert so they can all be converted in one pass, split across the
+    // worker threads if large enough, followed by a single flush.
+    std::vector<VertexConversionRange> ranges;
     if (conversion->isEntireBufferDirty())
     {
-        size_t srcOffset        = conversion->getCacheKey().offset;
-        size_t dstOffset        = 0;
-        const uint8_t *srcBytes = ANGLE_UNSAFE_TODO(src + srcOffset);
-        size_t bytesToCopy      = maxNumVertices * dstFormat.pixelBytes;
-        ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes, bytesToCopy,
-                                   dstOffset, maxNumVertices, srcStride, vertexLoadFunction));
+        size_t srcOffset = conversion->getCacheKey().offset;
+        ranges.push_back({ANGLE_UNSAFE_TODO(src + srcOffset), dst, maxNumVertices});
     }
     else
     {
@@ -888,6 +1004,7 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
         conversion->consolidateDirtyRanges();
 
         const std::vector<RangeDeviceSize> &dirtyRanges = conversion->getDirtyBufferRanges();
+        size_t rangeEndVertex                           = 0;
         for (const RangeDeviceSize &dirtyRange : dirtyRanges)
         {
             if (dirtyRange.empty())
@@ -896,26 +1013,42 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
                 continue;
             }
 
-            // Use numVertices instead of maxNumVertices to calculate bytesToCopy to avoid buffer
-            // overrun.
+            // Use numVertices instead of maxNumVertices to avoid buffer overrun.
             uint32_t srcOffset, dstOffset, numVertices;
             ANGLE_TRY(CalculateOffsetAndVertexCountForDirtyRange(
                 contextVk, srcBuffer, conversion, srcFormat, dstFormat, dirtyRange, &srcOffset,
                 &dstOffset, &numVertices));
             ASSERT(numVertices <= maxNumVertices);
 
-            if (numVertices > 0)
+            if (numVertices == 0)
             {
-                const uint8_t *srcBytes = ANGLE_UNSAFE_TODO(src + srcOffset);
+                continue;
+            }
 
-                size_t bytesToCopy = numVertices * dstFormat.pixelBytes;
-                ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes,
-                                           bytesToCopy, dstOffset, numVertices, srcStride,
-                                           vertexLoadFunction));
+            // The dirty ranges are sorted and disjoint, but neighbors may still share a vertex.
+            // Coalesce ranges that overlap or touch in vertices, so that every vertex is converted
+            // once and the ranges can be converted concurrently.
+            const size_t firstVertex = dstOffset / dstFormat.pixelBytes;
+            if (!ranges.empty() && firstVertex <= rangeEndVertex)
+            {
+                const size_t endVertex =
+                    std::max<size_t>(rangeEndVertex, firstVertex + numVertices);
+                ranges.back().vertexCount += endVertex - rangeEndVertex;
+                rangeEndVertex = endVertex;
+                continue;
             }
+
+            ranges.push_back({ANGLE_UNSAFE_TODO(src + srcOffset),
+                              ANGLE_UNSAFE_TODO(dst + dstOffset), numVertices});
+            rangeEndVertex = firstVertex + numVertices;
         }
     }
 
+    ASSERT(vertexLoadFunction != nullptr);
+    ConvertVertexRanges(contextVk->getImageLoadContext().multiThreadPool, vertexLoadFunction,
+                        srcStride, dstFormat.pixelBytes, ranges);
+    ANGLE_TRY(dstBuffer->flush(contextVk->getRenderer()));
+
     conversion->clearDirty();
     ANGLE_TRY(srcBuffer->unmapReadAccessOnly(contextVk));
 
@@ -6203,4 +6203,97 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
 
     return angle::Result::Continue;
 }
+
+SpvTransformCache::SpvTransformCache(size_t maxSize)
+    : mCache(maxSize), mHitCount(0), mMissCount(0)
+{}
+
+SpvTransformCache::~SpvTransformCache() = default;
+
+angle::Result SpvTransformCache::transformSpirvCode(
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const spirv::Blob &initialSpirvBlob,
+    SharedBlob *spirvBlobOut)
+{
+    const angle::BlobCacheKey key = GetKey(options, variableInfoMap, initialSpirvBlob);
+
+    {
+        std::unique_lock<angle::SimpleMutex> lock(mMutex);
+        const SharedBlob *cachedBlob = nullptr;
+        if (mCache.get(key, &cachedBlob))
+        {
+            ++mHitCount;
+            *spirvBlobOut = *cachedBlob;
+            return angle::Result::Continue;
+        }
+        ++mMissCount;
+    }
+
+    // Transform without holding the lock.  If another thread transforms the same shader meanwhile,
+    // the results are identical and either may be kept.
+    auto transformedSpirvBlob = std::make_shared<spirv::Blob>();
+    ANGLE_TRY(SpvTransformSpirvCode(options, variableInfoMap, initialSpirvBlob,
+                                    transformedSpirvBlob.get()));
+    *spirvBlobOut = transformedSpirvBlob;
+
+    const size_t blobSize = transformedSpirvBlob->size() * sizeof(uint32_t);
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    mCache.put(key, std::move(transformedSpirvBlob), blobSize);
+
+    return angle::Result::Continue;
+}
+
+// static
+angle::BlobCacheKey SpvTransformCache::GetKey(const SpvTransformOptions &options,
+                                              const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                              const spirv::Blob &initialSpirvBlob)
+{
+    // The options are hashed field by field as the struct may contain padding.
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+    hasher.Update(initialSpirvBlob.data(), initialSpirvBlob.size() * sizeof(uint32_t));
+    angle::UpdateHashWithValue(hasher, options.shaderType);
+    angle::UpdateHashWithValue(hasher, options.isLastPreFragmentStage);
+    angle::UpdateHashWithValue(hasher, options.isTransformFeedbackStage);
+    angle::UpdateHashWithValue(hasher, options.isTransformFeedbackEmulated);
+    angle::UpdateHashWithValue(hasher, options.isMultisampledFramebufferFetch);
+    angle::UpdateHashWithValue(hasher, options.enableSampleShading);
+    angle::UpdateHashWithValue(hasher, options.validate);
+    angle::UpdateHashWithValue(hasher, options.useSpirvVaryingPrecisionFixer);
+    angle::UpdateHashWithValue(hasher, options.removeDepthInput);
+    angle::UpdateHashWithValue(hasher, options.removeStencilInput);
+    angle::UpdateHashWithValue(hasher, options.roundOutputAfterDithering);
+    angle::UpdateHashWithValue(hasher, options.ditherControl);
+    variableInfoMap.hashShaderStage(options.shaderType, &hasher);
+    hasher.Final();
+
+    angle::BlobCacheKey key;
+    ANGLE_UNSAFE_TODO(memcpy(key.data(), hasher.Digest(), key.size()));
+    return key;
+}
+
+void SpvTransformCache::clear()
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    mCache.clear();
+}
+
+uint64_t SpvTransformCache::getHitCount() const
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    return mHitCount;
+}
+
+uint64_t SpvTransformCache::getMissCount() const
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    return mMissCount;
+}
+
+size_t SpvTransformCache::getSize() const
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    return mCache.size();
+}
 }  // namespace rx
@@ -11,8 +11,11 @@
 #define LIBANGLE_RENDERER_VULKAN_SPV_UTILS_H_
 
 #include <functional>
+#include <memory>
 
+#include "common/SimpleMutex.h"
 #include "common/spirv/spirv_types.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "platform/autogen/FeaturesVk_autogen.h"
@@ -202,6 +205,43 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
                                     const angle::spirv::Blob &initialSpirvBlob,
                                     angle::spirv::Blob *spirvBlobOut);
 
+// Caches the results of SpvTransformSpirvCode by the contents of its inputs.  Programs that share a
+// shader typically transform it with the same options and interface variables, and can share the
+// result instead of repeating the transformation.  The least recently used results are evicted
+// when the cache grows beyond its maximum size.  May be used from multiple threads.
+class SpvTransformCache final : angle::NonCopyable
+{
+  public:
+    using SharedBlob = std::shared_ptr<const angle::spirv::Blob>;
+
+    explicit SpvTransformCache(size_t maxSize);
+    ~SpvTransformCache();
+
+    angle::Result transformSpirvCode(const SpvTransformOptions &options,
+                                     const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                     const angle::spirv::Blob &initialSpirvBlob,
+                                     SharedBlob *spirvBlobOut);
+
+    // Returns the key that the result of the transformation is cached with.  It covers everything
+    // the transformation depends on.
+    static angle::BlobCacheKey GetKey(const SpvTransformOptions &options,
+                                      const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                      const angle::spirv::Blob &initialSpirvBlob);
+
+    void clear();
+
+    uint64_t getHitCount() const;
+    uint64_t getMissCount() const;
+    // Returns the total size of the cached blobs in bytes.
+    size_t getSize() const;
+
+  private:
+    mutable angle::SimpleMutex mMutex;
+    angle::SizedMRUCache<angle::BlobCacheKey, SharedBlob> mCache;
+    uint64_t mHitCount;
+    uint64_t mMissCount;
+};
+
 }  // namespace rx
 
 #endif  // LIBANGLE_RENDERER_VULKAN_SPV_UTILS_H_
@@ -2757,6 +2757,17 @@ bool ShouldDumpPipelineCacheGraph(ErrorContext *context)
 {
     return kDumpPipelineCacheGraph && context->getRenderer()->isPipelineCacheGraphDumpEnabled();
 }
+
+// The hash of a DescriptorSetDesc is the XOR of the hashes of its descriptor infos, each seeded
+// with its index so that the same info in different bindings hashes differently.
+size_t HashDescriptorInfoDesc(uint32_t infoDescIndex, const DescriptorInfoDesc &infoDesc)
+{
+#if defined(ANGLE_IS_64_BIT_CPU)
+    return XXH3_64bits_withSeed(&infoDesc, sizeof(infoDesc), infoDescIndex);
+#else
+    return XXH32(&infoDesc, sizeof(infoDesc), infoDescIndex);
+#endif  // defined(ANGLE_IS_64_BIT_CPU)
+}
 }  // anonymous namespace
 
 FramebufferFetchMode GetProgramFramebufferFetchMode(const gl::ProgramExecutable *executable)
@@ -3485,6 +3496,27 @@ void GraphicsPipelineDesc::initDefaults(const ErrorContext *context,
     mVertexInput.inputAssembly.bits.isProtectedContext = mShaders.shaders.bits.isProtectedContext =
         mFragmentOutput.blendMaskAndLogic.bits.isProtectedContext =
             pipelineProtectedAccess == PipelineProtectedAccess::Protected;
+
+    // Descriptor buffer usage is set separately by setUsesDescriptorBuffer().
+    mVertexInput.inputAssembly.bits.usesDescriptorBuffer =
+        mShaders.shaders.bits.usesDescriptorBuffer =
+            mFragmentOutput.blendMaskAndLogic.bits.usesDescriptorBuffer = 0;
+}
+
+void GraphicsPipelineDesc::setUsesDescriptorBuffer(GraphicsPipelineSubset subset)
+{
+    if (GraphicsPipelineHasVertexInput(subset))
+    {
+        mVertexInput.inputAssembly.bits.usesDescriptorBuffer = 1;
+    }
+    if (GraphicsPipelineHasShaders(subset))
+    {
+        mShaders.shaders.bits.usesDescriptorBuffer = 1;
+    }
+    if (GraphicsPipelineHasFragmentOutput(subset))
+    {
+        mFragmentOutput.blendMaskAndLogic.bits.usesDescriptorBuffer = 1;
+    }
 }
 
 VkResult GraphicsPipelineDesc::initializePipeline(ErrorContext *context,
@@ -3633,6 +3665,14 @@ VkResult GraphicsPipelineDesc::initializePipeline(ErrorContext *context,
         createInfo.flags |= VK_PIPELINE_CREATE_NO_PROTECTED_ACCESS_BIT_EXT;
     }
 
+    if ((hasVertexInput && mVertexInput.inputAssembly.bits.usesDescriptorBuffer) ||
+        (hasShaders && mShaders.shaders.bits.usesDescriptorBuffer) ||
+        (hasFragmentOutput && mFragmentOutput.blendMaskAndLogic.bits.usesDescriptorBuffer))
+    {
+        ASSERT(context->getFeatures().supportsDescriptorBuffer.enabled);
+        createInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+
     VkPipelineCreationFeedback feedback = {};
     gl::ShaderMap<VkPipelineCreationFeedback> perStageFeedback;
 
@@ -4995,12 +5035,13 @@ size_t DescriptorSetLayoutDesc::hash() const
         genericHash ^= angle::ComputeGenericHash(angle::as_byte_span(mImmutableSamplers));
     }
 
-    return genericHash;
+    return genericHash ^ mCreateFlags;
 }
 
 bool DescriptorSetLayoutDesc::operator==(const DescriptorSetLayoutDesc &other) const
 {
-    return mDescriptorSetLayoutBindings == other.mDescriptorSetLayoutBindings &&
+    return mCreateFlags == other.mCreateFlags &&
+           mDescriptorSetLayoutBindings == other.mDescriptorSetLayoutBindings &&
            mImmutableSamplers == other.mImmutableSamplers;
 }
 
@@ -5304,11 +5345,33 @@ void PipelineHelper::retainInRenderPass(RenderPassCommandBufferHelper *renderPas
 // DescriptorSetDesc implementation.
 size_t DescriptorSetDesc::hash() const
 {
-    if (mDescriptorInfos.empty())
+    if (!mIsHashValid)
     {
-        return 0;
+        mHash = 0;
+        for (uint32_t infoDescIndex = 0; infoDescIndex < mDescriptorInfos.size(); ++infoDescIndex)
+        {
+            mHash ^= HashDescriptorInfoDesc(infoDescIndex, mDescriptorInfos[infoDescIndex]);
+        }
+        mIsHashValid = true;
     }
-    return angle::ComputeGenericHash(angle::as_byte_span(mDescriptorInfos));
+    return mHash;
+}
+
+bool DescriptorSetDesc::updateInfoDesc(uint32_t infoDescIndex, const DescriptorInfoDesc &infoDesc)
+{
+    DescriptorInfoDesc &currentInfoDesc = mDescriptorInfos[infoDescIndex];
+    if (memcmp(&currentInfoDesc, &infoDesc, sizeof(DescriptorInfoDesc)) == 0)
+    {
+        return false;
+    }
+
+    if (mIsHashValid)
+    {
+        mHash ^= HashDescriptorInfoDesc(infoDescIndex, currentInfoDesc) ^
+                 HashDescriptorInfoDesc(infoDescIndex, infoDesc);
+    }
+    currentInfoDesc = infoDesc;
+    return true;
 }
 
 // FramebufferDesc implementation.
@@ -6239,8 +6302,8 @@ bool DescriptorSetDescAndPool::hasValidCachedObject(ContextVk *contextVk) const
 }
 
 // DescriptorSetDescBuilder implementation.
-DescriptorSetDescBuilder::DescriptorSetDescBuilder() = default;
-DescriptorSetDescBuilder::DescriptorSetDescBuilder(size_t descriptorCount)
+DescriptorSetDescBuilder::DescriptorSetDescBuilder() : mIsDescChanged(true) {}
+DescriptorSetDescBuilder::DescriptorSetDescBuilder(size_t descriptorCount) : mIsDescChanged(true)
 {
     resize(descriptorCount);
 }
@@ -6248,7 +6311,10 @@ DescriptorSetDescBuilder::DescriptorSetDescBuilder(size_t descriptorCount)
 DescriptorSetDescBuilder::~DescriptorSetDescBuilder() {}
 
 DescriptorSetDescBuilder::DescriptorSetDescBuilder(const DescriptorSetDescBuilder &other)
-    : mDesc(other.mDesc), mHandles(other.mHandles), mDynamicOffsets(other.mDynamicOffsets)
+    : mDesc(other.mDesc),
+      mHandles(other.mHandles),
+      mDynamicOffsets(other.mDynamicOffsets),
+      mIsDescChanged(true)
 {}
 
 DescriptorSetDescBuilder &DescriptorSetDescBuilder::operator=(const DescriptorSetDescBuilder &other)
@@ -6256,6 +6322,7 @@ DescriptorSetDescBuilder &DescriptorSetDescBuilder::operator=(const DescriptorSe
     mDesc           = other.mDesc;
     mHandles        = other.mHandles;
     mDynamicOffsets = other.mDynamicOffsets;
+    mIsDescChanged  = true;
     return *this;
 }
 
@@ -6264,13 +6331,12 @@ void DescriptorSetDescBuilder::updateUniformBuffer(uint32_t bindingIndex,
                                                    const BufferHelper &bufferHelper,
                                                    VkDeviceSize bufferRange)
 {
-    uint32_t infoIndex           = writeDescriptorDescs[bindingIndex].descriptorInfoIndex;
-    DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoIndex);
+    uint32_t infoIndex = writeDescriptorDescs[bindingIndex].descriptorInfoIndex;
 
+    DescriptorInfoDesc infoDesc                   = {};
     infoDesc.samplerOrBufferSerialOrStorageFormat = bufferHelper.getBlockSerial().getValue();
-    infoDesc.imageViewSerialOrOffset              = 0;
     SetBitField(infoDesc.imageLayoutOrRange, bufferRange);
-    infoDesc.imageSubresourceRange = 0;
+    updateInfoDesc(infoIndex, infoDesc);
 
     mHandles[infoIndex].buffer = bufferHelper.getBuffer().getHandle();
 }
@@ -6294,7 +6360,7 @@ void DescriptorSetDescBuilder::updateTransformFeedbackBuffer(
     VkDeviceSize adjustedRange = bufferRange + (bufferOffset - alignedOffset);
 
     uint32_t infoIndex = writeDescriptorDescs[baseBinding].descriptorInfoIndex + xfbBufferIndex;
-    DescriptorInfoDesc &infoDesc                  = mDesc.getInfoDesc(infoIndex);
+    DescriptorInfoDesc &infoDesc                  = getMutableInfoDesc(infoIndex);
     infoDesc.samplerOrBufferSerialOrStorageFormat = bufferHelper.getBufferSerial().getValue();
     SetBitField(infoDesc.imageViewSerialOrOffset, alignedOffset);
     SetBitField(infoDesc.imageLayoutOrRange, adjustedRange);
@@ -6386,16 +6452,13 @@ void DescriptorSetDescBuilder::updatePreCacheActiveTextures(
 
             uint32_t infoIndex = writeDescriptorDescs[info.binding].descriptorInfoIndex +
                                  arrayElement + samplerUniform.getOuterArrayOffset();
-            DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoIndex);
+            DescriptorInfoDesc infoDesc = {};
 
             if (textureVk->getState().getType() == gl::TextureType::Buffer)
             {
                 ImageOrBufferViewSubresourceSerial imageViewSerial =
                     textureVk->getBufferViewSerial();
                 infoDesc.imageViewSerialOrOffset = imageViewSerial.viewSerial.getValue();
-                infoDesc.imageLayoutOrRange      = 0;
-                infoDesc.samplerOrBufferSerialOrStorageFormat = 0;
-                infoDesc.imageSubresourceRange                = 0;
             }
             else
             {
@@ -6420,6 +6483,10 @@ void DescriptorSetDescBuilder::updatePreCacheActiveTextures(
                 memcpy(&infoDesc.imageSubresourceRange, &imageViewSerial.subresource,
                        sizeof(uint32_t));
             }
+
+            // Only the bindings whose texture or sampler actually changed affect the hash of the
+            // desc, and if none did, the current descriptor set is used again.
+            updateInfoDesc(infoIndex, infoDesc);
         }
     }
 }
@@ -6428,10 +6495,11 @@ void DescriptorSetDescBuilder::setEmptyBuffer(uint32_t infoDescIndex,
                                               VkDescriptorType descriptorType,
                                               const BufferHelper &emptyBuffer)
 {
-    DescriptorInfoDesc &emptyDesc = mDesc.getInfoDesc(infoDescIndex);
+    DescriptorInfoDesc emptyDesc = mDesc.getInfoDescs()[infoDescIndex];
     SetBitField(emptyDesc.imageLayoutOrRange, emptyBuffer.getSize());
     emptyDesc.imageViewSerialOrOffset              = 0;
     emptyDesc.samplerOrBufferSerialOrStorageFormat = emptyBuffer.getBlockSerial().getValue();
+    updateInfoDesc(infoDescIndex, emptyDesc);
 
     mHandles[infoDescIndex].buffer = emptyBuffer.getBuffer().getHandle();
 
@@ -6466,19 +6534,18 @@ void DescriptorSetDescBuilder::updateOneShaderBuffer(
     BufferHelper &bufferHelper = bufferVk->getBuffer();
     VkDeviceSize offset        = bufferBinding.getOffset() + bufferHelper.getOffset();
 
-    DescriptorInfoDesc &infoDesc                  = mDesc.getInfoDesc(infoDescIndex);
+    DescriptorInfoDesc infoDesc                   = {};
     infoDesc.samplerOrBufferSerialOrStorageFormat = bufferHelper.getBlockSerial().getValue();
     if (IsDynamicDescriptor(descriptorType))
     {
         SetBitField(mDynamicOffsets[infoDescIndex], offset);
-        infoDesc.imageViewSerialOrOffset = 0;
     }
     else
     {
         SetBitField(infoDesc.imageViewSerialOrOffset, offset);
     }
     SetBitField(infoDesc.imageLayoutOrRange, size);
-    infoDesc.imageSubresourceRange = 0;
+    updateInfoDesc(infoDescIndex, infoDesc);
 
     mHandles[infoDescIndex].buffer = bufferHelper.getBuffer().getHandle();
 }
@@ -6524,8 +6591,8 @@ void DescriptorSetDescBuilder::updateOneUniformBufferOffset(
     ASSERT(infoDescIndex != kInvalidDescriptorDescIndex && infoDescIndex < mDesc.size());
     ASSERT(bufferBinding.get() != nullptr);
 
-    DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoDescIndex);
-    BufferHelper &bufferHelper   = vk::GetImpl(bufferBinding.get())->getBuffer();
+    const DescriptorInfoDesc &infoDesc = mDesc.getInfoDescs()[infoDescIndex];
+    BufferHelper &bufferHelper         = vk::GetImpl(bufferBinding.get())->getBuffer();
     ASSERT(infoDesc.samplerOrBufferSerialOrStorageFormat ==
            bufferHelper.getBlockSerial().getValue());
     // Reachable only by program executables with dynamic descriptor type
@@ -6682,7 +6749,7 @@ void DescriptorSetDescBuilder::updateAtomicCounters(
 
         VkDeviceSize range = gl::GetBoundBufferAvailableSize(bufferBinding) + offsetDiff;
 
-        DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoIndex);
+        DescriptorInfoDesc &infoDesc = getMutableInfoDesc(infoIndex);
         SetBitField(infoDesc.imageLayoutOrRange, range);
         SetBitField(infoDesc.imageViewSerialOrOffset, offset);
         infoDesc.samplerOrBufferSerialOrStorageFormat = bufferHelper.getBlockSerial().getValue();
@@ -6749,12 +6816,29 @@ angle::Result DescriptorSetDescBuilder::updateImages(
                 uint32_t infoIndex = writeDescriptorDescs[info.binding].descriptorInfoIndex +
                                      arrayElement + imageUniform.getOuterArrayOffset();
 
+                if (renderer->getFeatures().supportsDescriptorBuffer.enabled)
+                {
+                    // With descriptor buffers, the descriptor is written from the buffer address,
+                    // which is stored in place of the unused fields.
+                    VkDescriptorAddressInfoEXT addressInfo;
+                    textureVk->getBufferDescriptorAddressInfo(contextVk, format, nullptr, true,
+                                                              &addressInfo);
+
+                    DescriptorInfoDesc &infoDesc = getMutableInfoDesc(infoIndex);
+                    infoDesc.imageViewSerialOrOffset =
+                        textureVk->getBufferViewSerial().viewSerial.getValue();
+                    infoDesc.samplerOrBufferSerialOrStorageFormat = addressInfo.address;
+                    SetBitField(infoDesc.imageLayoutOrRange, addressInfo.range);
+                    infoDesc.imageSubresourceRange = static_cast<uint32_t>(addressInfo.format);
+                    continue;
+                }
+
                 const vk::BufferView *view = nullptr;
                 VkFormat viewFormat;
                 ANGLE_TRY(
                     textureVk->getBufferView(contextVk, format, nullptr, true, &view, &viewFormat));
 
-                DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoIndex);
+                DescriptorInfoDesc &infoDesc = getMutableInfoDesc(infoIndex);
                 infoDesc.imageViewSerialOrOffset =
                     textureVk->getBufferViewSerial().viewSerial.getValue();
                 infoDesc.imageLayoutOrRange = 0;
@@ -6779,7 +6863,7 @@ angle::Result DescriptorSetDescBuilder::updateImages(
 
                 if (!textureVk)
                 {
-                    DescriptorInfoDesc &nullInfoDesc = mDesc.getInfoDesc(infoIndex);
+                    DescriptorInfoDesc &nullInfoDesc = getMutableInfoDesc(infoIndex);
                     SetBitField(nullInfoDesc.imageLayoutOrRange, VK_IMAGE_LAYOUT_GENERAL);
                     nullInfoDesc.imageSubresourceRange = 0;
 
@@ -6810,7 +6894,7 @@ angle::Result DescriptorSetDescBuilder::updateImages(
 
                 // Note: binding.access is unused because it is implied by the shader.
 
-                DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoIndex);
+                DescriptorInfoDesc &infoDesc = getMutableInfoDesc(infoIndex);
                 SetBitField(infoDesc.imageLayoutOrRange, image->getCurrentLayout(renderer));
                 memcpy(&infoDesc.imageSubresourceRange, &serial.subresource, sizeof(uint32_t));
                 infoDesc.imageViewSerialOrOffset = serial.viewSerial.getValue();
@@ -6952,7 +7036,7 @@ void DescriptorSetDescBuilder::updateInputAttachment(
 {
     uint32_t infoIndex = writeDescriptorDescs[binding].descriptorInfoIndex;
 
-    DescriptorInfoDesc &infoDesc = mDesc.getInfoDesc(infoIndex);
+    DescriptorInfoDesc &infoDesc = getMutableInfoDesc(infoIndex);
 
     // The serial is not totally precise.
     SetBitField(infoDesc.imageLayoutOrRange, layout);
@@ -8233,6 +8317,12 @@ angle::Result ComputePipelineCache::createPipeline(vk::ErrorContext *context,
         createInfo.flags |= VK_PIPELINE_CREATE_NO_PROTECTED_ACCESS_BIT_EXT;
     }
 
+    if (pipelineOptions.descriptorBuffer != 0)
+    {
+        ASSERT(context->getFeatures().supportsDescriptorBuffer.enabled);
+        createInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+
     VkPipelineCreationFeedback feedback               = {};
     VkPipelineCreationFeedback perStageFeedback       = {};
     VkPipelineCreationFeedbackCreateInfo feedbackInfo = {};
@@ -8494,7 +8584,7 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
     }
 
     // If DescriptorSetLayoutDesc is empty, reuse placeholder descriptor set layout handle
-    if (desc.empty())
+    if (desc.empty() && !desc.usesDescriptorBuffer())
     {
         *descriptorSetLayoutOut = context->getRenderer()->getEmptyDescriptorLayout();
         return angle::Result::Continue;
@@ -8505,9 +8595,21 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
     vk::DescriptorSetLayoutBindingVector bindingVector;
     desc.unpackBindings(&bindingVector);
 
+    VkDescriptorSetLayoutCreateFlags flags = 0;
+    if (desc.usesDescriptorBuffer())
+    {
+        // Dynamic descriptors don't exist with descriptor buffers.  The dynamic offset is instead
+        // folded into the descriptor when it's written into the descriptor buffer.
+        flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        for (VkDescriptorSetLayoutBinding &binding : bindingVector)
+        {
+            binding.descriptorType = vk::GetNonDynamicDescriptorType(binding.descriptorType);
+        }
+    }
+
     VkDescriptorSetLayoutCreateInfo createInfo = {};
     createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    createInfo.flags        = 0;
+    createInfo.flags        = flags;
     createInfo.bindingCount = static_cast<uint32_t>(bindingVector.size());
     createInfo.pBindings    = bindingVector.data();
 
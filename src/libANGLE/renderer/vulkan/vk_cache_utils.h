@@ -556,11 +556,13 @@ struct PackedInputAssemblyState final
         uint32_t isRobustContext : 1;
         // Whether the pipeline needs access to protected content (vertex input copy)
         uint32_t isProtectedContext : 1;
+        // Whether the pipeline binds resources through descriptor buffers (vertex input copy)
+        uint32_t usesDescriptorBuffer : 1;
 
         // Which attributes are actually active in the program and should affect the pipeline.
         uint32_t programActiveAttributeLocations : gl::MAX_VERTEX_ATTRIBS;
 
-        uint32_t padding : 23 - gl::MAX_VERTEX_ATTRIBS;
+        uint32_t padding : 22 - gl::MAX_VERTEX_ATTRIBS;
     } bits;
 };
 
@@ -612,8 +614,8 @@ struct PackedPreRasterizationAndFragmentStates final
         uint32_t isRobustContext : 1;
         // Whether the pipeline needs access to protected content (shader stages copy)
         uint32_t isProtectedContext : 1;
-
-        uint32_t padding : 1;
+        // Whether the pipeline binds resources through descriptor buffers (shader stages copy)
+        uint32_t usesDescriptorBuffer : 1;
     } bits;
 
     // Affecting specialization constants
@@ -689,13 +691,15 @@ struct PackedBlendMaskAndLogicOpState final
 
         // Whether the pipeline needs access to protected content (fragment output copy)
         uint32_t isProtectedContext : 1;
+        // Whether the pipeline binds resources through descriptor buffers (fragment output copy)
+        uint32_t usesDescriptorBuffer : 1;
 
         // Output that is present in the framebuffer but is never written to in the shader.  Used by
         // GL_ANGLE_robust_fragment_shader_output which defines the behavior in this case (which is
         // to mask these outputs)
         uint32_t missingOutputsMask : gl::IMPLEMENTATION_MAX_DRAW_BUFFERS;
 
-        uint32_t padding : 18 - gl::IMPLEMENTATION_MAX_DRAW_BUFFERS;
+        uint32_t padding : 17 - gl::IMPLEMENTATION_MAX_DRAW_BUFFERS;
     } bits;
 };
 
@@ -831,14 +835,18 @@ union ComputePipelineOptions final
         // protected-only. Similar to robustness, EGL allows protected and unprotected to be in the
         // same share group.
         uint8_t protectedAccess : 1;
-        uint8_t reserved : 6;  // must initialize to zero
+        // Whether the pipeline binds resources through descriptor buffers
+        // (VK_EXT_descriptor_buffer).  Only program pipelines do; internal pipelines don't.
+        uint8_t descriptorBuffer : 1;
+        uint8_t reserved : 5;  // must initialize to zero
     };
     uint8_t permutationIndex;
-    static constexpr uint32_t kPermutationCount = 0x1 << 2;
+    static constexpr uint32_t kPermutationCount = 0x1 << 3;
 };
 static_assert(sizeof(ComputePipelineOptions) == 1, "Size check failed");
 ComputePipelineOptions GetComputePipelineOptions(vk::PipelineRobustness robustness,
-                                                 vk::PipelineProtectedAccess protectedAccess);
+                                                 vk::PipelineProtectedAccess protectedAccess,
+                                                 bool descriptorBuffer);
 
 // Compute Pipeline Description
 class ComputePipelineDesc final
@@ -1142,6 +1150,10 @@ class GraphicsPipelineDesc final
         return mShaders.shaders.bits.isProtectedContext;
     }
 
+    // Set after initDefaults() for pipelines whose layout is made of descriptor-buffer set
+    // layouts.  Like protectedness, this must match across all pipeline library subsets.
+    void setUsesDescriptorBuffer(GraphicsPipelineSubset subset);
+
   private:
     void updateSubpass(GraphicsPipelineTransitionBits *transition, uint32_t subpass);
 
@@ -1209,6 +1221,15 @@ class DescriptorSetLayoutDesc final
 
     void unpackBindings(DescriptorSetLayoutBindingVector *bindings) const;
 
+    // Layouts used with VK_EXT_descriptor_buffer are created with
+    // VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT.  Every set layout of a pipeline
+    // layout must agree on this, so such layouts are created even when empty.
+    void setUsesDescriptorBuffer()
+    {
+        mCreateFlags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+    bool usesDescriptorBuffer() const { return mCreateFlags != 0; }
+
     bool empty() const { return mDescriptorSetLayoutBindings.empty(); }
 
   private:
@@ -1241,7 +1262,8 @@ class DescriptorSetLayoutDesc final
     angle::FastVector<PackedDescriptorSetBinding, kDefaultDescriptorSetLayoutBindingsCount>
         mDescriptorSetLayoutBindings;
 
-#if !defined(ANGLE_IS_64_BIT_CPU)
+    VkDescriptorSetLayoutCreateFlags mCreateFlags = 0;
+#if defined(ANGLE_IS_64_BIT_CPU)
     ANGLE_MAYBE_UNUSED_PRIVATE_FIELD uint32_t mPadding = 0;
 #endif
 };
@@ -1906,36 +1928,58 @@ std::ostream &operator<<(std::ostream &os, const WriteDescriptorDescs &desc);
 class DescriptorSetDesc
 {
   public:
-    DescriptorSetDesc()  = default;
+    DescriptorSetDesc() : mHash(0), mIsHashValid(false) {}
     ~DescriptorSetDesc() = default;
 
-    DescriptorSetDesc(const DescriptorSetDesc &other) : mDescriptorInfos(other.mDescriptorInfos) {}
+    DescriptorSetDesc(const DescriptorSetDesc &other)
+        : mDescriptorInfos(other.mDescriptorInfos),
+          mHash(other.mHash),
+          mIsHashValid(other.mIsHashValid)
+    {}
 
     DescriptorSetDesc &operator=(const DescriptorSetDesc &other)
     {
         mDescriptorInfos = other.mDescriptorInfos;
+        mHash            = other.mHash;
+        mIsHashValid     = other.mIsHashValid;
         return *this;
     }
 
+    // The hash is a combination of the hashes of the individual descriptor infos, so it can be
+    // updated incrementally by updateInfoDesc() when only a few of them change.  It is computed
+    // on first use and cached.
     size_t hash() const;
 
     size_t size() const { return mDescriptorInfos.size(); }
-    void resize(size_t count) { mDescriptorInfos.resize(count); }
+    void resize(size_t count)
+    {
+        mDescriptorInfos.resize(count);
+        mIsHashValid = false;
+    }
 
     size_t getKeySizeBytes() const { return mDescriptorInfos.size() * sizeof(DescriptorInfoDesc); }
 
     bool operator==(const DescriptorSetDesc &other) const
     {
+        if (mIsHashValid && other.mIsHashValid && mHash != other.mHash)
+        {
+            return false;
+        }
         return mDescriptorInfos.size() == other.mDescriptorInfos.size() &&
                ANGLE_UNSAFE_TODO(memcmp(mDescriptorInfos.data(), other.mDescriptorInfos.data(),
                                         mDescriptorInfos.size() * sizeof(DescriptorInfoDesc))) == 0;
     }
 
+    // Direct modification of a descriptor info; invalidates the cached hash.
     DescriptorInfoDesc &getInfoDesc(uint32_t infoDescIndex)
     {
+        mIsHashValid = false;
         return mDescriptorInfos[infoDescIndex];
     }
 
+    // Sets a descriptor info, keeping the cached hash up to date.  Returns whether it changed.
+    bool updateInfoDesc(uint32_t infoDescIndex, const DescriptorInfoDesc &infoDesc);
+
     const DescriptorInfoDesc &getInfoDesc(uint32_t infoDescIndex) const
     {
         return mDescriptorInfos[infoDescIndex];
@@ -1946,6 +1990,9 @@ class DescriptorSetDesc
   private:
     // After a preliminary minimum size, use heap memory.
     angle::FastVector<DescriptorInfoDesc, kFastDescriptorSetDescLimit> mDescriptorInfos;
+
+    mutable size_t mHash;
+    mutable bool mIsHashValid;
 };
 std::ostream &operator<<(std::ostream &os, const DescriptorSetDesc &desc);
 
@@ -2016,8 +2063,14 @@ class DescriptorSetDescBuilder final
         mDesc.resize(descriptorCount);
         mHandles.resize(descriptorCount);
         mDynamicOffsets.resize(descriptorCount);
+        mIsDescChanged = true;
     }
 
+    // Whether the desc changed since the last call to resetDescChanged().  When it hasn't, the
+    // descriptor set that was last retrieved for it can be used again without looking it up.
+    bool isDescChanged() const { return mIsDescChanged; }
+    void resetDescChanged() { mIsDescChanged = false; }
+
     // Specific helpers for uniforms/xfb descriptors.
     void updateUniformBuffer(uint32_t shaderIndex,
                              const WriteDescriptorDescs &writeDescriptorDescs,
@@ -2104,7 +2157,8 @@ class DescriptorSetDescBuilder final
                                          WriteDescriptorDescs &writeDescriptorDescs,
                                          gl::AttachmentsMask *currentMaskOut);
 
-    // Specialized update for textures.
+    // Specialized update for textures.  Every active texture is still visited, as the context
+    // doesn't track which texture units changed, but only those that did update the hash.
     void updatePreCacheActiveTextures(Context *context,
                                       const gl::ProgramExecutable &executable,
                                       const gl::ActiveTextureArray<TextureVk *> &textures,
@@ -2117,11 +2171,25 @@ class DescriptorSetDescBuilder final
 
     void resetDescriptor(uint32_t infoIndex)
     {
-        mDesc.getInfoDesc(infoIndex) = {};
-        mHandles[infoIndex]          = {};
+        getMutableInfoDesc(infoIndex) = {};
+        mHandles[infoIndex]           = {};
     }
 
   private:
+    // For updates that don't track whether the descriptor info actually changed.
+    DescriptorInfoDesc &getMutableInfoDesc(uint32_t infoIndex)
+    {
+        mIsDescChanged = true;
+        return mDesc.getInfoDesc(infoIndex);
+    }
+    void updateInfoDesc(uint32_t infoIndex, const DescriptorInfoDesc &infoDesc)
+    {
+        if (mDesc.updateInfoDesc(infoIndex, infoDesc))
+        {
+            mIsDescChanged = true;
+        }
+    }
+
     void updateInputAttachment(Context *context,
                                uint32_t binding,
                                VkImageLayout layout,
@@ -2136,6 +2204,7 @@ class DescriptorSetDescBuilder final
     DescriptorSetDesc mDesc;
     angle::FastVector<DescriptorDescHandles, kFastDescriptorSetDescLimit> mHandles;
     angle::FastVector<uint32_t, kFastDescriptorSetDescLimit> mDynamicOffsets;
+    bool mIsDescChanged;
 };
 
 // In the FramebufferDesc object:
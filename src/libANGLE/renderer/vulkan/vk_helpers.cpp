@@ -1007,6 +1007,8 @@ void CommandBufferHelperCommon::resetImpl(ErrorContext *context)
 
     ASSERT(mPipelineBarriers.isEmpty());
     ASSERT(mEventBarriers.isEmpty());
+
+    invalidateDescriptorBufferBindings();
 }
 
 template <class DerivedT>
@@ -1531,6 +1533,7 @@ RenderPassCommandBufferHelper::RenderPassCommandBufferHelper()
     : mCurrentSubpassCommandBufferIndex(0),
       mClearValues{},
       mRenderPassStarted(false),
+      mIsRenderPassElided(false),
       mTransformFeedbackCounterBuffers{},
       mTransformFeedbackCounterBufferOffsets{},
       mValidTransformFeedbackBufferCount(0),
@@ -1584,6 +1587,7 @@ angle::Result RenderPassCommandBufferHelper::reset(
     mFragmentShadingRateAtachment.reset();
 
     mRenderPassStarted                     = false;
+    mIsRenderPassElided                    = false;
     mValidTransformFeedbackBufferCount     = 0;
     mRebindTransformFeedbackBuffers        = false;
     mHasShaderStorageOutput                = false;
@@ -2435,6 +2439,9 @@ angle::Result RenderPassCommandBufferHelper::nextSubpass(ContextVk *contextVk,
     ANGLE_TRY(beginRenderPassCommandBuffer(contextVk));
     markOpen();
 
+    // Bindings don't carry over to the new command buffer.
+    invalidateDescriptorBufferBindings();
+
     // Return the new command buffer handle
     *commandBufferOut = &getCommandBuffer();
     return angle::Result::Continue;
@@ -2501,11 +2508,65 @@ void RenderPassCommandBufferHelper::invalidateRenderPassStencilAttachment(
                                   getRenderPassWriteCommandCount());
 }
 
+bool RenderPassCommandBufferHelper::isNoOpRenderPass() const
+{
+    // Anything recorded in the render pass (draws, mid-render-pass clears, queries, debug markers,
+    // etc) has to be executed, and so do resolve and unresolve operations.
+    if (getSubpassCommandBufferCount() != 1 || !mCommandBuffers[0].empty() ||
+        mImageOptimizeForPresent != nullptr || mRenderPassDesc.isRenderToTexture() ||
+        mRenderPassDesc.hasYUVResolveAttachment() ||
+        mRenderPassDesc.getColorResolveAttachmentMask().any() ||
+        mRenderPassDesc.getColorUnresolveAttachmentMask().any() ||
+        mRenderPassDesc.hasDepthStencilResolveAttachment() ||
+        mRenderPassDesc.hasDepthStencilUnresolveAttachment())
+    {
+        return false;
+    }
+
+    // Without any commands, a clear loadOp is the only way the attachment contents are modified.
+    // The other loadOps and storeOps either preserve the contents or leave them undefined, which
+    // skipping the render pass satisfies.  Layout transitions done by the render pass are
+    // observable however.
+    auto isNoOpAttachment = [](const PackedAttachmentOpsDesc &ops) {
+        return static_cast<RenderPassLoadOp>(ops.loadOp) != RenderPassLoadOp::Clear &&
+               static_cast<RenderPassLoadOp>(ops.stencilLoadOp) != RenderPassLoadOp::Clear &&
+               ops.initialLayout == ops.finalLayout;
+    };
+
+    for (PackedAttachmentIndex index = kAttachmentIndexZero; index < mColorAttachmentsCount;
+         ++index)
+    {
+        if (!isNoOpAttachment(mAttachmentOps[index]))
+        {
+            return false;
+        }
+    }
+
+    return mDepthStencilAttachmentIndex == kAttachmentIndexInvalid ||
+           isNoOpAttachment(mAttachmentOps[mDepthStencilAttachmentIndex]);
+}
+
 angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
                                                             CommandsState *commandsState,
                                                             PrimaryCommandBuffer *primaryCommands,
                                                             const RenderPass &renderPass,
                                                             VkFramebuffer framebufferOverride)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "RenderPassCommandBufferHelper::flushToPrimary");
+
+    ANGLE_TRY(beginFlushToPrimary(context, commandsState, primaryCommands, renderPass,
+                                  framebufferOverride));
+    endFlushToPrimary(context->getRenderer(), primaryCommands, !renderPass.valid());
+
+    return angle::Result::Continue;
+}
+
+angle::Result RenderPassCommandBufferHelper::beginFlushToPrimary(
+    Context *context,
+    CommandsState *commandsState,
+    PrimaryCommandBuffer *primaryCommands,
+    const RenderPass &renderPass,
+    VkFramebuffer framebufferOverride)
 {
     Renderer *renderer = context->getRenderer();
     // |framebufferOverride| must only be provided if the initial framebuffer the render pass was
@@ -2516,12 +2577,29 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
     // never imageless.
     ASSERT(!(framebufferOverride != VK_NULL_HANDLE && mFramebuffer.isImageless()));
 
-    ANGLE_TRACE_EVENT0("gpu.angle", "RenderPassCommandBufferHelper::flushToPrimary");
     ASSERT(mRenderPassStarted);
+    ASSERT(getSubpassCommandBufferCount() == 1 ||
+           !context->getFeatures().preferDynamicRendering.enabled);
 
     // Commands that are added to primary before beginRenderPass command
     executeBarriers(renderer, commandsState, primaryCommands);
 
+    // Push constants are not tied to the render pass, so they are recorded even if the render pass
+    // is elided; following render passes may rely on them.
+    if (mPipelineLayout != nullptr)
+    {
+        // This will issue pushConstants only if it is dirty, which by default it is not.
+        mGraphicsDriverUniforms->pushConstants(renderer, *mPipelineLayout, primaryCommands);
+        mPipelineLayout = nullptr;
+    }
+
+    mIsRenderPassElided = isNoOpRenderPass();
+    if (mIsRenderPassElided)
+    {
+        context->getPerfCounters().renderPassesElided++;
+        return angle::Result::Continue;
+    }
+
     constexpr VkSubpassContents kSubpassContents =
         ExecutesInline() ? VK_SUBPASS_CONTENTS_INLINE
                          : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
@@ -2554,25 +2632,35 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
             mFramebuffer.isImageless() ? &attachmentBeginInfo : nullptr);
     }
 
-    if (mPipelineLayout != nullptr)
+    return angle::Result::Continue;
+}
+
+void RenderPassCommandBufferHelper::endFlushToPrimary(Renderer *renderer,
+                                                      PrimaryCommandBuffer *primaryCommands,
+                                                      bool usesDynamicRendering)
+{
+    if (mIsRenderPassElided)
     {
-        // This will issue pushConstants only if it is dirty, which by default it is not.
-        mGraphicsDriverUniforms->pushConstants(renderer, *mPipelineLayout, primaryCommands);
-        mPipelineLayout = nullptr;
+        ASSERT(mRefCountedEvents.empty());
+        mVkEventArray.flushSetEvents(primaryCommands);
+        return;
     }
 
+    constexpr VkSubpassContents kSubpassContents =
+        ExecutesInline() ? VK_SUBPASS_CONTENTS_INLINE
+                         : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+
     // Run commands inside the RenderPass.
     for (uint32_t subpass = 0; subpass < getSubpassCommandBufferCount(); ++subpass)
     {
         if (subpass > 0)
         {
-            ASSERT(!context->getFeatures().preferDynamicRendering.enabled);
             primaryCommands->nextSubpass(kSubpassContents);
         }
         mCommandBuffers[subpass].executeCommands(primaryCommands);
     }
 
-    if (!renderPass.valid())
+    if (usesDynamicRendering)
     {
         primaryCommands->endRendering();
 
@@ -2600,8 +2688,6 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
     // Now issue VkCmdSetEvents to primary command buffer
     ASSERT(mRefCountedEvents.empty());
     mVkEventArray.flushSetEvents(primaryCommands);
-
-    return angle::Result::Continue;
 }
 
 void RenderPassCommandBufferHelper::addColorResolveAttachment(size_t colorIndexGL,
@@ -2713,6 +2799,21 @@ void RenderPassCommandBufferHelper::growRenderArea(ContextVk *contextVk,
     mStencilAttachment.onRenderAreaGrowth(contextVk, mRenderArea);
 }
 
+void RenderPassCommandBufferHelper::getCommandBlockStats(size_t *blockCountOut,
+                                                         size_t *allocatedBytesOut) const
+{
+    *blockCountOut     = 0;
+    *allocatedBytesOut = 0;
+    for (uint32_t subpass = 0; subpass < getSubpassCommandBufferCount(); ++subpass)
+    {
+        size_t blockCount     = 0;
+        size_t allocatedBytes = 0;
+        mCommandBuffers[subpass].getCommandBlockStats(&blockCount, &allocatedBytes);
+        *blockCountOut += blockCount;
+        *allocatedBytesOut += allocatedBytes;
+    }
+}
+
 angle::Result RenderPassCommandBufferHelper::attachCommandPool(ErrorContext *context,
                                                                SecondaryCommandPool *commandPool)
 {
@@ -2816,6 +2917,7 @@ void CommandBufferRecycler<CommandBufferHelperT>::onDestroy()
         SafeDelete(commandBufferHelper);
     }
     mCommandBufferHelperFreeList.clear();
+    mCommandMemoryRecycler.trim();
 }
 
 template void CommandBufferRecycler<OutsideRenderPassCommandBufferHelper>::onDestroy();
@@ -2832,6 +2934,7 @@ angle::Result CommandBufferRecycler<CommandBufferHelperT>::getCommandBufferHelpe
     {
         CommandBufferHelperT *commandBuffer = new CommandBufferHelperT();
         *commandBufferHelperOut             = commandBuffer;
+        commandBuffer->setCommandMemoryRecycler(&mCommandMemoryRecycler);
         ANGLE_TRY(commandBuffer->initialize(context));
     }
     else
@@ -2862,6 +2965,7 @@ void CommandBufferRecycler<CommandBufferHelperT>::recycleCommandBufferHelper(
 {
     (*commandBuffer)->assertCanBeRecycled();
     (*commandBuffer)->markOpen();
+    (*commandBuffer)->releaseCommandMemory();
 
     {
         std::unique_lock<angle::SimpleMutex> lock(mMutex);
@@ -3205,6 +3309,275 @@ void DynamicBuffer::reset()
     mNextAllocationOffset = 0;
 }
 
+// FrameRingBuffer implementation.
+FrameRingBuffer::FrameRingBuffer()
+    : mUsage(0),
+      mMemoryPropertyFlags(0),
+      mAlignment(0),
+      mSize(0),
+      mNextAllocationOffset(0),
+      mCurrentBufferIndex(0),
+      mIsFrameBoundaryPending(false),
+      mHasFrameOverflowed(false)
+{}
+
+FrameRingBuffer::~FrameRingBuffer()
+{
+    for (const std::unique_ptr<BufferHelper> &buffer : mBuffers)
+    {
+        ASSERT(buffer == nullptr);
+    }
+    ASSERT(mReplacedBuffers.empty());
+    ASSERT(mRetiredBuffers.empty());
+}
+
+void FrameRingBuffer::init(Renderer *renderer,
+                           VkBufferUsageFlags usage,
+                           size_t alignment,
+                           size_t initialSize)
+{
+    mUsage               = usage;
+    mMemoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+
+    if (renderer->getFeatures().preferHostCachedForNonStaticBufferUsage.enabled)
+    {
+        mMemoryPropertyFlags |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    }
+
+    // Check that we haven't overridden the initial size of the buffer in setMinimumSizeForTesting.
+    if (mSize == 0)
+    {
+        mSize = initialSize;
+    }
+
+    // Every suballocation is flushed separately, so it must also be aligned to the atom size.
+    const size_t atomSize =
+        static_cast<size_t>(renderer->getPhysicalDeviceProperties().limits.nonCoherentAtomSize);
+    ASSERT(gl::isPow2(alignment) && gl::isPow2(atomSize));
+    mAlignment = std::max(alignment, atomSize);
+}
+
+bool FrameRingBuffer::allocateFromCurrentBuffer(size_t sizeInBytes, BufferHelper **bufferHelperOut)
+{
+    BufferHelper *buffer = mBuffers[mCurrentBufferIndex].get();
+    if (buffer == nullptr || mIsFrameBoundaryPending)
+    {
+        return false;
+    }
+
+    ASSERT(bufferHelperOut);
+    const size_t sizeToAllocate = roundUp(sizeInBytes, mAlignment);
+    const size_t bufferSize     = static_cast<size_t>(buffer->getBlockMemorySize());
+    ASSERT(mNextAllocationOffset <= bufferSize);
+
+    if (sizeToAllocate > bufferSize - mNextAllocationOffset)
+    {
+        return false;
+    }
+
+    ASSERT(buffer->getMappedMemory());
+    buffer->setSuballocationOffsetAndSize(mNextAllocationOffset, sizeToAllocate);
+    *bufferHelperOut = buffer;
+
+    mNextAllocationOffset += sizeToAllocate;
+    mBuffersPendingSubmission.set(mCurrentBufferIndex);
+    return true;
+}
+
+angle::Result FrameRingBuffer::allocate(Context *context,
+                                        size_t sizeInBytes,
+                                        BufferHelper **bufferHelperOut,
+                                        bool *newBufferAllocatedOut)
+{
+    ASSERT(sizeInBytes != 0);
+    bool newBuffer = !allocateFromCurrentBuffer(sizeInBytes, bufferHelperOut);
+    if (newBufferAllocatedOut)
+    {
+        *newBufferAllocatedOut = newBuffer;
+    }
+
+    if (!newBuffer)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(switchToNextBuffer(context, roundUp(sizeInBytes, mAlignment)));
+
+    bool allocated = allocateFromCurrentBuffer(sizeInBytes, bufferHelperOut);
+    ASSERT(allocated);
+    ANGLE_UNUSED_VARIABLE(allocated);
+
+    return angle::Result::Continue;
+}
+
+angle::Result FrameRingBuffer::switchToNextBuffer(Context *context, size_t sizeToAllocate)
+{
+    Renderer *renderer = context->getRenderer();
+
+    // Running out of space before the frame boundary means the buffers are too small to hold a
+    // whole frame.  They are grown only once per frame, so that a one-off burst of allocations
+    // doesn't make them grow excessively.
+    if (!mIsFrameBoundaryPending && mBuffers[mCurrentBufferIndex] != nullptr &&
+        !mHasFrameOverflowed)
+    {
+        mSize *= 2;
+        mHasFrameOverflowed = true;
+    }
+    mIsFrameBoundaryPending = false;
+
+    mCurrentBufferIndex   = (mCurrentBufferIndex + 1) % kFrameRingBufferCount;
+    mNextAllocationOffset = 0;
+
+    std::unique_ptr<BufferHelper> &buffer = mBuffers[mCurrentBufferIndex];
+    const bool isPendingSubmission        = mBuffersPendingSubmission.test(mCurrentBufferIndex);
+    const size_t requiredSize             = std::max(mSize, sizeToAllocate);
+
+    // The buffer is reused as a whole, so it must not be used by the GPU or by commands that are
+    // not submitted yet.  It's also replaced if it doesn't have the current size, either because
+    // the buffers have grown since, or because it was allocated for an oversized allocation.
+    if (buffer != nullptr)
+    {
+        if (!isPendingSubmission && buffer->getBlockMemorySize() == requiredSize &&
+            renderer->hasResourceUseFinished(buffer->getResourceUse()))
+        {
+            return angle::Result::Continue;
+        }
+
+        // A buffer with unsubmitted writes can only be retired once it's marked as in use by the
+        // submission that includes them.
+        if (isPendingSubmission)
+        {
+            mReplacedBuffers.push_back(std::move(buffer));
+            mBuffersPendingSubmission.reset(mCurrentBufferIndex);
+        }
+        else
+        {
+            retireBuffer(context, std::move(buffer));
+        }
+    }
+
+    // Retired buffers are not reused once the buffers have grown.
+    while (!mRetiredBuffers.empty() && mRetiredBuffers.front()->getBlockMemorySize() != mSize)
+    {
+        mRetiredBuffers.front()->release(context);
+        mRetiredBuffers.pop_front();
+    }
+
+    // Reuse the oldest retired buffer if it's no longer in use.  The retired buffers are in the
+    // order they were last used, so if the oldest one is still in use, so are the others.
+    if (!mRetiredBuffers.empty() && requiredSize == mSize &&
+        renderer->hasResourceUseFinished(mRetiredBuffers.front()->getResourceUse()))
+    {
+        buffer = std::move(mRetiredBuffers.front());
+        mRetiredBuffers.pop_front();
+        return angle::Result::Continue;
+    }
+
+    RendererScoped<BufferHelper> newBuffer(renderer);
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = requiredSize;
+    createInfo.usage                 = mUsage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(newBuffer.get().init(context, createInfo, mMemoryPropertyFlags));
+
+    buffer = std::make_unique<BufferHelper>(newBuffer.release());
+    ASSERT(buffer->getBlockMemorySize() == requiredSize);
+    context->getPerfCounters().frameRingBufferAllocations++;
+
+    return angle::Result::Continue;
+}
+
+void FrameRingBuffer::retireBuffer(Context *context, std::unique_ptr<BufferHelper> buffer)
+{
+    // Buffers of another size than the current one are not reused.
+    if (buffer->getBlockMemorySize() != mSize)
+    {
+        buffer->release(context);
+        return;
+    }
+
+    mRetiredBuffers.push_back(std::move(buffer));
+}
+
+void FrameRingBuffer::updateQueueSerialAndRetireReplacedBuffers(Context *context,
+                                                                const QueueSerial &queueSerial)
+{
+    for (size_t bufferIndex : mBuffersPendingSubmission)
+    {
+        mBuffers[bufferIndex]->setQueueSerial(queueSerial);
+    }
+    mBuffersPendingSubmission.reset();
+
+    for (std::unique_ptr<BufferHelper> &buffer : mReplacedBuffers)
+    {
+        buffer->setQueueSerial(queueSerial);
+        retireBuffer(context, std::move(buffer));
+    }
+    mReplacedBuffers.clear();
+
+    // After the GPU has fallen far behind, the ring doesn't need all the buffers that were retired
+    // in the meantime.  No more retired buffers than there are buffers in the ring are kept.  The
+    // most recently retired ones are released, since the oldest ones become reusable first.
+    while (mRetiredBuffers.size() > kFrameRingBufferCount)
+    {
+        mRetiredBuffers.back()->release(context);
+        mRetiredBuffers.pop_back();
+    }
+}
+
+void FrameRingBuffer::release(Context *context)
+{
+    for (std::unique_ptr<BufferHelper> &buffer : mBuffers)
+    {
+        if (buffer)
+        {
+            buffer->release(context);
+            buffer.reset(nullptr);
+        }
+    }
+
+    ReleaseBufferListToRenderer(context, &mReplacedBuffers);
+    ReleaseBufferListToRenderer(context, &mRetiredBuffers);
+
+    mSize                 = 0;
+    mNextAllocationOffset = 0;
+    mBuffersPendingSubmission.reset();
+}
+
+void FrameRingBuffer::destroy(Renderer *renderer)
+{
+    for (std::unique_ptr<BufferHelper> &buffer : mBuffers)
+    {
+        if (buffer)
+        {
+            buffer->unmap(renderer);
+            buffer->destroy(renderer);
+            buffer.reset(nullptr);
+        }
+    }
+
+    DestroyBufferList(renderer, &mReplacedBuffers);
+    DestroyBufferList(renderer, &mRetiredBuffers);
+
+    mSize                 = 0;
+    mNextAllocationOffset = 0;
+    mBuffersPendingSubmission.reset();
+}
+
+void FrameRingBuffer::setMinimumSizeForTesting(size_t minSize)
+{
+    // This will really only have an effect next time we move on to the next buffer, which is
+    // forced on the next allocate.
+    mSize                   = minSize;
+    mIsFrameBoundaryPending = true;
+}
+
 // BufferPool implementation.
 BufferPool::BufferPool()
     : mVirtualBlockCreateFlags(vma::VirtualBlockCreateFlagBits::GENERAL),
@@ -5594,7 +5967,7 @@ void BufferHelper::fillWithPattern(const void *pattern,
     return;
 }
 
-VkDeviceAddress BufferHelper::getDeviceAddress(Context *context)
+VkDeviceAddress BufferHelper::getDeviceAddress(ErrorContext *context) const
 {
     ASSERT(context->getFeatures().supportsBufferDeviceAddress.enabled);
     ASSERT(valid());
@@ -10777,6 +11150,181 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+bool ImageHelper::canFlushStagedUpdatesOnTransferQueue(ContextVk *contextVk,
+                                                       gl::OwnerLevel levelGLStart,
+                                                       gl::OwnerLevel levelGLEnd,
+                                                       gl::OwnerLayer layerStart,
+                                                       gl::OwnerLayer layerEnd,
+                                                       const gl::TexLevelMask &skipLevels) const
+{
+    Renderer *renderer = contextVk->getRenderer();
+
+    if (!renderer->getFeatures().asyncTransferQueueUploads.enabled ||
+        !renderer->hasTransferQueue())
+    {
+        return false;
+    }
+
+    // Only images that have never been used are uploaded on the transfer queue, so that there is
+    // no previous use on the context's queue to synchronize with.  Images shared with external
+    // users, protected images and images that need emulation or transcoding are left to the
+    // context's queue.
+    if (mCurrentAccess != ImageAccess::Undefined || !renderer->hasResourceUseFinished(mUse) ||
+        mIsReleasedToExternal || mIsForeignImage || isBackedByExternalMemory() || mUseTileMemory ||
+        (mCreateFlags & VK_IMAGE_CREATE_PROTECTED_BIT) != 0 || mAcquireNextImageSemaphore.valid() ||
+        !canTransferTo() || getActualFormat().isYUV ||
+        getIntendedFormatID() != getActualFormatID())
+    {
+        return false;
+    }
+
+    // Copies to depth/stencil aspects are only supported on queues with graphics capability, so
+    // these images are uploaded on the transfer queue only if it falls back to the graphics family.
+    if ((getAspectFlags() & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) != 0 &&
+        renderer->getTransferDeviceQueueIndex().familyIndex() != renderer->getQueueFamilyIndex())
+    {
+        return false;
+    }
+
+    // Partial flushes are left to flushStagedUpdatesImpl, which keeps the updates that are not
+    // flushed.
+    if (skipLevels.any() || layerStart.get() != 0 || layerEnd.get() < mLayerCount)
+    {
+        return false;
+    }
+
+    for (gl::OwnerLevel levelGL = levelGLStart; levelGL < levelGLEnd; ++levelGL)
+    {
+        const SubresourceUpdates *levelUpdates = getLevelUpdates(levelGL);
+        ASSERT(levelUpdates != nullptr);
+
+        for (const SubresourceUpdate &update : *levelUpdates)
+        {
+            // The source buffer must not be in use by the context's queue either.
+            if (update.updateSource != UpdateSource::Buffer ||
+                !isDataFormatMatchForCopy(update.data.buffer.formatID) ||
+                !renderer->hasResourceUseFinished(
+                    update.data.buffer.bufferHelper->getResourceUse()))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+angle::Result ImageHelper::flushStagedUpdatesOnTransferQueue(ContextVk *contextVk,
+                                                             gl::OwnerLevel levelGLStart,
+                                                             gl::OwnerLevel levelGLEnd)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::flushStagedUpdatesOnTransferQueue");
+    Renderer *renderer = contextVk->getRenderer();
+
+    const VkImageAspectFlags aspectFlags      = getAspectFlags();
+    const DeviceQueueIndex transferQueueIndex = renderer->getTransferDeviceQueueIndex();
+    const DeviceQueueIndex contextQueueIndex  = contextVk->getDeviceQueueIndex();
+
+    const bool isQueueFamilyChangeNeeded =
+        transferQueueIndex.familyIndex() != contextQueueIndex.familyIndex();
+
+    // The staging buffers and the image are retained by the context's command buffer that acquires
+    // the image.  That command buffer is submitted after the transfer queue submission and waits
+    // for it.
+    OutsideRenderPassCommandBufferHelper *commandBufferHelper = nullptr;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper({}, &commandBufferHelper));
+
+    ScopedPrimaryCommandBuffer scopedCommandBuffer(renderer->getDevice());
+    ANGLE_TRY(renderer->getTransferCommandBuffer(contextVk, &scopedCommandBuffer));
+    PrimaryCommandBuffer &commandBuffer = scopedCommandBuffer.get();
+
+    // The image is in the Undefined layout, so it's not owned by any queue family yet.
+    VkSemaphore acquireNextImageSemaphore;
+    mCurrentDeviceQueueIndex = transferQueueIndex;
+    recordBarrierOneOffImpl(renderer, aspectFlags, ImageAccess::TransferDst, transferQueueIndex,
+                            &commandBuffer, &acquireNextImageSemaphore);
+    ASSERT(acquireNextImageSemaphore == VK_NULL_HANDLE);
+
+    for (gl::OwnerLevel updateMipLevelGL = levelGLStart; updateMipLevelGL < levelGLEnd;
+         ++updateMipLevelGL)
+    {
+        SubresourceUpdates *levelUpdates = getLevelUpdates(updateMipLevelGL);
+        ASSERT(levelUpdates != nullptr);
+        const LevelIndex updateMipLevelVk = toVkLevel(updateMipLevelGL);
+
+        bool isLevelWritten = false;
+        for (SubresourceUpdate &update : *levelUpdates)
+        {
+            ASSERT(update.updateSource == UpdateSource::Buffer);
+            BufferUpdate &bufferUpdate  = update.data.buffer;
+            BufferHelper *currentBuffer = bufferUpdate.bufferHelper;
+            ASSERT(currentBuffer && currentBuffer->valid());
+            ANGLE_TRY(currentBuffer->flush(renderer));
+
+            gl::OwnerLayer updateBaseLayer;
+            uint32_t updateLayerCount;
+            update.getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+
+            // Updates to the same level may overlap, so they are applied in order.
+            if (isLevelWritten)
+            {
+                VkMemoryBarrier memoryBarrier = {};
+                memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                memoryBarrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memoryBarrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+                commandBuffer.memoryBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                            VK_PIPELINE_STAGE_TRANSFER_BIT, memoryBarrier);
+            }
+            isLevelWritten = true;
+
+            VkBufferImageCopy *copyRegion         = &bufferUpdate.copyRegion;
+            copyRegion->imageSubresource.mipLevel = updateMipLevelVk.get();
+            commandBuffer.copyBufferToImage(currentBuffer->getBuffer().getHandle(), mImage,
+                                            getCurrentLayout(renderer), 1, copyRegion);
+            onWrite(updateMipLevelGL, 1, updateBaseLayer, updateLayerCount,
+                    copyRegion->imageSubresource.aspectMask);
+
+            mTotalStagedBufferUpdateSize -= currentBuffer->getSize();
+            commandBufferHelper->retainResource(currentBuffer);
+            update.release(renderer);
+        }
+
+        levelUpdates->clear();
+    }
+
+    // Release the image to the context's queue family.
+    if (isQueueFamilyChangeNeeded)
+    {
+        recordBarrierOneOffImpl(renderer, aspectFlags, ImageAccess::TransferDst, contextQueueIndex,
+                                &commandBuffer, &acquireNextImageSemaphore);
+    }
+
+    renderer->insertSubmitDebugMarkerInCommandBuffer(commandBuffer,
+                                                     QueueSubmitReason::TransferQueueUpload);
+    ANGLE_VK_TRY(contextVk, commandBuffer.end());
+
+    uint64_t signalValue = 0;
+    ANGLE_TRY(renderer->submitTransferCommands(contextVk, std::move(scopedCommandBuffer),
+                                               &signalValue));
+
+    // Acquire the image on the context's queue.  The matching release barrier is recorded above.
+    // The barriers that follow this upload synchronize with the semaphore wait, which is done at
+    // the transfer stage.
+    if (isQueueFamilyChangeNeeded)
+    {
+        mCurrentDeviceQueueIndex = transferQueueIndex;
+        changeLayoutAndQueue(contextVk, aspectFlags, ImageAccess::TransferDst, contextQueueIndex,
+                             &commandBufferHelper->getCommandBuffer());
+    }
+    mCurrentDeviceQueueIndex = contextQueueIndex;
+    commandBufferHelper->retainImage(renderer, this);
+
+    contextVk->addTransferQueueWait(signalValue);
+    contextVk->getPerfCounters().transferQueueUploads++;
+
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                                               gl::OwnerLevel levelGLStart,
                                               gl::OwnerLevel levelGLEnd,
@@ -10831,8 +11379,16 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
     // early, skipping the next loop.
     if (otherUpdatesToFlushOut)
     {
-        ANGLE_TRY(flushStagedUpdatesImpl(contextVk, levelGLStart, levelGLEnd, layerStart, layerEnd,
-                                         skipLevelsAnyFace));
+        if (canFlushStagedUpdatesOnTransferQueue(contextVk, levelGLStart, levelGLEnd, layerStart,
+                                                 layerEnd, skipLevelsAnyFace))
+        {
+            ANGLE_TRY(flushStagedUpdatesOnTransferQueue(contextVk, levelGLStart, levelGLEnd));
+        }
+        else
+        {
+            ANGLE_TRY(flushStagedUpdatesImpl(contextVk, levelGLStart, levelGLEnd, layerStart,
+                                             layerEnd, skipLevelsAnyFace));
+        }
     }
 
     // Compact mSubresourceUpdates, then check if there are any updates left.
@@ -12489,7 +13045,8 @@ LayerMode GetLayerMode(const vk::ImageHelper &image, uint32_t layerCount)
 }
 
 ComputePipelineOptions GetComputePipelineOptions(vk::PipelineRobustness robustness,
-                                                 vk::PipelineProtectedAccess protectedAccess)
+                                                 vk::PipelineProtectedAccess protectedAccess,
+                                                 bool descriptorBuffer)
 {
     vk::ComputePipelineOptions pipelineOptions = {};
 
@@ -12501,6 +13058,10 @@ ComputePipelineOptions GetComputePipelineOptions(vk::PipelineRobustness robustne
     {
         pipelineOptions.protectedAccess = 1;
     }
+    if (descriptorBuffer)
+    {
+        pipelineOptions.descriptorBuffer = 1;
+    }
 
     return pipelineOptions;
 }
@@ -13445,6 +14006,24 @@ angle::Result BufferViewHelper::getView(ErrorContext *context,
     return angle::Result::Continue;
 }
 
+void BufferViewHelper::getDescriptorAddressInfo(ErrorContext *context,
+                                                const BufferHelper &buffer,
+                                                VkDeviceSize bufferOffset,
+                                                const Format &format,
+                                                VkDescriptorAddressInfoEXT *addressInfoOut) const
+{
+    ASSERT(format.valid());
+
+    // Same as the range of the view created in getView().
+    const GLuint pixelBytes = format.getActualBufferFormat().pixelBytes;
+
+    addressInfoOut->sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    addressInfoOut->pNext   = nullptr;
+    addressInfoOut->address = buffer.getDeviceAddress(context) + mOffset + bufferOffset;
+    addressInfoOut->range   = mSize - mSize % pixelBytes;
+    addressInfoOut->format  = format.getActualBufferVkFormat(context->getRenderer());
+}
+
 ImageOrBufferViewSubresourceSerial BufferViewHelper::getSerial() const
 {
     ASSERT(mViewSerial.valid());
@@ -13645,6 +14224,425 @@ angle::Result MetaDescriptorPool::bindCachedDescriptorPool(
     return angle::Result::Continue;
 }
 
+// DescriptorBufferSet implementation.
+DescriptorBufferSet::DescriptorBufferSet() = default;
+
+DescriptorBufferSet::~DescriptorBufferSet() = default;
+
+void DescriptorBufferSet::init(Renderer *renderer,
+                               const DescriptorSetLayoutDesc &layoutDesc,
+                               const DescriptorSetLayout &layout,
+                               uint32_t combinedImageSamplerDescriptorCount)
+{
+    ASSERT(layoutDesc.usesDescriptorBuffer());
+    reset();
+
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &properties =
+        renderer->getPhysicalDeviceDescriptorBufferProperties();
+    const bool robust = renderer->getEnabledFeatures().features.robustBufferAccess == VK_TRUE;
+    VkDevice device   = renderer->getDevice();
+
+    VkDeviceSize layoutSize = 0;
+    vkGetDescriptorSetLayoutSizeEXT(device, layout.getHandle(), &layoutSize);
+    mData.resize(static_cast<size_t>(layoutSize), 0);
+    mDirty = true;
+
+    DescriptorSetLayoutBindingVector bindings;
+    layoutDesc.unpackBindings(&bindings);
+
+    for (const VkDescriptorSetLayoutBinding &binding : bindings)
+    {
+        if (binding.binding >= mBindings.size())
+        {
+            mBindings.resize(binding.binding + 1, {});
+        }
+
+        Binding &bufferBinding = mBindings[binding.binding];
+        vkGetDescriptorSetLayoutBindingOffsetEXT(device, layout.getHandle(), binding.binding,
+                                                 &bufferBinding.offset);
+        bufferBinding.type = GetNonDynamicDescriptorType(binding.descriptorType);
+
+        size_t descriptorSize = 0;
+        switch (bufferBinding.type)
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                descriptorSize = robust ? properties.robustUniformBufferDescriptorSize
+                                        : properties.uniformBufferDescriptorSize;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                descriptorSize = robust ? properties.robustStorageBufferDescriptorSize
+                                        : properties.storageBufferDescriptorSize;
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                descriptorSize = robust ? properties.robustUniformTexelBufferDescriptorSize
+                                        : properties.uniformTexelBufferDescriptorSize;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                descriptorSize = robust ? properties.robustStorageTexelBufferDescriptorSize
+                                        : properties.storageTexelBufferDescriptorSize;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                descriptorSize = properties.storageImageDescriptorSize;
+                break;
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                descriptorSize = properties.inputAttachmentDescriptorSize;
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                // Multi-planar images with an immutable Ycbcr sampler take multiple descriptors.
+                descriptorSize = properties.combinedImageSamplerDescriptorSize;
+                if (binding.pImmutableSamplers != nullptr)
+                {
+                    descriptorSize *= combinedImageSamplerDescriptorCount;
+                }
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+        bufferBinding.descriptorSize = static_cast<uint32_t>(descriptorSize);
+
+        if (IsDynamicDescriptor(binding.descriptorType))
+        {
+            bufferBinding.dynamicIndex = static_cast<uint32_t>(mDynamicDescriptors.size());
+            for (uint32_t arrayElement = 0; arrayElement < binding.descriptorCount; ++arrayElement)
+            {
+                DynamicDescriptor dynamicDescriptor = {};
+                dynamicDescriptor.offset =
+                    bufferBinding.offset + arrayElement * bufferBinding.descriptorSize;
+                dynamicDescriptor.type           = bufferBinding.type;
+                dynamicDescriptor.descriptorSize = bufferBinding.descriptorSize;
+                mDynamicDescriptors.push_back(dynamicDescriptor);
+            }
+        }
+        else
+        {
+            bufferBinding.dynamicIndex = kInvalidDescriptorDescIndex;
+        }
+    }
+}
+
+void DescriptorBufferSet::reset()
+{
+    mBindings.clear();
+    mDynamicDescriptors.clear();
+    mData.clear();
+    mDirty = false;
+}
+
+void DescriptorBufferSet::writeDescriptor(Renderer *renderer,
+                                          const VkDescriptorGetInfoEXT &getInfo,
+                                          uint32_t binding,
+                                          uint32_t arrayElement)
+{
+    const Binding &bufferBinding = mBindings[binding];
+    const VkDeviceSize offset = bufferBinding.offset + arrayElement * bufferBinding.descriptorSize;
+    ASSERT(offset + bufferBinding.descriptorSize <= mData.size());
+
+    vkGetDescriptorEXT(renderer->getDevice(), &getInfo, bufferBinding.descriptorSize,
+                       ANGLE_UNSAFE_TODO(mData.data() + offset));
+    mDirty = true;
+}
+
+void DescriptorBufferSet::writeBuffer(Renderer *renderer,
+                                      uint32_t binding,
+                                      uint32_t arrayElement,
+                                      VkDeviceAddress address,
+                                      VkDeviceSize range)
+{
+    const Binding &bufferBinding = mBindings[binding];
+
+    // The descriptors of dynamic buffers are only written once the dynamic offset is known.
+    if (bufferBinding.dynamicIndex != kInvalidDescriptorDescIndex)
+    {
+        DynamicDescriptor &dynamicDescriptor =
+            mDynamicDescriptors[bufferBinding.dynamicIndex + arrayElement];
+        if (dynamicDescriptor.address != address || dynamicDescriptor.range != range)
+        {
+            dynamicDescriptor.address   = address;
+            dynamicDescriptor.range     = range;
+            dynamicDescriptor.isWritten = false;
+        }
+        return;
+    }
+
+    VkDescriptorAddressInfoEXT addressInfo = {};
+    addressInfo.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    addressInfo.address                    = address;
+    addressInfo.range                      = range;
+    addressInfo.format                     = VK_FORMAT_UNDEFINED;
+
+    VkDescriptorGetInfoEXT getInfo = {};
+    getInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    getInfo.type                   = bufferBinding.type;
+    if (bufferBinding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+    {
+        getInfo.data.pUniformBuffer = &addressInfo;
+    }
+    else
+    {
+        ASSERT(bufferBinding.type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        getInfo.data.pStorageBuffer = &addressInfo;
+    }
+
+    writeDescriptor(renderer, getInfo, binding, arrayElement);
+}
+
+void DescriptorBufferSet::update(Renderer *renderer,
+                                 const DescriptorSetDescBuilder &builder,
+                                 const WriteDescriptorDescs &writeDescriptorDescs)
+{
+    const DescriptorInfoDesc *infoDescs  = builder.getDesc().getInfoDescs();
+    const DescriptorDescHandles *handles = builder.getHandles();
+    VkDevice device                      = renderer->getDevice();
+
+    for (uint32_t binding = 0; binding < writeDescriptorDescs.size(); ++binding)
+    {
+        const WriteDescriptorDesc &writeDesc = writeDescriptorDescs[binding];
+
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        const uint32_t infoDescIndex = writeDesc.descriptorInfoIndex;
+
+        switch (GetNonDynamicDescriptorType(
+            static_cast<VkDescriptorType>(writeDesc.descriptorType)))
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            {
+                ASSERT(writeDesc.descriptorCount == 1);
+                const DescriptorInfoDesc &infoDesc = infoDescs[infoDescIndex];
+
+                VkDescriptorAddressInfoEXT info = {};
+                info.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+                info.address                    = infoDesc.samplerOrBufferSerialOrStorageFormat;
+                info.range                      = infoDesc.imageLayoutOrRange;
+                info.format = static_cast<VkFormat>(infoDesc.imageSubresourceRange);
+                writeTexelBuffer(renderer, binding, 0, info);
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            {
+                for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount;
+                     ++arrayElement)
+                {
+                    const DescriptorInfoDesc &infoDesc = infoDescs[infoDescIndex + arrayElement];
+
+                    VkBufferDeviceAddressInfo addressInfo = {};
+                    addressInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+                    addressInfo.buffer = handles[infoDescIndex + arrayElement].buffer;
+
+                    const VkDeviceAddress bufferAddress =
+                        VK_CALL(vkGetBufferDeviceAddressKHR, device, &addressInfo);
+
+                    writeBuffer(renderer, binding, arrayElement,
+                                bufferAddress + infoDesc.imageViewSerialOrOffset,
+                                infoDesc.imageLayoutOrRange);
+                }
+                break;
+            }
+            // VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER is handled exclusively by
+            // |writeCombinedImageSampler|.
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            {
+                const bool isInputAttachment =
+                    writeDesc.descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+                for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount;
+                     ++arrayElement)
+                {
+                    const DescriptorInfoDesc &infoDesc = infoDescs[infoDescIndex + arrayElement];
+
+                    VkDescriptorImageInfo imageInfo = {};
+                    imageInfo.imageLayout = static_cast<VkImageLayout>(infoDesc.imageLayoutOrRange);
+                    imageInfo.imageView   = handles[infoDescIndex + arrayElement].imageView;
+
+                    VkDescriptorGetInfoEXT getInfo = {};
+                    getInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+                    getInfo.type = static_cast<VkDescriptorType>(writeDesc.descriptorType);
+                    if (isInputAttachment)
+                    {
+                        getInfo.data.pInputAttachmentImage = &imageInfo;
+                    }
+                    else
+                    {
+                        getInfo.data.pStorageImage = &imageInfo;
+                    }
+
+                    writeDescriptor(renderer, getInfo, binding, arrayElement);
+                }
+                break;
+            }
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+}
+
+void DescriptorBufferSet::writeCombinedImageSampler(Renderer *renderer,
+                                                    uint32_t binding,
+                                                    uint32_t arrayElement,
+                                                    const VkDescriptorImageInfo &imageInfo)
+{
+    ASSERT(mBindings[binding].type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+    VkDescriptorGetInfoEXT getInfo     = {};
+    getInfo.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    getInfo.type                       = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    getInfo.data.pCombinedImageSampler = &imageInfo;
+
+    writeDescriptor(renderer, getInfo, binding, arrayElement);
+}
+
+void DescriptorBufferSet::writeTexelBuffer(Renderer *renderer,
+                                           uint32_t binding,
+                                           uint32_t arrayElement,
+                                           const VkDescriptorAddressInfoEXT &addressInfo)
+{
+    const Binding &bufferBinding = mBindings[binding];
+    const VkDescriptorType type  = bufferBinding.type;
+
+    // Unbound texel buffers are given zeroed descriptors, so that the address of a previously
+    // bound buffer, which may since have been freed, doesn't linger in the set.
+    if (addressInfo.address == 0)
+    {
+        const VkDeviceSize offset =
+            bufferBinding.offset + arrayElement * bufferBinding.descriptorSize;
+        ASSERT(offset + bufferBinding.descriptorSize <= mData.size());
+        ANGLE_UNSAFE_TODO(memset(mData.data() + offset, 0, bufferBinding.descriptorSize));
+        mDirty = true;
+        return;
+    }
+
+    VkDescriptorGetInfoEXT getInfo = {};
+    getInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    getInfo.type                   = type;
+    if (type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER)
+    {
+        getInfo.data.pUniformTexelBuffer = &addressInfo;
+    }
+    else
+    {
+        ASSERT(type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER);
+        getInfo.data.pStorageTexelBuffer = &addressInfo;
+    }
+
+    writeDescriptor(renderer, getInfo, binding, arrayElement);
+}
+
+void DescriptorBufferSet::updateDynamicDescriptors(Renderer *renderer,
+                                                   const uint32_t *dynamicOffsets)
+{
+    VkDevice device = renderer->getDevice();
+    for (size_t dynamicIndex = 0; dynamicIndex < mDynamicDescriptors.size(); ++dynamicIndex)
+    {
+        DynamicDescriptor &dynamicDescriptor = mDynamicDescriptors[dynamicIndex];
+        VkDeviceAddress address              = dynamicDescriptor.address;
+        if (address != 0)
+        {
+            address += dynamicOffsets[dynamicIndex];
+        }
+
+        // Most of the time, only a few of the dynamic offsets change between binds.
+        if (dynamicDescriptor.isWritten && dynamicDescriptor.writtenAddress == address)
+        {
+            continue;
+        }
+        dynamicDescriptor.writtenAddress = address;
+        dynamicDescriptor.isWritten      = true;
+        mDirty                           = true;
+
+        uint8_t *descriptor = ANGLE_UNSAFE_TODO(mData.data() + dynamicDescriptor.offset);
+        if (address == 0)
+        {
+            ANGLE_UNSAFE_TODO(memset(descriptor, 0, dynamicDescriptor.descriptorSize));
+            continue;
+        }
+
+        VkDescriptorAddressInfoEXT addressInfo = {};
+        addressInfo.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+        addressInfo.address                    = address;
+        addressInfo.range                      = dynamicDescriptor.range;
+        addressInfo.format                     = VK_FORMAT_UNDEFINED;
+
+        VkDescriptorGetInfoEXT getInfo = {};
+        getInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        getInfo.type                   = dynamicDescriptor.type;
+        if (dynamicDescriptor.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+        {
+            getInfo.data.pUniformBuffer = &addressInfo;
+        }
+        else
+        {
+            getInfo.data.pStorageBuffer = &addressInfo;
+        }
+
+        vkGetDescriptorEXT(device, &getInfo, dynamicDescriptor.descriptorSize, descriptor);
+    }
+}
+
+void DescriptorBufferSet::copyTo(uint8_t *dst)
+{
+    ASSERT(valid());
+    ANGLE_UNSAFE_TODO(memcpy(dst, mData.data(), mData.size()));
+    mDirty = false;
+}
+
+// DescriptorBufferRing implementation.
+DescriptorBufferRing::DescriptorBufferRing() : mCurrentBufferAddress(0) {}
+
+DescriptorBufferRing::~DescriptorBufferRing() = default;
+
+void DescriptorBufferRing::init(Renderer *renderer, size_t initialSize)
+{
+    const size_t alignment = static_cast<size_t>(
+        renderer->getPhysicalDeviceDescriptorBufferProperties().descriptorBufferOffsetAlignment);
+    mStorage.init(renderer, kDescriptorBufferUsageFlags, alignment, initialSize, true);
+}
+
+void DescriptorBufferRing::release(Context *context)
+{
+    mStorage.release(context);
+    mCurrentBufferSerial  = kInvalidBufferSerial;
+    mCurrentBufferAddress = 0;
+}
+
+void DescriptorBufferRing::updateQueueSerialAndReleaseInFlightBuffers(
+    ContextVk *contextVk,
+    const QueueSerial &queueSerial)
+{
+    // Only the buffers the ring already moved on from are released; the sets in the current buffer
+    // remain valid.
+    mStorage.updateQueueSerialAndReleaseInFlightBuffers(contextVk, queueSerial);
+}
+
+angle::Result DescriptorBufferRing::allocate(Context *context,
+                                             size_t sizeInBytes,
+                                             size_t fullSizeInBytes,
+                                             BufferHelper **bufferHelperOut,
+                                             bool *newBufferOut)
+{
+    ASSERT(sizeInBytes <= fullSizeInBytes);
+    *newBufferOut = !mStorage.allocateFromCurrentBuffer(sizeInBytes, bufferHelperOut);
+    if (!*newBufferOut)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(mStorage.allocate(context, fullSizeInBytes, bufferHelperOut, nullptr));
+
+    // The buffer may be one recycled from the free list, so a new serial is given every time.
+    Renderer *renderer    = context->getRenderer();
+    mCurrentBufferSerial  = renderer->getResourceSerialFactory().generateBufferSerial();
+    mCurrentBufferAddress = (*bufferHelperOut)->getDeviceAddress(context);
+
+    return angle::Result::Continue;
+}
+
 static_assert(static_cast<uint32_t>(PresentMode::ImmediateKHR) == VK_PRESENT_MODE_IMMEDIATE_KHR,
               "PresentMode must be updated");
 static_assert(static_cast<uint32_t>(PresentMode::MailboxKHR) == VK_PRESENT_MODE_MAILBOX_KHR,
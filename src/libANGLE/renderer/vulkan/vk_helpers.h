@@ -199,6 +199,94 @@ class DynamicBuffer : angle::NonCopyable
     BufferHelperQueue mBufferFreeList;
 };
 
+// A frame ring buffer is a dynamic buffer for data that is rewritten every frame, such as default
+// uniforms and vertex data streamed from client memory.  It keeps a ring of large, persistently
+// mapped buffers, one per frame in flight, and suballocates linearly from the buffer of the current
+// frame.  At the frame boundary it moves on to the next buffer of the ring, which is reused as a
+// whole once the submissions of the frame that last wrote to it have finished.  Unlike
+// DynamicBuffer, no buffer is retired to the free list or to the garbage on every switch; the only
+// per-submission work is stamping the buffers written since the last submission with its serial.
+//
+// When a frame overflows its buffer, the ring moves on to the next buffer as if a frame boundary
+// was hit, which also takes care of contexts that never swap.  If that buffer is still in use, it
+// is retired to a free list and replaced with a retired buffer that is no longer in use, or a new
+// one if there is none.  This effectively grows the ring when the GPU is more frames behind than
+// there are buffers, without creating buffers every frame.  Buffers that are too small are
+// released.  The buffer size is doubled the first time a frame overflows, so that the ring settles
+// on a size that fits a whole frame.
+constexpr size_t kFrameRingBufferCount = 3;
+
+class FrameRingBuffer : angle::NonCopyable
+{
+  public:
+    FrameRingBuffer();
+    ~FrameRingBuffer();
+
+    void init(Renderer *renderer, VkBufferUsageFlags usage, size_t alignment, size_t initialSize);
+
+    // Same as DynamicBuffer::allocateFromCurrentBuffer.  Fails at the frame boundary too, so the
+    // caller moves on to the next buffer of the ring.
+    bool allocateFromCurrentBuffer(size_t sizeInBytes, BufferHelper **bufferHelperOut);
+
+    // Same as DynamicBuffer::allocate.  |newBufferAllocatedOut| is set if the allocation is made
+    // from a different buffer than the previous one.
+    angle::Result allocate(Context *context,
+                           size_t sizeInBytes,
+                           BufferHelper **bufferHelperOut,
+                           bool *newBufferAllocatedOut);
+
+    // Marks the buffers written to since the last submission as used by |queueSerial|, and
+    // retires the buffers that were replaced in the meantime.  Must be called for every
+    // submission.
+    void updateQueueSerialAndRetireReplacedBuffers(Context *context,
+                                                   const QueueSerial &queueSerial);
+
+    // Moves on to the next buffer of the ring on the next allocation.
+    void onFrameBoundary()
+    {
+        mIsFrameBoundaryPending = true;
+        mHasFrameOverflowed     = false;
+    }
+
+    // This releases resources when they might currently be in use.
+    void release(Context *context);
+
+    // This frees resources immediately.
+    void destroy(Renderer *renderer);
+
+    BufferHelper *getCurrentBuffer() const { return mBuffers[mCurrentBufferIndex].get(); }
+
+    // For testing only!
+    void setMinimumSizeForTesting(size_t minSize);
+
+    bool valid() const { return mSize != 0; }
+
+  private:
+    angle::Result switchToNextBuffer(Context *context, size_t sizeToAllocate);
+    // Moves a buffer taken out of the ring to the free list if it can be reused later.
+    void retireBuffer(Context *context, std::unique_ptr<BufferHelper> buffer);
+
+    VkBufferUsageFlags mUsage;
+    VkMemoryPropertyFlags mMemoryPropertyFlags;
+    size_t mAlignment;
+    size_t mSize;
+    size_t mNextAllocationOffset;
+    size_t mCurrentBufferIndex;
+    bool mIsFrameBoundaryPending;
+    bool mHasFrameOverflowed;
+
+    std::array<std::unique_ptr<BufferHelper>, kFrameRingBufferCount> mBuffers;
+    // The buffers written to since the last submission, which need to be marked as in use by it.
+    angle::BitSet8<kFrameRingBufferCount> mBuffersPendingSubmission;
+    // Buffers that were replaced in the ring while pending submission.  They are retired after
+    // being marked as in use by the next submission.
+    BufferHelperQueue mReplacedBuffers;
+    // Buffers taken out of the ring while still in use, oldest first.  They replace a buffer of
+    // the ring that is in use once they are no longer in use themselves.  At most
+    // kFrameRingBufferCount of them are kept past a submission.
+    BufferHelperQueue mRetiredBuffers;
+};
+
 // Class DescriptorSetHelper. This is a wrapper of VkDescriptorSet with GPU resource use tracking.
 using DescriptorPoolPointer     = SharedPtr<DescriptorPoolHelper>;
 using DescriptorPoolWeakPointer = WeakPtr<DescriptorPoolHelper>;
@@ -360,6 +448,9 @@ class DynamicDescriptorPool final : angle::NonCopyable
                                              const DescriptorSetLayout &descriptorSetLayout,
                                              DescriptorSetPointer *descriptorSetOut,
                                              SharedDescriptorSetCacheKey *sharedCacheKeyOut);
+    // Called when the descriptor set retrieved for a desc is used again because the desc didn't
+    // change, without looking it up.
+    void onDescriptorSetReused() { mCacheStats.hit(); }
 
     void releaseCachedDescriptorSet(Renderer *renderer, const DescriptorSetDesc &desc);
     void destroyCachedDescriptorSet(Renderer *renderer, const DescriptorSetDesc &desc);
@@ -477,6 +568,147 @@ class MetaDescriptorPool final : angle::NonCopyable
     std::unordered_map<DescriptorSetLayoutDesc, DynamicDescriptorPoolPointer> mPayload;
 };
 
+// With VK_EXT_descriptor_buffer, the descriptors of a set live in buffer memory instead of in a
+// VkDescriptorSet allocated from a pool.  DescriptorBufferSet holds a CPU copy of one set's
+// descriptors, laid out as the set layout dictates.  The copy is only rewritten when the
+// descriptors change, and is copied into the context's descriptor ring only when it is dirty.
+// Descriptor buffers have no dynamic offsets, so the descriptors of dynamic uniform and storage
+// buffers are written with the offset folded into the buffer address, and only rewritten when
+// that address changes.
+constexpr VkBufferUsageFlags kDescriptorBufferUsageFlags =
+    VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+    VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+class DescriptorBufferSet final : angle::NonCopyable
+{
+  public:
+    DescriptorBufferSet();
+    ~DescriptorBufferSet();
+
+    // |combinedImageSamplerDescriptorCount| is the number of descriptors taken by a combined image
+    // sampler with an immutable (Ycbcr conversion) sampler.
+    void init(Renderer *renderer,
+              const DescriptorSetLayoutDesc &layoutDesc,
+              const DescriptorSetLayout &layout,
+              uint32_t combinedImageSamplerDescriptorCount);
+    void reset();
+
+    bool valid() const { return !mData.empty(); }
+    VkDeviceSize getSize() const { return mData.size(); }
+    uint32_t getDynamicDescriptorCount() const
+    {
+        return static_cast<uint32_t>(mDynamicDescriptors.size());
+    }
+
+    // Writes the descriptors of the uniforms and buffers sets, similarly to
+    // UpdateDescriptorSetsBuilder::updateWriteDescriptorSet().
+    void update(Renderer *renderer,
+                const DescriptorSetDescBuilder &builder,
+                const WriteDescriptorDescs &writeDescriptorDescs);
+
+    // Used to write the textures set.
+    void writeCombinedImageSampler(Renderer *renderer,
+                                   uint32_t binding,
+                                   uint32_t arrayElement,
+                                   const VkDescriptorImageInfo &imageInfo);
+    void writeTexelBuffer(Renderer *renderer,
+                          uint32_t binding,
+                          uint32_t arrayElement,
+                          const VkDescriptorAddressInfoEXT &addressInfo);
+
+    // Rewrites the descriptors of the dynamic buffers whose address, including the dynamic
+    // offset, changed.  There must be one entry in |dynamicOffsets| per dynamic descriptor, in
+    // binding order.
+    void updateDynamicDescriptors(Renderer *renderer, const uint32_t *dynamicOffsets);
+
+    // Whether the descriptors changed since they were last copied into the descriptor ring.
+    bool isDirty() const { return mDirty; }
+
+    // Copies the descriptors to |dst|, the set's location in the descriptor ring.
+    void copyTo(uint8_t *dst);
+
+  private:
+    struct Binding
+    {
+        VkDeviceSize offset;
+        VkDescriptorType type;
+        uint32_t descriptorSize;
+        // Index of the first array element in mDynamicDescriptors, if the binding is dynamic.
+        uint32_t dynamicIndex;
+    };
+    struct DynamicDescriptor
+    {
+        VkDeviceSize offset;
+        VkDescriptorType type;
+        uint32_t descriptorSize;
+        VkDeviceAddress address;
+        VkDeviceSize range;
+        // The address the descriptor in mData was written with, dynamic offset included.  Only
+        // meaningful if |isWritten|.
+        VkDeviceAddress writtenAddress;
+        bool isWritten;
+    };
+
+    void writeDescriptor(Renderer *renderer,
+                         const VkDescriptorGetInfoEXT &getInfo,
+                         uint32_t binding,
+                         uint32_t arrayElement);
+    void writeBuffer(Renderer *renderer,
+                     uint32_t binding,
+                     uint32_t arrayElement,
+                     VkDeviceAddress address,
+                     VkDeviceSize range);
+
+    // Indexed by binding.
+    std::vector<Binding> mBindings;
+    std::vector<DynamicDescriptor> mDynamicDescriptors;
+    std::vector<uint8_t> mData;
+    bool mDirty = false;
+};
+
+// The ring the descriptor sets are copied into with VK_EXT_descriptor_buffer.  Sets are
+// suballocated from the ring's current buffer and stay valid there until the ring moves on to
+// another buffer, at which point the current buffer is given a new serial.  A set copied into the
+// buffer with the current serial can thus be bound again without being copied again.
+class DescriptorBufferRing final : angle::NonCopyable
+{
+  public:
+    DescriptorBufferRing();
+    ~DescriptorBufferRing();
+
+    void init(Renderer *renderer, size_t initialSize);
+    void release(Context *context);
+    void updateQueueSerialAndReleaseInFlightBuffers(ContextVk *contextVk,
+                                                    const QueueSerial &queueSerial);
+
+    bool valid() const { return mStorage.valid(); }
+
+    // Allocates |sizeInBytes| from the current buffer.  If that doesn't fit, |fullSizeInBytes| is
+    // allocated from a new buffer instead, and |newBufferOut| is set; all the sets to be bound
+    // must then be copied into the new buffer.
+    angle::Result allocate(Context *context,
+                           size_t sizeInBytes,
+                           size_t fullSizeInBytes,
+                           BufferHelper **bufferHelperOut,
+                           bool *newBufferOut);
+
+    BufferHelper *getCurrentBuffer() const { return mStorage.getCurrentBuffer(); }
+    BufferSerial getCurrentBufferSerial() const { return mCurrentBufferSerial; }
+    VkDeviceAddress getCurrentBufferAddress() const { return mCurrentBufferAddress; }
+
+  private:
+    DynamicBuffer mStorage;
+    BufferSerial mCurrentBufferSerial;
+    VkDeviceAddress mCurrentBufferAddress;
+};
+
+// The descriptor buffer set offsets last set in a command buffer for one pipeline bind point.
+struct DescriptorBufferOffsets
+{
+    VkPipelineLayout pipelineLayout          = VK_NULL_HANDLE;
+    DescriptorSetArray<VkDeviceSize> offsets = {};
+};
+
 template <typename Pool>
 class DynamicallyGrowingPool : angle::NonCopyable
 {
@@ -1002,7 +1234,7 @@ class BufferHelper : public ReadWriteResource
 
     void fillWithPattern(const void *pattern, size_t patternSize, size_t offset, size_t size);
 
-    VkDeviceAddress getDeviceAddress(Context *context);
+    VkDeviceAddress getDeviceAddress(ErrorContext *context) const;
 
     // Special handling for VertexArray code so that we can create a dedicated VkBuffer for the
     // sub-range of memory of the actual buffer data size that user requested (i.e, excluding extra
@@ -1484,11 +1716,40 @@ class CommandBufferHelperCommon : angle::NonCopyable
     void markClosed() {}
 #endif
 
+    // The command memory is taken from and given back to |recycler|, shared by all helpers of the
+    // same CommandBufferRecycler.  The memory is released while the helper is idle in the
+    // recycler, so that the helpers in use don't need to allocate new memory.
+    void setCommandMemoryRecycler(angle::PoolPageRecycler *recycler)
+    {
+        mCommandAllocator.setPageRecycler(recycler);
+    }
+    void releaseCommandMemory() { mCommandAllocator.releaseFreePages(); }
+
     void setHasShaderStorageOutput() { mHasShaderStorageOutput = true; }
     bool hasShaderStorageOutput() const { return mHasShaderStorageOutput; }
 
     bool hasGLMemoryBarrierIssued() const { return mHasGLMemoryBarrierIssued; }
 
+    // With VK_EXT_descriptor_buffer, the descriptor ring buffer and the set offsets are only bound
+    // again in the same command buffer if they changed.  Binding another buffer invalidates the
+    // set offsets.
+    bool isDescriptorBufferBound(BufferSerial bufferSerial) const
+    {
+        return mBoundDescriptorBufferSerial.valid() && mBoundDescriptorBufferSerial == bufferSerial;
+    }
+    void onDescriptorBufferBound(BufferSerial bufferSerial)
+    {
+        mBoundDescriptorBufferSerial = bufferSerial;
+        mDescriptorBufferOffsets     = {};
+    }
+    DescriptorBufferOffsets &getDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint)
+    {
+        ASSERT(pipelineBindPoint < mDescriptorBufferOffsets.size());
+        return mDescriptorBufferOffsets[pipelineBindPoint];
+    }
+    // Called when descriptor sets are bound in the command buffer outside the descriptor ring.
+    void invalidateDescriptorBufferBindings() { onDescriptorBufferBound(kInvalidBufferSerial); }
+
     void retainResource(Resource *resource) { resource->setQueueSerial(mQueueSerial); }
 
     void retainResourceForWrite(ReadWriteResource *writeResource)
@@ -1607,6 +1868,11 @@ class CommandBufferHelperCommon : angle::NonCopyable
 
     // Check for any buffer write commands recorded for host-visible buffers
     bool mIsAnyHostVisibleBufferWritten = false;
+
+    // The descriptor ring buffer bound in the command buffer, and the set offsets per pipeline
+    // bind point (graphics and compute).
+    BufferSerial mBoundDescriptorBufferSerial;
+    std::array<DescriptorBufferOffsets, 2> mDescriptorBufferOffsets;
 };
 
 class SecondaryCommandBufferCollector;
@@ -1633,6 +1899,11 @@ class OutsideRenderPassCommandBufferHelper final : public CommandBufferHelperCom
 
     bool empty() const { return mCommandBuffer.empty(); }
 
+    void getCommandBlockStats(size_t *blockCountOut, size_t *allocatedBytesOut) const
+    {
+        mCommandBuffer.getCommandBlockStats(blockCountOut, allocatedBytesOut);
+    }
+
     angle::Result attachCommandPool(ErrorContext *context, SecondaryCommandPool *commandPool);
     angle::Result detachCommandPool(ErrorContext *context, SecondaryCommandPool **commandPoolOut);
     void releaseCommandPool();
@@ -1874,6 +2145,8 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
 
     bool empty() const { return mCommandBuffers[0].empty(); }
 
+    void getCommandBlockStats(size_t *blockCountOut, size_t *allocatedBytesOut) const;
+
     angle::Result attachCommandPool(ErrorContext *context, SecondaryCommandPool *commandPool);
     void detachCommandPool(SecondaryCommandPool **commandPoolOut);
     void releaseCommandPool();
@@ -1932,6 +2205,11 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
                                  const RenderPass &renderPass,
                                  VkFramebuffer framebufferOverride);
 
+    // Whether the render pass recorded no commands and its load, store and layout operations leave
+    // every attachment untouched.  Such a render pass is elided when flushed, and only its barriers
+    // and events are recorded in the primary command buffer.
+    bool isNoOpRenderPass() const;
+
     bool started() const { return mRenderPassStarted; }
 
     // Finalize the layout if image has any deferred layout transition. Return true if it does end
@@ -2121,6 +2399,18 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     angle::Result beginRenderPassCommandBuffer(ContextVk *contextVk);
     angle::Result endRenderPassCommandBuffer(ContextVk *contextVk);
 
+    // The two halves of flushToPrimary().  beginFlushToPrimary() records the barriers and the
+    // start of the render pass, or elides the render pass.  endFlushToPrimary() replays the render
+    // pass commands and ends the render pass.
+    angle::Result beginFlushToPrimary(Context *context,
+                                      CommandsState *commandsState,
+                                      PrimaryCommandBuffer *primaryCommands,
+                                      const RenderPass &renderPass,
+                                      VkFramebuffer framebufferOverride);
+    void endFlushToPrimary(Renderer *renderer,
+                           PrimaryCommandBuffer *primaryCommands,
+                           bool usesDynamicRendering);
+
 
     void updateStartedRenderPassWithDepthStencilMode(RenderPassAttachment *resolveAttachment,
                                                      bool renderPassHasWriteOrClear,
@@ -2157,6 +2447,9 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     gl::Rectangle mRenderArea;
     PackedClearValuesArray mClearValues;
     bool mRenderPassStarted;
+    // Set by beginFlushToPrimary() if isNoOpRenderPass(), so endFlushToPrimary() skips the render
+    // pass too.
+    bool mIsRenderPassElided;
 
     // Transform feedback state
     gl::TransformFeedbackBuffersArray<VkBuffer> mTransformFeedbackCounterBuffers;
@@ -2220,8 +2513,15 @@ class CommandBufferRecycler
     void recycleCommandBufferHelper(CommandBufferHelperT **commandBuffer);
 
   private:
+    // The most command memory kept around by mCommandMemoryRecycler.
+    static constexpr size_t kMaxCachedCommandMemory = 4 * 1024 * 1024;
+
     angle::SimpleMutex mMutex;
     std::vector<CommandBufferHelperT *> mCommandBufferHelperFreeList;
+
+    // Command memory of the helpers, reused across helpers and frames.
+    angle::SynchronizedPoolPageRecycler mCommandMemoryRecycler{
+        SecondaryCommandBlockAllocator::kDefaultPoolAllocatorPageSize, kMaxCachedCommandMemory};
 };
 
 // The source of update to an ImageHelper
@@ -3339,6 +3639,18 @@ class ImageHelper final : public Resource, public angle::Subject
                                          gl::OwnerLayer layerStart,
                                          gl::OwnerLayer layerEnd,
                                          const gl::TexLevelMask &skipLevels);
+    // With asyncTransferQueueUploads, the initial buffer updates of an image are copied on the
+    // transfer queue instead, so the upload can overlap with rendering.  The image is then
+    // acquired by the context's queue, whose next submission waits for the upload.
+    bool canFlushStagedUpdatesOnTransferQueue(ContextVk *contextVk,
+                                              gl::OwnerLevel levelGLStart,
+                                              gl::OwnerLevel levelGLEnd,
+                                              gl::OwnerLayer layerStart,
+                                              gl::OwnerLayer layerEnd,
+                                              const gl::TexLevelMask &skipLevels) const;
+    angle::Result flushStagedUpdatesOnTransferQueue(ContextVk *contextVk,
+                                                    gl::OwnerLevel levelGLStart,
+                                                    gl::OwnerLevel levelGLEnd);
 
     // Limit the input level to the number of levels in subresource update list.
     void clipLevelToUpdateListUpperLimit(gl::OwnerLevel *level) const;
@@ -4014,6 +4326,14 @@ class BufferViewHelper final : public Resource
                           const BufferView **viewOut,
                           VkFormat *viewVkFormatOut);
 
+    // With VK_EXT_descriptor_buffer, texel buffer descriptors are written from the address, range
+    // and format of the view instead of a VkBufferView.
+    void getDescriptorAddressInfo(ErrorContext *context,
+                                  const BufferHelper &buffer,
+                                  VkDeviceSize bufferOffset,
+                                  const Format &format,
+                                  VkDescriptorAddressInfoEXT *addressInfoOut) const;
+
     // Return unique Serial for a bufferView.
     ImageOrBufferViewSubresourceSerial getSerial() const;
 
@@ -108,6 +108,8 @@ constexpr angle::PackedEnumMap<QueueSubmitReason, const char *> kQueueSubmitReas
      "Queue submission imminent due to fallback to CPU when copying texture"},
     {QueueSubmitReason::GenerateMipmapOnCPU,
      "Queue submission imminent due to fallback to CPU when generating mipmaps"},
+    {QueueSubmitReason::TransferQueueUpload,
+     "Queue submission imminent due to uploading an image on the transfer queue"},
     {QueueSubmitReason::ExternalSemaphoreSignal,
      "Queue submission imminent due to external semaphore signal"},
     {QueueSubmitReason::GetQueryResult, "Queue submission imminent after getting query result"},
@@ -180,6 +182,9 @@ constexpr uint32_t kPipelineCacheVersion = 3;
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
 
+// Maximum total size of the transformed SPIR-V kept for reuse by programs that share shaders.
+constexpr size_t kSpvTransformCacheMaxSize = 8 * 1024 * 1024;
+
 // Per the Vulkan specification, ANGLE must indicate the highest version of Vulkan functionality
 // that it uses.  The Vulkan validation layers will issue messages for any core functionality that
 // requires a higher version.
@@ -2124,6 +2129,7 @@ Renderer::Renderer()
       mDefaultUniformBufferSize(kPreferredDefaultUniformBufferSize),
       mDevice(VK_NULL_HANDLE),
       mDeviceLost(false),
+      mSpvTransformCache(kSpvTransformCacheMaxSize),
       mStagingBufferAlignment(1),
       mHostVisibleVertexConversionBufferMemoryTypeIndex(kInvalidMemoryTypeIndex),
       mDeviceLocalVertexConversionBufferMemoryTypeIndex(kInvalidMemoryTypeIndex),
@@ -2199,6 +2205,7 @@ void Renderer::onDestroy(vk::ErrorContext *context)
     ASSERT(mOrphanedBufferBlockList.empty());
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mSpvTransformCache.clear();
 
     mRefCountedEventRecycler.destroy(mDevice);
 
@@ -3210,6 +3217,12 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceProperties, &mTileMemoryHeapProperties);
     }
 
+    if (ExtensionFound(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mDescriptorBufferFeatures);
+        vk::AddToPNextChain(deviceProperties, &mDescriptorBufferProperties);
+    }
+
     if (ExtensionFound(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceProperties, &mShaderCorePropertiesAMD);
@@ -3770,6 +3783,13 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mTileMemoryHeapProperties.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_MEMORY_HEAP_PROPERTIES_QCOM;
 
+    mDescriptorBufferFeatures = {};
+    mDescriptorBufferFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+    mDescriptorBufferProperties = {};
+    mDescriptorBufferProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+
     mShaderCorePropertiesAMD       = {};
     mShaderCorePropertiesAMD.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD;
 
@@ -3869,9 +3889,11 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mExternalFormatResolveFeatures.pNext   = nullptr;
     mExternalFormatResolveProperties.pNext = nullptr;
 #endif
-    mTileMemoryHeapFeatures.pNext   = nullptr;
-    mTileMemoryHeapProperties.pNext = nullptr;
-    mShaderCorePropertiesAMD.pNext  = nullptr;
+    mTileMemoryHeapFeatures.pNext     = nullptr;
+    mTileMemoryHeapProperties.pNext   = nullptr;
+    mDescriptorBufferFeatures.pNext   = nullptr;
+    mDescriptorBufferProperties.pNext = nullptr;
+    mShaderCorePropertiesAMD.pNext    = nullptr;
 }
 
 // See comment above appendDeviceExtensionFeaturesNotPromoted.  Additional extensions are enabled
@@ -4194,6 +4216,16 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mTileMemoryHeapFeatures);
     }
 
+    if (getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // Only the base feature is used; capture/replay and push descriptors are not needed.
+        mDescriptorBufferFeatures.descriptorBufferCaptureReplay      = VK_FALSE;
+        mDescriptorBufferFeatures.descriptorBufferImageLayoutIgnored = VK_FALSE;
+        mDescriptorBufferFeatures.descriptorBufferPushDescriptors    = VK_FALSE;
+        mEnabledDeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mDescriptorBufferFeatures);
+    }
+
     if (getFeatures().supportsAmdShaderCoreProperties.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME);
@@ -4637,6 +4669,10 @@ void Renderer::initDeviceExtensionEntryPoints()
     {
         InitTileMemoryHeapFunctions(mDevice);
     }
+    if (mFeatures.supportsDescriptorBuffer.enabled)
+    {
+        InitDescriptorBufferFunctions(mDevice);
+    }
     // Extensions promoted to Vulkan 1.2
     {
         if (mFeatures.supportsHostQueryReset.enabled)
@@ -4793,7 +4829,7 @@ angle::Result Renderer::createDeviceAndQueue(vk::ErrorContext *context,
     }
 
     uint32_t queueCreateInfoCount                                          = 1;
-    VkDeviceQueueCreateInfo queueCreateInfo[3]                             = {};
+    VkDeviceQueueCreateInfo queueCreateInfo[4]                             = {};
     VkDeviceQueueGlobalPriorityCreateInfo queueGlobalPriorityCreateInfo[3] = {};
 
     // If global priority is supported, we split queueCreateInfo into three groups so that the
@@ -4855,6 +4891,25 @@ angle::Result Renderer::createDeviceAndQueue(vk::ErrorContext *context,
         queueCreateInfo[0].pQueuePriorities = vk::QueueFamily::kQueuePriorities.data();
     }
 
+    // With asyncTransferQueueUploads, a queue of another family is created for uploads if there is
+    // a suitable one.  Otherwise the last of the graphics queues is used.
+    uint32_t transferQueueFamilyIndex = QueueFamily::kInvalidIndex;
+    if (mFeatures.asyncTransferQueueUploads.enabled)
+    {
+        transferQueueFamilyIndex =
+            QueueFamily::FindTransferIndex(mQueueFamilyProperties2, queueFamilyIndex);
+        if (transferQueueFamilyIndex != QueueFamily::kInvalidIndex)
+        {
+            VkDeviceQueueCreateInfo &transferQueueCreateInfo =
+                queueCreateInfo[queueCreateInfoCount++];
+            transferQueueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            transferQueueCreateInfo.flags            = 0;
+            transferQueueCreateInfo.queueFamilyIndex = transferQueueFamilyIndex;
+            transferQueueCreateInfo.queueCount       = 1;
+            transferQueueCreateInfo.pQueuePriorities = &vk::QueueFamily::kQueuePriorityMedium;
+        }
+    }
+
     // Setup device initialization struct
     VkDeviceCreateInfo createInfo    = {};
     createInfo.sType                 = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -4900,6 +4955,18 @@ angle::Result Renderer::createDeviceAndQueue(vk::ErrorContext *context,
     initDeviceExtensionEntryPoints();
 
     ANGLE_TRY(mCommandQueue.init(context, queueFamily, enableProtectedContent, queueCount));
+    if (mFeatures.asyncTransferQueueUploads.enabled)
+    {
+        if (transferQueueFamilyIndex != QueueFamily::kInvalidIndex)
+        {
+            ANGLE_TRY(mCommandQueue.initTransferQueue(context, transferQueueFamilyIndex, 0, false));
+        }
+        else
+        {
+            ANGLE_TRY(mCommandQueue.initTransferQueue(context, queueFamilyIndex, queueCount - 1,
+                                                      enableProtectedContent));
+        }
+    }
     ANGLE_TRY(mCleanUpThread.init());
 
     if (mFeatures.forceMaxUniformBufferSize16KB.enabled)
@@ -6052,6 +6119,8 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 maxComputeWorkGroupInvocations >= 256 &&
                                 ((isAMD && !IsWindows()) || isNvidia || isSamsung));
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, forceGenerateMipmapOnCPU, false);
+
     bool isAdreno540 = mPhysicalDeviceProperties.deviceID == angle::kDeviceID_Adreno540;
     ANGLE_FEATURE_CONDITION(&mFeatures, forceMaxUniformBufferSize16KB,
                             isQualcommProprietary && isAdreno540);
@@ -6561,6 +6630,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
             (libraryBlobsAreReusedByMonolithicPipelines && !isQualcommProprietary &&
              !(IsLinux() && isIntel) && !(IsChromeOS() && isSwiftShader)));
 
+    // The pipeline manifest adds a blob cache entry for every program, so it's opt-in for now.  It
+    // builds on the link time warm up, and has no effect without it.
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpPipelinesFromManifest, false);
+
     // On SwiftShader, no data is retrieved from the pipeline cache, so there is no reason to
     // serialize it or put it in the blob cache.
     // For Windows NVIDIA Vulkan driver, Vulkan pipeline cache will only generate one
@@ -6769,6 +6842,16 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
                             mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
 
+    // Uploading on a separate queue is opt-in.  The graphics submissions synchronize with the
+    // uploads through a timeline semaphore.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncTransferQueueUploads, false);
+    if (!mFeatures.supportsTimelineSemaphore.enabled)
+    {
+        mFeatures.asyncTransferQueueUploads.applyOverride(false);
+    }
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, cacheTransformedSpirv, true);
+
 #if defined(ANGLE_PLATFORM_ANDROID)
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsExternalFormatResolve,
                             mExternalFormatResolveFeatures.externalFormatResolve == VK_TRUE);
@@ -6905,6 +6988,22 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // keep it as an opt-in override instead
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsBufferDeviceAddress, false);
 
+    // VK_EXT_descriptor_buffer is likewise opt-in.  It requires buffer device addresses for the
+    // descriptor ring and for the buffers whose descriptors are written into it.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsDescriptorBuffer, false);
+    if (mFeatures.supportsDescriptorBuffer.enabled)
+    {
+        if (mDescriptorBufferFeatures.descriptorBuffer != VK_TRUE ||
+            mBufferDeviceAddressFeatures.bufferDeviceAddress != VK_TRUE)
+        {
+            mFeatures.supportsDescriptorBuffer.applyOverride(false);
+        }
+        else
+        {
+            mFeatures.supportsBufferDeviceAddress.applyOverride(true);
+        }
+    }
+
     // Disable memory report feature overrides if extension is not supported.
     if ((mFeatures.logMemoryReportCallbacks.enabled || mFeatures.logMemoryReportStats.enabled) &&
         !mMemoryReportFeatures.deviceMemoryReport)
@@ -7260,6 +7359,38 @@ angle::Result Renderer::mergeIntoPipelineCache(vk::ErrorContext *context,
     return angle::Result::Continue;
 }
 
+bool Renderer::getPipelineManifest(const angle::BlobCacheKey &key,
+                                   size_t maxSize,
+                                   angle::MemoryBuffer *manifestOut)
+{
+    if (mGlobalOps == nullptr)
+    {
+        return false;
+    }
+
+    // The blob cache lookup may use the display's scratch buffer, which the pipeline cache
+    // initialization also uses while holding this lock.
+    std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
+
+    angle::BlobCacheValue compressedManifest;
+    return mGlobalOps->getBlob(key, &compressedManifest) &&
+           angle::DecompressBlob(compressedManifest.data(), compressedManifest.size(), maxSize,
+                                 manifestOut);
+}
+
+void Renderer::putPipelineManifest(const angle::BlobCacheKey &key,
+                                   angle::Span<const uint8_t> manifest)
+{
+    angle::MemoryBuffer compressedManifest;
+    if (mGlobalOps == nullptr ||
+        !angle::CompressBlob(manifest.size(), manifest.data(), &compressedManifest))
+    {
+        return;
+    }
+
+    mGlobalOps->putCachedBlob(key, std::move(compressedManifest));
+}
+
 const gl::Caps &Renderer::getNativeCaps() const
 {
     ensureCapsInitialized();
@@ -7424,7 +7555,8 @@ angle::Result Renderer::syncPipelineCacheVk(const gl::Context *contextGL)
         // Create task to compress.
         mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
             std::make_shared<CompressAndStorePipelineCacheTask>(
-                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize));
+                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize),
+            angle::WorkerTaskPriority::CacheCompression);
     }
     else
     {
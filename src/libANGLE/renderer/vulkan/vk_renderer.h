@@ -177,6 +177,11 @@ class Renderer : angle::NonCopyable
     {
         return mPhysicalDeviceProperties;
     }
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &getPhysicalDeviceDescriptorBufferProperties()
+        const
+    {
+        return mDescriptorBufferProperties;
+    }
     const VkPhysicalDeviceDrmPropertiesEXT &getPhysicalDeviceDrmProperties() const
     {
         return mDrmProperties;
@@ -326,6 +331,27 @@ class Renderer : angle::NonCopyable
                                     VkPipelineStageFlags waitSemaphoreStageMasks,
                                     QueueSerial *queueSerialOut);
 
+    // The transfer queue is used for uploads with the asyncTransferQueueUploads feature.  Its
+    // command buffers are submitted with submitTransferCommands, and the returned value must be
+    // waited on by the context's next submission through ContextVk::addTransferQueueWait.
+    bool hasTransferQueue() const { return mCommandQueue.hasTransferQueue(); }
+    const DeviceQueueIndex getTransferDeviceQueueIndex() const
+    {
+        return mCommandQueue.getTransferDeviceQueueIndex();
+    }
+    angle::Result getTransferCommandBuffer(vk::ErrorContext *context,
+                                           vk::ScopedPrimaryCommandBuffer *commandBufferOut)
+    {
+        return mCommandQueue.getTransferCommandBuffer(context, commandBufferOut);
+    }
+    angle::Result submitTransferCommands(vk::ErrorContext *context,
+                                         vk::ScopedPrimaryCommandBuffer &&commandBuffer,
+                                         uint64_t *signalValueOut)
+    {
+        return mCommandQueue.submitTransferCommands(context, std::move(commandBuffer),
+                                                    signalValueOut);
+    }
+
     angle::Result queueSubmitWaitSemaphore(vk::ErrorContext *context,
                                            egl::ContextPriority priority,
                                            const vk::Semaphore &waitSemaphore,
@@ -385,6 +411,12 @@ class Renderer : angle::NonCopyable
     angle::Result mergeIntoPipelineCache(vk::ErrorContext *context,
                                          const vk::PipelineCache &pipelineCache);
 
+    // The pipeline warm up manifests of programs, stored compressed in the blob cache.
+    bool getPipelineManifest(const angle::BlobCacheKey &key,
+                             size_t maxSize,
+                             angle::MemoryBuffer *manifestOut);
+    void putPipelineManifest(const angle::BlobCacheKey &key, angle::Span<const uint8_t> manifest);
+
     const std::vector<const char *> &getSkippedValidationMessages() const
     {
         return mSkippedValidationMessages;
@@ -591,6 +623,7 @@ class Renderer : angle::NonCopyable
     void addBufferBlockToOrphanList(vk::BufferBlock *block) { mOrphanedBufferBlockList.add(block); }
     SamplerCache &getSamplerCache() { return mSamplerCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
+    SpvTransformCache &getSpvTransformCache() { return mSpvTransformCache; }
 
     VkDeviceSize getSuballocationDestroyedSize() const
     {
@@ -939,6 +972,8 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceShaderAtomicInt64Features mShaderAtomicInt64Features;
     VkPhysicalDeviceTileMemoryHeapFeaturesQCOM mTileMemoryHeapFeatures;
     VkPhysicalDeviceTileMemoryHeapPropertiesQCOM mTileMemoryHeapProperties;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT mDescriptorBufferFeatures;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT mDescriptorBufferProperties;
     VkPhysicalDeviceTextureCompressionASTC3DFeaturesEXT mTextureCompressionASTC3DFeatures;
     VkPhysicalDeviceShaderCorePropertiesAMD mShaderCorePropertiesAMD;
 
@@ -970,6 +1005,8 @@ class Renderer : angle::NonCopyable
 
     SamplerCache mSamplerCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
+    // Shared by the programs of all contexts, and used from link threads.
+    SpvTransformCache mSpvTransformCache;
 
     VkDeviceSize mPendingGarbageSizeLimit;
 
@@ -1161,6 +1161,13 @@ PFN_vkGetImageSubresourceLayout2KHR vkGetImageSubresourceLayout2KHR = nullptr;
 // VK_QCOM_tile_memory_heap
 PFN_vkCmdBindTileMemoryQCOM vkCmdBindTileMemoryQCOM = nullptr;
 
+// VK_EXT_descriptor_buffer
+PFN_vkGetDescriptorSetLayoutSizeEXT vkGetDescriptorSetLayoutSizeEXT                   = nullptr;
+PFN_vkGetDescriptorSetLayoutBindingOffsetEXT vkGetDescriptorSetLayoutBindingOffsetEXT = nullptr;
+PFN_vkGetDescriptorEXT vkGetDescriptorEXT                                             = nullptr;
+PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT                       = nullptr;
+PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT             = nullptr;
+
 // VK_KHR_external_fence_capabilities
 PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR vkGetPhysicalDeviceExternalFencePropertiesKHR =
     nullptr;
@@ -1410,6 +1417,16 @@ void InitTileMemoryHeapFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdBindTileMemoryQCOM);
 }
 
+// VK_EXT_descriptor_buffer
+void InitDescriptorBufferFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetDescriptorSetLayoutSizeEXT);
+    GET_DEVICE_FUNC(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    GET_DEVICE_FUNC(vkGetDescriptorEXT);
+    GET_DEVICE_FUNC(vkCmdBindDescriptorBuffersEXT);
+    GET_DEVICE_FUNC(vkCmdSetDescriptorBufferOffsetsEXT);
+}
+
 // VK_GOOGLE_display_timing
 void InitGetPastPresentationTimingGoogleFunction(VkDevice device)
 {
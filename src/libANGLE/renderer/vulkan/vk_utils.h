@@ -390,9 +390,13 @@ class GlobalOps : angle::NonCopyable
 
     virtual void putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value) = 0;
     virtual bool getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut)  = 0;
+    // Like putBlob(), but the blob is also kept in the in-memory cache when the application doesn't
+    // provide one.  Used for small blobs that are looked up often, such as pipeline manifests.
+    virtual void putCachedBlob(const angle::BlobCacheKey &key, angle::MemoryBuffer &&value) = 0;
 
     virtual std::shared_ptr<angle::WaitableEvent> postMultiThreadWorkerTask(
-        const std::shared_ptr<angle::Closure> &task) = 0;
+        const std::shared_ptr<angle::Closure> &task,
+        angle::WorkerTaskPriority priority) = 0;
 
     virtual void notifyDeviceLost() = 0;
 
@@ -1365,6 +1369,19 @@ constexpr bool IsDynamicDescriptor(VkDescriptorType descriptorType)
     }
 }
 
+constexpr VkDescriptorType GetNonDynamicDescriptorType(VkDescriptorType descriptorType)
+{
+    switch (descriptorType)
+    {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        default:
+            return descriptorType;
+    }
+}
+
 constexpr bool IsUniformBuffer(const VkDescriptorType descriptorType)
 {
     return descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
@@ -1478,6 +1495,9 @@ void InitMaintenance5Functions(VkDevice device);
 // VK_QCOM_tile_memory_heap
 void InitTileMemoryHeapFunctions(VkDevice device);
 
+// VK_EXT_descriptor_buffer
+void InitDescriptorBufferFunctions(VkDevice device);
+
 // VK_GOOGLE_display_timing
 void InitGetPastPresentationTimingGoogleFunction(VkDevice device);
 
@@ -1722,6 +1742,7 @@ enum class QueueSubmitReason
     TextureReformatToRenderable,
     CopyTextureOnCPU,
     GenerateMipmapOnCPU,
+    TransferQueueUpload,
 
     // Sync/Query/Timestamp
     ExternalSemaphoreSignal,
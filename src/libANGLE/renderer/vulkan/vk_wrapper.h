@@ -199,6 +199,8 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void beginRenderPass(const VkRenderPassBeginInfo &beginInfo, VkSubpassContents subpassContents);
     void beginRendering(const VkRenderingInfo &beginInfo);
 
+    // VK_EXT_descriptor_buffer.  ANGLE binds a single descriptor buffer, at index 0.
+    void bindDescriptorBuffer(VkDeviceAddress address, VkBufferUsageFlags usage);
     void bindDescriptorSets(const PipelineLayout &layout,
                             VkPipelineBindPoint pipelineBindPoint,
                             DescriptorSetIndex firstSet,
@@ -316,6 +318,7 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void executeCommands(uint32_t commandBufferCount, const CommandBuffer *commandBuffers);
 
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
+    void getCommandBlockStats(size_t *blockCountOut, size_t *allocatedBytesOut) const;
 
     void fillBuffer(const Buffer &dstBuffer,
                     VkDeviceSize dstOffset,
@@ -374,6 +377,11 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void setDepthCompareOp(VkCompareOp depthCompareOp);
     void setDepthTestEnable(VkBool32 depthTestEnable);
     void setDepthWriteEnable(VkBool32 depthWriteEnable);
+    void setDescriptorBufferOffsets(const PipelineLayout &layout,
+                                    VkPipelineBindPoint pipelineBindPoint,
+                                    DescriptorSetIndex firstSet,
+                                    uint32_t setCount,
+                                    const VkDeviceSize *offsets);
     void setEvent(VkEvent event, VkPipelineStageFlags stageMask);
     void setFragmentShadingRate(const VkExtent2D *fragmentSize,
                                 VkFragmentShadingRateCombinerOpKHR ops[2]);
@@ -1077,6 +1085,17 @@ ANGLE_INLINE void CommandBuffer::bindIndexBuffer2(const Buffer &buffer,
         vkCmdBindIndexBuffer2KHR(mHandle, buffer.getHandle(), offset, size, indexType));
 }
 
+ANGLE_INLINE void CommandBuffer::bindDescriptorBuffer(VkDeviceAddress address,
+                                                      VkBufferUsageFlags usage)
+{
+    ASSERT(valid() && address != 0);
+    VkDescriptorBufferBindingInfoEXT bindingInfo = {};
+    bindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+    bindingInfo.address = address;
+    bindingInfo.usage   = usage;
+    VK_SECONDARY_CMD_CALL(vkCmdBindDescriptorBuffersEXT(this->mHandle, 1, &bindingInfo));
+}
+
 ANGLE_INLINE void CommandBuffer::bindDescriptorSets(const PipelineLayout &layout,
                                                     VkPipelineBindPoint pipelineBindPoint,
                                                     DescriptorSetIndex firstSet,
@@ -1107,6 +1126,14 @@ ANGLE_INLINE void CommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
     *allocatedMemoryOut = 1;
 }
 
+ANGLE_INLINE void CommandBuffer::getCommandBlockStats(size_t *blockCountOut,
+                                                      size_t *allocatedBytesOut) const
+{
+    // The memory is managed by the driver.
+    *blockCountOut     = 0;
+    *allocatedBytesOut = 0;
+}
+
 ANGLE_INLINE void CommandBuffer::fillBuffer(const Buffer &dstBuffer,
                                             VkDeviceSize dstOffset,
                                             VkDeviceSize size,
@@ -1171,6 +1198,22 @@ ANGLE_INLINE void CommandBuffer::setDepthWriteEnable(VkBool32 depthWriteEnable)
     VK_SECONDARY_CMD_CALL(vkCmdSetDepthWriteEnableEXT(mHandle, depthWriteEnable));
 }
 
+ANGLE_INLINE void CommandBuffer::setDescriptorBufferOffsets(const PipelineLayout &layout,
+                                                            VkPipelineBindPoint pipelineBindPoint,
+                                                            DescriptorSetIndex firstSet,
+                                                            uint32_t setCount,
+                                                            const VkDeviceSize *offsets)
+{
+    // All sets are in the one descriptor buffer bound by bindDescriptorBuffer().  There are at
+    // most four descriptor sets (see DescriptorSetIndex).
+    constexpr uint32_t kBufferIndices[4] = {};
+    ASSERT(valid() && layout.valid());
+    ASSERT(setCount <= 4);
+    VK_SECONDARY_CMD_CALL(vkCmdSetDescriptorBufferOffsetsEXT(
+        this->mHandle, pipelineBindPoint, layout.getHandle(), ToUnderlying(firstSet), setCount,
+        kBufferIndices, offsets));
+}
+
 ANGLE_INLINE void CommandBuffer::setEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ASSERT(valid() && event != VK_NULL_HANDLE);
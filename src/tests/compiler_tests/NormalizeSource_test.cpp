@@ -0,0 +1,128 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NormalizeSource_test.cpp:
+//   Tests that sh::GetNormalizedSource only ignores the parts of the source that cannot change the
+//   result of a successful compilation.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+std::string Normalize(const char *source)
+{
+    std::string normalized;
+    EXPECT_TRUE(sh::GetNormalizedSource(&source, 1, &normalized)) << source;
+    return normalized;
+}
+
+void ExpectSameNormalizedSource(const char *source1, const char *source2)
+{
+    EXPECT_EQ(Normalize(source1), Normalize(source2));
+}
+
+void ExpectDifferentNormalizedSource(const char *source1, const char *source2)
+{
+    EXPECT_NE(Normalize(source1), Normalize(source2));
+}
+
+constexpr char kShader[] = R"(#version 300 es
+precision mediump float;
+out vec4 color;
+void main()
+{
+    color = vec4(1.0, 0.0, 0.0, 1.0);
+})";
+
+// Comments and white space are ignored.
+TEST(NormalizeSourceTest, CommentsAndWhiteSpace)
+{
+    constexpr char kVariant[] = R"(#version 300 es
+precision   mediump  float; // Default precision
+/* The output
+   color */ out vec4 color;
+void main() { color = vec4(1.0,0.0,0.0,1.0); }
+
+)";
+    ExpectSameNormalizedSource(kShader, kVariant);
+}
+
+// #line directives are ignored.
+TEST(NormalizeSourceTest, LineDirectives)
+{
+    constexpr char kVariant[] = R"(#version 300 es
+#line 100
+precision mediump float;
+#line 20 3
+out vec4 color;
+void main()
+{
+    color = vec4(1.0, 0.0, 0.0, 1.0);
+})";
+    ExpectSameNormalizedSource(kShader, kVariant);
+}
+
+// Line continuations and the sources being split into multiple strings are ignored.
+TEST(NormalizeSourceTest, MultipleStrings)
+{
+    const char *kStrings[] = {"#version 300 es\nprecision mediump float;\nout vec4 col",
+                              "or;\nvoid main()\n{\n    color = vec4(1.0, 0.0, \\\n0.0, 1.0);\n}"};
+    std::string normalized;
+    EXPECT_TRUE(sh::GetNormalizedSource(kStrings, 2, &normalized));
+    EXPECT_EQ(Normalize(kShader), normalized);
+}
+
+// Tokens are not merged or reordered.
+TEST(NormalizeSourceTest, Tokens)
+{
+    ExpectDifferentNormalizedSource("void main() { int a = 1; a++; }",
+                                    "void main() { int a = 1; a + +; }");
+    ExpectDifferentNormalizedSource("void main() { int a = 1; }", "void main() { int a = 01; }");
+}
+
+// Directives are kept, as is the white space that tells function-like macros apart from
+// object-like ones.
+TEST(NormalizeSourceTest, Directives)
+{
+    ExpectSameNormalizedSource("#define F(x) x\nvoid main() {}",
+                               "#  define F(x)  x // Identity\nvoid main() {}");
+    ExpectDifferentNormalizedSource("#define F(x) x\nvoid main() {}",
+                                    "#define F (x) x\nvoid main() {}");
+    ExpectDifferentNormalizedSource("#define A 1\nvoid main() {}", "#define A\n1\nvoid main() {}");
+    ExpectDifferentNormalizedSource("void f() {}\n#line 10 a\nvoid main() {}",
+                                    "void f() {}\nvoid main() {}");
+}
+
+// The white space between the tokens of a directive is kept, as a macro can only be redefined with
+// the same white space separation.
+TEST(NormalizeSourceTest, MacroRedefinition)
+{
+    ExpectDifferentNormalizedSource("#define A 1 + 2\n#define A 1 + 2\nvoid main() {}",
+                                    "#define A 1 + 2\n#define A 1+2\nvoid main() {}");
+    ExpectSameNormalizedSource("#define A 1 + 2\n#define A 1+2\nvoid main() {}",
+                               "#define A 1  +\t2\n#define A 1+2 // Redefined\nvoid main() {}");
+}
+
+// The line of #version is significant, and so are #line directives that could change it.
+TEST(NormalizeSourceTest, VersionLine)
+{
+    ExpectDifferentNormalizedSource(kShader, (std::string("\n") + kShader).c_str());
+    ExpectDifferentNormalizedSource("#line 0\nvoid main() {}", "void main() {}");
+}
+
+// Sources that depend on line numbers are not normalized.
+TEST(NormalizeSourceTest, LineDependentSources)
+{
+    const char *kLine = "void main() { int a = __LINE__; }";
+    const char *kFile = "void main() { int a = __FILE__; }";
+    std::string normalized;
+    EXPECT_FALSE(sh::GetNormalizedSource(&kLine, 1, &normalized));
+    EXPECT_FALSE(sh::GetNormalizedSource(&kFile, 1, &normalized));
+}
+
+}  // anonymous namespace
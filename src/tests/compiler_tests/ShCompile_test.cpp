@@ -8,6 +8,7 @@
 //
 
 #include <clocale>
+#include <cstring>
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
 #include "common/angleutils.h"
@@ -140,6 +141,86 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
     testCompile(shaderStrings, 3, true);
 }
 
+// Test that the memory statistics of a compilation are reported, and that a second compilation on
+// the same thread reuses the memory of the first.
+TEST_F(ShCompileTest, MemoryStats)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}";
+
+    const char *shaderStrings[] = {shaderString.c_str()};
+
+    testCompile(shaderStrings, 1, true);
+    ShCompileMemoryStats firstStats = sh::GetCompileMemoryStats(mCompiler);
+    EXPECT_GT(firstStats.allocationCount, 0u);
+    EXPECT_GT(firstStats.allocatedBytes, 0u);
+
+    testCompile(shaderStrings, 1, true);
+    ShCompileMemoryStats secondStats = sh::GetCompileMemoryStats(mCompiler);
+    EXPECT_EQ(firstStats.allocationCount, secondStats.allocationCount);
+    EXPECT_EQ(firstStats.allocatedBytes, secondStats.allocatedBytes);
+
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    EXPECT_GT(secondStats.peakPageCount, 0u);
+    EXPECT_GE(secondStats.peakBytes, secondStats.allocatedBytes);
+    EXPECT_GT(secondStats.recycledPageCount, 0u);
+#endif
+
+    sh::ClearResults(mCompiler);
+    EXPECT_EQ(0u, sh::GetCompileMemoryStats(mCompiler).allocationCount);
+}
+
+// Test that the phases of a compilation are only reported when requested, and that they nest.
+TEST_F(ShCompileTest, PhaseStats)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}";
+
+    const char *shaderStrings[] = {shaderString.c_str()};
+
+    testCompile(shaderStrings, 1, true);
+    EXPECT_TRUE(sh::GetCompilePhaseStats(mCompiler).empty());
+
+    ShCompileOptions options    = {};
+    options.objectCode          = true;
+    options.initOutputVariables = true;
+    options.collectPhaseStats   = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options));
+
+    const std::vector<ShCompilePhaseStats> &phases = sh::GetCompilePhaseStats(mCompiler);
+    ASSERT_FALSE(phases.empty());
+    EXPECT_STREQ("Parse", phases[0].name);
+    EXPECT_EQ(0u, phases[0].depth);
+    EXPECT_GT(phases[0].allocatedBytes, 0u);
+
+    bool foundSimplify  = false;
+    bool foundTranslate = false;
+    for (size_t index = 0; index < phases.size(); ++index)
+    {
+        const ShCompilePhaseStats &phase = phases[index];
+        EXPECT_GE(phase.seconds, 0.0);
+        foundSimplify  = foundSimplify || strcmp(phase.name, "CheckAndSimplifyAST") == 0;
+        foundTranslate = foundTranslate || strcmp(phase.name, "Translate") == 0;
+
+        // A nested phase is enclosed by the phase before it, or by one of its parents.
+        if (index > 0)
+        {
+            EXPECT_LE(phase.depth, phases[index - 1].depth + 1);
+        }
+    }
+    EXPECT_TRUE(foundSimplify);
+    EXPECT_TRUE(foundTranslate);
+
+    // The AST passes are nested in CheckAndSimplifyAST.
+    EXPECT_GT(phases.size(), 3u);
+}
+
 // Parsing floats in shaders can run afoul of locale settings.
 // Eg. in de_DE, `strtof("1.5")` will yield `1.0f`. (It's expecting "1.5")
 TEST_F(ShCompileTest, DecimalSepLocale)
@@ -456,6 +456,147 @@ void main()
     glDeleteShader(shaderID);
 }
 
+// Checks that shaders that differ only in comments, white space and #line directives share an entry
+// in the shader cache.
+TEST_P(BlobCacheTest, ShaderCacheNormalizedSource)
+{
+    ANGLE_SKIP_TEST_IF(!getEGLWindow()->isFeatureEnabled(Feature::CacheCompiledShader));
+    ANGLE_SKIP_TEST_IF(getEGLWindow()->isFeatureEnabled(Feature::DisableProgramCaching));
+
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+    ANGLE_SKIP_TEST_IF(getClientMajorVersion() < 3);
+
+    TestUserData data;
+    glBlobCacheCallbacksANGLE(SetBlob, GetBlob, &data);
+    ASSERT_GL_NO_ERROR();
+
+    constexpr char kFragmentShaderSrc[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+})";
+
+    constexpr char kFragmentShaderVariantSrc[] = R"(#version 300 es
+// Variant 2
+#line 1 2
+precision mediump float;
+uniform vec4 color;  /* The color to output */
+out vec4 fragColor;
+
+void main() { fragColor = color; }
+)";
+
+    constexpr char kFragmentShaderLineSrc[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color * float(__LINE__ > 0);
+})";
+
+    // Compile a shader so it puts something in the cache
+    GLuint shaderID = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    ASSERT_TRUE(shaderID != 0);
+    EXPECT_EQ(CacheOpResult::SetSuccess, data.cacheOpResult);
+    data.cacheOpResult = CacheOpResult::ValueNotSet;
+    glDeleteShader(shaderID);
+
+    // Compile the variant, which should be retrieved from the cache
+    shaderID = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderVariantSrc);
+    ASSERT_TRUE(shaderID != 0);
+    EXPECT_EQ(CacheOpResult::GetSuccess, data.cacheOpResult);
+    data.cacheOpResult = CacheOpResult::ValueNotSet;
+    glDeleteShader(shaderID);
+
+    // Compile a shader that uses __LINE__, which depends on the line numbers and should create a
+    // new entry
+    shaderID = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderLineSrc);
+    ASSERT_TRUE(shaderID != 0);
+    EXPECT_EQ(CacheOpResult::SetSuccess, data.cacheOpResult);
+    data.cacheOpResult = CacheOpResult::ValueNotSet;
+    glDeleteShader(shaderID);
+
+    // Use the variant in a program to make sure the shader loaded from the cache is functional
+    ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), kFragmentShaderVariantSrc);
+    glUseProgram(program);
+    glUniform4f(glGetUniformLocation(program, "color"), 0, 1, 0, 1);
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Checks that the shader cache statistics reported through the performance counters count hits,
+// misses and hits on entries compiled from a different but equivalent source.
+TEST_P(BlobCacheTest, ShaderCacheStatistics)
+{
+    ANGLE_SKIP_TEST_IF(!getEGLWindow()->isFeatureEnabled(Feature::CacheCompiledShader));
+    ANGLE_SKIP_TEST_IF(getEGLWindow()->isFeatureEnabled(Feature::DisableProgramCaching));
+
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    TestUserData data;
+    glBlobCacheCallbacksANGLE(SetBlob, GetBlob, &data);
+    ASSERT_GL_NO_ERROR();
+
+    GLPerfMonitor monitor;
+    glBeginPerfMonitorAMD(monitor);
+
+    const CounterNameToIndexMap indexMap   = BuildCounterNameToIndexMap();
+    const angle::VulkanPerfCounters before = GetPerfCounters(indexMap);
+
+    constexpr char kFragmentShaderSrc[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color;
+})";
+
+    constexpr char kFragmentShaderVariantSrc[] = R"(precision mediump float;
+uniform vec4 color; // The color to output
+void main() { gl_FragColor = color; }
+)";
+
+    constexpr char kOtherFragmentShaderSrc[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color.bgra;
+})";
+
+    // A miss, which puts the shader in the cache.
+    GLuint shaderID = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    ASSERT_NE(shaderID, 0u);
+    glDeleteShader(shaderID);
+
+    // A hit on the same source.
+    shaderID = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    ASSERT_NE(shaderID, 0u);
+    glDeleteShader(shaderID);
+
+    // A hit on an equivalent source.
+    shaderID = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderVariantSrc);
+    ASSERT_NE(shaderID, 0u);
+    glDeleteShader(shaderID);
+
+    // A miss on a different shader.
+    shaderID = CompileShader(GL_FRAGMENT_SHADER, kOtherFragmentShaderSrc);
+    ASSERT_NE(shaderID, 0u);
+    glDeleteShader(shaderID);
+
+    const angle::VulkanPerfCounters after = GetPerfCounters(indexMap);
+    EXPECT_EQ(before.shaderCacheHits + 2, after.shaderCacheHits);
+    EXPECT_EQ(before.shaderCacheMisses + 2, after.shaderCacheMisses);
+    EXPECT_EQ(before.shaderCacheNormalizedSourceHits + 1, after.shaderCacheNormalizedSourceHits);
+    EXPECT_GE(after.shaderCacheSavedCompileDurationUs, before.shaderCacheSavedCompileDurationUs);
+
+    glEndPerfMonitorAMD(monitor);
+}
+
 // Makes sure ANGLE recovers from corrupted cache.
 TEST_P(BlobCacheTest, CacheCorruption)
 {
@@ -2891,7 +2891,11 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     ES2_OPENGLES().enable(Feature::UseIntermediateTextureForGenerateMipmap),
     ES2_OPENGLES()
         .enable(Feature::UseIntermediateTextureForGenerateMipmap)
-        .enable(Feature::UseIntermediateTextureForGenerateMipmap));
+        .enable(Feature::UseIntermediateTextureForGenerateMipmap),
+    ES2_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+    ES2_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads),
+    ES3_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+    ES3_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Mipmap3DBoxFilterTest);
 ANGLE_INSTANTIATE_TEST(Mipmap3DBoxFilterTest,
@@ -2902,7 +2906,9 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MipmapTestES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(MipmapTestES3,
                                ES3_OPENGL().enable(Feature::RecreateMipmapLevelsBeforeGenerate),
                                ES3_OPENGLES().enable(Feature::RecreateMipmapLevelsBeforeGenerate),
-                               ES3_WEBGPU());
+                               ES3_WEBGPU(),
+                               ES3_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+                               ES3_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MipmapTestES31);
 ANGLE_INSTANTIATE_TEST_ES31_AND(
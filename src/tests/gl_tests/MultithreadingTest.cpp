@@ -731,6 +731,135 @@ TEST_P(MultithreadingTest, CreateMultiSharedContextAndDraw)
     EXPECT_EGL_SUCCESS();
 }
 
+// Test that shared contexts can create, look up and delete buffers concurrently when the share
+// group has tens of thousands of buffers, so that the buffer ids are well past the flat part of the
+// resource map.
+TEST_P(MultithreadingTest, MultiSharedContextManyBuffers)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    EGLWindow *window             = getEGLWindow();
+    EGLDisplay dpy                = window->getDisplay();
+    EGLConfig config              = window->getConfig();
+    EGLContext mainCtx            = window->getContext();
+    constexpr EGLint kPBufferSize = 256;
+
+    constexpr size_t kThreadCount         = 8;
+    constexpr GLsizei kInitialBufferCount = 40000;
+    constexpr GLsizei kBuffersPerBatch    = 1000;
+    constexpr size_t kIterationsPerThread = 8;
+
+    // Fill the share group with buffers, and give each thread one of the last ones to draw with.
+    auto quadVertices = GetQuadVertices();
+    std::vector<GLuint> initialBuffers(kInitialBufferCount);
+    glGenBuffers(kInitialBufferCount, initialBuffers.data());
+    std::array<GLuint, kThreadCount> drawBuffers;
+    for (size_t threadIdx = 0; threadIdx < kThreadCount; threadIdx++)
+    {
+        drawBuffers[threadIdx] = initialBuffers[kInitialBufferCount - 1 - threadIdx];
+        glBindBuffer(GL_ARRAY_BUFFER, drawBuffers[threadIdx]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 3 * 6, quadVertices.data(),
+                     GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glFinish();
+    ASSERT_GL_NO_ERROR();
+
+    EGLint pbufferAttributes[] = {
+        EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+    };
+
+    std::vector<std::thread> threads(kThreadCount);
+    std::atomic<uint32_t> numOfContextsCreated(0);
+    std::mutex mutex;
+    for (size_t threadIdx = 0; threadIdx < kThreadCount; threadIdx++)
+    {
+        threads[threadIdx] = std::thread([&, threadIdx]() {
+            EGLSurface surface = EGL_NO_SURFACE;
+            EGLContext ctx     = EGL_NO_CONTEXT;
+
+            {
+                std::lock_guard<decltype(mutex)> lock(mutex);
+                surface = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+                EXPECT_EGL_SUCCESS();
+                ctx = createMultithreadedContext(window, mainCtx);
+                EXPECT_NE(EGL_NO_CONTEXT, ctx);
+                EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, ctx));
+                EXPECT_EGL_SUCCESS();
+                numOfContextsCreated++;
+            }
+
+            // Wait for all contexts created.
+            while (numOfContextsCreated < kThreadCount)
+            {
+            }
+
+            {
+                ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(),
+                                 essl1_shaders::fs::UniformColor());
+                glUseProgram(program);
+
+                GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+                GLint positionLocation =
+                    glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+
+                for (size_t iteration = 0; iteration < kIterationsPerThread; iteration++)
+                {
+                    // Create more buffers while the other threads do the same, so that the
+                    // resource map grows concurrently with the lookups.
+                    std::vector<GLuint> buffers(kBuffersPerBatch);
+                    glGenBuffers(kBuffersPerBatch, buffers.data());
+                    for (GLuint buffer : buffers)
+                    {
+                        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                        EXPECT_GL_TRUE(glIsBuffer(buffer));
+                    }
+
+                    glBindBuffer(GL_ARRAY_BUFFER, drawBuffers[threadIdx]);
+                    glEnableVertexAttribArray(positionLocation);
+                    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+                    const GLColor color(static_cast<GLubyte>(threadIdx % 255),
+                                        static_cast<GLubyte>(iteration % 255), 0, 255);
+                    const angle::Vector4 floatColor = color.toNormalizedVector();
+                    glUniform4fv(colorLocation, 1, floatColor.data());
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+
+                    glDeleteBuffers(kBuffersPerBatch, buffers.data());
+                    for (GLuint buffer : buffers)
+                    {
+                        EXPECT_GL_FALSE(glIsBuffer(buffer));
+                    }
+                }
+
+                EXPECT_GL_NO_ERROR();
+            }
+
+            {
+                std::lock_guard<decltype(mutex)> lock(mutex);
+                EXPECT_EGL_TRUE(
+                    eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+                EXPECT_EGL_SUCCESS();
+                eglDestroySurface(dpy, surface);
+                eglDestroyContext(dpy, ctx);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (GLuint buffer : initialBuffers)
+    {
+        EXPECT_GL_TRUE(glIsBuffer(buffer));
+    }
+    glDeleteBuffers(kInitialBufferCount, initialBuffers.data());
+    ASSERT_GL_NO_ERROR();
+}
+
 // Producer/Consumer test using EGLImages and EGLSyncs
 TEST_P(MultithreadingTest, EGLImageProduceConsume)
 {
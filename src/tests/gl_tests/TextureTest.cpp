@@ -23811,7 +23811,8 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3,
                                ES3_VULKAN().enable(Feature::AllocateNonZeroMemory),
                                ES3_VULKAN().enable(Feature::ForceFallbackFormat),
-                               ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferBGR565ToRGB565));
+                               ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferBGR565ToRGB565),
+                               ES3_VULKAN_SWIFTSHADER().enable(Feature::SupportsDescriptorBuffer));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DMemoryTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(Texture2DMemoryTestES3);
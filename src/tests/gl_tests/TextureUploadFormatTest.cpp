@@ -705,7 +705,15 @@ TEST_P(TextureUploadFormatTest, InvalidTypeAndFormat)
     }
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(TextureUploadFormatTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    TextureUploadFormatTest,
+    ES2_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+    ES2_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads),
+    ES3_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+    ES3_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TextureUploadFormatTest_ES3);
-ANGLE_INSTANTIATE_TEST_ES3(TextureUploadFormatTest_ES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(
+    TextureUploadFormatTest_ES3,
+    ES3_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+    ES3_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads));
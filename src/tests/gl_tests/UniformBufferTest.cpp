@@ -4978,7 +4978,8 @@ void main()
 }
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformBufferTest);
-ANGLE_INSTANTIATE_TEST_ES3(UniformBufferTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(UniformBufferTest,
+                               ES3_VULKAN_SWIFTSHADER().enable(Feature::SupportsDescriptorBuffer));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformBufferShadowBufferTest);
 ANGLE_INSTANTIATE_TEST_ES3_AND(UniformBufferShadowBufferTest,
@@ -9,6 +9,7 @@
 
 #include "test_utils/ANGLETest.h"
 #include "test_utils/gl_raii.h"
+#include "util/shader_utils.h"
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -17,6 +18,8 @@
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
+#include <random>
+
 using namespace angle;
 
 namespace
@@ -98,6 +101,114 @@ TEST_P(VulkanDescriptorSetTest, AtomicCounterReadLimitedDescriptorPool)
     }
 }
 
+class VulkanDescriptorBufferTest : public ANGLETest<>
+{
+  protected:
+    VulkanDescriptorBufferTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    gl::Context *hackContext() const
+    {
+        egl::Display *display   = static_cast<egl::Display *>(getEGLWindow()->getDisplay());
+        gl::ContextID contextID = {
+            static_cast<GLuint>(reinterpret_cast<uintptr_t>(getEGLWindow()->getContext()))};
+        return display->getContext(contextID);
+    }
+
+    rx::ContextVk *hackANGLE() const
+    {
+        // Hack the angle!
+        return rx::GetImplAs<rx::ContextVk>(hackContext());
+    }
+};
+
+// Test that with VK_EXT_descriptor_buffer, drawing with textures, default uniforms and uniform
+// buffers allocates no descriptor sets, and that the sets are only copied into the descriptor ring
+// when they change.
+TEST_P(VulkanDescriptorBufferTest, NoDescriptorSetAllocations)
+{
+    rx::ContextVk *contextVk = hackANGLE();
+    // The feature is turned off if the device doesn't support descriptorBuffer or
+    // bufferDeviceAddress, even if the test enables it.
+    ANGLE_SKIP_TEST_IF(!contextVk->getFeatures().supportsDescriptorBuffer.enabled);
+
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform sampler2D tex;
+uniform vec4 color;
+layout(std140) uniform Block
+{
+    vec4 blockColor;
+};
+out vec4 fragColor;
+void main()
+{
+    fragColor = texture(tex, vec2(0.5)) + color + blockColor;
+})";
+
+    ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+
+    const GLColor kRed(255, 0, 0, 0);
+    const GLColor kBlue(0, 0, 255, 0);
+    GLTexture textures[2];
+    for (uint32_t index = 0; index < 2; ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     index == 0 ? &kRed : &kBlue);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    glBindTexture(GL_TEXTURE_2D, textures[0]);
+
+    const float kGreen[4] = {0.0f, 1.0f, 0.0f, 0.0f};
+    GLBuffer uniformBuffer;
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(kGreen), kGreen, GL_STATIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, uniformBuffer);
+    glUniformBlockBinding(program, glGetUniformBlockIndex(program, "Block"), 0);
+
+    const GLint colorLocation = glGetUniformLocation(program, "color");
+    ASSERT_NE(colorLocation, -1);
+    glUniform4f(colorLocation, 0.0f, 0.0f, 0.0f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+
+    const uint64_t expectedAllocations = contextVk->getPerfCounters().descriptorSetAllocations;
+
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    uint64_t expectedCopies = contextVk->getPerfCounters().descriptorBufferSetCopies;
+
+    // Nothing changed, so nothing is copied again.
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    EXPECT_EQ(expectedCopies, contextVk->getPerfCounters().descriptorBufferSetCopies);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
+
+    // Only the set of the default uniforms changes.
+    glUniform4f(colorLocation, 0.0f, 0.0f, 0.0f, 0.5f);
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    EXPECT_EQ(expectedCopies + 1, contextVk->getPerfCounters().descriptorBufferSetCopies);
+    EXPECT_PIXEL_COLOR_NEAR(0, 0, GLColor(255, 255, 0, 127), 1);
+
+    // Only the set of the textures changes.
+    expectedCopies = contextVk->getPerfCounters().descriptorBufferSetCopies;
+    glBindTexture(GL_TEXTURE_2D, textures[1]);
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    EXPECT_EQ(expectedCopies + 1, contextVk->getPerfCounters().descriptorBufferSetCopies);
+    EXPECT_PIXEL_COLOR_NEAR(0, 0, GLColor(0, 255, 255, 127), 1);
+
+    EXPECT_EQ(expectedAllocations, contextVk->getPerfCounters().descriptorSetAllocations);
+    ASSERT_GL_NO_ERROR();
+}
+
 class VulkanDescriptorSetLayoutDescTest : public ANGLETest<>
 {
   protected:
@@ -243,8 +354,72 @@ TEST_P(VulkanDescriptorSetLayoutDescTest, DestroyWithPendingGarbage)
     mDescriptorSetLayoutCache.destroy(contextVk->getRenderer());
 }
 
+// Test that the hash of a DescriptorSetDesc that is updated incrementally as textures are bound
+// and unbound matches the hash of the same desc computed from scratch.
+TEST(VulkanDescriptorSetDescTest, IncrementalHashMatchesFullHash)
+{
+    constexpr uint32_t kDescriptorCount = 16;
+    constexpr uint32_t kIterationCount  = 1000;
+
+    auto makeTextureInfoDesc = [](uint32_t serial) {
+        rx::vk::DescriptorInfoDesc infoDesc           = {};
+        infoDesc.samplerOrBufferSerialOrStorageFormat = serial;
+        infoDesc.imageViewSerialOrOffset              = serial * 3 + 1;
+        infoDesc.imageLayoutOrRange                   = serial % 7;
+        infoDesc.imageSubresourceRange                = serial % 5;
+        return infoDesc;
+    };
+
+    auto computeFullHash = [](const rx::vk::DescriptorSetDesc &desc) {
+        rx::vk::DescriptorSetDesc fullDesc;
+        fullDesc.resize(desc.size());
+        for (uint32_t infoDescIndex = 0; infoDescIndex < desc.size(); ++infoDescIndex)
+        {
+            fullDesc.getInfoDesc(infoDescIndex) = desc.getInfoDescs()[infoDescIndex];
+        }
+        return fullDesc.hash();
+    };
+
+    rx::vk::DescriptorSetDesc desc;
+    desc.resize(kDescriptorCount);
+    // Compute the hash so that it is updated incrementally from here on.
+    const size_t emptyHash = desc.hash();
+
+    std::mt19937 rng(0x1234);
+    for (uint32_t iteration = 0; iteration < kIterationCount; ++iteration)
+    {
+        uint32_t infoDescIndex = rng() % kDescriptorCount;
+        // Bind one of a few textures, or unbind the texture.
+        uint32_t serial                     = rng() % 4;
+        rx::vk::DescriptorInfoDesc infoDesc = serial == 0 ? rx::vk::DescriptorInfoDesc{}
+                                                          : makeTextureInfoDesc(serial);
+
+        const bool expectChanged =
+            memcmp(&desc.getInfoDescs()[infoDescIndex], &infoDesc, sizeof(infoDesc)) != 0;
+        EXPECT_EQ(desc.updateInfoDesc(infoDescIndex, infoDesc), expectChanged);
+        ASSERT_EQ(desc.hash(), computeFullHash(desc)) << "iteration " << iteration;
+    }
+
+    // Unbinding everything gets back to the hash of the empty desc.
+    for (uint32_t infoDescIndex = 0; infoDescIndex < kDescriptorCount; ++infoDescIndex)
+    {
+        desc.updateInfoDesc(infoDescIndex, {});
+    }
+    EXPECT_EQ(desc.hash(), emptyHash);
+    EXPECT_EQ(desc.hash(), computeFullHash(desc));
+
+    // The same texture bound at different indices must not cancel out in the hash.
+    desc.updateInfoDesc(0, makeTextureInfoDesc(1));
+    desc.updateInfoDesc(1, makeTextureInfoDesc(1));
+    EXPECT_NE(desc.hash(), emptyHash);
+    EXPECT_EQ(desc.hash(), computeFullHash(desc));
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanDescriptorSetTest, ES31_VULKAN(), ES31_VULKAN_SWIFTSHADER());
 ANGLE_INSTANTIATE_TEST(VulkanDescriptorSetLayoutDescTest, ES31_VULKAN(), ES31_VULKAN_SWIFTSHADER());
+ANGLE_INSTANTIATE_TEST(VulkanDescriptorBufferTest,
+                       ES3_VULKAN().enable(Feature::SupportsDescriptorBuffer),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::SupportsDescriptorBuffer));
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanDescriptorSetLayoutDescTest);
 
 }  // namespace
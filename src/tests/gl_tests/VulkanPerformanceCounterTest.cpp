@@ -839,6 +839,163 @@ TEST_P(VulkanPerformanceCounterTest, NewTextureDoesNotBreakRenderPass)
     EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
 }
 
+// Tests that binding another framebuffer and binding back without using it merges the draws into
+// the same render pass.
+TEST_P(VulkanPerformanceCounterTest, SwitchFramebufferAndBackMergesRenderPass)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr GLsizei kSize = 16;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    GLTexture otherTexture;
+    glBindTexture(GL_TEXTURE_2D, otherTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLFramebuffer otherFramebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, otherFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, otherTexture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Passthrough(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorUniformLocation =
+        glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorUniformLocation);
+    ASSERT_GL_NO_ERROR();
+
+    // Start a render pass on the first framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, kSize, kSize);
+    glUniform4f(colorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    // Reactivating the render pass without deferred clears to apply is not counted as a merge.
+    uint64_t expectedRenderPassCount       = getPerfCounters().renderPasses;
+    uint64_t expectedMergedRenderPassCount = getPerfCounters().renderPassesMerged;
+
+    // Switch to the other framebuffer and back, then draw again.
+    glBindFramebuffer(GL_FRAMEBUFFER, otherFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glUniform4f(colorUniformLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    // Make sure the render pass was reactivated instead of starting a new one.
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+    EXPECT_EQ(expectedMergedRenderPassCount, getPerfCounters().renderPassesMerged);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSize, kSize, GLColor::yellow);
+}
+
+// Tests that a clear of the attachment through another framebuffer is applied in the render pass
+// that is already started on the framebuffer, instead of starting a new render pass.
+TEST_P(VulkanPerformanceCounterTest, ClearThroughOtherFramebufferMergesRenderPass)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr GLsizei kSize = 16;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // A second framebuffer with the same attachment.
+    GLFramebuffer otherFramebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, otherFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Passthrough(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorUniformLocation =
+        glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorUniformLocation);
+    ASSERT_GL_NO_ERROR();
+
+    // Start a render pass on the first framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, kSize, kSize);
+    glUniform4f(colorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    uint64_t expectedRenderPassCount       = getPerfCounters().renderPasses;
+    uint64_t expectedMergedRenderPassCount = getPerfCounters().renderPassesMerged + 1;
+
+    // Clear the attachment through the other framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, otherFramebuffer);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Draw to part of the attachment through the first framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, kSize / 2, kSize / 2);
+    glUniform4f(colorUniformLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    // Make sure the clear was applied in the reactivated render pass.
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+    EXPECT_EQ(expectedMergedRenderPassCount, getPerfCounters().renderPassesMerged);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - 1, kSize / 2 - 1, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::blue);
+}
+
+// Tests that a render pass that ends up with no effect is elided.  A clear of a 3D texture layer
+// opens a render pass that is otherwise empty, and invalidating the attachment removes the clear.
+TEST_P(VulkanPerformanceCounterTest, InvalidatedClearRenderPassIsElided)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr GLsizei kSize = 16;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_3D, texture);
+    glTexImage3D(GL_TEXTURE_3D, 0, GL_RGBA8, kSize, kSize, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 nullptr);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, 1);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    ASSERT_GL_NO_ERROR();
+
+    uint64_t expectedRenderPassCount       = getPerfCounters().renderPasses + 1;
+    uint64_t expectedElidedRenderPassCount = getPerfCounters().renderPassesElided + 1;
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const GLenum discard = GL_COLOR_ATTACHMENT0;
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &discard);
+    glFinish();
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+    EXPECT_EQ(expectedElidedRenderPassCount, getPerfCounters().renderPassesElided);
+}
+
 // Tests that each update for a large cube map face results in outside command buffer submission.
 TEST_P(VulkanPerformanceCounterTest, LargeCubeMapUpdatesSubmitsOutsideCommandBuffer)
 {
@@ -8640,6 +8797,52 @@ TEST_P(VulkanPerformanceCounterTest, AsyncMonolithicPipelineCreation)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+class VulkanPerformanceCounterTest_PipelineManifest : public VulkanPerformanceCounterTest
+{};
+
+// Verify that a pipeline created at draw time is recorded in the program's manifest, and is warmed
+// up when a program with the same shaders is linked again.
+TEST_P(VulkanPerformanceCounterTest_PipelineManifest, DrawPipelineIsWarmedUpOnRelink)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(!hasWarmUpPipelineCacheAtLink() ||
+                       !isFeatureEnabled(Feature::WarmUpPipelinesFromManifest));
+
+    constexpr GLsizei kSize = 4;
+
+    // Draw to a multisampled framebuffer, whose pipeline is different from the one that is warmed
+    // up by default.
+    GLRenderbuffer color;
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, 4, GL_RGBA8, kSize, kSize);
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    glViewport(0, 0, kSize, kSize);
+
+    const angle::VulkanPerfCounters before = getPerfCounters();
+    {
+        ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+    }
+    const angle::VulkanPerfCounters afterFirstProgram = getPerfCounters();
+    EXPECT_EQ(afterFirstProgram.coldGraphicsPipelineMisses, before.coldGraphicsPipelineMisses + 1);
+
+    // The same shaders find the manifest of the first program, so the draw uses a warmed up
+    // pipeline.
+    ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    const angle::VulkanPerfCounters afterSecondProgram = getPerfCounters();
+    EXPECT_EQ(afterSecondProgram.coldGraphicsPipelineMisses,
+              afterFirstProgram.coldGraphicsPipelineMisses);
+    EXPECT_EQ(afterSecondProgram.warmedUpGraphicsPipelineMisses,
+              afterFirstProgram.warmedUpGraphicsPipelineMisses + 1);
+}
+
 // Verify that changing framebuffer and back doesn't break the render pass.
 TEST_P(VulkanPerformanceCounterTest, FBOChangeAndBackDoesNotBreakRenderPass)
 {
@@ -11135,6 +11338,91 @@ TEST_P(VulkanPerformanceCounterTest_ClipDistance, ToggleClipDistanceShouldUpdate
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that once the frame ring buffers have settled, streaming uniforms doesn't create new
+// buffers every frame.
+TEST_P(VulkanPerformanceCounterTest, StreamedUniformsDoNotAllocateBuffersEveryFrame)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    // The buffers grow at most once per frame, and there may be as many buffers in use as frames
+    // in flight, so let a few frames pass before counting.
+    constexpr uint32_t kWarmUpFrameCount = 10;
+    constexpr uint32_t kFrameCount       = 10;
+    constexpr uint32_t kDrawsPerFrame    = 100;
+
+    uint64_t frameRingBufferAllocations = 0;
+    for (uint32_t frame = 0; frame < kWarmUpFrameCount + kFrameCount; ++frame)
+    {
+        for (uint32_t draw = 0; draw < kDrawsPerFrame; ++draw)
+        {
+            glUniform4f(colorLocation, 0.0f, static_cast<float>(draw) / kDrawsPerFrame, 0.0f, 1.0f);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+
+        // The counter is reset every frame.
+        if (frame >= kWarmUpFrameCount)
+        {
+            frameRingBufferAllocations += getPerfCounters().frameRingBufferAllocations;
+        }
+        swapBuffers();
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(0u, frameRingBufferAllocations);
+}
+
+class VulkanPerformanceCounterTest_TransferQueue : public VulkanPerformanceCounterTest
+{};
+
+// Tests that the contents of a new texture are uploaded on the transfer queue and sampled
+// correctly, and that later updates of the texture are done on the context's queue.
+TEST_P(VulkanPerformanceCounterTest_TransferQueue, NewTextureIsUploadedOnTransferQueue)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::AsyncTransferQueueUploads));
+
+    constexpr GLsizei kSize = 16;
+
+    // Bottom half red, top half green.
+    std::vector<GLColor> data(kSize * kSize, GLColor::green);
+    std::fill(data.begin(), data.begin() + kSize * kSize / 2, GLColor::red);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    uint64_t expectedTransferQueueUploads = getPerfCounters().transferQueueUploads + 1;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 data.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(expectedTransferQueueUploads, getPerfCounters().transferQueueUploads);
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h / 2, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(0, h / 2, w, h - h / 2, GLColor::green);
+
+    // The texture is now in use, so updating it doesn't go through the transfer queue.
+    std::vector<GLColor> blueData(kSize * kSize, GLColor::blue);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                    blueData.data());
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(expectedTransferQueueUploads, getPerfCounters().transferQueueUploads);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::blue);
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest);
 ANGLE_INSTANTIATE_TEST(
     VulkanPerformanceCounterTest,
@@ -11180,6 +11468,16 @@ ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_Prerotation,
                        ES3_VULKAN().enable(Feature::EmulatedPrerotation180),
                        ES3_VULKAN().enable(Feature::EmulatedPrerotation270));
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_PipelineManifest);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_PipelineManifest,
+                       ES3_VULKAN().enable(Feature::WarmUpPipelinesFromManifest),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::WarmUpPipelinesFromManifest));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_TransferQueue);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_TransferQueue,
+                       ES3_VULKAN().enable(Feature::AsyncTransferQueueUploads),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::AsyncTransferQueueUploads));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_SingleBuffer);
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_SingleBuffer, ES3_VULKAN());
 
@@ -0,0 +1,264 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanSpvTransformCacheTest:
+//   Tests that the cache of transformed SPIR-V only shares results between identical inputs.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
+#include "libANGLE/renderer/vulkan/spv_utils.h"
+
+#include <functional>
+
+using namespace angle;
+
+namespace
+{
+constexpr uint32_t kVaryingId = sh::vk::spirv::kIdShaderVariablesBegin;
+
+using ModifyOptions         = std::function<void(rx::SpvTransformOptions *)>;
+using ModifyVariableInfoMap = std::function<void(rx::ShaderInterfaceVariableInfoMap *)>;
+
+// Creates the interface variables of a vertex shader output that is a fragment shader input.
+void InitVariableInfoMap(rx::ShaderInterfaceVariableInfoMap *variableInfoMap)
+{
+    rx::ShaderInterfaceVariableInfo &output =
+        variableInfoMap->add(gl::ShaderType::Vertex, kVaryingId);
+    output.location = 0;
+    output.activeStages.set(gl::ShaderType::Vertex);
+    output.varyingIsOutput = true;
+
+    rx::ShaderInterfaceVariableInfo &input =
+        variableInfoMap->add(gl::ShaderType::Fragment, kVaryingId);
+    input.location = 0;
+    input.activeStages.set(gl::ShaderType::Fragment);
+    input.varyingIsInput = true;
+}
+
+BlobCacheKey GetFragmentShaderKey(const ModifyOptions &modifyOptions,
+                                  const ModifyVariableInfoMap &modifyVariableInfoMap)
+{
+    // The contents of the SPIR-V are only hashed, so they need not be valid.
+    const spirv::Blob spirvBlob = {0x07230203, 0x00010000, 0, kVaryingId + 1, 0};
+
+    rx::SpvTransformOptions options;
+    options.shaderType = gl::ShaderType::Fragment;
+    modifyOptions(&options);
+
+    rx::ShaderInterfaceVariableInfoMap variableInfoMap;
+    InitVariableInfoMap(&variableInfoMap);
+    modifyVariableInfoMap(&variableInfoMap);
+
+    return rx::SpvTransformCache::GetKey(options, variableInfoMap, spirvBlob);
+}
+
+rx::ShaderInterfaceVariableInfo &GetFragmentInput(
+    rx::ShaderInterfaceVariableInfoMap *variableInfoMap)
+{
+    return variableInfoMap->getMutable(gl::ShaderType::Fragment, kVaryingId);
+}
+
+// Test that the cache key changes with every input of the transformation, and only with those.
+TEST(VulkanSpvTransformCacheKeyTest, KeyCoversInputs)
+{
+    const ModifyOptions keepOptions                 = [](rx::SpvTransformOptions *) {};
+    const ModifyVariableInfoMap keepVariableInfoMap = [](rx::ShaderInterfaceVariableInfoMap *) {};
+
+    const BlobCacheKey key = GetFragmentShaderKey(keepOptions, keepVariableInfoMap);
+    EXPECT_EQ(key, GetFragmentShaderKey(keepOptions, keepVariableInfoMap));
+
+    // Only the variables of the stage being transformed are hashed.
+    EXPECT_EQ(key, GetFragmentShaderKey(keepOptions, [](rx::ShaderInterfaceVariableInfoMap *map) {
+                  map->getMutable(gl::ShaderType::Vertex, kVaryingId).location = 1;
+              }));
+
+    const std::vector<ModifyOptions> optionChanges = {
+        [](rx::SpvTransformOptions *options) { options->shaderType = gl::ShaderType::Vertex; },
+        [](rx::SpvTransformOptions *options) { options->isLastPreFragmentStage = true; },
+        [](rx::SpvTransformOptions *options) { options->isTransformFeedbackStage = true; },
+        [](rx::SpvTransformOptions *options) { options->isTransformFeedbackEmulated = true; },
+        [](rx::SpvTransformOptions *options) { options->isMultisampledFramebufferFetch = true; },
+        [](rx::SpvTransformOptions *options) { options->enableSampleShading = true; },
+        [](rx::SpvTransformOptions *options) { options->validate = false; },
+        [](rx::SpvTransformOptions *options) { options->useSpirvVaryingPrecisionFixer = true; },
+        [](rx::SpvTransformOptions *options) { options->removeDepthInput = true; },
+        [](rx::SpvTransformOptions *options) { options->removeStencilInput = true; },
+        [](rx::SpvTransformOptions *options) { options->roundOutputAfterDithering = true; },
+        [](rx::SpvTransformOptions *options) { options->ditherControl = 1; },
+    };
+    for (size_t index = 0; index < optionChanges.size(); ++index)
+    {
+        EXPECT_NE(key, GetFragmentShaderKey(optionChanges[index], keepVariableInfoMap))
+            << "option change " << index;
+    }
+
+    const std::vector<ModifyVariableInfoMap> variableInfoChanges = {
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).descriptorSet = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).binding = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).location = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).component = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).index = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            GetFragmentInput(map).activeStages.set(gl::ShaderType::Vertex);
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            SetBitField(GetFragmentInput(map).useRelaxedPrecision,
+                        rx::PrecisionAdjustmentEnum::kLowerPrecision);
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            SetBitField(GetFragmentInput(map).ditherType, rx::DitheredOutputType::Vec4);
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).varyingIsInput = 0; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).varyingIsOutput = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { GetFragmentInput(map).isArray = 1; },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            GetFragmentInput(map).attributeComponentCount = 4;
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            GetFragmentInput(map).attributeLocationCount = 1;
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            GetFragmentInput(map).fragmentOutputArraySize = 2;
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            map->getXFBMutable(gl::ShaderType::Fragment, kVaryingId);
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            map->getXFBMutable(gl::ShaderType::Fragment, kVaryingId)->xfb.pod.offset = 4;
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            map->getXFBMutable(gl::ShaderType::Fragment, kVaryingId)->fieldXfb.emplace_back();
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) {
+            map->add(gl::ShaderType::Fragment, kVaryingId + 1);
+        },
+        [](rx::ShaderInterfaceVariableInfoMap *map) { map->setHasAliasingAttributes(); },
+    };
+    for (size_t index = 0; index < variableInfoChanges.size(); ++index)
+    {
+        EXPECT_NE(key, GetFragmentShaderKey(keepOptions, variableInfoChanges[index]))
+            << "variable info change " << index;
+    }
+}
+
+class VulkanSpvTransformCacheTest : public ANGLETest<>
+{
+  protected:
+    gl::Context *hackContext() const
+    {
+        egl::Display *display   = static_cast<egl::Display *>(getEGLWindow()->getDisplay());
+        gl::ContextID contextID = {
+            static_cast<GLuint>(reinterpret_cast<uintptr_t>(getEGLWindow()->getContext()))};
+        return display->getContext(contextID);
+    }
+};
+
+// Test that the cache hits when a shader is transformed the same way again, and misses when it is
+// transformed differently.
+TEST_P(VulkanSpvTransformCacheTest, HitsOnlyOnEqualInputs)
+{
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 position;
+out vec4 color;
+void main()
+{
+    color       = position * 0.5 + 0.5;
+    gl_Position = position;
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+in vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+})";
+
+    GLShader vertexShader(GL_VERTEX_SHADER);
+    GLShader fragmentShader(GL_FRAGMENT_SHADER);
+    const char *vertexSource   = kVS;
+    const char *fragmentSource = kFS;
+    glShaderSource(vertexShader, 1, &vertexSource, nullptr);
+    glShaderSource(fragmentShader, 1, &fragmentSource, nullptr);
+    glCompileShader(vertexShader);
+    glCompileShader(fragmentShader);
+
+    GLProgram program;
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    ASSERT_EQ(linkStatus, GL_TRUE);
+    glUseProgram(program);
+    ASSERT_GL_NO_ERROR();
+
+    const gl::Context *context = hackContext();
+    const rx::ProgramExecutableVk *executableVk =
+        rx::vk::GetImpl(context->getState().getProgramExecutable());
+    const rx::ShaderInterfaceVariableInfoMap &variableInfoMap = executableVk->getVariableInfoMap();
+    const spirv::Blob &spirvBlob =
+        context->getShaderResolveCompile({fragmentShader})->getCompiledState()->compiledBinary;
+    ASSERT_FALSE(spirvBlob.empty());
+
+    rx::SpvTransformOptions options;
+    options.shaderType = gl::ShaderType::Fragment;
+
+    // Options that apply to any fragment shader.
+    const std::vector<ModifyOptions> optionChanges = {
+        [](rx::SpvTransformOptions *options) { options->validate = false; },
+        [](rx::SpvTransformOptions *options) { options->enableSampleShading = true; },
+        [](rx::SpvTransformOptions *options) { options->useSpirvVaryingPrecisionFixer = true; },
+    };
+
+    rx::SpvTransformCache cache(1024 * 1024);
+    rx::SpvTransformCache::SharedBlob transformedBlob;
+    rx::SpvTransformCache::SharedBlob cachedBlob;
+
+    ASSERT_EQ(cache.transformSpirvCode(options, variableInfoMap, spirvBlob, &transformedBlob),
+              Result::Continue);
+    EXPECT_EQ(cache.getHitCount(), 0u);
+    EXPECT_EQ(cache.getMissCount(), 1u);
+
+    ASSERT_EQ(cache.transformSpirvCode(options, variableInfoMap, spirvBlob, &cachedBlob),
+              Result::Continue);
+    EXPECT_EQ(cache.getHitCount(), 1u);
+    EXPECT_EQ(cache.getMissCount(), 1u);
+    EXPECT_EQ(transformedBlob, cachedBlob);
+
+    for (size_t index = 0; index < optionChanges.size(); ++index)
+    {
+        rx::SpvTransformOptions changedOptions = options;
+        optionChanges[index](&changedOptions);
+
+        const uint64_t hitCount  = cache.getHitCount();
+        const uint64_t missCount = cache.getMissCount();
+
+        ASSERT_EQ(
+            cache.transformSpirvCode(changedOptions, variableInfoMap, spirvBlob, &transformedBlob),
+            Result::Continue);
+        EXPECT_EQ(cache.getHitCount(), hitCount) << "option change " << index;
+        EXPECT_EQ(cache.getMissCount(), missCount + 1) << "option change " << index;
+
+        ASSERT_EQ(
+            cache.transformSpirvCode(changedOptions, variableInfoMap, spirvBlob, &cachedBlob),
+            Result::Continue);
+        EXPECT_EQ(cache.getHitCount(), hitCount + 1) << "option change " << index;
+        EXPECT_EQ(cache.getMissCount(), missCount + 1) << "option change " << index;
+        EXPECT_EQ(transformedBlob, cachedBlob);
+    }
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(VulkanSpvTransformCacheTest, ES3_VULKAN(), ES3_VULKAN_SWIFTSHADER());
@@ -0,0 +1,149 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCachePerf:
+//   Performance benchmark for egl::BlobCache under concurrent use, as when many contexts look up
+//   and store programs and pipeline caches at once.  Each thread mostly looks up blobs, and
+//   occasionally replaces them.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <thread>
+
+#include "libANGLE/BlobCache.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+constexpr size_t kOperationsPerThread     = 2000;
+constexpr size_t kKeyCount                = 1024;
+constexpr size_t kBlobSize                = 2048;
+// One in this many operations stores a blob.
+constexpr size_t kPutInterval = 10;
+
+struct BlobCachePerfParams
+{
+    size_t threadCount;
+};
+
+std::string BlobCachePerfParamsToString(const TestParamInfo<BlobCachePerfParams> &info)
+{
+    std::stringstream strstr;
+    strstr << info.param.threadCount << "_threads";
+    return strstr.str();
+}
+
+egl::BlobCache::Key MakeKey(size_t index)
+{
+    // Real keys are hashes, so spread the index over all the bytes.
+    egl::BlobCache::Key key;
+    uint32_t state = static_cast<uint32_t>(index) * 2654435761u + 1;
+    for (uint8_t &byte : key)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        byte = static_cast<uint8_t>(state);
+    }
+    return key;
+}
+
+angle::MemoryBuffer MakeBlob(size_t index)
+{
+    // Compressible, like program binaries.
+    angle::MemoryBuffer blob;
+    if (blob.resize(kBlobSize))
+    {
+        for (size_t i = 0; i < kBlobSize; ++i)
+        {
+            blob[i] = static_cast<uint8_t>((i / 16 + index) & 0x3F);
+        }
+    }
+    return blob;
+}
+
+class BlobCachePerfTest : public ANGLEPerfTest, public WithParamInterface<BlobCachePerfParams>
+{
+  public:
+    BlobCachePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    void runThread(size_t threadIndex);
+
+    egl::BlobCache mBlobCache;
+    std::vector<egl::BlobCache::Key> mKeys;
+};
+
+BlobCachePerfTest::BlobCachePerfTest()
+    : ANGLEPerfTest("BlobCachePerf", "", BlobCachePerfParamsToString({GetParam(), 0}),
+                    kIterationsPerStep),
+      mBlobCache(kKeyCount * kBlobSize)
+{}
+
+void BlobCachePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    for (size_t index = 0; index < kKeyCount; ++index)
+    {
+        mKeys.push_back(MakeKey(index));
+        mBlobCache.compressAndPut(nullptr, mKeys.back(), MakeBlob(index));
+    }
+}
+
+void BlobCachePerfTest::runThread(size_t threadIndex)
+{
+    angle::MemoryBuffer uncompressed;
+    for (size_t operation = 0; operation < kOperationsPerThread; ++operation)
+    {
+        const size_t keyIndex = (threadIndex * 7919 + operation * 104729) % kKeyCount;
+        if (operation % kPutInterval == threadIndex % kPutInterval)
+        {
+            mBlobCache.compressAndPut(nullptr, mKeys[keyIndex], MakeBlob(keyIndex));
+        }
+        else
+        {
+            mBlobCache.getAndDecompress(nullptr, nullptr, mKeys[keyIndex], kBlobSize,
+                                        &uncompressed);
+        }
+    }
+}
+
+void BlobCachePerfTest::step()
+{
+    const size_t threadCount = GetParam().threadCount;
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        std::vector<std::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(&BlobCachePerfTest::runThread, this, threadIndex);
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+TEST_P(BlobCachePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         BlobCachePerfTest,
+                         Values(BlobCachePerfParams{1}, BlobCachePerfParams{4},
+                                BlobCachePerfParams{16}),
+                         BlobCachePerfParamsToString);
+
+}  // anonymous namespace
@@ -6,12 +6,18 @@
 // CompilerPerfTest:
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
-//   different shaders.
+//   different shaders.  The preprocessor is additionally measured on its own.
 //
 
 #include "ANGLEPerfTest.h"
 
+#include <map>
+
 #include "GLSLANG/ShaderLang.h"
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
@@ -162,6 +168,56 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// This shader is in the style of generated uber-shaders, where most of the code comes from nested
+// function-like macros.
+const char *kMacroHeavyESSL300FragSource = R"(#version 300 es
+precision highp float;
+
+#define QUALITY 2
+#define LAYER_COUNT 16
+
+#define SATURATE(x) clamp((x), 0.0, 1.0)
+#define LERP(a, b, t) mix((a), (b), SATURATE(t))
+#define SQR(x) ((x) * (x))
+#define LUMA(c) dot((c).rgb, vec3(0.299, 0.587, 0.114))
+#define TONEMAP(c) ((c) / (vec3(1.0) + (c)))
+
+#define LAYER_COLOR(i) TONEMAP(uLayers[i].rgb * SQR(uWeights[i]))
+#define LAYER_ALPHA(i) SATURATE(LUMA(uLayers[i]) * uWeights[i])
+#define APPLY_LAYER(acc, i) acc = LERP(acc, LAYER_COLOR(i), LAYER_ALPHA(i))
+#define APPLY_LAYERS_4(acc, base) \
+    APPLY_LAYER(acc, base);       \
+    APPLY_LAYER(acc, base + 1);   \
+    APPLY_LAYER(acc, base + 2);   \
+    APPLY_LAYER(acc, base + 3)
+#define APPLY_LAYERS_16(acc)  \
+    APPLY_LAYERS_4(acc, 0);   \
+    APPLY_LAYERS_4(acc, 4);   \
+    APPLY_LAYERS_4(acc, 8);   \
+    APPLY_LAYERS_4(acc, 12)
+
+#if QUALITY > 1
+#define ENABLE_DETAIL_LAYERS 1
+#endif
+
+uniform vec4 uLayers[LAYER_COUNT];
+uniform float uWeights[LAYER_COUNT];
+out vec4 outColor;
+
+void main()
+{
+    vec3 color = vec3(0.0);
+    APPLY_LAYERS_16(color);
+    APPLY_LAYERS_16(color);
+#ifdef ENABLE_DETAIL_LAYERS
+    APPLY_LAYERS_16(color);
+    APPLY_LAYERS_16(color);
+#endif
+    outColor = vec4(color, 1.0);
+})";
+
+const char *kMacroHeavyESSL300Id = "MacroHeavyESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -280,10 +336,55 @@ void CompilerPerfTest::SetUp()
     }
 
     setTestShader(params.shaderSource);
+
+    mReporter->RegisterFyiMetric(".allocated_bytes", "sizeInBytes");
+    mReporter->RegisterFyiMetric(".peak_pool_bytes", "sizeInBytes");
+    mReporter->RegisterFyiMetric(".peak_pool_pages", "count");
+    mReporter->RegisterFyiMetric(".recycled_pool_pages", "count");
 }
 
 void CompilerPerfTest::TearDown()
 {
+    // Every compile of the shader uses the same amount of memory, so report that of the last one.
+    if (mTranslator)
+    {
+        const angle::PoolAllocatorStats &stats = mTranslator->getPoolAllocatorStats();
+        mReporter->AddResult(".allocated_bytes", stats.allocatedBytes);
+        mReporter->AddResult(".peak_pool_bytes", stats.peakPageCount * stats.pageSize);
+        mReporter->AddResult(".peak_pool_pages", stats.peakPageCount);
+        mReporter->AddResult(".recycled_pool_pages", stats.recycledPageCount);
+
+        // The time and memory spent in each phase, excluding its nested phases, summed over the
+        // phases of the same name.
+        const std::vector<ShCompilePhaseStats> &phases = sh::GetCompilePhaseStats(mTranslator);
+        std::map<std::string, ShCompilePhaseStats> selfStats;
+        for (size_t index = 0; index < phases.size(); ++index)
+        {
+            ShCompilePhaseStats &self = selfStats[phases[index].name];
+            self.seconds += phases[index].seconds;
+            self.allocatedBytes += phases[index].allocatedBytes;
+
+            for (size_t child = index + 1;
+                 child < phases.size() && phases[child].depth > phases[index].depth; ++child)
+            {
+                if (phases[child].depth == phases[index].depth + 1)
+                {
+                    self.seconds -= phases[child].seconds;
+                    self.allocatedBytes -= phases[child].allocatedBytes;
+                }
+            }
+        }
+        for (const auto &nameAndStats : selfStats)
+        {
+            const std::string timeMetric  = ".phase_time_" + nameAndStats.first;
+            const std::string bytesMetric = ".phase_allocated_bytes_" + nameAndStats.first;
+            mReporter->RegisterFyiMetric(timeMetric, "ms");
+            mReporter->RegisterFyiMetric(bytesMetric, "sizeInBytes");
+            mReporter->AddResult(timeMetric, nameAndStats.second.seconds * 1000.0);
+            mReporter->AddResult(bytesMetric, nameAndStats.second.allocatedBytes);
+        }
+    }
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -302,6 +403,7 @@ void CompilerPerfTest::step()
     compileOptions.objectCode                    = true;
     compileOptions.initializeUninitializedLocals = true;
     compileOptions.initOutputVariables           = true;
+    compileOptions.collectPhaseStats             = true;
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -323,6 +425,97 @@ TEST_P(CompilerPerfTest, Run)
     run();
 }
 
+struct PreprocessorPerfParameters final
+{
+    PreprocessorPerfParameters(const char *shaderSource, const char *shaderSourceId)
+        : shaderSource(shaderSource)
+    {
+        testId = shaderSourceId;
+        testId += "_Preprocessor";
+    }
+
+    const char *shaderSource;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const PreprocessorPerfParameters &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+bool IsPlatformAvailable(const PreprocessorPerfParameters &param)
+{
+    return true;
+}
+
+class NullPreprocessorDiagnostics : public angle::pp::Diagnostics
+{
+  protected:
+    void print(ID id, const angle::pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public angle::pp::DirectiveHandler
+{
+  public:
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {}
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {}
+    void handleVersion(const angle::pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       angle::pp::MacroSet *macro_set) override
+    {}
+};
+
+// Runs only the preprocessor over the shader, consuming the tokens the same way the translator's
+// lexer does.
+class PreprocessorPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<PreprocessorPerfParameters>
+{
+  public:
+    PreprocessorPerfTest();
+
+    void step() override;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep)
+{}
+
+void PreprocessorPerfTest::step()
+{
+    const char *shaderStrings[] = {GetParam().shaderSource};
+    const angle::pp::PreprocessorSettings settings(
+        SH_WEBGL2_SPEC, angle::pp::WebGLExtensionDisableBehavior::Standard);
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        NullPreprocessorDiagnostics diagnostics;
+        NullDirectiveHandler directiveHandler;
+        angle::pp::Preprocessor preprocessor(&diagnostics, &directiveHandler, settings);
+        preprocessor.init(1, shaderStrings, nullptr);
+
+        angle::pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+        } while (token.type != angle::pp::Token::LAST);
+    }
+}
+
+TEST_P(PreprocessorPerfTest, Run)
+{
+    run();
+}
+
 ANGLE_INSTANTIATE_TEST(
     CompilerPerfTest,
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
@@ -338,6 +531,13 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id));
+
+ANGLE_INSTANTIATE_TEST(
+    PreprocessorPerfTest,
+    PreprocessorPerfParameters(kRealWorldESSL100FragSource, kRealWorldESSL100Id),
+    PreprocessorPerfParameters(kTrickyESSL300FragSource, kTrickyESSL300Id),
+    PreprocessorPerfParameters(kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id));
 
 }  // anonymous namespace
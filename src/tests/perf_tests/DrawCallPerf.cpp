@@ -30,6 +30,8 @@ enum class StateChange
     Scissor,
     ManyTextureDraw,
     Uniform,
+    // Draws with vertex data streamed from client memory.
+    ClientArray,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
@@ -45,6 +47,7 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+    bool descriptorBuffer   = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -82,10 +85,18 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Uniform:
             strstr << "_uniform";
             break;
+        case StateChange::ClientArray:
+            strstr << "_client_array";
+            break;
         default:
             break;
     }
 
+    if (descriptorBuffer)
+    {
+        strstr << "_descriptor_buffer";
+    }
+
     return strstr.str();
 }
 
@@ -147,6 +158,7 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     int mNumTris = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
     size_t mCurrentVBO = 0;
+    std::vector<GLfloat> mClientVertexData;
 };
 
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam())
@@ -281,6 +293,12 @@ void main()
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
+    if (params.stateChange == StateChange::ClientArray)
+    {
+        Generate2DTriangleData(mNumTris, &mClientVertexData);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
     // Set the viewport
     glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
 
@@ -570,6 +588,17 @@ void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
     }
 }
 
+void DrawFromClientArray(unsigned int iterations,
+                         GLsizei numElements,
+                         const std::vector<GLfloat> &vertexData)
+{
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, vertexData.data());
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+    }
+}
+
 void DrawCallPerfBenchmark::drawBenchmark()
 {
     // This workaround fixes a huge queue of graphics commands accumulating on the GL
@@ -626,6 +655,9 @@ void DrawCallPerfBenchmark::drawBenchmark()
         case StateChange::Uniform:
             UpdateUniformThenDraw(params.iterationsPerStep, numElements);
             break;
+        case StateChange::ClientArray:
+            DrawFromClientArray(params.iterationsPerStep, numElements, mClientVertexData);
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
@@ -655,14 +687,38 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams DescriptorBuffer(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out = in;
+    out.descriptorBuffer     = true;
+    out.eglParameters.enable(Feature::SupportsDescriptorBuffer);
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
 std::vector<P> gTestsWithStateChange =
     CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
 std::vector<P> gTestsWithRenderer =
     CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
+
+// Texture changes are dominated by descriptor updates on Vulkan, so they are also measured with
+// VK_EXT_descriptor_buffer.
+std::vector<P> gTestsWithDescriptorBuffer = CombineWithFuncs(
+    CombineWithValues({Vulkan<P>(P())}, {StateChange::Texture, StateChange::ManyTextureDraw},
+                      CombineStateChange),
+    {DescriptorBuffer});
+
+std::vector<P> AddDescriptorBufferTests(std::vector<P> tests)
+{
+    tests.insert(tests.end(), gTestsWithDescriptorBuffer.begin(),
+                 gTestsWithDescriptorBuffer.end());
+    return tests;
+}
+
 std::vector<P> gTestsWithDevice =
-    CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+    CombineWithFuncs(AddDescriptorBufferTests(gTestsWithRenderer),
+                     {Passthrough<P>, Offscreen<P>, NullDevice<P>});
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
 
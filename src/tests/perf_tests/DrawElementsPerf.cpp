@@ -46,6 +46,11 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
             strstr << "_index_buffer_changed";
         }
 
+        if (streamingSubRanges)
+        {
+            strstr << "_streaming_sub_ranges";
+        }
+
         if (type == GL_UNSIGNED_SHORT)
         {
             strstr << "_ushort";
@@ -56,8 +61,14 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
 
     GLenum type             = GL_UNSIGNED_INT;
     bool indexBufferChanged = false;
+    // Draw from many sub-ranges of one large index buffer while updating one of them with
+    // glBufferSubData per draw.  This stresses the index range cache invalidation.
+    bool streamingSubRanges = false;
 };
 
+// Number of sub-ranges in the index buffer in the streaming sub-range variant.
+constexpr GLsizei kStreamingSubRangeCount = 2048;
+
 std::ostream &operator<<(std::ostream &os, const DrawElementsPerfParams &params)
 {
     os << params.backendAndStory().substr(1);
@@ -82,6 +93,7 @@ class DrawElementsPerfBenchmark : public ANGLERenderTest,
     GLuint mTexture     = 0;
     GLsizei mBufferSize = 0;
     int mCount          = 3 * GetParam().numTris;
+    GLuint mIteration   = 0;
     std::vector<GLuint> mIntIndexData;
     std::vector<GLushort> mShortIndexData;
 };
@@ -119,8 +131,11 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
+    const GLsizei subRangeCount = params.streamingSubRanges ? kStreamingSubRangeCount : 1;
+    const GLenum indexUsage     = params.streamingSubRanges ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+
     mBuffer      = Create2DTriangleBuffer(params.numTris, GL_STATIC_DRAW);
-    mIndexBuffer = CreateElementArrayBuffer(mCount, params.type, GL_STATIC_DRAW);
+    mIndexBuffer = CreateElementArrayBuffer(mCount * subRangeCount, params.type, indexUsage);
 
     for (int i = 0; i < mCount; i++)
     {
@@ -133,13 +148,28 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
 
     mBufferSize = ElementTypeSize(params.type) * mCount;
 
-    if (params.type == GL_UNSIGNED_INT)
+    for (GLsizei subRange = 0; subRange < subRangeCount; ++subRange)
     {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, mIntIndexData.data());
+        const GLintptr offset = subRange * mBufferSize;
+        if (params.type == GL_UNSIGNED_INT)
+        {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, mBufferSize, mIntIndexData.data());
+        }
+        else
+        {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, mBufferSize, mShortIndexData.data());
+        }
     }
-    else
+
+    if (params.streamingSubRanges)
     {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, mShortIndexData.data());
+        // Populate the index range cache with every sub-range.
+        for (GLsizei subRange = 0; subRange < subRangeCount; ++subRange)
+        {
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type,
+                           reinterpret_cast<const void *>(
+                               static_cast<uintptr_t>(subRange * mBufferSize)));
+        }
     }
 
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
@@ -180,7 +210,30 @@ void DrawElementsPerfBenchmark::drawBenchmark()
 
     const DrawElementsPerfParams &params = GetParam();
 
-    if (params.indexBufferChanged)
+    if (params.streamingSubRanges)
+    {
+        const void *bufferData = (params.type == GL_UNSIGNED_INT)
+                                     ? static_cast<GLvoid *>(mIntIndexData.data())
+                                     : static_cast<GLvoid *>(mShortIndexData.data());
+        for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+        {
+            // Rewrite one sub-range, then draw it and a sub-range that is still cached.
+            const GLsizei writtenSubRange = mIteration % kStreamingSubRangeCount;
+            const GLsizei cachedSubRange =
+                (writtenSubRange + kStreamingSubRangeCount / 2) % kStreamingSubRangeCount;
+            ++mIteration;
+
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, writtenSubRange * mBufferSize, mBufferSize,
+                            bufferData);
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type,
+                           reinterpret_cast<const void *>(
+                               static_cast<uintptr_t>(writtenSubRange * mBufferSize)));
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type,
+                           reinterpret_cast<const void *>(
+                               static_cast<uintptr_t>(cachedSubRange * mBufferSize)));
+        }
+    }
+    else if (params.indexBufferChanged)
     {
         const void *bufferData = (params.type == GL_UNSIGNED_INT)
                                      ? static_cast<GLvoid *>(mIntIndexData.data())
@@ -230,13 +283,28 @@ P CombineIndexBufferChanged(const P &in, bool indexBufferChanged)
     return out;
 }
 
+P CombineStreamingSubRanges(const P &in, bool streamingSubRanges)
+{
+    P out                  = in;
+    out.streamingSubRanges = streamingSubRanges;
+
+    // Scale down iterations for slower tests.
+    if (streamingSubRanges)
+        out.iterationsPerStep /= 100;
+
+    return out;
+}
+
 std::vector<GLenum> gIndexTypes = {GL_UNSIGNED_INT, GL_UNSIGNED_SHORT};
 std::vector<P> gWithIndexType   = CombineWithValues({P()}, gIndexTypes, CombineIndexType);
 std::vector<P> gWithRenderer =
     CombineWithFuncs(gWithIndexType, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
 std::vector<P> gWithChange =
     CombineWithValues(gWithRenderer, {false, true}, CombineIndexBufferChanged);
-std::vector<P> gWithDevice = CombineWithFuncs(gWithChange, {Passthrough<P>, NullDevice<P>});
+std::vector<P> gWithStreaming =
+    FilterWithFunc(CombineWithValues(gWithChange, {false, true}, CombineStreamingSubRanges),
+                   [](const P &p) { return !p.indexBufferChanged || !p.streamingSubRanges; });
+std::vector<P> gWithDevice = CombineWithFuncs(gWithStreaming, {Passthrough<P>, NullDevice<P>});
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, gWithDevice);
 
@@ -4,10 +4,12 @@
 // found in the LICENSE file.
 //
 // EGLInitializePerfTest:
-//   Performance test for device creation.
+//   Performance test for device creation.  The _disk_blob_cache variant enables the on-disk blob
+//   cache, which is warm after the first iteration.
 //
 
 #include "ANGLEPerfTest.h"
+#include "common/system_utils.h"
 #include "common/unsafe_buffers.h"
 #include "platform/PlatformMethods.h"
 #include "test_utils/angle_test_configs.h"
@@ -62,21 +64,24 @@ class EGLInitializePerfTest : public ANGLEPerfTest,
                               public WithParamInterface<angle::PlatformParameters>
 {
   public:
-    EGLInitializePerfTest();
+    EGLInitializePerfTest() : EGLInitializePerfTest("_run") {}
     ~EGLInitializePerfTest();
 
     void step() override;
     void SetUp() override;
     void TearDown() override;
 
+  protected:
+    explicit EGLInitializePerfTest(const char *story);
+
   private:
     OSWindow *mOSWindow;
     EGLDisplay mDisplay;
     Captures mCaptures;
 };
 
-EGLInitializePerfTest::EGLInitializePerfTest()
-    : ANGLEPerfTest("EGLInitialize", "", "_run", 1), mOSWindow(nullptr), mDisplay(EGL_NO_DISPLAY)
+EGLInitializePerfTest::EGLInitializePerfTest(const char *story)
+    : ANGLEPerfTest("EGLInitialize", "", story, 1), mOSWindow(nullptr), mDisplay(EGL_NO_DISPLAY)
 {
     auto platform = GetParam().eglParameters;
 
@@ -155,14 +160,49 @@ void EGLInitializePerfTest::TearDown()
     ANGLEResetDisplayPlatform(mDisplay);
 }
 
+class EGLInitializeDiskBlobCachePerfTest : public EGLInitializePerfTest
+{
+  public:
+    EGLInitializeDiskBlobCachePerfTest() : EGLInitializePerfTest("_disk_blob_cache") {}
+
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void EGLInitializeDiskBlobCachePerfTest::SetUp()
+{
+    // The cache is kept across runs, to also measure the warm start of the first iteration.
+    Optional<std::string> tempDirectory = angle::GetTempDirectory();
+    ASSERT_TRUE(tempDirectory.valid());
+    angle::SetEnvironmentVar(
+        "ANGLE_BLOB_CACHE_DIR",
+        angle::ConcatenatePath(tempDirectory.value(), "angle_egl_initialize_perf_blob_cache")
+            .c_str());
+
+    EGLInitializePerfTest::SetUp();
+}
+
+void EGLInitializeDiskBlobCachePerfTest::TearDown()
+{
+    EGLInitializePerfTest::TearDown();
+    angle::UnsetEnvironmentVar("ANGLE_BLOB_CACHE_DIR");
+}
+
 TEST_P(EGLInitializePerfTest, Run)
 {
     run();
 }
 
+TEST_P(EGLInitializeDiskBlobCachePerfTest, Run)
+{
+    run();
+}
+
 ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest,
                        angle::ES2_D3D11(),
                        angle::ES2_METAL(),
                        angle::ES2_VULKAN());
 
+ANGLE_INSTANTIATE_TEST(EGLInitializeDiskBlobCachePerfTest, angle::ES2_VULKAN());
+
 }  // namespace
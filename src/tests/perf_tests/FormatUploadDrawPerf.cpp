@@ -24,12 +24,18 @@ enum class TestedFormat
     RGBA8,
     RGB8,
     RGB565,
+    LA8,
+    R11G11B10F,
+    RGBA16F,
 };
 
 constexpr const char *kTestedFormatString[] = {
     "rgba8",
     "rgb8",
     "rgb565",
+    "la8",
+    "r11g11b10f",
+    "rgba16f",
 };
 
 template <typename E>
@@ -81,6 +87,7 @@ class FormatUploadDrawPerfBenchmark
     TestedFormat mTestedFormat;
     uint32_t mTextureSize;
     uint32_t mPixelSize;
+    GLuint mInternalFormat;
     GLuint mFormat;
     GLuint mType;
     GLuint mProgram;
@@ -94,19 +101,42 @@ FormatUploadDrawPerfBenchmark::FormatUploadDrawPerfBenchmark()
     switch (mTestedFormat)
     {
         case TestedFormat::RGBA8:
-            mFormat    = GL_RGBA;
-            mType      = GL_UNSIGNED_BYTE;
-            mPixelSize = 4;
+            mInternalFormat = GL_RGBA;
+            mFormat         = GL_RGBA;
+            mType           = GL_UNSIGNED_BYTE;
+            mPixelSize      = 4;
             break;
         case TestedFormat::RGB8:
-            mFormat    = GL_RGB;
-            mType      = GL_UNSIGNED_BYTE;
-            mPixelSize = 3;
+            mInternalFormat = GL_RGB;
+            mFormat         = GL_RGB;
+            mType           = GL_UNSIGNED_BYTE;
+            mPixelSize      = 3;
             break;
         case TestedFormat::RGB565:
-            mFormat    = GL_RGB;
-            mType      = GL_UNSIGNED_SHORT_5_6_5;
-            mPixelSize = 2;
+            mInternalFormat = GL_RGB;
+            mFormat         = GL_RGB;
+            mType           = GL_UNSIGNED_SHORT_5_6_5;
+            mPixelSize      = 2;
+            break;
+        case TestedFormat::LA8:
+            mInternalFormat = GL_LUMINANCE_ALPHA;
+            mFormat         = GL_LUMINANCE_ALPHA;
+            mType           = GL_UNSIGNED_BYTE;
+            mPixelSize      = 2;
+            break;
+        case TestedFormat::R11G11B10F:
+            // Uploaded as half floats, which are converted on the CPU.
+            mInternalFormat = GL_R11F_G11F_B10F;
+            mFormat         = GL_RGB;
+            mType           = GL_HALF_FLOAT;
+            mPixelSize      = 6;
+            break;
+        case TestedFormat::RGBA16F:
+            // Uploaded as floats, which are converted on the CPU.
+            mInternalFormat = GL_RGBA16F;
+            mFormat         = GL_RGBA;
+            mType           = GL_FLOAT;
+            mPixelSize      = 16;
             break;
         default:
             UNREACHABLE();
@@ -123,7 +153,8 @@ void FormatUploadDrawPerfBenchmark::initializeBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexImage2D(GL_TEXTURE_2D, 0, mFormat, mTextureSize, mTextureSize, 0, mFormat, mType, nullptr);
+    glTexImage2D(GL_TEXTURE_2D, 0, mInternalFormat, mTextureSize, mTextureSize, 0, mFormat, mType,
+                 nullptr);
 
     // Initialize color data.
     mColors.resize(mTextureSize * mTextureSize * mPixelSize);
@@ -223,12 +254,24 @@ ANGLE_INSTANTIATE_TEST(FormatUploadDrawPerfBenchmark,
                        VulkanParams(TestedFormat::RGBA8),
                        VulkanParams(TestedFormat::RGB8),
                        VulkanParams(TestedFormat::RGB565),
+                       VulkanParams(TestedFormat::LA8),
+                       VulkanParams(TestedFormat::R11G11B10F),
+                       VulkanParams(TestedFormat::RGBA16F),
                        OpenGLOrGLESParams(TestedFormat::RGBA8),
                        OpenGLOrGLESParams(TestedFormat::RGB8),
                        OpenGLOrGLESParams(TestedFormat::RGB565),
+                       OpenGLOrGLESParams(TestedFormat::LA8),
+                       OpenGLOrGLESParams(TestedFormat::R11G11B10F),
+                       OpenGLOrGLESParams(TestedFormat::RGBA16F),
                        MetalParams(TestedFormat::RGBA8),
                        MetalParams(TestedFormat::RGB8),
                        MetalParams(TestedFormat::RGB565),
+                       MetalParams(TestedFormat::LA8),
+                       MetalParams(TestedFormat::R11G11B10F),
+                       MetalParams(TestedFormat::RGBA16F),
                        D3D11Params(TestedFormat::RGBA8),
                        D3D11Params(TestedFormat::RGB8),
-                       D3D11Params(TestedFormat::RGB565));
+                       D3D11Params(TestedFormat::RGB565),
+                       D3D11Params(TestedFormat::LA8),
+                       D3D11Params(TestedFormat::R11G11B10F),
+                       D3D11Params(TestedFormat::RGBA16F));
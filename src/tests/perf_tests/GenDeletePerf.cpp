@@ -0,0 +1,297 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenDeletePerf:
+//   Performance test for generating and deleting object names.  Exercises the handle allocator
+//   with batches of glGen* and glDelete* calls, optionally deleting the objects in a shuffled
+//   order so the released handles are fragmented.  Can also bind names that were never
+//   generated, which reserves them in the handle allocator.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+#include "test_utils/angle_test_instantiate.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 64;
+// First name used when binding names that were never generated, well above the generated ones.
+constexpr GLuint kFirstReservedName = 1000000;
+
+enum class ObjectType
+{
+    Buffer,
+    Texture,
+    Renderbuffer,
+};
+
+struct GenDeleteParams final : public RenderTestParams
+{
+    GenDeleteParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+
+        iterationsPerStep = kIterationsPerStep;
+    }
+
+    std::string story() const override;
+
+    ObjectType objectType = ObjectType::Buffer;
+    // Number of names generated and deleted by each glGen* and glDelete* call.
+    GLsizei batchSize = 1000;
+    // Number of objects that stay alive throughout the test, interleaved with the churned ones.
+    GLsizei liveObjectCount = 0;
+    // Delete the objects in a shuffled order, one at a time.
+    bool shuffledDelete = false;
+    // Instead of generating names, bind increasing names that were never generated.
+    bool reserveAscending = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const GenDeleteParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string GenDeleteParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    switch (objectType)
+    {
+        case ObjectType::Buffer:
+            strstr << "_buffers";
+            break;
+        case ObjectType::Texture:
+            strstr << "_textures";
+            break;
+        case ObjectType::Renderbuffer:
+            strstr << "_renderbuffers";
+            break;
+    }
+
+    strstr << "_" << batchSize;
+
+    if (liveObjectCount > 0)
+    {
+        strstr << "_" << liveObjectCount << "_live";
+    }
+
+    if (shuffledDelete)
+    {
+        strstr << "_shuffled";
+    }
+
+    if (reserveAscending)
+    {
+        strstr << "_reserved";
+    }
+
+    return strstr.str();
+}
+
+class GenDeleteBenchmark : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<GenDeleteParams>
+{
+  public:
+    GenDeleteBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void genObjects(GLsizei count, GLuint *objects);
+    void bindObjects(GLsizei count, const GLuint *objects);
+    void deleteObjects(GLsizei count, const GLuint *objects);
+
+    std::vector<GLuint> mLiveObjects;
+    std::vector<GLuint> mObjects;
+    std::mt19937 mGenerator;
+};
+
+GenDeleteBenchmark::GenDeleteBenchmark() : ANGLERenderTest("GenDelete", GetParam()) {}
+
+void GenDeleteBenchmark::genObjects(GLsizei count, GLuint *objects)
+{
+    switch (GetParam().objectType)
+    {
+        case ObjectType::Buffer:
+            glGenBuffers(count, objects);
+            break;
+        case ObjectType::Texture:
+            glGenTextures(count, objects);
+            break;
+        case ObjectType::Renderbuffer:
+            glGenRenderbuffers(count, objects);
+            break;
+    }
+}
+
+void GenDeleteBenchmark::bindObjects(GLsizei count, const GLuint *objects)
+{
+    for (GLsizei index = 0; index < count; ++index)
+    {
+        switch (GetParam().objectType)
+        {
+            case ObjectType::Buffer:
+                glBindBuffer(GL_ARRAY_BUFFER, objects[index]);
+                break;
+            case ObjectType::Texture:
+                glBindTexture(GL_TEXTURE_2D, objects[index]);
+                break;
+            case ObjectType::Renderbuffer:
+                glBindRenderbuffer(GL_RENDERBUFFER, objects[index]);
+                break;
+        }
+    }
+}
+
+void GenDeleteBenchmark::deleteObjects(GLsizei count, const GLuint *objects)
+{
+    switch (GetParam().objectType)
+    {
+        case ObjectType::Buffer:
+            glDeleteBuffers(count, objects);
+            break;
+        case ObjectType::Texture:
+            glDeleteTextures(count, objects);
+            break;
+        case ObjectType::Renderbuffer:
+            glDeleteRenderbuffers(count, objects);
+            break;
+    }
+}
+
+void GenDeleteBenchmark::initializeBenchmark()
+{
+    const GenDeleteParams &params = GetParam();
+
+    // Generate twice as many objects as will stay alive and delete every other one, so the churned
+    // names are interleaved with the live ones.
+    if (params.liveObjectCount > 0)
+    {
+        std::vector<GLuint> objects(params.liveObjectCount * 2);
+        genObjects(static_cast<GLsizei>(objects.size()), objects.data());
+        for (size_t index = 0; index < objects.size(); index += 2)
+        {
+            deleteObjects(1, &objects[index]);
+            mLiveObjects.push_back(objects[index + 1]);
+        }
+    }
+
+    mObjects.resize(params.batchSize, 0);
+    if (params.reserveAscending)
+    {
+        for (GLsizei index = 0; index < params.batchSize; ++index)
+        {
+            mObjects[index] = kFirstReservedName + index;
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void GenDeleteBenchmark::destroyBenchmark()
+{
+    deleteObjects(static_cast<GLsizei>(mLiveObjects.size()), mLiveObjects.data());
+}
+
+void GenDeleteBenchmark::drawBenchmark()
+{
+    const GenDeleteParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        if (params.reserveAscending)
+        {
+            bindObjects(params.batchSize, mObjects.data());
+        }
+        else
+        {
+            genObjects(params.batchSize, mObjects.data());
+        }
+
+        if (params.shuffledDelete)
+        {
+            std::shuffle(mObjects.begin(), mObjects.end(), mGenerator);
+            for (GLuint object : mObjects)
+            {
+                deleteObjects(1, &object);
+            }
+        }
+        else
+        {
+            deleteObjects(params.batchSize, mObjects.data());
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+GenDeleteParams D3D11Params(ObjectType objectType)
+{
+    GenDeleteParams params;
+    params.eglParameters = egl_platform::D3D11_NULL();
+    params.objectType    = objectType;
+    return params;
+}
+
+GenDeleteParams VulkanParams(ObjectType objectType)
+{
+    GenDeleteParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.objectType    = objectType;
+    return params;
+}
+
+GenDeleteParams SmallBatch(GenDeleteParams params)
+{
+    params.batchSize = 1;
+    return params;
+}
+
+GenDeleteParams Fragmented(GenDeleteParams params)
+{
+    params.liveObjectCount = 100000;
+    params.shuffledDelete  = true;
+    return params;
+}
+
+GenDeleteParams ReserveAscending(GenDeleteParams params)
+{
+    params.batchSize        = 10000;
+    params.reserveAscending = true;
+    return params;
+}
+
+TEST_P(GenDeleteBenchmark, Run)
+{
+    run();
+}
+}  // namespace
+
+ANGLE_INSTANTIATE_TEST(GenDeleteBenchmark,
+                       D3D11Params(ObjectType::Buffer),
+                       VulkanParams(ObjectType::Buffer),
+                       VulkanParams(ObjectType::Texture),
+                       VulkanParams(ObjectType::Renderbuffer),
+                       SmallBatch(VulkanParams(ObjectType::Buffer)),
+                       Fragmented(VulkanParams(ObjectType::Buffer)),
+                       Fragmented(VulkanParams(ObjectType::Texture)),
+                       ReserveAscending(VulkanParams(ObjectType::Buffer)));
+
+}  // namespace angle
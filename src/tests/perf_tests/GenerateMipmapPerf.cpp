@@ -34,7 +34,8 @@ struct GenerateMipmapParams final : public RenderTestParams
 
         internalFormat = GL_RGBA;
 
-        webgl = false;
+        webgl   = false;
+        cpuPath = false;
     }
 
     std::string story() const override;
@@ -45,6 +46,9 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool webgl;
+
+    // Whether the Vulkan backend is forced to generate mipmaps on the CPU.
+    bool cpuPath;
 };
 
 std::ostream &operator<<(std::ostream &os, const GenerateMipmapParams &params)
@@ -68,6 +72,11 @@ std::string GenerateMipmapParams::story() const
         strstr << "_rgb";
     }
 
+    if (cpuPath)
+    {
+        strstr << "_cpu";
+    }
+
     return strstr.str();
 }
 
@@ -314,17 +323,25 @@ GenerateMipmapParams OpenGLOrGLESParams(bool webglCompat, bool singleIteration)
     return params;
 }
 
-GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool emulatedFormat)
+GenerateMipmapParams VulkanParams(bool webglCompat,
+                                  bool singleIteration,
+                                  bool emulatedFormat,
+                                  bool cpuPath = false)
 {
     GenerateMipmapParams params;
     params.eglParameters = egl_platform::VULKAN();
     params.majorVersion  = 3;
     params.minorVersion  = 0;
     params.webgl         = webglCompat;
+    params.cpuPath       = cpuPath;
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
     }
+    if (cpuPath)
+    {
+        params.eglParameters.enable(Feature::ForceGenerateMipmapOnCPU);
+    }
     if (singleIteration)
     {
         params.iterationsPerStep = 1;
@@ -356,7 +373,9 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       VulkanParams(false, false, false, true),
+                       VulkanParams(false, false, true, true));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -368,4 +387,6 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        VulkanParams(false, true, false),
                        VulkanParams(true, true, false),
                        VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(true, true, true),
+                       VulkanParams(false, true, false, true),
+                       VulkanParams(false, true, true, true));
@@ -0,0 +1,183 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance benchmark for gl::ComputeIndexRange(...), which scans client-side and uncached
+//   index data on glDrawElements.  Each variant runs with a subset of the CPU features to compare
+//   the vectorized kernels with the scalar fallback.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/unsafe_buffers.h"
+
+#include <sstream>
+
+#include "common/simd_utils.h"
+#include "common/utilities.h"
+#include "libANGLE/formatutils.h"
+#include "util/random_utils.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 20;
+constexpr size_t kIndexCount              = 1024 * 1024;
+
+enum class SIMDMode
+{
+    Scalar,
+    SSE41,
+    Native,
+};
+
+struct IndexRangePerfParams
+{
+    gl::DrawElementsType indexType;
+    bool primitiveRestart;
+    SIMDMode simdMode;
+};
+
+std::string IndexRangePerfParamsToString(const TestParamInfo<IndexRangePerfParams> &info)
+{
+    const IndexRangePerfParams &params = info.param;
+    std::stringstream strstr;
+
+    switch (params.indexType)
+    {
+        case gl::DrawElementsType::UnsignedByte:
+            strstr << "uint8";
+            break;
+        case gl::DrawElementsType::UnsignedShort:
+            strstr << "uint16";
+            break;
+        default:
+            strstr << "uint32";
+            break;
+    }
+
+    if (params.primitiveRestart)
+    {
+        strstr << "_restart";
+    }
+
+    switch (params.simdMode)
+    {
+        case SIMDMode::Scalar:
+            strstr << "_scalar";
+            break;
+        case SIMDMode::SSE41:
+            strstr << "_sse41";
+            break;
+        case SIMDMode::Native:
+            strstr << "_native";
+            break;
+    }
+
+    return strstr.str();
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest, public WithParamInterface<IndexRangePerfParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    angle::RNG mRNG;
+    std::vector<uint8_t> mIndexData;
+    size_t mCount = 0;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", IndexRangePerfParamsToString({GetParam(), 0}),
+                    kIterationsPerStep),
+      mRNG(0x12345678u)
+{}
+
+void IndexRangePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const IndexRangePerfParams &params = GetParam();
+
+    switch (params.simdMode)
+    {
+        case SIMDMode::Scalar:
+            angle::SetCPUFeatureMaskForTesting(0);
+            break;
+        case SIMDMode::SSE41:
+            angle::SetCPUFeatureMaskForTesting(
+                static_cast<angle::CPUFeatureMask>(angle::CPUFeature::SSE41));
+            break;
+        case SIMDMode::Native:
+            angle::SetCPUFeatureMaskForTesting(angle::kAllCPUFeatures);
+            break;
+    }
+
+    const size_t indexSize = gl::GetDrawElementsTypeSize(params.indexType);
+    mCount                 = kIndexCount;
+    mIndexData.resize(mCount * indexSize);
+    FillVectorWithRandomUBytes(&mRNG, &mIndexData);
+
+    if (params.primitiveRestart)
+    {
+        // Sprinkle in restart indices, as a triangle strip batcher would.
+        for (size_t i = 0; i < mCount; i += 64)
+        {
+            ANGLE_UNSAFE_TODO(memset(mIndexData.data() + i * indexSize, 0xFF, indexSize));
+        }
+    }
+}
+
+void IndexRangePerfTest::TearDown()
+{
+    angle::SetCPUFeatureMaskForTesting(angle::kAllCPUFeatures);
+    ANGLEPerfTest::TearDown();
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangePerfParams &params = GetParam();
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        gl::IndexRange range = gl::ComputeIndexRange(params.indexType, mIndexData.data(), mCount,
+                                                     params.primitiveRestart);
+        ANGLE_UNUSED_VARIABLE(range);
+    }
+}
+
+std::vector<IndexRangePerfParams> GetIndexRangePerfParams()
+{
+    std::vector<IndexRangePerfParams> params;
+    for (gl::DrawElementsType indexType :
+         {gl::DrawElementsType::UnsignedByte, gl::DrawElementsType::UnsignedShort,
+          gl::DrawElementsType::UnsignedInt})
+    {
+        for (bool primitiveRestart : {false, true})
+        {
+            for (SIMDMode simdMode : {SIMDMode::Scalar, SIMDMode::SSE41, SIMDMode::Native})
+            {
+                params.push_back({indexType, primitiveRestart, simdMode});
+            }
+        }
+    }
+    return params;
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         IndexRangePerfTest,
+                         ValuesIn(GetIndexRangePerfParams()),
+                         IndexRangePerfParamsToString);
+
+}  // anonymous namespace
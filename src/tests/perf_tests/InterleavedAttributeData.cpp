@@ -7,6 +7,7 @@
 //   Performance test for draws using interleaved attribute data in vertex buffers.
 //
 
+#include <string.h>
 #include <sstream>
 #include "common/unsafe_buffers.h"
 
@@ -30,10 +31,14 @@ struct InterleavedAttributeDataParams final : public RenderTestParams
         windowWidth  = 512;
         windowHeight = 512;
         numSprites   = 3000;
+        fixedColor   = false;
     }
 
     // static parameters
     unsigned int numSprites;
+
+    // Store the colors as unaligned GL_FIXED, which backends such as Vulkan convert on the CPU.
+    bool fixedColor;
 };
 
 std::ostream &operator<<(std::ostream &os, const InterleavedAttributeDataParams &params)
@@ -45,6 +50,11 @@ std::ostream &operator<<(std::ostream &os, const InterleavedAttributeDataParams
         os << "_" << params.eglParameters.majorVersion << "_" << params.eglParameters.minorVersion;
     }
 
+    if (params.fixedColor)
+    {
+        os << "_fixed_color";
+    }
+
     return os;
 }
 
@@ -68,6 +78,21 @@ class InterleavedAttributeDataBenchmark
     const size_t mBytesPerSpriteUnaligned = 2 * sizeof(float) + 3;
     const size_t mBytesPerSprite =
         ((mBytesPerSpriteUnaligned + sizeof(float) - 1) / sizeof(float)) * sizeof(float);
+
+    // With fixedColor, the buffers contain two floats, a byte of padding and 3 fixed point colors.
+    const size_t mFixedColorOffset = 2 * sizeof(float) + 1;
+    const size_t mBytesPerFixedColorSprite =
+        ((mFixedColorOffset + 3 * sizeof(GLfixed) + sizeof(float) - 1) / sizeof(float)) *
+        sizeof(float);
+
+    size_t getBytesPerSprite() const
+    {
+        return GetParam().fixedColor ? mBytesPerFixedColorSprite : mBytesPerSprite;
+    }
+    size_t getColorOffset() const
+    {
+        return GetParam().fixedColor ? mFixedColorOffset : 2 * sizeof(float);
+    }
 };
 
 InterleavedAttributeDataBenchmark::InterleavedAttributeDataBenchmark()
@@ -108,10 +133,13 @@ void InterleavedAttributeDataBenchmark::initializeBenchmark()
 
     glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
 
+    const size_t bytesPerSprite = getBytesPerSprite();
+    const size_t colorOffset    = getColorOffset();
+
     for (size_t i = 0; i < ArraySize(mPositionColorBuffer); i++)
     {
         // Set up initial data for pointsprite positions and colors
-        std::vector<uint8_t> positionColorData(mBytesPerSprite * params.numSprites);
+        std::vector<uint8_t> positionColorData(bytesPerSprite * params.numSprites);
         for (unsigned int j = 0; j < params.numSprites; j++)
         {
             float pointSpriteX =
@@ -128,22 +156,33 @@ void InterleavedAttributeDataBenchmark::initializeBenchmark()
 
             // Add position data for the pointsprite
             *reinterpret_cast<float *>(
-                &(positionColorData[j * mBytesPerSprite + 0 * sizeof(float) + 0])) =
+                &(positionColorData[j * bytesPerSprite + 0 * sizeof(float) + 0])) =
                 pointSpriteX;  // X
             *reinterpret_cast<float *>(
-                &(positionColorData[j * mBytesPerSprite + 1 * sizeof(float) + 0])) =
+                &(positionColorData[j * bytesPerSprite + 1 * sizeof(float) + 0])) =
                 pointSpriteY;  // Y
 
             // Add color data for the pointsprite
-            positionColorData[j * mBytesPerSprite + 2 * sizeof(float) + 0] = pointSpriteRed;    // R
-            positionColorData[j * mBytesPerSprite + 2 * sizeof(float) + 1] = pointSpriteGreen;  // G
-            positionColorData[j * mBytesPerSprite + 2 * sizeof(float) + 2] = pointSpriteBlue;   // B
+            if (params.fixedColor)
+            {
+                const GLfixed color[3] = {pointSpriteRed * 65536 / 255,
+                                          pointSpriteGreen * 65536 / 255,
+                                          pointSpriteBlue * 65536 / 255};
+                memcpy(&positionColorData[j * bytesPerSprite + colorOffset], color,
+                       sizeof(color));
+            }
+            else
+            {
+                positionColorData[j * bytesPerSprite + colorOffset + 0] = pointSpriteRed;    // R
+                positionColorData[j * bytesPerSprite + colorOffset + 1] = pointSpriteGreen;  // G
+                positionColorData[j * bytesPerSprite + colorOffset + 2] = pointSpriteBlue;   // B
+            }
         }
 
         // Generate the GL buffer with the position/color data
         glGenBuffers(1, &ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]));
         glBindBuffer(GL_ARRAY_BUFFER, ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]));
-        glBufferData(GL_ARRAY_BUFFER, params.numSprites * mBytesPerSprite, &(positionColorData[0]),
+        glBufferData(GL_ARRAY_BUFFER, params.numSprites * bytesPerSprite, &(positionColorData[0]),
                      GL_STATIC_DRAW);
     }
 
@@ -164,6 +203,11 @@ void InterleavedAttributeDataBenchmark::drawBenchmark()
 {
     glClear(GL_COLOR_BUFFER_BIT);
 
+    const GLsizei bytesPerSprite    = static_cast<GLsizei>(getBytesPerSprite());
+    const size_t colorOffset        = getColorOffset();
+    const GLenum colorType          = GetParam().fixedColor ? GL_FIXED : GL_UNSIGNED_BYTE;
+    const GLboolean colorNormalized = GetParam().fixedColor ? GL_FALSE : GL_TRUE;
+
     for (size_t k = 0; k < 20; k++)
     {
         for (size_t i = 0; i < ArraySize(mPositionColorBuffer); i++)
@@ -178,17 +222,15 @@ void InterleavedAttributeDataBenchmark::drawBenchmark()
             // Bind the position data from one buffer
             glBindBuffer(GL_ARRAY_BUFFER, ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]));
             glEnableVertexAttribArray(positionLocation);
-            glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE,
-                                  static_cast<GLsizei>(mBytesPerSprite), 0);
+            glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, bytesPerSprite, 0);
 
             // But bind the color data from the other buffer.
             glBindBuffer(
                 GL_ARRAY_BUFFER,
                 ANGLE_UNSAFE_TODO(mPositionColorBuffer[(i + 1) % ArraySize(mPositionColorBuffer)]));
             glEnableVertexAttribArray(colorLocation);
-            glVertexAttribPointer(colorLocation, 3, GL_UNSIGNED_BYTE, GL_TRUE,
-                                  static_cast<GLsizei>(mBytesPerSprite),
-                                  reinterpret_cast<void *>(2 * sizeof(float)));
+            glVertexAttribPointer(colorLocation, 3, colorType, colorNormalized, bytesPerSprite,
+                                  reinterpret_cast<void *>(colorOffset));
 
             // Then draw the colored pointsprites
             glDrawArrays(GL_POINTS, 0, GetParam().numSprites);
@@ -234,10 +276,18 @@ InterleavedAttributeDataParams VulkanParams()
     return params;
 }
 
+InterleavedAttributeDataParams VulkanFixedColorParams()
+{
+    InterleavedAttributeDataParams params = VulkanParams();
+    params.fixedColor                     = true;
+    return params;
+}
+
 ANGLE_INSTANTIATE_TEST(InterleavedAttributeDataBenchmark,
                        D3D11Params(),
                        MetalParams(),
                        OpenGLOrGLESParams(),
-                       VulkanParams());
+                       VulkanParams(),
+                       VulkanFixedColorParams());
 
 }  // anonymous namespace
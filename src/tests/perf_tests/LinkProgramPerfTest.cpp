@@ -11,6 +11,7 @@
 
 #include <array>
 
+#include "common/system_utils.h"
 #include "common/vector_utils.h"
 #include "util/shader_utils.h"
 
@@ -72,6 +73,26 @@ struct LinkProgramParams final : public RenderTestParams
             strstr << "_multi_thread";
         }
 
+        if (uniquePrograms)
+        {
+            strstr << "_unique";
+        }
+
+        if (backgroundBlobCompression)
+        {
+            strstr << "_background_compression";
+        }
+
+        if (diskBlobCache)
+        {
+            strstr << "_disk_blob_cache";
+        }
+
+        if (!transformedSpirvCache)
+        {
+            strstr << "_no_spirv_cache";
+        }
+
         if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
         {
             strstr << "_null";
@@ -82,6 +103,17 @@ struct LinkProgramParams final : public RenderTestParams
 
     TaskOption taskOption;
     ThreadOption threadOption;
+
+    // Whether every iteration links a different program, so that each link misses the program
+    // cache and stores a new blob in it.
+    bool uniquePrograms = false;
+    // Whether the blobs are compressed in the background instead of at link time.
+    bool backgroundBlobCompression = false;
+    // Whether the on-disk blob cache is used.  It's kept across runs, so every link hits the cache.
+    bool diskBlobCache = false;
+    // Whether the Vulkan backend reuses the SPIR-V it transformed for earlier programs.  Unique
+    // programs still share the vertex shader, so its transformation is only done once.
+    bool transformedSpirvCache = true;
 };
 
 std::ostream &operator<<(std::ostream &os, const LinkProgramParams &params)
@@ -95,16 +127,41 @@ class LinkProgramBenchmark : public ANGLERenderTest,
 {
   public:
     LinkProgramBenchmark();
+    ~LinkProgramBenchmark() override;
 
     void initializeBenchmark() override;
     void destroyBenchmark() override;
     void drawBenchmark() override;
 
   protected:
-    GLuint mVertexBuffer = 0;
+    GLuint mVertexBuffer   = 0;
+    uint32_t mProgramIndex = 0;
 };
 
-LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", GetParam()) {}
+constexpr char kBlobCacheDirectoryVarName[] = "ANGLE_BLOB_CACHE_DIR";
+
+LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", GetParam())
+{
+    if (GetParam().diskBlobCache)
+    {
+        // Read when the display is initialized.
+        Optional<std::string> tempDirectory = GetTempDirectory();
+        if (tempDirectory.valid())
+        {
+            const std::string directory =
+                ConcatenatePath(tempDirectory.value(), "angle_link_program_perf_blob_cache");
+            SetEnvironmentVar(kBlobCacheDirectoryVarName, directory.c_str());
+        }
+    }
+}
+
+LinkProgramBenchmark::~LinkProgramBenchmark()
+{
+    if (GetParam().diskBlobCache)
+    {
+        UnsetEnvironmentVar(kBlobCacheDirectoryVarName);
+    }
+}
 
 void LinkProgramBenchmark::initializeBenchmark()
 {
@@ -148,8 +205,23 @@ void LinkProgramBenchmark::drawBenchmark()
         "void main() {\n"
         "    gl_FragColor = vec4(1, 0, 0, 1);\n"
         "}";
+
+    std::string uniqueFragmentShader;
+    if (GetParam().uniquePrograms)
+    {
+        std::stringstream strstr;
+        strstr << "precision mediump float;\n"
+                  "void main() {\n"
+                  "    gl_FragColor = vec4(1, 0, 0, "
+               << (mProgramIndex++ % 1000000) << ".0 / 1000000.0);\n"
+               << "}";
+        uniqueFragmentShader = strstr.str();
+    }
+
     GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
-    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, GetParam().uniquePrograms
+                                                      ? uniqueFragmentShader.c_str()
+                                                      : fragmentShader);
 
     ASSERT_NE(0u, vs);
     ASSERT_NE(0u, fs);
@@ -210,6 +282,37 @@ LinkProgramParams LinkProgramVulkanParams(TaskOption taskOption, ThreadOption th
     return params;
 }
 
+LinkProgramParams LinkProgramVulkanUniqueParams(bool backgroundBlobCompression)
+{
+    LinkProgramParams params(TaskOption::CompileAndLink, ThreadOption::MultiThread);
+    params.eglParameters             = VULKAN();
+    params.uniquePrograms            = true;
+    params.backgroundBlobCompression = backgroundBlobCompression;
+    if (backgroundBlobCompression)
+    {
+        params.eglParameters.enable(Feature::CompressBlobCacheInBackground);
+    }
+    return params;
+}
+
+LinkProgramParams LinkProgramVulkanUniqueNoSpirvCacheParams()
+{
+    LinkProgramParams params(TaskOption::CompileAndLink, ThreadOption::MultiThread);
+    params.eglParameters         = VULKAN();
+    params.uniquePrograms        = true;
+    params.transformedSpirvCache = false;
+    params.eglParameters.disable(Feature::CacheTransformedSpirv);
+    return params;
+}
+
+LinkProgramParams LinkProgramVulkanDiskBlobCacheParams()
+{
+    LinkProgramParams params(TaskOption::CompileAndLink, ThreadOption::MultiThread);
+    params.eglParameters = VULKAN();
+    params.diskBlobCache = true;
+    return params;
+}
+
 TEST_P(LinkProgramBenchmark, Run)
 {
     run();
@@ -232,6 +335,10 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramMetalParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramVulkanUniqueParams(false),
+    LinkProgramVulkanUniqueParams(true),
+    LinkProgramVulkanUniqueNoSpirvCacheParams(),
+    LinkProgramVulkanDiskBlobCacheParams());
 
 }  // anonymous namespace
@@ -61,6 +61,11 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    if (isEnableRequested(Feature::AsyncTransferQueueUploads))
+    {
+        strstr << "_async_transfer";
+    }
+
     return strstr.str();
 }
 
@@ -116,6 +121,18 @@ class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+// Streams textures the way a game loading a level would: every iteration defines a new texture,
+// uploads its data and samples it once.  The uploads are to images that the GPU has never used,
+// which lets the Vulkan backend perform them on a transfer queue if asyncTransferQueueUploads is
+// enabled.
+class TextureUploadStreamingBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadStreamingBenchmark() : TextureUploadBenchmarkBase("TextureStreaming") {}
+
+    void drawBenchmark() override;
+};
+
 class PBOSubImageBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -403,6 +420,32 @@ void TextureUploadFullMipBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadStreamingBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, params.baseSize, params.baseSize, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, mTextureData.data());
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        glDeleteTextures(1, &texture);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void PBOSubImageBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -475,6 +518,12 @@ TextureUploadParams VulkanParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams AsyncTransferQueueUploads(TextureUploadParams params)
+{
+    params.enable(Feature::AsyncTransferQueueUploads);
+    return params;
+}
+
 TextureUploadParams ES3VulkanParams(bool webglCompat)
 {
     TextureUploadParams params;
@@ -545,6 +594,11 @@ TEST_P(TextureUploadFullMipBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadStreamingBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(PBOSubImageBenchmark, Run)
 {
     run();
@@ -580,6 +634,13 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        VulkanParams(true));
 
+ANGLE_INSTANTIATE_TEST(TextureUploadStreamingBenchmark,
+                       D3D11Params(false),
+                       MetalParams(false),
+                       OpenGLOrGLESParams(false),
+                       VulkanParams(false),
+                       AsyncTransferQueueUploads(VulkanParams(false)));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
                        ES3OpenGLPBOParams(1024, 128),
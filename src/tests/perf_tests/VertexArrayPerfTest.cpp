@@ -21,8 +21,22 @@ enum class TestMode
     BufferData,
     BindBuffer,
     UpdateBufferData,
+    // Draws from a buffer whose attribute format needs a CPU conversion in the Vulkan backend,
+    // after updating a few scattered ranges of it.
+    ConvertBufferSubData,
+    // Same as above, but respecifies the whole buffer.
+    ConvertBufferData,
 };
 
+// GL_FIXED is converted to float, and the unaligned offset makes the Vulkan backend convert it on
+// the CPU instead of with a compute shader.
+constexpr GLsizei kConversionVertexCount   = 256 * 1024;
+constexpr GLsizei kConversionStride        = sizeof(GLfixed);
+constexpr GLintptr kConversionOffset       = 2;
+constexpr GLsizeiptr kConversionBufferSize = kConversionVertexCount * kConversionStride + 4;
+constexpr int kConversionUpdateCount       = 16;
+constexpr GLsizeiptr kConversionUpdateSize = 1024;
+
 struct VertexArrayParams final : public RenderTestParams
 {
     VertexArrayParams()
@@ -64,6 +78,14 @@ std::string VertexArrayParams::story() const
     {
         strstr << "_updatebufferdata";
     }
+    else if (testMode == TestMode::ConvertBufferSubData)
+    {
+        strstr << "_convertbuffersubdata";
+    }
+    else if (testMode == TestMode::ConvertBufferData)
+    {
+        strstr << "_convertbufferdata";
+    }
 
     return strstr.str();
 }
@@ -86,6 +108,9 @@ class VertexArrayBenchmark : public ANGLERenderTest,
     GLuint mProgram       = 0;
     GLint mAttribLocation = 0;
     std::vector<GLuint> mVertexArrays;
+    GLBuffer mConversionBuffer;
+    GLVertexArray mConversionVertexArray;
+    std::vector<uint8_t> mConversionData;
 };
 
 VertexArrayBenchmark::VertexArrayBenchmark() : ANGLERenderTest("VertexArrayPerf", GetParam()) {}
@@ -131,6 +156,26 @@ void main()
 
     glBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
+
+    const TestMode testMode = GetParam().testMode;
+    if (testMode == TestMode::ConvertBufferSubData || testMode == TestMode::ConvertBufferData)
+    {
+        mConversionData.resize(kConversionBufferSize);
+        for (size_t i = 0; i < mConversionData.size(); ++i)
+        {
+            mConversionData[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        glBindVertexArray(mConversionVertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, mConversionBuffer);
+        glBufferData(GL_ARRAY_BUFFER, kConversionBufferSize, mConversionData.data(),
+                     GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(mAttribLocation);
+        glVertexAttribPointer(mAttribLocation, 1, GL_FIXED, GL_FALSE, kConversionStride,
+                              reinterpret_cast<const void *>(kConversionOffset));
+    }
+
+    ASSERT_GL_NO_ERROR();
 }
 
 void VertexArrayBenchmark::rebindVertexArray(GLuint vertexArrayID, GLuint bufferID)
@@ -165,6 +210,8 @@ void VertexArrayBenchmark::destroyBenchmark()
     mVertexArrays.clear();
     glDeleteBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
     mBuffers.clear();
+    mConversionBuffer.reset();
+    mConversionVertexArray.reset();
 }
 
 void VertexArrayBenchmark::drawBenchmark()
@@ -184,6 +231,23 @@ void VertexArrayBenchmark::drawBenchmark()
                              ANGLE_UNSAFE_TODO(params.bufferSize[bufferSizeIndex]));
         }
     }
+    else if (params.testMode == TestMode::ConvertBufferSubData)
+    {
+        // Update ranges spread across the buffer, so that only those are converted again.
+        constexpr GLintptr kUpdateSpacing = kConversionBufferSize / kConversionUpdateCount;
+        for (int i = 0; i < kConversionUpdateCount; ++i)
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, i * kUpdateSpacing, kConversionUpdateSize,
+                            ANGLE_UNSAFE_TODO(mConversionData.data() + i * kUpdateSpacing));
+        }
+        glDrawArrays(GL_POINTS, 0, kConversionVertexCount);
+    }
+    else if (params.testMode == TestMode::ConvertBufferData)
+    {
+        glBufferData(GL_ARRAY_BUFFER, kConversionBufferSize, mConversionData.data(),
+                     GL_DYNAMIC_DRAW);
+        glDrawArrays(GL_POINTS, 0, kConversionVertexCount);
+    }
     else
     {
         int bufferIndex = 0;
@@ -229,5 +293,7 @@ ANGLE_INSTANTIATE_TEST(VertexArrayBenchmark,
                        VulkanNullParams(TestMode::BindBuffer),
                        VulkanNullParams(TestMode::BufferData),
                        VulkanNullParams(TestMode::UpdateBufferData),
+                       VulkanNullParams(TestMode::ConvertBufferSubData),
+                       VulkanNullParams(TestMode::ConvertBufferData),
                        params::Native(VertexArrayParams()));
 }  // namespace
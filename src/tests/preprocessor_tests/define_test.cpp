@@ -1303,4 +1303,99 @@ f
     preprocess(kInput, kExpected);
 }
 
+// Tests function-like macros expanded both in the arguments and in the replacement list of another
+// function-like macro, where the arguments themselves are function-like macro invocations.
+TEST_F(DefineTest, FuncNestedInArgsAndReplacement)
+{
+    const char *input =
+        "#define ADD(a, b) (a + b)\n"
+        "#define MUL(a, b) (a * b)\n"
+        "#define F(x, y) ADD(MUL(x, y), ADD(y, x))\n"
+        "F(ADD(1, 2), MUL(3, 4))\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "\n"
+        "(((1 + 2) * (3 * 4)) + ((3 * 4) + (1 + 2)))\n";
+    EXPECT_CALL(mDirectiveHandler, handleVersion(pp::SourceLocation(0, 1), 100, SH_GLES2_SPEC, _))
+        .Times(1);
+    preprocess(input, expected);
+}
+
+// Tests a function-like macro that refers to itself both directly and through an argument.  The
+// inner references are not expanded.
+TEST_F(DefineTest, FuncSelfReferenceThroughArg)
+{
+    const char *input =
+        "#define f(x) x + f(x)\n"
+        "#define g(x) f(x)\n"
+        "g(f(1))\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "1 + f(1) + f(1 + f(1))\n";
+    EXPECT_CALL(mDirectiveHandler, handleVersion(pp::SourceLocation(0, 1), 100, SH_GLES2_SPEC, _))
+        .Times(1);
+    preprocess(input, expected);
+}
+
+// Tests looking for the left parenthesis of a function-like macro invocation when the macro name
+// and the next token come from different parts of a replacement list, i.e. the replacement list
+// itself and an argument, with empty arguments in between.  If the next token is not a left
+// parenthesis, it must be put back where it came from.
+TEST_F(DefineTest, FuncLeftParenAcrossReplacementBoundary)
+{
+    const char *input =
+        "#define f(x) [x]\n"
+        "#define A(x) f x\n"
+        "#define B(x) x (2)\n"
+        "#define C(x, y, z) f y z x\n"
+        "A((1))\n"
+        "A(1)\n"
+        "B(f)\n"
+        "C((3), , )\n"
+        "C(3, , )\n"
+        "C(3, , 4)\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "[1]\n"
+        "f 1\n"
+        "[2]\n"
+        "[3]\n"
+        "f 3\n"
+        "f 4 3\n";
+    EXPECT_CALL(mDirectiveHandler, handleVersion(pp::SourceLocation(0, 1), 100, SH_GLES2_SPEC, _))
+        .Times(1);
+    preprocess(input, expected);
+}
+
+// Tests undefining a function-like macro that comes from the expansion of another macro while its
+// arguments are being collected.  The #undef is rejected, so the macro remains defined.
+TEST_F(DefineTest, UndefineInInvocationFromExpansion)
+{
+    const char *input =
+        "#define f(x) [x]\n"
+        "#define g f\n"
+        "g(\n"
+        "#undef f\n"
+        "1)\n"
+        "f(2)\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "[1]\n"
+        "[2]\n";
+    EXPECT_CALL(mDirectiveHandler, handleVersion(pp::SourceLocation(0, 1), 100, SH_GLES2_SPEC, _))
+        .Times(1);
+    EXPECT_CALL(mDiagnostics, print(pp::Diagnostics::PP_MACRO_UNDEFINED_WHILE_INVOKED,
+                                    pp::SourceLocation(0, 4), "f"));
+
+    preprocess(input, expected);
+}
+
 }  // namespace angle
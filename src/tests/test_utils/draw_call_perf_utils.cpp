@@ -80,22 +80,6 @@ void main()
                    texture2D(tex5, texCoord) + texture2D(tex6, texCoord) +
                    texture2D(tex7, texCoord) + texture2D(tex8, texCoord);
 })";
-
-void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData)
-{
-    for (size_t triIndex = 0; triIndex < numTris; ++triIndex)
-    {
-        floatData->push_back(1.0f);
-        floatData->push_back(2.0f);
-
-        floatData->push_back(0.0f);
-        floatData->push_back(0.0f);
-
-        floatData->push_back(2.0f);
-        floatData->push_back(0.0f);
-    }
-}
-
 }  // anonymous namespace
 
 GLuint SetupSimpleScaleAndOffsetProgram()
@@ -173,6 +157,21 @@ GLuint SetupEightTextureProgram()
     return program;
 }
 
+void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData)
+{
+    for (size_t triIndex = 0; triIndex < numTris; ++triIndex)
+    {
+        floatData->push_back(1.0f);
+        floatData->push_back(2.0f);
+
+        floatData->push_back(0.0f);
+        floatData->push_back(0.0f);
+
+        floatData->push_back(2.0f);
+        floatData->push_back(0.0f);
+    }
+}
+
 GLuint Create2DTriangleBuffer(size_t numTris, GLenum usage)
 {
     GLuint buffer = 0u;
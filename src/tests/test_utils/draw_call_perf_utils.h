@@ -12,6 +12,8 @@
 
 #include <stddef.h>
 
+#include <vector>
+
 #include "util/gles_loader_autogen.h"
 
 // Returns program ID. The program is left in use, no uniforms.
@@ -30,6 +32,10 @@ GLuint SetupEightTextureProgram();
 // uScale = 0.5, uOffset = -0.5
 GLuint SetupSimpleScaleAndOffsetProgram();
 
+// Appends the 2-component coordinates of |numTris| triangles to |floatData|, as used by
+// Create2DTriangleBuffer.
+void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData);
+
 // Returns buffer ID filled with 2-component triangle coordinates. The buffer is left as bound.
 // Generates triangles like this with 2-component coordinates:
 //    A
@@ -54,6 +54,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AppendAliasedMemoryDecorations, "appendAliasedMemoryDecorations"},
     {Feature::AsyncCommandBufferReset, "asyncCommandBufferReset"},
     {Feature::AsyncGarbageCleanup, "asyncGarbageCleanup"},
+    {Feature::AsyncTransferQueueUploads, "asyncTransferQueueUploads"},
     {Feature::Avoid1BitAlphaTextureFormats, "avoid1BitAlphaTextureFormats"},
     {Feature::AvoidBindFragDataLocation, "avoidBindFragDataLocation"},
     {Feature::AvoidComplexExpressionsInStructConstructor, "avoidComplexExpressionsInStructConstructor"},
@@ -68,6 +69,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
     {Feature::BresenhamLineRasterization, "bresenhamLineRasterization"},
     {Feature::CacheCompiledShader, "cacheCompiledShader"},
+    {Feature::CacheTransformedSpirv, "cacheTransformedSpirv"},
     {Feature::CallClearTwice, "callClearTwice"},
     {Feature::ClampArrayAccess, "clampArrayAccess"},
     {Feature::ClampFragDepth, "clampFragDepth"},
@@ -80,6 +82,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ClipSrcRegionForBlitFramebuffer, "clipSrcRegionForBlitFramebuffer"},
     {Feature::ClSerializedExecution, "clSerializedExecution"},
     {Feature::CompileJobIsThreadSafe, "compileJobIsThreadSafe"},
+    {Feature::CompressBlobCacheInBackground, "compressBlobCacheInBackground"},
     {Feature::CompressProgramBinaryBlob, "compressProgramBinaryBlob"},
     {Feature::ConvertLowpAndMediumpFloatUniformsTo16Bits, "convertLowpAndMediumpFloatUniformsTo16Bits"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization, "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
@@ -201,6 +204,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ForceDisableFullScreenExclusive, "forceDisableFullScreenExclusive"},
     {Feature::ForceFallbackFormat, "forceFallbackFormat"},
     {Feature::ForceFlushAfterDrawcallUsingShadowmap, "forceFlushAfterDrawcallUsingShadowmap"},
+    {Feature::ForceGenerateMipmapOnCPU, "forceGenerateMipmapOnCPU"},
     {Feature::ForceGlErrorChecking, "forceGlErrorChecking"},
     {Feature::ForceHostImageCopyForLuma, "forceHostImageCopyForLuma"},
     {Feature::ForceInitShaderVariables, "forceInitShaderVariables"},
@@ -375,6 +379,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsDepthClipControl, "supportsDepthClipControl"},
     {Feature::SupportsDepthStencilIndependentResolveNone, "supportsDepthStencilIndependentResolveNone"},
     {Feature::SupportsDepthStencilResolve, "supportsDepthStencilResolve"},
+    {Feature::SupportsDescriptorBuffer, "supportsDescriptorBuffer"},
     {Feature::SupportsDeviceFault, "supportsDeviceFault"},
     {Feature::SupportsDynamicRendering, "supportsDynamicRendering"},
     {Feature::SupportsDynamicRenderingLocalRead, "supportsDynamicRenderingLocalRead"},
@@ -531,6 +536,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::VerifyPipelineCacheInBlobCache, "verifyPipelineCacheInBlobCache"},
     {Feature::VertexIDDoesNotIncludeBaseVertex, "vertexIDDoesNotIncludeBaseVertex"},
     {Feature::WarmUpPipelineCacheAtLink, "warmUpPipelineCacheAtLink"},
+    {Feature::WarmUpPipelinesFromManifest, "warmUpPipelinesFromManifest"},
     {Feature::WrapSwitchInIfTrue, "wrapSwitchInIfTrue"},
     {Feature::WriteHelperSampleMask, "writeHelperSampleMask"},
 }};
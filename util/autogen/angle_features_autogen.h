@@ -54,6 +54,7 @@ enum class Feature
     AppendAliasedMemoryDecorations,
     AsyncCommandBufferReset,
     AsyncGarbageCleanup,
+    AsyncTransferQueueUploads,
     Avoid1BitAlphaTextureFormats,
     AvoidBindFragDataLocation,
     AvoidComplexExpressionsInStructConstructor,
@@ -68,6 +69,7 @@ enum class Feature
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
     CacheCompiledShader,
+    CacheTransformedSpirv,
     CallClearTwice,
     ClampArrayAccess,
     ClampFragDepth,
@@ -80,6 +82,7 @@ enum class Feature
     ClipSrcRegionForBlitFramebuffer,
     ClSerializedExecution,
     CompileJobIsThreadSafe,
+    CompressBlobCacheInBackground,
     CompressProgramBinaryBlob,
     ConvertLowpAndMediumpFloatUniformsTo16Bits,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
@@ -201,6 +204,7 @@ enum class Feature
     ForceDisableFullScreenExclusive,
     ForceFallbackFormat,
     ForceFlushAfterDrawcallUsingShadowmap,
+    ForceGenerateMipmapOnCPU,
     ForceGlErrorChecking,
     ForceHostImageCopyForLuma,
     ForceInitShaderVariables,
@@ -375,6 +379,7 @@ enum class Feature
     SupportsDepthClipControl,
     SupportsDepthStencilIndependentResolveNone,
     SupportsDepthStencilResolve,
+    SupportsDescriptorBuffer,
     SupportsDeviceFault,
     SupportsDynamicRendering,
     SupportsDynamicRenderingLocalRead,
@@ -531,6 +536,7 @@ enum class Feature
     VerifyPipelineCacheInBlobCache,
     VertexIDDoesNotIncludeBaseVertex,
     WarmUpPipelineCacheAtLink,
+    WarmUpPipelinesFromManifest,
     WrapSwitchInIfTrue,
     WriteHelperSampleMask,
 